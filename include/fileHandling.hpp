@@ -14,6 +14,7 @@
 #include "world/world.hpp"
 #include "calendar.hpp"
 #include "genetics/organisms/Plant.hpp"
+#include "statistics/genomeStatsEngine.hpp"
 
 #include <nlohmann/json.hpp>
 #include <fstream>
@@ -24,6 +25,7 @@
 #include <memory>
 #include <optional>
 #include <chrono>
+#include <future>
 
 class FileHandling {
   private:
@@ -54,6 +56,8 @@ class FileHandling {
 
     std::string saveDir, statDir, genomeDir;
 
+    std::future<bool> genomeStatsJob;   ///< Background genome statistics write, if any
+
     //============================================================================
     //  Private Helper Methods - Legacy CSV format (deprecated)
     //============================================================================
@@ -100,6 +104,7 @@ class FileHandling {
     //  Constructor
     //============================================================================
     FileHandling (const std::string &directory);
+    ~FileHandling ();
 
     //============================================================================
     //  Setters
@@ -113,6 +118,9 @@ class FileHandling {
     bool appendStats (const std::string &str);
     bool saveGenomes (const std::string &filename,
                       const std::vector<EcoSim::Genetics::OrganismPtr> &creatures);
+    bool saveGenomeStats (const std::string &filename, const GenomeStatsReport &report);
+    void saveGenomeStatsAsync (const std::string &filename, GenomeSnapshot snapshot);
+    bool waitForGenomeStats ();
     
     //============================================================================
     //  Saving - Legacy CSV (deprecated)
@@ -112,6 +112,11 @@ public:
     /** Number of registered passive ticks. */
     std::size_t getPassiveTickCount() const;
 
+    /**
+     * @brief Bytes held by the controller and every behavior it owns
+     */
+    std::size_t memoryUsage() const;
+
 private:
     std::vector<std::unique_ptr<IBehavior>> behaviors_;
     std::vector<std::unique_ptr<IPassiveTick>> passiveTicks_;
@@ -30,6 +30,7 @@ class Phenotype;
  * 
  * Execution:
  * - Finds nearest edible plant within detection range
+ * - Grazes ground cover instead when a grazeable tile is closer
  * - If adjacent, attempts to eat using FeedingInteraction
  * - If not adjacent, signals movement is needed
  * 
@@ -127,6 +128,29 @@ private:
     Plant* findNearestEdiblePlant(const Organism& organism,
                                    const BehaviorContext& ctx) const;
     
+    /**
+     * @brief Find a grazeable ground-cover tile closer than a plant
+     * @param organism The organism searching for food
+     * @param ctx Behavior context with world access
+     * @param targetPlant Nearest individual plant, or nullptr
+     * @param[out] outX, outY The tile found
+     * @return true if the tile is strictly closer than targetPlant
+     */
+    bool findNearerGroundCover(const Organism& organism,
+                               const BehaviorContext& ctx,
+                               const Plant* targetPlant,
+                               int& outX, int& outY) const;
+    
+    /**
+     * @brief Eat biomass from a ground-cover tile
+     * 
+     * Feeding rules come from the species' representative plant; the
+     * bite is removed from the tile's biomass.
+     * 
+     * @return Result as for eating an individual plant
+     */
+    BehaviorResult graze(Organism& organism, BehaviorContext& ctx, int x, int y);
+    
     /**
      * @brief Get current hunger level (0=starving, 1=full)
      * 
@@ -2,7 +2,6 @@
 
 #include "genetics/behaviors/IBehavior.hpp"
 #include <unordered_map>
-#include <random>
 #include <string>
 
 namespace EcoSim {
@@ -93,6 +92,9 @@ public:
      * @return Estimated energy units consumed (HUNT_COST)
      */
     float getEnergyCost(const Organism& organism) const override;
+    
+    /** @brief Includes the per-organism hunt cooldowns */
+    std::size_t memoryUsage() const override;
 
 private:
     CombatInteraction& combat_;
@@ -100,8 +102,6 @@ private:
     
     mutable std::unordered_map<unsigned int, unsigned int> lastHuntTick_;
     
-    mutable std::mt19937 rng_{std::random_device{}()};
-    
     static constexpr float HUNT_INSTINCT_THRESHOLD = 0.4f;
     static constexpr float LOCOMOTION_THRESHOLD = 0.3f;
     static constexpr float SATIATION_THRESHOLD = 0.8f;
@@ -168,10 +168,12 @@ private:
      * @brief Roll escape chance and determine if prey escapes
      * @param predator The hunting organism
      * @param prey The prey organism
+     * @param tick Current tick, keying the predator's roll for this tick
      * @return true if prey successfully escapes
      */
     bool attemptEscape(const Organism& predator,
-                       const Organism& prey) const;
+                       const Organism& prey,
+                       unsigned int tick) const;
     
     /**
      * @brief Find potential prey in detection range
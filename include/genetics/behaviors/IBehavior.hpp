@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <memory>
 
@@ -108,6 +109,15 @@ public:
      * @return Estimated energy units consumed
      */
     virtual float getEnergyCost(const Organism& organism) const = 0;
+    
+    /**
+     * @brief Bytes held by this behavior instance
+     * 
+     * Behaviors that keep per-organism state override this to add it.
+     * 
+     * @return Size of the behavior plus the heap it owns
+     */
+    virtual std::size_t memoryUsage() const { return sizeof(*this); }
 };
 
 /**
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace EcoSim {
 namespace Genetics {
 
@@ -32,6 +34,9 @@ public:
      * @param env      Current local environment state.
      */
     virtual void tick(Organism& organism, const EnvironmentState& env) = 0;
+
+    /** @brief Bytes held by this passive tick, including its own size. */
+    virtual std::size_t memoryUsage() const { return sizeof(*this); }
 };
 
 } // namespace Genetics
@@ -80,6 +80,9 @@ public:
      */
     float getEnergyCost(const Organism& organism) const override;
     
+    /** @brief Includes the per-organism burr and gut seed lists */
+    std::size_t memoryUsage() const override;
+    
     /**
      * @brief Attach a burr from a plant to an organism (epizoochory)
      * 
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace EcoSim {
+namespace Genetics {
+
+/**
+ * Turn scheduling state for organisms updated at a reduced rate.
+ *
+ * Attached by the TurnScheduler the first time it schedules an organism
+ * (only while level-of-detail scheduling is enabled). Between full turns
+ * the organism is not updated at all; the ticks it skipped are integrated
+ * at the start of its next turn using the energy cost of the behavior it
+ * was holding.
+ *
+ * Interactions from other organisms (damage, combat, being chosen as a
+ * mate) set `woken`, which makes the next tick a full turn.
+ */
+struct ScheduleComponent {
+    unsigned lastTurnTick = 0;       // Tick of the last full turn
+    unsigned nextTurnTick = 0;       // Tick the next full turn is due
+    float heldEnergyCost = 0.0f;     // Energy the held behavior costs per tick
+    bool woken = false;              // An interaction asked for a full turn
+};
+
+} // namespace Genetics
+} // namespace EcoSim
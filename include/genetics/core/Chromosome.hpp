@@ -71,6 +71,12 @@ public:
      */
     const std::vector<Gene>& getGenes() const { return genes_; }
     
+    /**
+     * @brief Heap owned by the chromosome (genes and the ID index)
+     * @return Bytes, excluding sizeof(Chromosome)
+     */
+    std::size_t heapUsage() const;
+    
     /**
      * @brief Mutate all genes on this chromosome
      * @param mutation_rate Probability of mutation per gene
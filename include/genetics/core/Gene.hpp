@@ -102,6 +102,12 @@ public:
      */
     void setAlleleValues(float value1, float value2);
     
+    /**
+     * @brief Heap owned by the gene (ID and string allele values)
+     * @return Bytes, excluding sizeof(Gene)
+     */
+    std::size_t heapUsage() const;
+    
     // ========================================================================
     // Serialization
     // ========================================================================
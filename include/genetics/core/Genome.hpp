@@ -41,6 +41,9 @@ public:
     std::vector<std::reference_wrapper<const Gene>> getAllGenes() const;
     size_t getTotalGeneCount() const;
     
+    // Heap owned by the chromosomes and the lookup cache (excludes sizeof(Genome))
+    size_t heapUsage() const;
+    
     // Reproduction - create offspring from two parent genomes
     static Genome crossover(const Genome& parent1, const Genome& parent2,
                             float recombination_rate = 0.5f);
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "genetics/core/RandomStream.hpp"
+
+#include <cstdint>
 #include <random>
 
 namespace EcoSim {
@@ -8,9 +11,16 @@ namespace Genetics {
 /**
  * @brief Centralized thread-safe random number generation utility
  * 
- * Provides a thread-local random engine and common distribution helpers.
- * Each thread gets its own engine, seeded independently, ensuring thread safety
- * without synchronization overhead.
+ * Provides a thread-local random stream and common distribution helpers.
+ * Each thread gets its own stream, so no synchronization is needed.
+ * 
+ * A thread that calls seed() draws reproducibly from then on: get() and
+ * stream() are derived from the seed rather than from random_device.
+ * Until then the thread's seed comes from random_device, as before.
+ * Keyed streams (stream()) give the same numbers for the same entity and
+ * tick whichever thread asks, which is what parallel runs need; get()
+ * is a single sequence per thread and is only reproducible when the
+ * order of draws on that thread is.
  * 
  * This utility eliminates DRY violations where thread-local RNG engines were
  * duplicated across Gene, GeneDefinition, and Chromosome classes.
@@ -18,12 +28,38 @@ namespace Genetics {
 class RandomEngine {
 public:
     /**
-     * @brief Get the thread-local random engine
-     * @return Reference to thread-local mt19937 engine
+     * @brief Reseed the calling thread
+     *
+     * Restarts get() from the beginning of the seed's Engine stream.
+     * Call before building a world so every system seeded from it
+     * (PlantManager, spawning, ...) follows the same seed.
+     */
+    static void seed(std::uint64_t worldSeed) {
+        State& s = state();
+        s.seed = worldSeed;
+        s.stream = RandomStream(worldSeed, RandomSystem::Engine);
+    }
+
+    /** @brief Seed the calling thread is drawing from */
+    static std::uint64_t currentSeed() { return state().seed; }
+
+    /**
+     * @brief Get the thread-local random stream
+     * @return Reference to the thread's general-purpose stream
      */
-    static std::mt19937& get() {
-        thread_local static std::mt19937 engine(std::random_device{}());
-        return engine;
+    static RandomStream& get() {
+        return state().stream;
+    }
+
+    /**
+     * @brief Keyed stream for one system, entity and tick
+     *
+     * Derived from the calling thread's seed; the same arguments always
+     * give the same sequence.
+     */
+    static RandomStream stream(RandomSystem system, std::uint64_t entity = 0,
+                               std::uint64_t tick = 0) {
+        return RandomStream(state().seed, system, entity, tick);
     }
     
     /**
@@ -33,8 +69,7 @@ public:
      * @return Random float in range
      */
     static float randomFloat(float min, float max) {
-        std::uniform_real_distribution<float> dist(min, max);
-        return dist(get());
+        return get().uniform(min, max);
     }
     
     /**
@@ -44,8 +79,7 @@ public:
      * @return Random int in range
      */
     static int randomInt(int min, int max) {
-        std::uniform_int_distribution<int> dist(min, max);
-        return dist(get());
+        return get().uniformInt(min, max);
     }
     
     /**
@@ -53,7 +87,7 @@ public:
      * @return Random probability value
      */
     static float randomProbability() {
-        return randomFloat(0.0f, 1.0f);
+        return get().uniform();
     }
     
     /**
@@ -64,6 +98,22 @@ public:
     static bool rollProbability(float probability) {
         return randomProbability() < probability;
     }
+
+private:
+    struct State {
+        std::uint64_t seed;
+        RandomStream stream;
+
+        State()
+            : seed((static_cast<std::uint64_t>(std::random_device{}()) << 32) |
+                   std::random_device{}())
+            , stream(seed, RandomSystem::Engine) {}
+    };
+
+    static State& state() {
+        thread_local static State s;
+        return s;
+    }
 };
 
 /**
@@ -72,7 +122,7 @@ public:
  * Shorter alias for RandomEngine::get() for backward compatibility
  * and ease of migration from the old getRandomEngine() pattern.
  */
-inline std::mt19937& getThreadLocalRNG() {
+inline RandomStream& getThreadLocalRNG() {
     return RandomEngine::get();
 }
 
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace EcoSim {
+namespace Genetics {
+
+/**
+ * @brief Simulation systems that draw from their own random streams
+ *
+ * Part of a stream's key, so two systems asking for the same entity and
+ * tick never see the same numbers. Append new values at the end; the
+ * numeric values feed the key and reordering them changes every run.
+ */
+enum class RandomSystem : std::uint32_t {
+    Engine = 0,      ///< General per-thread draws (RandomEngine::get)
+    Spawning,        ///< Initial population placement
+    Plants,          ///< PlantManager spawning and reproduction
+    SeedDispersal,   ///< Seed scatter direction and distance
+    Movement,        ///< Wandering movement
+    Hunting,         ///< Escape rolls
+    Navigation       ///< Navigator tile wandering
+};
+
+/**
+ * @brief Counter-based random number generator
+ *
+ * A stream is a 64-bit key plus a counter. The n-th value of a stream is
+ * a pure function of (key, n), so a stream can be created on demand for
+ * any (seed, system, entity, tick) and always yields the same sequence,
+ * on any thread, in any order relative to other streams. The key is
+ * derived with SplitMix64 finalisers and each value is two more rounds
+ * over the key and counter.
+ *
+ * Satisfies UniformRandomBitGenerator, so it works with the standard
+ * distributions. The uniform() helpers do their own conversion and give
+ * the same values on every standard library.
+ */
+class RandomStream {
+public:
+    using result_type = std::uint64_t;
+
+    RandomStream() : RandomStream(0, RandomSystem::Engine) {}
+
+    /**
+     * @brief Stream for an entity's draws on a tick
+     * @param seed World or run seed
+     * @param system System making the draws
+     * @param entity Organism ID or other subject (0 when not per-entity)
+     * @param tick Simulation tick (0 when not per-tick)
+     */
+    RandomStream(std::uint64_t seed, RandomSystem system,
+                 std::uint64_t entity = 0, std::uint64_t tick = 0)
+        : key_(deriveKey(seed, system, entity, tick)) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return at(key_, counter_++); }
+
+    /** @brief Uniform float in [0, 1) */
+    float uniform() { return toUnit(operator()()); }
+
+    /** @brief Uniform float in [lo, hi) */
+    float uniform(float lo, float hi) { return lo + (hi - lo) * uniform(); }
+
+    /** @brief Uniform int in [lo, hi] */
+    int uniformInt(int lo, int hi) {
+        const std::uint64_t range = static_cast<std::uint64_t>(
+            static_cast<std::int64_t>(hi) - static_cast<std::int64_t>(lo)) + 1;
+        const std::uint64_t scaled = ((operator()() >> 32) * range) >> 32;
+        return static_cast<int>(static_cast<std::int64_t>(lo) +
+                                static_cast<std::int64_t>(scaled));
+    }
+
+    /**
+     * @brief Fill a buffer with uniform floats in [0, 1)
+     *
+     * Equivalent to calling uniform() count times. Every value depends only
+     * on its index, so the loop has no carried state and vectorises.
+     */
+    void fillUniform(float* out, std::size_t count) {
+        const std::uint64_t base = counter_;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = toUnit(at(key_, base + i));
+        }
+        counter_ += count;
+    }
+
+    /** @brief Skip ahead without generating */
+    void discard(std::uint64_t count) { counter_ += count; }
+
+    std::uint64_t key() const { return key_; }
+    std::uint64_t position() const { return counter_; }
+
+    /**
+     * @brief Value at a position of the stream with a given key
+     */
+    static std::uint64_t at(std::uint64_t key, std::uint64_t counter) {
+        return mix(key ^ mix(counter * GOLDEN_GAMMA + GOLDEN_GAMMA));
+    }
+
+    /**
+     * @brief Key for (seed, system, entity, tick)
+     */
+    static std::uint64_t deriveKey(std::uint64_t seed, RandomSystem system,
+                                   std::uint64_t entity, std::uint64_t tick) {
+        std::uint64_t k = mix(seed + GOLDEN_GAMMA);
+        k = mix(k ^ (static_cast<std::uint64_t>(system) + 1) * GOLDEN_GAMMA);
+        k = mix(k ^ entity);
+        return mix(k ^ tick);
+    }
+
+private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+    /** @brief SplitMix64 finaliser */
+    static std::uint64_t mix(std::uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /** @brief Top 24 bits as a float in [0, 1) */
+    static float toUnit(std::uint64_t bits) {
+        return static_cast<float>(bits >> 40) * (1.0f / 16777216.0f);
+    }
+
+    std::uint64_t key_;
+    std::uint64_t counter_ = 0;
+};
+
+} // namespace Genetics
+} // namespace EcoSim
@@ -140,6 +140,12 @@ public:
      */
     float getCacheHitRate() const;
     
+    /**
+     * @brief Heap owned by the trait caches
+     * @return Bytes, excluding sizeof(Phenotype)
+     */
+    std::size_t heapUsage() const;
+    
     /**
      * @brief Check if phenotype is valid (has genome and registry)
      * @return true if both genome and registry are set
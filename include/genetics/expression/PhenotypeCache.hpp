@@ -33,6 +33,9 @@ public:
     // Get cache hit rate for diagnostics
     float getCacheHitRate() const;
     
+    // Heap owned by the cached entries (excludes sizeof(PhenotypeCache))
+    std::size_t heapUsage() const;
+    
 private:
     struct CacheEntry {
         float value;
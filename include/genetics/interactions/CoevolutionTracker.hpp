@@ -3,9 +3,9 @@
 
 #include <string>
 #include <vector>
-#include <map>
 #include <deque>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include "objects/creature/creature.hpp"
 #include "genetics/organisms/Plant.hpp"
@@ -43,12 +43,20 @@ struct CoevolutionStats {
 
 /**
  * @brief Gene frequency record for a single generation
+ *
+ * Indexed by the tracker's dense gene index (see CoevolutionTracker::
+ * creatureGeneIndex / plantGeneIndex). A gene with no samples that
+ * generation, or registered after the record was made, has a count of 0.
  */
 struct GeneFrequencyRecord {
-    int generation;
-    std::map<std::string, float> meanValues;       ///< Gene name -> mean value
-    std::map<std::string, float> variances;        ///< Gene name -> variance
-    std::map<std::string, int> sampleCounts;       ///< Gene name -> sample count
+    int generation = 0;
+    std::vector<float> meanValues;                 ///< Gene index -> mean value
+    std::vector<float> variances;                  ///< Gene index -> sample variance
+    std::vector<int> sampleCounts;                 ///< Gene index -> sample count
+    
+    bool has(size_t gene) const {
+        return gene < sampleCounts.size() && sampleCounts[gene] > 0;
+    }
 };
 
 /**
@@ -71,6 +79,11 @@ struct ArmsRaceConfig {
  * and plants to identify evolutionary arms races - situations where selection
  * pressure from one species drives evolutionary change in another, and vice versa.
  * 
+ * Genes are interned to dense indices when a pair is tracked. Each
+ * generation is reduced with streaming (Welford) accumulators, and every
+ * tracked pair keeps running sums over its history window, so correlation,
+ * trend and variance queries are O(1) rather than rescanning history.
+ * 
  * Common coevolutionary pairs tracked:
  * - Plant TOXIN_PRODUCTION vs Creature TOXIN_TOLERANCE/TOXIN_METABOLISM
  * - Plant THORN_DENSITY vs Creature HIDE_THICKNESS
@@ -83,7 +96,13 @@ struct ArmsRaceConfig {
  * 
  * // Each generation, record population data
  * tracker.recordCreatureGeneration(allCreatures);
- * tracker.recordPlantGeneration(allPlants);
+ * 
+ * // ...or stream samples straight from where they live, without copying
+ * tracker.beginPlantGeneration();
+ * for (const auto& plant : tile.getPlants()) {
+ *     tracker.addPlantSample(plant->getPhenotype());
+ * }
+ * tracker.advanceGeneration();
  * 
  * // Check for active arms races
  * if (tracker.isArmsRaceActive("TOXIN_TOLERANCE", "TOXIN_PRODUCTION")) {
@@ -135,6 +154,30 @@ public:
      */
     void recordPlantGeneration(const std::vector<Plant>& plants);
     
+    /**
+     * @brief Start a new creature generation for streaming samples
+     * 
+     * Discards any creature samples added since the last advanceGeneration().
+     */
+    void beginCreatureGeneration();
+    
+    /**
+     * @brief Start a new plant generation for streaming samples
+     */
+    void beginPlantGeneration();
+    
+    /**
+     * @brief Fold one creature's tracked traits into the current generation
+     * @param phenotype Phenotype of a living creature
+     */
+    void addCreatureSample(const Phenotype& phenotype);
+    
+    /**
+     * @brief Fold one plant's tracked traits into the current generation
+     * @param phenotype Phenotype of a living plant
+     */
+    void addPlantSample(const Phenotype& phenotype);
+    
     /**
      * @brief Advance to next generation
      * 
@@ -254,6 +297,18 @@ public:
      */
     int getCurrentGeneration() const { return currentGeneration_; }
     
+    /**
+     * @brief Dense index of a tracked creature gene
+     * @return Index into GeneFrequencyRecord vectors, or -1 if not tracked
+     */
+    int creatureGeneIndex(const std::string& geneName) const;
+    
+    /**
+     * @brief Dense index of a tracked plant gene
+     * @return Index into GeneFrequencyRecord vectors, or -1 if not tracked
+     */
+    int plantGeneIndex(const std::string& geneName) const;
+    
     /**
      * @brief Get historical data for a creature gene
      * 
@@ -285,41 +340,103 @@ public:
     void reset();
     
 private:
+    /**
+     * @brief Welford accumulator for one gene within the current generation
+     */
+    struct GeneAccumulator {
+        int count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;
+        
+        void add(float value);
+    };
+    
+    /**
+     * @brief Interned gene names on one side (creature or plant) of the pairs
+     */
+    struct GeneTable {
+        std::vector<std::string> names;
+        std::unordered_map<std::string, size_t> index;
+        std::vector<GeneAccumulator> current;      ///< This generation's samples
+        
+        size_t intern(const std::string& name);
+        int find(const std::string& name) const;
+    };
+    
+    /**
+     * @brief One generation where both genes of a pair had samples
+     */
+    struct PairSample {
+        int generation;
+        double x;                                  ///< Creature gene mean
+        double y;                                  ///< Plant gene mean
+    };
+    
+    /**
+     * @brief Running sums over a pair's samples in the history window
+     *
+     * Positions are the sample's ordinal since the pair started tracking,
+     * so slopes can be re-based onto the oldest retained sample in O(1).
+     */
+    struct PairState {
+        size_t creature = 0;
+        size_t plant = 0;
+        std::deque<PairSample> samples;
+        long long firstOrdinal = 0;                ///< Ordinal of samples.front()
+        size_t evictions = 0;                      ///< Removals since last rebuild
+        double sumX = 0.0, sumY = 0.0;
+        double sumXX = 0.0, sumYY = 0.0, sumXY = 0.0;
+        double sumKX = 0.0, sumKY = 0.0;           ///< Sum of ordinal * value
+        
+        void push(const PairSample& sample);
+        void popFront();
+        void rebuild();
+    };
+    
     // ========================================================================
     // Internal Methods
     // ========================================================================
     
     /**
-     * @brief Calculate Pearson correlation coefficient between two gene histories
+     * @brief Intern a pair's genes and build its state from history
      */
-    float calculateCorrelation(
-        const std::vector<float>& creatureValues,
-        const std::vector<float>& plantValues
-    ) const;
+    void addPairState(const std::string& creatureGene, const std::string& plantGene);
     
     /**
-     * @brief Determine trend from historical values
-     * @return "escalating", "declining", "stable", or "oscillating"
+     * @brief Rebuild all pair states from the configuration and history
      */
-    std::string detectTrend(
-        const std::vector<float>& creatureValues,
-        const std::vector<float>& plantValues
-    ) const;
+    void rebuildPairs();
     
     /**
-     * @brief Calculate linear regression slope
+     * @brief Find the state of a tracked pair, or nullptr
      */
-    float calculateSlope(const std::vector<float>& values) const;
+    const PairState* findPair(const std::string& creatureGene, const std::string& plantGene) const;
     
     /**
-     * @brief Calculate variance of values
+     * @brief Fold a phenotype's traits into one side's accumulators
      */
-    float calculateVariance(const std::vector<float>& values) const;
+    static void addSample(GeneTable& table, const Phenotype& phenotype);
     
     /**
-     * @brief Calculate mean of values
+     * @brief Turn one side's accumulators into a history record
      */
-    float calculateMean(const std::vector<float>& values) const;
+    GeneFrequencyRecord finalize(const GeneTable& table) const;
+    
+    /**
+     * @brief Pearson correlation from a pair's running sums
+     */
+    static float calculateCorrelation(const PairState& pair);
+    
+    /**
+     * @brief Linear regression slopes of both genes against generation order
+     */
+    static void calculateSlopes(const PairState& pair, float& creatureSlope, float& plantSlope);
+    
+    /**
+     * @brief Determine trend from a pair's slopes
+     * @return "escalating", "declining", "stable", or "oscillating"
+     */
+    std::string detectTrend(const PairState& pair) const;
     
     /**
      * @brief Initialize default tracked gene pairs
@@ -333,23 +450,17 @@ private:
     ArmsRaceConfig config_;                            ///< Detection configuration
     int currentGeneration_;                            ///< Current generation number
     
+    GeneTable creatureGenes_;                          ///< Interned creature genes
+    GeneTable plantGenes_;                             ///< Interned plant genes
+    
     /// Historical creature gene frequencies by generation
     std::deque<GeneFrequencyRecord> creatureHistory_;
     
     /// Historical plant gene frequencies by generation
     std::deque<GeneFrequencyRecord> plantHistory_;
     
-    /// Current generation's creature data (before finalization)
-    GeneFrequencyRecord currentCreatureData_;
-    
-    /// Current generation's plant data (before finalization)
-    GeneFrequencyRecord currentPlantData_;
-    
-    /// Cached correlation values for performance
-    mutable std::map<std::pair<std::string, std::string>, float> correlationCache_;
-    
-    /// Flag indicating if cache needs refresh
-    mutable bool cacheValid_;
+    /// Running state of each tracked pair, parallel to config_.trackedPairs
+    std::vector<PairState> pairs_;
 };
 
 } // namespace Genetics
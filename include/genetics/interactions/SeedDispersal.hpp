@@ -4,6 +4,7 @@
 #include "genetics/organisms/Plant.hpp"
 #include "genetics/expression/EnvironmentState.hpp"
 #include "genetics/defaults/UniversalGenes.hpp"
+#include "genetics/core/RandomStream.hpp"
 #include <string>
 #include <cmath>
 #include <algorithm>
@@ -74,12 +75,18 @@ class SeedDispersal {
 public:
     /**
      * @brief Default constructor
+     *
+     * Draws from the calling thread's RandomEngine, so one instance can be
+     * shared by worlds running on different threads.
      */
     SeedDispersal();
     
     /**
      * @brief Constructor with random seed
-     * @param randomSeed Seed for random number generator
+     * @param randomSeed Seed for a private random number generator
+     *
+     * The private generator makes results reproducible but must not be
+     * used from more than one thread at a time.
      */
     explicit SeedDispersal(unsigned int randomSeed);
     
@@ -273,7 +280,11 @@ private:
     // Random number generation
     // ========================================================================
     
-    mutable std::mt19937 rng_;
+    mutable RandomStream rng_;
+    bool seeded_ = false;     ///< Use rng_ rather than the thread's stream
+    
+    /** @brief Generator for the next draw */
+    RandomStream& rng() const;
     
     // ========================================================================
     // Constants
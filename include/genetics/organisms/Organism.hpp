@@ -16,10 +16,12 @@ class World;
 #include "genetics/components/CombatComponent.hpp"
 #include "genetics/components/ThermalComponent.hpp"
 #include "genetics/components/IdentityComponent.hpp"
+#include "genetics/components/ScheduleComponent.hpp"
 #include "genetics/core/MotivationAction.hpp"
 #include "genetics/behaviors/BehaviorController.hpp"
 #include "rendering/RenderTypes.hpp"
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -191,6 +193,13 @@ protected:
     // their seed-spread gene.
     virtual float getOffspringSpreadDistance() const { return 0.0f; }
 
+    // Heap owned by the Organism members, excluding the object itself.
+    std::size_t heapUsage() const;
+
+    // One tick of the passive lifecycle at the current environment:
+    // growth, metabolism, fatigue, thermal stress damage, mate drive, age.
+    void passiveTick();
+
 public:
     
     // ========================================================================
@@ -249,6 +258,11 @@ public:
     unsigned int       getColour() const;    // phenotype color_hue, fallback 1
     virtual std::string toString() const;    // "<name>","<desc>","<char>",<colour>,<passable>
 
+    // Bytes held by this organism: the object itself, its genome and
+    // expressed traits, components, behaviors and any pending offspring.
+    // Subclasses override to count their own size (see heapUsage()).
+    virtual std::size_t memoryUsage() const;
+
     // ========================================================================
     // Health System (shared)
     // ========================================================================
@@ -324,31 +338,44 @@ public:
     // sessile photosynthesisers skip MobilityComponent, inert fruit skips
     // HeterotrophyComponent, etc. Accessors return nullptr when absent,
     // callers null-check before use.
+    //
+    // Components are stored inline rather than each in its own heap
+    // block, so reading one is no further away than reading the organism.
+    // The returned pointers are only valid until the organism is moved.
     // ========================================================================
 
-    MobilityComponent*     mobility()     { return mobility_.get(); }
-    HeterotrophyComponent* heterotrophy() { return heterotrophy_.get(); }
-    AutotrophyComponent*   autotrophy()   { return autotrophy_.get(); }
-    ReproductionComponent* reproduction() { return reproduction_.get(); }
-    CombatComponent*       combat()       { return combat_.get(); }
-    ThermalComponent*      thermal()      { return thermal_.get(); }
-    IdentityComponent*     identity()     { return identity_.get(); }
-
-    const MobilityComponent*     mobility()     const { return mobility_.get(); }
-    const HeterotrophyComponent* heterotrophy() const { return heterotrophy_.get(); }
-    const AutotrophyComponent*   autotrophy()   const { return autotrophy_.get(); }
-    const ReproductionComponent* reproduction() const { return reproduction_.get(); }
-    const CombatComponent*       combat()       const { return combat_.get(); }
-    const ThermalComponent*      thermal()      const { return thermal_.get(); }
-    const IdentityComponent*     identity()     const { return identity_.get(); }
-
-    void attachMobility(std::unique_ptr<MobilityComponent> c)         { mobility_     = std::move(c); }
-    void attachHeterotrophy(std::unique_ptr<HeterotrophyComponent> c) { heterotrophy_ = std::move(c); }
-    void attachAutotrophy(std::unique_ptr<AutotrophyComponent> c)     { autotrophy_   = std::move(c); }
-    void attachReproduction(std::unique_ptr<ReproductionComponent> c) { reproduction_ = std::move(c); }
-    void attachCombat(std::unique_ptr<CombatComponent> c)             { combat_       = std::move(c); }
-    void attachThermal(std::unique_ptr<ThermalComponent> c)           { thermal_      = std::move(c); }
-    void attachIdentity(std::unique_ptr<IdentityComponent> c)         { identity_     = std::move(c); }
+    MobilityComponent*     mobility()     { return mobility_     ? &*mobility_     : nullptr; }
+    HeterotrophyComponent* heterotrophy() { return heterotrophy_ ? &*heterotrophy_ : nullptr; }
+    AutotrophyComponent*   autotrophy()   { return autotrophy_   ? &*autotrophy_   : nullptr; }
+    ReproductionComponent* reproduction() { return reproduction_ ? &*reproduction_ : nullptr; }
+    CombatComponent*       combat()       { return combat_       ? &*combat_       : nullptr; }
+    ThermalComponent*      thermal()      { return thermal_      ? &*thermal_      : nullptr; }
+    IdentityComponent*     identity()     { return identity_     ? &*identity_     : nullptr; }
+    ScheduleComponent*     schedule()     { return schedule_     ? &*schedule_     : nullptr; }
+
+    const MobilityComponent*     mobility()     const { return mobility_     ? &*mobility_     : nullptr; }
+    const HeterotrophyComponent* heterotrophy() const { return heterotrophy_ ? &*heterotrophy_ : nullptr; }
+    const AutotrophyComponent*   autotrophy()   const { return autotrophy_   ? &*autotrophy_   : nullptr; }
+    const ReproductionComponent* reproduction() const { return reproduction_ ? &*reproduction_ : nullptr; }
+    const CombatComponent*       combat()       const { return combat_       ? &*combat_       : nullptr; }
+    const ThermalComponent*      thermal()      const { return thermal_      ? &*thermal_      : nullptr; }
+    const IdentityComponent*     identity()     const { return identity_     ? &*identity_     : nullptr; }
+    const ScheduleComponent*     schedule()     const { return schedule_     ? &*schedule_     : nullptr; }
+
+    void attachMobility(MobilityComponent c = {})         { mobility_     = std::move(c); }
+    void attachHeterotrophy(HeterotrophyComponent c = {}) { heterotrophy_ = std::move(c); }
+    void attachAutotrophy(AutotrophyComponent c = {})     { autotrophy_   = std::move(c); }
+    void attachReproduction(ReproductionComponent c = {}) { reproduction_ = std::move(c); }
+    void attachCombat(CombatComponent c = {})             { combat_       = std::move(c); }
+    void attachThermal(ThermalComponent c = {})           { thermal_      = std::move(c); }
+    void attachIdentity(IdentityComponent c = {})         { identity_     = std::move(c); }
+    void attachSchedule(ScheduleComponent c = {})         { schedule_     = c; }
+    void detachSchedule()                                 { schedule_.reset(); }
+
+    // Ask for a full turn next tick. Only matters for organisms on a
+    // reduced turn schedule; called by anything that acts on another
+    // organism (damage, combat, mating) so it reacts at full rate.
+    void wake() { if (schedule_) schedule_->woken = true; }
 
     // ========================================================================
     // Behavior controller (shared between creatures and plants)
@@ -391,9 +418,10 @@ public:
     Phenotype phenotype_;
     const GeneRegistry* registry_;
 
-    // Identity
+    // Identity. The counters are atomic because independent worlds may be
+    // simulated on several threads at once (headless batch runs).
     int id_;
-    static int nextId_;
+    static std::atomic<int> nextId_;
 
     // Shared services historically owned by Creature (lazy-init).
     // Declared here so they're accessible from methods that will move
@@ -405,7 +433,7 @@ public:
     static std::unique_ptr<CombatInteraction>   s_combatInteraction;
 
     // Sequential creature display ID counter (moves to a factory later).
-    static int nextCreatureId_;
+    static std::atomic<int> nextCreatureId_;
 
 public:
     // Static ID counter management — historical Creature statics,
@@ -455,6 +483,15 @@ public:
                                           unsigned int currentTick) const;
     BehaviorResult updateWithBehaviors(BehaviorContext& ctx);
 
+    // Level-of-detail support for the TurnScheduler. integrateSkippedTicks
+    // applies the passive lifecycle (metabolism, fatigue, thermal stress,
+    // mate drive, growth, age) of ticks the organism was not updated for,
+    // charging heldEnergyCost per tick for the behavior it was holding.
+    // needDriftPerTick is the largest per-tick change of hunger, thirst,
+    // fatigue or mate drive at the current rates.
+    void  integrateSkippedTicks(unsigned ticks, float heldEnergyCost);
+    float needDriftPerTick(float heldEnergyCost) const;
+
     // String / serialization helpers (delegate to CreatureSerialization)
     static Direction stringToDirection(const std::string& str);
     std::string directionToString() const;
@@ -544,14 +581,20 @@ public:
     Motivation motivation_ = Motivation::Content;
     Action     action_     = Action::Idle;
 
-    // Optional runtime-state components (nullptr until attached)
-    std::unique_ptr<MobilityComponent>     mobility_;
-    std::unique_ptr<HeterotrophyComponent> heterotrophy_;
-    std::unique_ptr<AutotrophyComponent>   autotrophy_;
-    std::unique_ptr<ReproductionComponent> reproduction_;
-    std::unique_ptr<CombatComponent>       combat_;
-    std::unique_ptr<ThermalComponent>      thermal_;
-    std::unique_ptr<IdentityComponent>     identity_;
+    // Optional runtime-state components (empty until attached). Kept inline
+    // rather than in per-type pools owned by OrganismStore: plants are
+    // Organisms too but live in shared_ptrs on their tiles, outside any
+    // store, and every component is read per organism from its behavior
+    // controller, so no system makes the bulk pass over one component
+    // type that a column layout would speed up.
+    std::optional<MobilityComponent>     mobility_;
+    std::optional<HeterotrophyComponent> heterotrophy_;
+    std::optional<AutotrophyComponent>   autotrophy_;
+    std::optional<ReproductionComponent> reproduction_;
+    std::optional<CombatComponent>       combat_;
+    std::optional<ThermalComponent>      thermal_;
+    std::optional<IdentityComponent>     identity_;
+    std::optional<ScheduleComponent>     schedule_;
 
     // Shared behavior controller — holds IBehavior (active decisions) and
     // IPassiveTick (physiology). Named organismBehaviorController_ to avoid
@@ -562,6 +605,12 @@ public:
     // Offspring produced by this organism during the current tick,
     // waiting to be added to the simulation by the main loop.
     std::unique_ptr<Organism> pendingOffspring_;
+
+private:
+    // Empty every component slot of a moved-from organism. Only the move
+    // constructor and move assignment may call this: on a live organism it
+    // would drop identity_ without releasing its archetype population.
+    void releaseComponents();
 };
 
 /**
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "genetics/organisms/Organism.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace EcoSim {
+namespace Genetics {
+
+/**
+ * @brief Owning container for the simulation's organisms with stable
+ *        handles and O(1) lookup by organism ID.
+ *
+ * Organisms are kept in a dense vector in turn order, so the update loop
+ * and every system that reads the population still walks contiguous
+ * memory. Alongside it sits a slot map: each organism is given a slot
+ * whose generation is bumped when the organism is removed, so a Handle
+ * taken earlier either resolves to the same organism or to nothing, never
+ * to whoever reused the slot. Freed slots are recycled from a free list.
+ *
+ * The per-tick lifecycle is:
+ *  1. run turns over organisms()
+ *  2. collectOffspring() appends the tick's births as one batch
+ *  3. removeDead() drops the dead in a single order-preserving pass
+ *
+ * organisms() also hands out the dense vector itself for the many APIs
+ * that take std::vector<OrganismPtr>. Elements may be modified in place,
+ * but after inserting or removing through that reference call reindex().
+ */
+class OrganismStore {
+public:
+    static constexpr std::uint32_t INVALID_SLOT = UINT32_MAX;
+
+    /**
+     * @brief Generational reference to a stored organism
+     */
+    struct Handle {
+        std::uint32_t slot = INVALID_SLOT;
+        std::uint32_t generation = 0;
+
+        bool valid() const { return slot != INVALID_SLOT; }
+        bool operator==(const Handle& other) const {
+            return slot == other.slot && generation == other.generation;
+        }
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+    using iterator       = std::vector<OrganismPtr>::iterator;
+    using const_iterator = std::vector<OrganismPtr>::const_iterator;
+
+    // ========================================================================
+    // Insertion and lookup
+    // ========================================================================
+
+    /**
+     * @brief Take ownership of an organism, appending it to the turn order
+     * @return Handle to the organism, or an invalid handle for nullptr
+     */
+    Handle insert(OrganismPtr organism);
+
+    /**
+     * @brief Resolve a handle
+     * @return The organism, or nullptr if it has been removed
+     */
+    Organism* get(Handle handle) const;
+
+    /**
+     * @brief Handle of the organism with an ID, or an invalid handle
+     */
+    Handle handleOf(int id) const;
+
+    /**
+     * @brief Organism with an ID (e.g. CombatComponent::targetId)
+     * @return The organism, or nullptr if no stored organism has that ID
+     */
+    Organism* find(int id) const { return get(handleOf(id)); }
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /**
+     * @brief Move every pending offspring into the store
+     *
+     * Only organisms present before the call are drained, so offspring are
+     * not asked for offspring of their own in the same tick.
+     *
+     * @return Number of offspring added
+     */
+    std::size_t collectOffspring();
+
+    /**
+     * @brief Remove organisms that are no longer alive
+     *
+     * Survivors keep their relative order and their handles.
+     *
+     * @return Number of organisms removed
+     */
+    std::size_t removeDead();
+
+    /**
+     * @brief Remove every organism and invalidate every handle
+     */
+    void clear();
+
+    // ========================================================================
+    // Dense access
+    // ========================================================================
+
+    std::size_t size() const { return live_.size(); }
+    bool empty() const { return live_.empty(); }
+
+    iterator begin() { return live_.begin(); }
+    iterator end()   { return live_.end(); }
+    const_iterator begin() const { return live_.begin(); }
+    const_iterator end()   const { return live_.end(); }
+
+    /**
+     * @brief The organisms in turn order, for vector-based APIs
+     */
+    std::vector<OrganismPtr>& organisms() { return live_; }
+    const std::vector<OrganismPtr>& organisms() const { return live_; }
+
+    /**
+     * @brief Rebuild the slot map after organisms() was changed directly
+     *
+     * Organisms whose ID was already stored keep their handle; handles of
+     * organisms no longer present are invalidated.
+     */
+    void reindex();
+
+    /**
+     * @brief Bytes held by the store and every organism in it
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    struct Slot {
+        std::uint32_t generation = 0;
+        std::uint32_t dense = 0;    ///< Index into live_ while in use
+        bool used = false;
+    };
+
+    /** @brief Claim a slot for live_[dense] */
+    Handle bind(std::size_t dense);
+
+    /** @brief Return a slot to the free list, invalidating its handles */
+    void release(std::uint32_t slot);
+
+    std::vector<OrganismPtr> live_;
+    std::vector<std::uint32_t> denseSlot_;      ///< Slot of each live_ entry
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::unordered_map<int, std::uint32_t> idSlot_;
+};
+
+} // namespace Genetics
+} // namespace EcoSim
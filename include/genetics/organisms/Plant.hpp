@@ -294,6 +294,18 @@ public:
      */
     bool canSurviveTemperature(float temperature) const;
     
+    /**
+     * @brief Get the lowest temperature the plant tolerates
+     * @return Temperature in Celsius
+     */
+    float getTempToleranceLow() const;
+    
+    /**
+     * @brief Get the highest temperature the plant tolerates
+     * @return Temperature in Celsius
+     */
+    float getTempToleranceHigh() const;
+    
     /**
      * @brief Update plant state for one tick
      * @param env Current environment state
@@ -540,6 +552,11 @@ public:
      */
     std::string toString() const;
     
+    /**
+     * @brief Bytes held by this plant, including its genome and traits
+     */
+    std::size_t memoryUsage() const override;
+    
     /**
      * @brief Create plant from serialized string
      * @param data Serialized plant data
@@ -600,6 +617,9 @@ public:
     float getScentProductionRate() const;
 
 protected:
+    // Compacts and rebuilds the lifecycle state below
+    friend class PlantRecordStore;
+
     // Plant-specific energy budget integration
     EnergyState energyState_;
     
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "genetics/organisms/Plant.hpp"
+#include "genetics/expression/EnvironmentState.hpp"
+#include "genetics/core/GeneticTypes.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace EcoSim {
+namespace Genetics {
+
+class GeneRegistry;
+
+/**
+ * @brief Gene-derived plant values, computed once per genotype
+ *
+ * The values Plant::update() and Plant::takeDamage() read from the genome,
+ * plus the lifespan and what PlantManager reads for scent and dispersal.
+ * Every record with the same genotype shares one block.
+ */
+struct PlantTraits {
+    float maxSize = 5.0f;
+    float growthRate = 0.5f;
+    float lightNeed = 0.5f;
+    float waterNeed = 0.5f;
+    float tempToleranceLow = 5.0f;
+    float tempToleranceHigh = 35.0f;
+    float waterStorage = 0.0f;
+    float hardiness = 0.5f;
+    unsigned int lifespan = 5000;
+    float fruitAppeal = 0.5f;
+    float toxicity = 0.0f;
+    float thornDamage = 0.0f;
+    float scentProductionRate = 0.0f;
+    float fruitProductionRate = 0.3f;
+    float runnerProduction = 0.0f;
+
+    /** @brief Read the traits from a plant's genome */
+    static PlantTraits fromPlant(const Plant& plant);
+};
+
+/**
+ * @brief Mutable state of one plant, 40 bytes
+ *
+ * Everything else about the plant lives in its genotype. Every way a plant
+ * dies leaves it at zero health, so health doubles as the alive flag.
+ */
+struct PlantRecord {
+    std::int32_t id = 0;             ///< Organism ID of the plant compacted
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    std::uint32_t genotype = 0;      ///< Index into the store's genotypes
+    std::uint32_t age = 0;
+    std::uint32_t fruitTimer = 0;
+    float currentSize = 0.0f;
+    float health = 1.0f;
+    float energy = 100.0f;           ///< EnergyState::currentEnergy
+    bool mature = false;
+
+    bool isAlive() const { return health > 0.0f; }
+};
+
+/**
+ * @brief Compact storage for very large plant populations
+ *
+ * A Plant is a full Organism: genome with string-keyed genes and lookup
+ * maps, phenotype caches, components and identity, around 12 KB each.
+ * PlantRecordStore keeps a plant as a PlantRecord in one dense array, with
+ * everything derived from its genes in a shared genotype:
+ * - PlantTraits, computed once from the first plant with that genotype
+ * - the allele values as packed floats; gene IDs and chromosomes are
+ *   stored once per gene layout (in practice, once per species template)
+ *
+ * Plants whose alleles are identical (clones, template plants with fixed
+ * genes) share a genotype. A unique genotype of the 31 default plant genes
+ * costs about 700 bytes, so a record plus its genotype is around 15 times
+ * smaller than the Plant it came from.
+ *
+ * update() and takeDamage() give the same results as the Plant methods on
+ * the same state. A full Genome or Plant is built only on request, by
+ * genome() and materialize(), for reproduction, feeding or inspection.
+ *
+ * Genotypes are reference counted: removeDead() releases the genotypes of
+ * the plants it drops and recycles their slots.
+ */
+class PlantRecordStore {
+public:
+    // ========================================================================
+    // Insertion
+    // ========================================================================
+
+    /**
+     * @brief Compact a plant into a new record
+     * @return Index of the record
+     */
+    std::size_t add(const Plant& plant);
+
+    // ========================================================================
+    // Simulation
+    // ========================================================================
+
+    /**
+     * @brief Advance one record a tick, as Plant::update()
+     */
+    void update(std::size_t index, const EnvironmentState& env);
+
+    /**
+     * @brief Damage one record, as Plant::takeDamage()
+     */
+    void takeDamage(std::size_t index, float amount);
+
+    /**
+     * @brief Copy a materialized plant's state back into its record
+     *
+     * For plants built by materialize() and changed outside the store,
+     * e.g. eaten by a creature.
+     */
+    void sync(std::size_t index, const Plant& plant);
+
+    /**
+     * @brief Drop records that are no longer alive
+     *
+     * Survivors keep their relative order; indices after the first removed
+     * record change.
+     *
+     * @return Number of records removed
+     */
+    std::size_t removeDead();
+
+    void clear();
+
+    // ========================================================================
+    // Access
+    // ========================================================================
+
+    std::size_t size() const { return records_.size(); }
+    bool empty() const { return records_.empty(); }
+
+    const PlantRecord& operator[](std::size_t index) const { return records_[index]; }
+    const std::vector<PlantRecord>& records() const { return records_; }
+
+    const PlantTraits& traits(std::size_t index) const {
+        return genotypes_[records_[index].genotype].traits;
+    }
+
+    /** @brief As Plant::canSpreadVegetatively() */
+    bool canSpreadVegetatively(std::size_t index) const;
+
+    /** @brief As Plant::getScentSignature() */
+    std::array<float, 8> scentSignature(std::size_t index) const;
+
+    /** @brief Genotypes in use */
+    std::size_t genotypeCount() const { return genotypes_.size() - freeGenotypes_.size(); }
+
+    // ========================================================================
+    // Materialization
+    // ========================================================================
+
+    /**
+     * @brief Build the full genome of a record
+     */
+    Genome genome(std::size_t index) const;
+
+    /**
+     * @brief Build a Plant with a record's genome and state
+     *
+     * The plant is a new organism with its own ID; identity is derived from
+     * the genome as when loading a save.
+     */
+    Plant materialize(std::size_t index, const GeneRegistry& registry) const;
+
+    /**
+     * @brief Bytes held by the records, genotypes and layouts
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    /// Gene IDs and chromosomes, in the order the alleles are packed
+    struct GeneLayout {
+        std::vector<std::pair<ChromosomeType, std::string>> genes;
+    };
+
+    struct Genotype {
+        PlantTraits traits;
+        std::uint32_t layout = 0;
+        std::uint32_t plants = 0;            ///< Records using it; 0 when free
+        std::uint64_t fingerprint = 0;
+        std::vector<float> alleles;          ///< value, strength for both alleles
+        std::unique_ptr<Genome> fullGenome;  ///< Only when an allele is not a float
+    };
+
+    std::uint32_t internLayout(const Genome& genome);
+    std::uint32_t internGenotype(const Plant& plant);
+    void releaseGenotype(std::uint32_t genotype);
+    void die(std::size_t index, const char* cause);
+
+    std::vector<PlantRecord> records_;
+
+    std::vector<Genotype> genotypes_;
+    std::vector<std::uint32_t> freeGenotypes_;
+    std::unordered_map<std::uint64_t, std::uint32_t> genotypeByFingerprint_;
+    std::vector<GeneLayout> layouts_;
+};
+
+} // namespace Genetics
+} // namespace EcoSim
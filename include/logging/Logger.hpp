@@ -267,6 +267,10 @@ public:
     void extinctionWarning(const std::string& type, int remaining);
     void extinction(const std::string& entityType);
 
+    // === Memory ===
+    void memoryBudgetExceeded(const std::string& subsystem, size_t bytes, size_t budget);
+    size_t memoryUsage() const;  ///< Bytes held by the logger's statistics and buffers
+
     // === Energy ===
     void energyChange(int entityId, const std::string& reason, float before, float after);
 
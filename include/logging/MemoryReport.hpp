@@ -0,0 +1,127 @@
+#ifndef MEMORY_REPORT_HPP
+#define MEMORY_REPORT_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Per-subsystem memory accounting
+ *
+ * A MemoryReport collects the memoryUsage() of each subsystem under a name
+ * (World::reportMemory() adds the world's parts; the caller adds creatures,
+ * statistics and the logger). A MemoryBudget holds optional soft limits
+ * per name and warns through the Logger when a report exceeds one.
+ *
+ * Reporting walks every organism, so it is meant for occasional snapshots
+ * (the GUI takes one every few hundred ticks), not for every tick.
+ *
+ * @code
+ * MemoryReport report;
+ * world.reportMemory(report);
+ * report.add("creatures", creatures.memoryUsage(), creatures.size());
+ *
+ * MemoryBudget budget = MemoryBudget::fromEnvironment();
+ * budget.check(report);   // logs MEMORY_BUDGET warnings
+ * @endcode
+ */
+
+namespace logging {
+
+/**
+ * @brief Sizes of named subsystems, in the order they were added
+ */
+class MemoryReport {
+public:
+    struct Entry {
+        const char* name;           ///< String literal
+        std::size_t bytes;
+        std::size_t objects;        ///< Items the bytes hold, 0 when not countable
+    };
+
+    void add(const char* name, std::size_t bytes, std::size_t objects = 0) {
+        entries_.push_back({name, bytes, objects});
+    }
+
+    const std::vector<Entry>& entries() const { return entries_; }
+    bool empty() const { return entries_.empty(); }
+
+    /** @brief Sum of every entry */
+    std::size_t total() const;
+
+    /** @return The entry with this name, or nullptr */
+    const Entry* find(const std::string& name) const;
+
+private:
+    std::vector<Entry> entries_;
+};
+
+/**
+ * @brief Optional soft memory limits per report entry
+ *
+ * Limits are named after report entries; "total" limits the sum. Each
+ * limit warns once when first exceeded and again only after the report
+ * has been back under it.
+ */
+class MemoryBudget {
+public:
+    /// Limit name for the sum of every entry
+    static constexpr const char* TOTAL = "total";
+
+    /**
+     * @brief A limit a report went over
+     */
+    struct Overrun {
+        std::string name;
+        std::size_t bytes;
+        std::size_t limit;
+    };
+
+    /** @brief Set (or replace) the limit for an entry */
+    void setLimit(const std::string& name, std::size_t bytes);
+
+    /**
+     * @brief Set a limit from "NAME=MB" (fractional megabytes allowed)
+     * @return false if the text is malformed
+     */
+    bool parseLimit(const std::string& spec);
+
+    /**
+     * @brief Limits from ECOSIM_MEMORY_BUDGET, a comma separated list of
+     *        NAME=MB (e.g. "plants=256,total=1024")
+     *
+     * Malformed items are reported on stderr and skipped.
+     */
+    static MemoryBudget fromEnvironment();
+
+    bool empty() const { return limits_.empty(); }
+
+    /** @return The limit for an entry in bytes, or 0 when it has none */
+    std::size_t limitFor(const std::string& name) const;
+
+    /**
+     * @brief Compare a report against the limits
+     *
+     * Logs a MEMORY_BUDGET warning for each limit that has just been
+     * exceeded.
+     *
+     * @return The limits exceeded by this report but not the previous one
+     */
+    std::vector<Overrun> check(const MemoryReport& report);
+
+    /** @return Names of the limits exceeded at the last check() */
+    std::vector<std::string> exceeded() const;
+
+private:
+    struct Limit {
+        std::string name;
+        std::size_t bytes;
+        bool over = false;
+    };
+
+    std::vector<Limit> limits_;
+};
+
+} // namespace logging
+
+#endif // MEMORY_REPORT_HPP
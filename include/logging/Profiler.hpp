@@ -0,0 +1,184 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Scoped profiling zones
+ *
+ * ECOSIM_PROFILE_ZONE("name") times the rest of the enclosing scope. While
+ * no capture is running a zone costs one relaxed atomic load; with
+ * ECOSIM_PROFILING=0 (CMake option ECOSIM_PROFILING=OFF) it compiles to
+ * nothing. Zone names must be string literals (or otherwise outlive the
+ * capture), since only the pointer is recorded.
+ *
+ * @code
+ * void PlantManager::tick(unsigned currentTick) {
+ *     ECOSIM_PROFILE_ZONE("PlantManager::tick");
+ *     ...
+ * }
+ *
+ * Profiler::getInstance().start();
+ * // ... run ticks ...
+ * Profiler::getInstance().stop();
+ * Profiler::getInstance().writeChromeTrace("trace.json");  // chrome://tracing, Perfetto
+ * @endcode
+ */
+#ifndef ECOSIM_PROFILING
+#define ECOSIM_PROFILING 0
+#endif
+
+#define ECOSIM_PROFILE_CONCAT_INNER(a, b) a##b
+#define ECOSIM_PROFILE_CONCAT(a, b) ECOSIM_PROFILE_CONCAT_INNER(a, b)
+
+#if ECOSIM_PROFILING
+#define ECOSIM_PROFILE_ZONE(name) \
+    ::logging::ProfileZone ECOSIM_PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define ECOSIM_PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace logging {
+
+/**
+ * @brief One completed zone
+ */
+struct ProfileEvent {
+    const char* name;
+    std::int64_t startNs;       ///< steady_clock time
+    std::int64_t durationNs;
+};
+
+/**
+ * @brief Process-wide collector of profiling zones
+ *
+ * Every thread records into its own buffer, so recording takes no lock and
+ * threads never share a cache line. A buffer is only read by the exporter
+ * once stop() has seen every other thread leave its open zones.
+ *
+ * @note Thread Safety: zones may be recorded from any thread. start(),
+ * stop() and the readers are meant for one controlling thread.
+ */
+class Profiler {
+public:
+    /// Events kept per thread per capture; later zones are counted as dropped
+    static constexpr std::size_t MAX_EVENTS_PER_THREAD = std::size_t(1) << 20;
+
+    /**
+     * @brief Per-thread event storage
+     */
+    struct ThreadBuffer {
+        std::vector<ProfileEvent> events;
+        std::atomic<int> openZones{0};
+        std::size_t dropped = 0;
+        std::uint32_t threadId = 0;
+        std::string threadName;
+    };
+
+    static Profiler& getInstance();
+
+    /** @brief Drop the previous capture and begin recording */
+    void start();
+
+    /** @brief Stop recording, waiting for other threads to close their zones */
+    void stop();
+
+    static bool isRecording() { return recording_.load(std::memory_order_relaxed); }
+
+    /** @brief Name the calling thread in exported traces */
+    void setThreadName(const std::string& name);
+
+    /**
+     * @brief Write the last capture in the Chrome trace event format
+     *
+     * The file loads in chrome://tracing and ui.perfetto.dev.
+     *
+     * @return false while recording or if the file cannot be written
+     */
+    bool writeChromeTrace(const std::string& path) const;
+
+    /** @brief Events recorded by the last (or current) capture */
+    std::size_t eventCount() const;
+
+    /** @brief Zones not recorded because a thread buffer was full */
+    std::size_t droppedCount() const;
+
+    /**
+     * @brief Copy of every recorded event and its thread, in thread order
+     *
+     * Only valid while not recording.
+     */
+    std::vector<std::pair<std::uint32_t, ProfileEvent>> events() const;
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // ========================================================================
+    // Zone recording (used by ProfileZone)
+    // ========================================================================
+
+    /**
+     * @brief Open a zone on the calling thread
+     * @return The thread's buffer, or nullptr when not recording
+     */
+    ThreadBuffer* beginZone();
+
+    static void endZone(ThreadBuffer* buffer, const char* name, std::int64_t startNs) {
+        const std::int64_t end = now();
+        if (buffer->events.size() < MAX_EVENTS_PER_THREAD) {
+            buffer->events.push_back({name, startNs, end - startNs});
+        } else {
+            ++buffer->dropped;
+        }
+        buffer->openZones.fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    Profiler() = default;
+
+    ThreadBuffer& threadBuffer();
+
+    static inline std::atomic<bool> recording_{false};
+
+    mutable std::mutex mutex_;      ///< Guards buffers_ (registration only)
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::int64_t captureStartNs_ = 0;
+};
+
+/**
+ * @brief RAII zone; use through ECOSIM_PROFILE_ZONE
+ */
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name) : name_(name) {
+        if (Profiler::isRecording()) {
+            buffer_ = Profiler::getInstance().beginZone();
+            if (buffer_) start_ = Profiler::now();
+        }
+    }
+
+    ~ProfileZone() {
+        if (buffer_) Profiler::endZone(buffer_, name_, start_);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_;
+    Profiler::ThreadBuffer* buffer_ = nullptr;
+    std::int64_t start_ = 0;
+};
+
+} // namespace logging
+
+#endif // PROFILER_HPP
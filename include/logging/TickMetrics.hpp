@@ -0,0 +1,265 @@
+#ifndef TICK_METRICS_HPP
+#define TICK_METRICS_HPP
+
+#include "logging/Profiler.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Rolling per-tick performance metrics
+ *
+ * While enabled, TickMetrics keeps one Sample per tick in a fixed-size ring:
+ * time per tick phase, behavior executions and their cost, A* searches and
+ * nodes expanded, creature spatial index occupancy and heap allocations made
+ * by the ticking thread. Named memory gauges hold the latest size reported
+ * for each subsystem. Nothing is allocated per tick, so the GUI can keep it
+ * running and read it live (ImGuiOverlay's Performance window).
+ *
+ * ECOSIM_TICK_PHASE(Phase) times the rest of the enclosing scope as a tick
+ * phase and opens a profiling zone of the same name. Like
+ * ECOSIM_PROFILE_ZONE it compiles to nothing with ECOSIM_PROFILING=0.
+ *
+ * @code
+ * metrics.beginTick(tick);
+ * {
+ *     ECOSIM_TICK_PHASE(SpatialIndex);
+ *     w.rebuildCreatureIndex(creatures);
+ * }
+ * metrics.endTick();
+ * @endcode
+ */
+#if ECOSIM_PROFILING
+#define ECOSIM_TICK_PHASE(phase) \
+    ECOSIM_PROFILE_ZONE(::logging::tickPhaseName(::logging::TickPhase::phase)); \
+    ::logging::PhaseTimer ECOSIM_PROFILE_CONCAT(phaseTimer_, __LINE__)(::logging::TickPhase::phase)
+#else
+#define ECOSIM_TICK_PHASE(phase) ((void)0)
+#endif
+
+namespace logging {
+
+/**
+ * @brief The steps of advanceSimulation, in the order they run
+ */
+enum class TickPhase : std::size_t {
+    EnvironmentCache = 0,
+    SpatialIndex,
+    WorldObjects,
+    ScentLayer,
+    Corpses,
+    BreedingScents,
+    CreatureTurns,
+    Offspring,
+    RemoveDead,
+    Statistics,
+    Count
+};
+
+constexpr std::size_t TICK_PHASE_COUNT = static_cast<std::size_t>(TickPhase::Count);
+
+/** @brief Name used for the profiling zone and the dashboard */
+const char* tickPhaseName(TickPhase phase);
+
+/**
+ * @brief Heap allocations made so far by the calling thread
+ *
+ * Counted by the global operator new when ECOSIM_PROFILING is on; always 0
+ * otherwise.
+ */
+std::uint64_t threadAllocationCount();
+
+/**
+ * @brief Collects per-tick metrics for the live performance dashboard
+ *
+ * @note Thread Safety: recording is done by the one thread running ticks.
+ * Readers must not run concurrently with a tick; the GUI reads a copy of
+ * history() that the snapshot capture takes between ticks. The headless
+ * batch runner, which ticks on several threads, leaves it disabled.
+ */
+class TickMetrics {
+public:
+    static constexpr std::size_t HISTORY_SIZE = 240;      ///< Ticks kept
+    static constexpr std::size_t MAX_BEHAVIORS = 16;      ///< Distinct behavior IDs tracked
+    static constexpr std::size_t MAX_MEMORY_GAUGES = 16;
+    static constexpr unsigned MEMORY_SAMPLE_INTERVAL = 30; ///< Ticks between process memory reads
+
+    /**
+     * @brief Everything measured during one tick
+     */
+    struct Sample {
+        std::uint64_t tick = 0;
+        float totalMs = 0.0f;
+        std::array<float, TICK_PHASE_COUNT> phaseMs{};
+        std::array<std::uint32_t, MAX_BEHAVIORS> behaviorCalls{};  ///< Indexed by behaviorName()
+        std::array<float, MAX_BEHAVIORS> behaviorMs{};
+        std::uint32_t pathSearches = 0;
+        std::uint32_t pathNodes = 0;            ///< A* nodes expanded
+        std::uint32_t allocations = 0;
+        std::uint32_t indexedCreatures = 0;
+        std::uint32_t occupiedCells = 0;        ///< Spatial index cells holding a creature
+        std::uint32_t totalCells = 0;
+        std::uint32_t largestCell = 0;          ///< Creatures in the fullest cell
+    };
+
+    /**
+     * @brief Latest size reported for one subsystem
+     */
+    struct MemoryGauge {
+        const char* name = nullptr;
+        std::size_t bytes = 0;
+        std::size_t objects = 0;    ///< Items the bytes hold, 0 when not countable
+        std::size_t budget = 0;     ///< Soft limit, 0 for none
+    };
+
+    /**
+     * @brief The kept ticks, behavior names and memory gauges
+     *
+     * A plain value, so it can be copied between ticks and read elsewhere
+     * while the next tick runs.
+     */
+    class History {
+    public:
+        /** @brief Number of ticks kept */
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        /** @brief The i-th oldest tick */
+        const Sample& at(std::size_t i) const {
+            return samples_[(head_ + HISTORY_SIZE - size_ + i) % HISTORY_SIZE];
+        }
+
+        const Sample& latest() const { return at(size_ - 1); }
+
+        std::size_t behaviorCount() const { return behaviorCount_; }
+        const std::string& behaviorName(std::size_t index) const { return behaviorNames_[index]; }
+
+        std::size_t memoryGaugeCount() const { return memoryCount_; }
+        const MemoryGauge& memoryGauge(std::size_t index) const { return memory_[index]; }
+
+    private:
+        friend class TickMetrics;
+
+        std::array<Sample, HISTORY_SIZE> samples_{};
+        std::size_t head_ = 0;          ///< Slot the next tick is written to
+        std::size_t size_ = 0;
+
+        std::array<std::string, MAX_BEHAVIORS> behaviorNames_;
+        std::size_t behaviorCount_ = 0;
+
+        std::array<MemoryGauge, MAX_MEMORY_GAUGES> memory_{};
+        std::size_t memoryCount_ = 0;
+    };
+
+    static TickMetrics& getInstance();
+
+    /** @brief Start or stop recording; disabling keeps the history */
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    static bool isEnabled() {
+        return ECOSIM_PROFILING && enabled_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Drop the history, behavior names and memory gauges */
+    void clear();
+
+    // ========================================================================
+    // Recording (no-ops while disabled or outside a tick)
+    // ========================================================================
+
+    void beginTick(std::uint64_t tick);
+    void endTick();
+
+    void addPhaseTime(TickPhase phase, std::int64_t ns) {
+        if (inTick_) current_.phaseMs[static_cast<std::size_t>(phase)] += toMs(ns);
+    }
+
+    /** @brief Count one execution of a behavior and its cost */
+    void recordBehavior(const std::string& behaviorId, std::int64_t ns);
+
+    void recordPathSearch(unsigned nodesExpanded) {
+        if (!inTick_) return;
+        ++current_.pathSearches;
+        current_.pathNodes += nodesExpanded;
+    }
+
+    void recordSpatialIndex(std::size_t indexed, std::size_t occupiedCells,
+                            std::size_t totalCells, std::size_t largestCell);
+
+    /**
+     * @brief Set the size of a subsystem
+     * @param name Gauge label; a string literal, since only the pointer is kept
+     * @param objects Items the bytes hold (creatures, plants, ...), 0 if none
+     * @param budget Soft limit to show against, 0 for none
+     */
+    void setMemory(const char* name, std::size_t bytes,
+                   std::size_t objects = 0, std::size_t budget = 0);
+
+    // ========================================================================
+    // Reading
+    // ========================================================================
+
+    /** @brief Everything recorded so far */
+    const History& history() const { return history_; }
+
+    // Shorthands for history()
+    std::size_t size() const { return history_.size(); }
+    bool empty() const { return history_.empty(); }
+    const Sample& at(std::size_t i) const { return history_.at(i); }
+    const Sample& latest() const { return history_.latest(); }
+    std::size_t behaviorCount() const { return history_.behaviorCount(); }
+    const std::string& behaviorName(std::size_t index) const { return history_.behaviorName(index); }
+    std::size_t memoryGaugeCount() const { return history_.memoryGaugeCount(); }
+    const MemoryGauge& memoryGauge(std::size_t index) const { return history_.memoryGauge(index); }
+
+    static std::int64_t now() { return Profiler::now(); }
+
+private:
+    TickMetrics() = default;
+
+    static float toMs(std::int64_t ns) { return static_cast<float>(ns) / 1.0e6f; }
+
+    /** @brief Report the resident set size as the "process (resident)" gauge */
+    void sampleProcessMemory();
+
+    static inline std::atomic<bool> enabled_{false};
+
+    History history_;
+
+    Sample current_;
+    bool inTick_ = false;
+    std::int64_t tickStartNs_ = 0;
+    std::uint64_t tickStartAllocations_ = 0;
+};
+
+/**
+ * @brief RAII tick phase timer; use through ECOSIM_TICK_PHASE
+ */
+class PhaseTimer {
+public:
+    explicit PhaseTimer(TickPhase phase) : phase_(phase) {
+        if (TickMetrics::isEnabled()) {
+            active_ = true;
+            start_ = TickMetrics::now();
+        }
+    }
+
+    ~PhaseTimer() {
+        if (active_) TickMetrics::getInstance().addPhaseTime(phase_, TickMetrics::now() - start_);
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    TickPhase phase_;
+    bool active_ = false;
+    std::int64_t start_ = 0;
+};
+
+} // namespace logging
+
+#endif // TICK_METRICS_HPP
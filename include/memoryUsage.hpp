@@ -0,0 +1,112 @@
+/**
+ * @file memoryUsage.hpp
+ * @brief Heap size estimates for standard containers
+ * @author Gary Ferguson
+ *
+ * Subsystems report their footprint through a memoryUsage() method: the
+ * size of the object itself plus the heap it owns. These helpers give the
+ * heap part for the containers used across the simulation, so each
+ * reporter is a short sum over its members.
+ *
+ * The figures are estimates of what the allocator was asked for (capacity,
+ * not size), using libstdc++'s node layouts. Allocator bookkeeping and
+ * fragmentation are not included; compare against the process resident
+ * size to see those.
+ *
+ * Usage:
+ * @code
+ * std::size_t ScentLayer::memoryUsage() const {
+ *     std::size_t bytes = sizeof(*this) + EcoSim::Memory::heapBytes(_scents);
+ *     for (const auto& entry : _scents) bytes += EcoSim::Memory::heapBytes(entry.second);
+ *     return bytes;
+ * }
+ * @endcode
+ */
+
+#ifndef ECOSIM_MEMORY_USAGE_HPP
+#define ECOSIM_MEMORY_USAGE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace EcoSim {
+namespace Memory {
+
+/// Per-node overhead of a red-black tree node (colour, parent, left, right)
+constexpr std::size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*);
+
+/// Per-node overhead of a hash node (next pointer and cached hash)
+constexpr std::size_t HASH_NODE_OVERHEAD = 2 * sizeof(void*);
+
+/** @brief Characters stored outside the small-string buffer */
+inline std::size_t heapBytes(const std::string& s) {
+    static const std::size_t inlineCapacity = std::string().capacity();
+    return s.capacity() > inlineCapacity ? s.capacity() + 1 : 0;
+}
+
+template<typename T, typename A>
+std::size_t heapBytes(const std::vector<T, A>& v) {
+    return v.capacity() * sizeof(T);
+}
+
+/** @brief Outer and inner arrays of a 2D map */
+template<typename T, typename A, typename OA>
+std::size_t nestedHeapBytes(const std::vector<std::vector<T, A>, OA>& rows) {
+    std::size_t bytes = heapBytes(rows);
+    for (const auto& row : rows) bytes += heapBytes(row);
+    return bytes;
+}
+
+/** @brief Element blocks plus the block map, at 512 bytes per block */
+template<typename T, typename A>
+std::size_t heapBytes(const std::deque<T, A>& d) {
+    constexpr std::size_t blockBytes = sizeof(T) < 512 ? 512 : sizeof(T);
+    constexpr std::size_t perBlock = blockBytes / sizeof(T);
+    const std::size_t blocks = d.size() / perBlock + 1;
+    return blocks * blockBytes + (blocks + 8) * sizeof(void*);
+}
+
+template<typename K, typename V, typename C, typename A>
+std::size_t heapBytes(const std::map<K, V, C, A>& m) {
+    return m.size() * (sizeof(typename std::map<K, V, C, A>::value_type) + TREE_NODE_OVERHEAD);
+}
+
+template<typename K, typename C, typename A>
+std::size_t heapBytes(const std::set<K, C, A>& s) {
+    return s.size() * (sizeof(K) + TREE_NODE_OVERHEAD);
+}
+
+template<typename K, typename V, typename H, typename E, typename A>
+std::size_t heapBytes(const std::unordered_map<K, V, H, E, A>& m) {
+    using Value = typename std::unordered_map<K, V, H, E, A>::value_type;
+    return m.bucket_count() * sizeof(void*) + m.size() * (sizeof(Value) + HASH_NODE_OVERHEAD);
+}
+
+template<typename K, typename H, typename E, typename A>
+std::size_t heapBytes(const std::unordered_set<K, H, E, A>& s) {
+    return s.bucket_count() * sizeof(void*) + s.size() * (sizeof(K) + HASH_NODE_OVERHEAD);
+}
+
+/**
+ * @brief Heap of a map plus the heap owned by its string keys
+ *
+ * For the name-keyed caches (gene IDs, trait names) where the keys are
+ * often longer than the small-string buffer.
+ */
+template<typename Map>
+std::size_t heapBytesWithKeys(const Map& m) {
+    std::size_t bytes = heapBytes(m);
+    for (const auto& entry : m) bytes += heapBytes(entry.first);
+    return bytes;
+}
+
+} // namespace Memory
+} // namespace EcoSim
+
+#endif // ECOSIM_MEMORY_USAGE_HPP
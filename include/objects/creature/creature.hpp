@@ -297,6 +297,9 @@ public:
     //  grow and updatePhenotypeContext live on Organism. Plant overrides
     //  grow to add photosynthesis-driven growth.
 
+    /// Bytes held by this creature (Organism::memoryUsage at Creature size)
+    std::size_t memoryUsage() const override;
+
     //============================================================================
     //  Genetics System - Instance Methods
     //============================================================================
@@ -289,7 +289,8 @@ class Navigator {
                                  const int &endY,
                                  const PathfindingContext* ctx = nullptr);
     static bool wander          (EcoSim::Genetics::Organism &c, const std::vector<std::vector<Tile>> &map,
-                                 const unsigned rows, const unsigned cols);
+                                 const unsigned rows, const unsigned cols,
+                                 const unsigned currentTick);
     static bool moveTowards     (EcoSim::Genetics::Organism &c,
                                  const std::vector<std::vector<Tile>> &map,
                                  const int &rows,
@@ -301,7 +302,8 @@ class Navigator {
                                  const int &rows,
                                  const int &cols,
                                  const int &awayX,
-                                 const int &awayY);
+                                 const int &awayY,
+                                 const unsigned currentTick);
     
     //============================================================================
     //  Float Movement System
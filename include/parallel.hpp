@@ -0,0 +1,257 @@
+/**
+ * @file parallel.hpp
+ * @brief Shared worker pool and data-parallel loop helper
+ * @author Gary Ferguson
+ *
+ * The simulation is single-threaded, but several batch jobs (genome
+ * statistics, world generation, headless runs) are embarrassingly parallel.
+ * This header provides one process-wide pool of worker threads so those jobs
+ * do not each spin up and tear down their own threads.
+ *
+ * Key concepts:
+ * - ThreadPool::instance(): lazily created pool sized to the machine
+ * - parallelFor(): splits [begin, end) into grain-sized chunks which the
+ *   workers and the calling thread claim in order until none remain
+ * - Nested parallelFor() calls made from a worker run serially on that
+ *   worker, so a parallel job may safely call other parallel code
+ *
+ * The worker count defaults to std::thread::hardware_concurrency() and can be
+ * overridden with the ECOSIM_THREADS environment variable (1 disables all
+ * worker threads).
+ *
+ * Usage:
+ * @code
+ * EcoSim::parallelFor(0, rows, 16, [&](size_t first, size_t last) {
+ *     for (size_t y = first; y < last; ++y) processRow(y);
+ * });
+ * @endcode
+ */
+
+#ifndef ECOSIM_PARALLEL_HPP
+#define ECOSIM_PARALLEL_HPP
+
+#include "logging/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EcoSim {
+
+//==============================================================================
+// ThreadPool Class
+//==============================================================================
+
+/**
+ * @brief Fixed set of worker threads consuming a shared task queue
+ *
+ * @note Thread Safety: submit() and parallelFor() may be called from any
+ * thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Create a pool with the given number of worker threads
+     * @param workers Number of threads to start (0 runs everything inline)
+     */
+    explicit ThreadPool(unsigned int workers) {
+        workers_.reserve(workers);
+        for (unsigned int i = 0; i < workers; ++i) {
+            workers_.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Process-wide pool shared by all parallel jobs
+     *
+     * The calling thread always takes part in parallelFor(), so the pool
+     * keeps one thread fewer than the requested concurrency.
+     */
+    static ThreadPool& instance() {
+        static ThreadPool pool(defaultConcurrency() - 1);
+        return pool;
+    }
+
+    /**
+     * @brief Number of threads that can work on one parallelFor() at once
+     */
+    unsigned int concurrency() const {
+        return static_cast<unsigned int>(workers_.size()) + 1;
+    }
+
+    /**
+     * @brief Concurrency requested by ECOSIM_THREADS or the hardware
+     */
+    static unsigned int defaultConcurrency() {
+        if (const char* env = std::getenv("ECOSIM_THREADS")) {
+            long requested = std::strtol(env, nullptr, 10);
+            if (requested > 0) {
+                return static_cast<unsigned int>(std::min(requested, 256L));
+            }
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief True when called from one of this process's pool workers
+     */
+    static bool onWorkerThread() {
+        return insideWorker();
+    }
+
+    /**
+     * @brief Queue a fire-and-forget task
+     *
+     * Runs inline when the pool has no workers.
+     */
+    void submit(std::function<void()> task) {
+        if (workers_.empty()) {
+            task();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * @brief Run fn(first, last) over grain-sized chunks of [begin, end)
+     *
+     * Blocks until every chunk has finished. Chunk boundaries depend only on
+     * begin, end and grain, never on the number of threads, so a job that
+     * writes each chunk's results to its own slot is deterministic.
+     * The first exception thrown by any chunk is rethrown here.
+     */
+    template<typename Fn>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn) {
+        if (end <= begin) return;
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks = (end - begin + grain - 1) / grain;
+
+        if (chunks == 1 || workers_.empty() || insideWorker()) {
+            fn(begin, end);
+            return;
+        }
+
+        // Helpers only touch `body` after claiming a chunk, and the caller
+        // cannot return while a claimed chunk is unfinished, so the reference
+        // stays valid. Everything else lives in the shared Job.
+        struct Job {
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+            std::size_t chunks = 0;
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr error;
+            std::function<void(std::size_t)> body;
+        };
+        auto job = std::make_shared<Job>();
+        job->chunks = chunks;
+        job->body = [&fn, begin, end, grain](std::size_t chunk) {
+            std::size_t first = begin + chunk * grain;
+            fn(first, std::min(end, first + grain));
+        };
+
+        auto drain = [](Job& j) {
+            std::size_t chunk;
+            while ((chunk = j.next.fetch_add(1)) < j.chunks) {
+                try {
+                    j.body(chunk);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(j.mutex);
+                    if (!j.error) j.error = std::current_exception();
+                }
+                if (j.done.fetch_add(1) + 1 == j.chunks) {
+                    std::lock_guard<std::mutex> lock(j.mutex);
+                    j.finished.notify_all();
+                }
+            }
+        };
+
+        const std::size_t helpers = std::min(workers_.size(), chunks - 1);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            submit([job, drain]() { drain(*job); });
+        }
+        drain(*job);
+
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->finished.wait(lock, [&job]() { return job->done.load() == job->chunks; });
+        if (job->error) std::rethrow_exception(job->error);
+    }
+
+private:
+    static bool& insideWorker() {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+    void workerLoop() {
+        insideWorker() = true;
+        logging::Profiler::getInstance().setThreadName("worker");
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+//==============================================================================
+// Convenience Functions
+//==============================================================================
+
+/**
+ * @brief parallelFor() on the shared pool
+ */
+template<typename Fn>
+inline void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn) {
+    ThreadPool::instance().parallelFor(begin, end, grain, std::forward<Fn>(fn));
+}
+
+/**
+ * @brief Threads the shared pool can apply to one parallelFor()
+ */
+inline unsigned int parallelConcurrency() {
+    return ThreadPool::instance().concurrency();
+}
+
+} // namespace EcoSim
+
+#endif // ECOSIM_PARALLEL_HPP
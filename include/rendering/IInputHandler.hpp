@@ -124,6 +124,8 @@ enum class InputAction {
     
     // UI actions
     TOGGLE_HUD,         ///< Toggle HUD visibility
+    TOGGLE_TRACE,       ///< Start/stop a profiling capture
+    TOGGLE_LOD,         ///< Toggle level-of-detail turn scheduling
     
     // Simulation actions
     ADD_CREATURES,      ///< Add more creatures
@@ -14,6 +14,7 @@
 #define ECOSIM_IRENDERER_HPP
 
 #include "RenderTypes.hpp"
+#include "RenderSnapshot.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -156,6 +157,19 @@ public:
     virtual void renderCreature(const EcoSim::Genetics::Organism& creature,
                                 int screenX, int screenY) = 0;
 
+    /**
+     * @brief Render terrain and entities from a simulation snapshot
+     * 
+     * Used while the simulation runs on its own thread. Everything drawn
+     * comes from the snapshot; the world is only read through the
+     * snapshot's terrain grid, whose terrain fields do not change while
+     * the simulation runs.
+     * 
+     * @param snapshot Latest snapshot published by the simulation thread
+     * @param viewport The viewport configuration for culling
+     */
+    virtual void renderSnapshot(const RenderSnapshot& snapshot, const Viewport& viewport) = 0;
+
     //==========================================================================
     // UI Rendering Methods
     //==========================================================================
@@ -170,6 +184,17 @@ public:
      */
     virtual void renderHUD(const HUDData& data) = 0;
     
+    /**
+     * @brief HUD panels renderHUD() will show
+     *
+     * The snapshot copies what these panels need and renderHUD() reads it
+     * through HUDData::panels, so panels never touch the live world.
+     * Default implementation asks for nothing.
+     *
+     * @return The panels currently open
+     */
+    virtual PanelRequest panelRequest() const { return PanelRequest(); }
+    
     /**
      * @brief Render a menu and return the selected option
      * 
@@ -273,6 +298,17 @@ public:
      * @return Current zoom level (tile size in pixels for SDL2, 1 for NCurses)
      */
     virtual int getZoomLevel() const { return 1; }
+    
+    /**
+     * @brief Get the WorldOverview level drawn at the current zoom
+     * 
+     * When zoomed out past single tiles, renderers draw one summarised cell
+     * per block of tiles instead (see WorldOverview). Callers copy this into
+     * Viewport::overviewLevel.
+     * 
+     * @return Overview level, or -1 when tiles are drawn individually
+     */
+    virtual int getOverviewLevel() const { return -1; }
 
     //==========================================================================
     // Viewport Center Request Methods (for UI-driven viewport changes)
@@ -64,6 +64,8 @@ inline std::map<KeyCode, InputAction> getDefaultMappings() {
     // UI actions
     //==========================================================================
     mappings[KeyCode::KEY_F] = InputAction::TOGGLE_HUD;
+    mappings[KeyCode::KEY_T] = InputAction::TOGGLE_TRACE;
+    mappings[KeyCode::KEY_O] = InputAction::TOGGLE_LOD;
     
     //==========================================================================
     // Simulation actions
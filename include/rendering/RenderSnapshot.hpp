@@ -0,0 +1,267 @@
+/**
+ * @file RenderSnapshot.hpp
+ * @brief Immutable copy of what the renderer needs from one simulation tick
+ * @author Gary Ferguson
+ *
+ * The simulation runs on its own thread (see simulationThread.hpp) and
+ * publishes one RenderSnapshot per tick. Renderers draw from the snapshot
+ * instead of walking the live World and creature list, so a slow tick never
+ * holds up a frame and a frame never holds up a tick.
+ *
+ * A snapshot holds plain values: sprite positions, IDs and appearance for
+ * the entities around the viewport, the HUD numbers, and the terrain
+ * revision. Terrain itself is not copied; it only changes while the
+ * simulation is stopped for the editor, so renderers may read terrain fields
+ * (type, elevation, water depth) from the grid pointer. Plants stored on
+ * tiles are live simulation state and must be taken from the snapshot.
+ *
+ * When the view is zoomed out far enough to draw the WorldOverview
+ * (region.overviewLevel >= 0), no sprites are collected; the overview cells
+ * covering the region are copied instead, so a snapshot stays the size of
+ * the screen however much of the world is visible.
+ *
+ * The HUD panels (statistics history, tick metrics, world details, the
+ * creature list and the inspected creature) are copied too, but only the
+ * ones the renderer has open (see PanelRequest).
+ */
+
+#ifndef ECOSIM_RENDER_SNAPSHOT_HPP
+#define ECOSIM_RENDER_SNAPSHOT_HPP
+
+#include "RenderTypes.hpp"
+#include "genetics/core/MotivationAction.hpp"
+#include "genetics/systems/HealthSystem.hpp"
+#include "logging/TickMetrics.hpp"
+#include "statistics/timeSeries.hpp"
+#include "world/WorldGenerator.hpp"
+#include "world/WorldOverview.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class World;
+namespace EcoSim {
+    class WorldGrid;
+    namespace Genetics {
+        class Organism;
+        enum class DietType;
+    }
+}
+
+/**
+ * @brief A creature as drawn this tick
+ */
+struct CreatureSprite {
+    int id;                                 ///< Sequential creature ID (matches UI selection)
+    float worldX;                           ///< Sub-tile world position
+    float worldY;
+    int tileX;                              ///< Tile the creature occupies
+    int tileY;
+    EcoSim::Genetics::Motivation motivation;///< Drives the profile color
+    char glyph;                             ///< Archetype render character
+};
+
+/**
+ * @brief The plant drawn on a tile this tick
+ */
+struct PlantSprite {
+    int tileX;
+    int tileY;
+    EntityType type;                        ///< Drives the plant color
+    char glyph;
+};
+
+/**
+ * @brief A corpse as drawn this tick
+ */
+struct CorpseSprite {
+    float worldX;
+    float worldY;
+    float decay;                            ///< 0.0 = fresh, 1.0 = gone
+};
+
+/**
+ * @brief HUD panel contents a renderer wants copied into the next snapshot
+ *
+ * Renderers report this every frame through IRenderer::panelRequest().
+ * Panels that are closed ask for nothing, so they cost the tick nothing.
+ */
+struct PanelRequest {
+    bool history;                           ///< One tier of the long-run statistics series
+    SeriesTier historyTier;
+    bool metrics;                           ///< The tick metrics history
+    bool world;                             ///< Corpse and generator details
+    bool creatureList;                      ///< A row for every living creature
+    int selectedCreature;                   ///< Sequential ID to copy in full, -1 for none
+
+    PanelRequest()
+        : history(false), historyTier(SeriesTier::Tick), metrics(false)
+        , world(false), creatureList(false), selectedCreature(-1) {}
+
+    bool operator==(const PanelRequest& other) const {
+        return history == other.history && historyTier == other.historyTier &&
+               metrics == other.metrics && world == other.world &&
+               creatureList == other.creatureList && selectedCreature == other.selectedCreature;
+    }
+    bool operator!=(const PanelRequest& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief A creature as listed in the creature panel
+ */
+struct CreatureRow {
+    int id;                                 ///< Sequential creature ID
+    int tileX;
+    int tileY;
+    unsigned int age;
+    unsigned int lifespan;
+    float hunger;                           ///< Needs on a 0-10 scale
+    float thirst;
+    float fatigue;
+    float mate;
+    EcoSim::Genetics::Motivation motivation;
+    EcoSim::Genetics::DietType diet;        ///< Emergent diet from the phenotype
+};
+
+/**
+ * @brief The creature shown in the inspector
+ *
+ * traits holds every trait the phenotype expresses; trait() returns 0 for
+ * any other, as Phenotype::getTrait() does.
+ */
+struct CreatureDetails : CreatureRow {
+    std::string label;                      ///< Common name with biome prefix
+    std::string scientificName;
+    float worldX;
+    float worldY;
+    EcoSim::Genetics::Action action;
+    float health;
+    float maxHealth;
+    float healthPercent;
+    EcoSim::Genetics::WoundState woundState;
+    float woundSeverity;
+    float healingRate;
+    float metabolism;
+    float maintenanceCost;                  ///< Total phenotype maintenance per tick
+    unsigned int speed;
+    bool inCombat;
+    bool fleeing;
+    int targetId;
+    int combatCooldown;
+    std::unordered_map<std::string, float> traits;
+
+    float trait(const std::string& traitId) const {
+        auto it = traits.find(traitId);
+        return it != traits.end() ? it->second : 0.0f;
+    }
+};
+
+/**
+ * @brief World panel details
+ */
+struct WorldDetails {
+    std::size_t corpses;
+    float averageDecay;                     ///< Mean corpse decay, 0 without corpses
+    EcoSim::MapGen mapGen;
+    EcoSim::OctaveGen octaveGen;
+    const EcoSim::WorldOverview* overview;  ///< Terrain fields only, as for RenderSnapshot::terrain
+};
+
+/**
+ * @brief What the HUD panels show, copied on the simulation thread
+ *
+ * Only the parts named in request are filled; the rest keep whatever an
+ * earlier snapshot left in them.
+ */
+struct HUDPanels {
+    PanelRequest request;                   ///< What the fields below were filled for
+    SeriesRing history;                     ///< request.historyTier of the statistics series
+    logging::TickMetrics::History metrics;
+    WorldDetails world;
+    std::vector<CreatureRow> creatures;
+    bool hasSelected;                       ///< False once the selected creature is gone
+    CreatureDetails selected;
+
+    HUDPanels() : history(0), world(), hasSelected(false), selected() {}
+};
+
+/**
+ * @brief Everything a renderer needs to draw one frame of the running game
+ */
+struct RenderSnapshot {
+    std::uint64_t sequence;                 ///< Increases with every published snapshot
+    unsigned int tick;                      ///< Simulation tick the snapshot was taken after
+
+    // Terrain (see file comment for what may be read through the pointer)
+    const EcoSim::WorldGrid* terrain;       ///< Grid whose terrain fields may be read, or nullptr
+    unsigned int worldWidth;
+    unsigned int worldHeight;
+    std::uint64_t terrainRevision;          ///< World::getTerrainRevision() at capture
+
+    // Entities within the captured region
+    Viewport region;                        ///< Area the sprites were collected from
+    std::vector<PlantSprite> plants;
+    std::vector<CorpseSprite> corpses;
+    std::vector<CreatureSprite> creatures;
+
+    // Overview cells within the captured region (only when region.overviewLevel >= 0)
+    unsigned int overviewBlock;             ///< Tiles along each side of a copied cell
+    int overviewCellX;                      ///< Level cell coordinates of the first copied cell
+    int overviewCellY;
+    unsigned int overviewCols;
+    unsigned int overviewRows;
+    std::vector<EcoSim::WorldOverview::Cell> overview;   ///< Row-major, overviewCols x overviewRows
+
+    // HUD numbers (panels is left null) and the panel contents it may point at
+    HUDData hud;
+    HUDPanels panels;
+
+    RenderSnapshot()
+        : sequence(0), tick(0)
+        , terrain(nullptr), worldWidth(0), worldHeight(0)
+        , terrainRevision(0)
+        , overviewBlock(0), overviewCellX(0), overviewCellY(0), overviewCols(0), overviewRows(0) {}
+};
+
+/**
+ * @brief Fill a snapshot from the live world
+ *
+ * Must be called by whichever thread owns the world (or under its lock).
+ * Containers are cleared and refilled so their capacity is reused.
+ *
+ * @param world World to copy from
+ * @param creatures Live creature list
+ * @param region Area to collect plants, corpses and creatures from
+ *        (clipped to the world; callers usually pad the viewport), or the
+ *        overview cells when region.overviewLevel >= 0
+ * @param out Snapshot to fill (sequence, tick and hud are left to the caller)
+ */
+void captureRenderSnapshot(const World& world,
+                           const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures,
+                           const Viewport& region,
+                           RenderSnapshot& out);
+
+/**
+ * @brief Fill the HUD panels a renderer asked for
+ *
+ * Same threading rule as captureRenderSnapshot().
+ *
+ * @param world World to copy from
+ * @param creatures Live creature list
+ * @param series Long-run statistics history
+ * @param metrics Tick metrics history
+ * @param request Panels to fill
+ * @param out Panels to fill; containers keep their capacity
+ */
+void captureHUDPanels(const World& world,
+                      const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures,
+                      const TimeSeriesStore& series,
+                      const logging::TickMetrics::History& metrics,
+                      const PanelRequest& request,
+                      HUDPanels& out);
+
+#endif // ECOSIM_RENDER_SNAPSHOT_HPP
@@ -14,6 +14,8 @@
 
 #include <string>
 
+struct HUDPanels;
+
 /**
  * @brief Terrain type enumeration for tile classification
  * 
@@ -148,15 +150,18 @@ struct Viewport {
     unsigned int height;    ///< Viewport height in tiles
     unsigned int screenX;   ///< Screen X position to start rendering (pixels or chars)
     unsigned int screenY;   ///< Screen Y position to start rendering (pixels or chars)
+    int overviewLevel;      ///< WorldOverview level drawn instead of tiles, or -1
     
     /** @brief Default constructor */
     Viewport() 
-        : originX(0), originY(0), width(0), height(0), screenX(0), screenY(0) {}
+        : originX(0), originY(0), width(0), height(0), screenX(0), screenY(0)
+        , overviewLevel(-1) {}
     
     /** @brief Construct viewport with all parameters */
     Viewport(int ox, int oy, unsigned int w, unsigned int h, 
-             unsigned int sx, unsigned int sy)
-        : originX(ox), originY(oy), width(w), height(h), screenX(sx), screenY(sy) {}
+             unsigned int sx, unsigned int sy, int level = -1)
+        : originX(ox), originY(oy), width(w), height(h), screenX(sx), screenY(sy)
+        , overviewLevel(level) {}
 };
 
 /**
@@ -195,13 +200,17 @@ struct HUDData {
     // Simulation state
     unsigned int tickRate;      ///< Current simulation tick rate
     bool paused;                ///< Whether simulation is paused
+    std::string statusMessage;  ///< Short notice for the status line, empty for none
+    
+    // Panel contents (optional, owned by the RenderSnapshot being drawn)
+    const HUDPanels* panels;    ///< History, metrics and inspection data, or nullptr
     
     /** @brief Default constructor */
     HUDData() 
         : population(0), births(0), foodEaten(0), deaths()
         , timeString(""), dateString("")
         , worldWidth(0), worldHeight(0), viewportX(0), viewportY(0)
-        , tickRate(1), paused(false) {}
+        , tickRate(1), paused(false), statusMessage(""), panels(nullptr) {}
 };
 
 /**
@@ -13,6 +13,7 @@
 
 #include "../../../rendering/IRenderer.hpp"
 #include "../../../rendering/RenderTypes.hpp"
+#include "NCursesScreenBuffer.hpp"
 #include <string>
 #include <vector>
 
@@ -72,14 +73,16 @@ public:
     /**
      * @brief Begin a new rendering frame
      * 
-     * Clears the screen using erase().
+     * Clears the shadow screen buffer that this frame is composed into.
+     * Picks up terminal resizes.
      */
     void beginFrame() override;
     
     /**
      * @brief End frame and present to display
      * 
-     * Calls refresh() to update the terminal.
+     * Writes the cells that changed since the last frame to stdscr, then
+     * calls refresh() to update the terminal.
      */
     void endFrame() override;
 
@@ -124,6 +127,14 @@ public:
      */
     void renderCreature(const EcoSim::Genetics::Organism& creature,
                        int screenX, int screenY) override;
+    
+    /**
+     * @brief Render terrain, plants and creatures from a snapshot
+     * 
+     * @param snapshot Snapshot published by the simulation thread
+     * @param viewport The viewport configuration
+     */
+    void renderSnapshot(const RenderSnapshot& snapshot, const Viewport& viewport) override;
 
     //==========================================================================
     // UI Rendering Methods
@@ -243,6 +254,7 @@ private:
     int _rows;
     int _cols;
     bool _hasColors;
+    NCursesScreenBuffer _screen;
     
     // UI layout constants
     static constexpr unsigned int MAP_HORI_BORDER = 2;
@@ -250,6 +262,7 @@ private:
     
     // Helper methods
     void printCentered(const std::string& str, int y);
+    void printAt(int y, int x, const char* format, ...);
     int getColorPairForProfile(const EcoSim::Genetics::Organism& creature) const;
 };
 
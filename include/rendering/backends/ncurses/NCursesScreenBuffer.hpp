@@ -0,0 +1,107 @@
+/**
+ * @file NCursesScreenBuffer.hpp
+ * @brief Shadow screen buffer for incremental ncurses redraws
+ * @author Gary Ferguson
+ * @date October 2026
+ *
+ * The renderer composes each frame into this buffer instead of drawing to
+ * stdscr directly. flush() compares the frame with what was written last
+ * time and only sends the cells that changed, so the work done per frame
+ * (and the bytes sent to the terminal) follows how much of the screen
+ * actually changed rather than the size of the viewport.
+ */
+
+#ifndef ECOSIM_NCURSES_SCREEN_BUFFER_HPP
+#define ECOSIM_NCURSES_SCREEN_BUFFER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Double-buffered (glyph, color pair) grid diffed against stdscr
+ *
+ * The back buffer holds the frame being composed; the front buffer holds
+ * what stdscr is known to contain. Cells outside the screen are clipped.
+ */
+class NCursesScreenBuffer {
+public:
+    NCursesScreenBuffer();
+
+    /**
+     * @brief Resize both buffers to the screen size
+     *
+     * The front buffer is invalidated, so the next flush rewrites everything.
+     */
+    void resize(int rows, int cols);
+
+    /**
+     * @brief Blank the back buffer at the start of a frame
+     */
+    void clear();
+
+    /**
+     * @brief Set a single cell of the back buffer
+     */
+    void put(int y, int x, char glyph, short pair = 0);
+
+    /**
+     * @brief Write a string into the back buffer starting at (y, x)
+     */
+    void putText(int y, int x, const std::string& text, short pair = 0);
+
+    /**
+     * @brief Forget what stdscr contains
+     *
+     * Call after anything else has drawn to or cleared stdscr (e.g. a modal
+     * menu), so the next flush rewrites every cell.
+     */
+    void invalidate();
+
+    /**
+     * @brief Write changed cells to stdscr
+     *
+     * Consecutive changed cells on a row that share a color pair are sent
+     * as one string. Does not call refresh().
+     *
+     * @return Number of cells written
+     */
+    std::size_t flush();
+
+    /**
+     * @brief Number of cells written by the last flush()
+     */
+    std::size_t lastFlushCells() const { return _lastFlushCells; }
+
+    int rows() const { return _rows; }
+    int cols() const { return _cols; }
+
+private:
+    struct Cell {
+        char glyph;
+        short pair;
+
+        bool operator==(const Cell& other) const {
+            return glyph == other.glyph && pair == other.pair;
+        }
+        bool operator!=(const Cell& other) const { return !(*this == other); }
+    };
+
+    static constexpr Cell BLANK = {' ', 0};
+    // Never produced by put(), so every cell compares as changed
+    static constexpr Cell UNKNOWN = {'\0', -1};
+
+    std::size_t index(int y, int x) const {
+        return static_cast<std::size_t>(y) * static_cast<std::size_t>(_cols) +
+               static_cast<std::size_t>(x);
+    }
+
+    int _rows;
+    int _cols;
+    std::vector<Cell> _back;
+    std::vector<Cell> _front;
+    std::string _run;
+    std::size_t _lastFlushCells;
+};
+
+#endif // ECOSIM_NCURSES_SCREEN_BUFFER_HPP
@@ -13,21 +13,23 @@
 #define ECOSIM_IMGUI_OVERLAY_HPP
 
 #include <SDL.h>
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
 #include <functional>
 #include "../../RenderTypes.hpp"
+#include "../../RenderSnapshot.hpp"
+#include "logging/TickMetrics.hpp"
 
 // Forward declarations
 struct ImGuiContext;
-class World;
 class Creature;
 struct SaveFileInfo; // Defined in IRenderer.hpp
 
 namespace EcoSim {
+class WorldOverview;
 namespace Genetics {
-    class Organism;
     class Plant;
     enum class DietType;
 }
@@ -104,13 +106,17 @@ public:
     /**
      * @brief Render all ImGui windows with simulation data
      *
-     * @param hudData HUD data containing simulation statistics
-     * @param world Optional world pointer for additional info
-     * @param creatures Optional pointer to creatures vector for creature panels
+     * The inspection windows draw from hudData.panels; a window whose data
+     * the snapshot has not copied yet shows a placeholder for that frame.
+     *
+     * @param hudData HUD data containing simulation statistics and panels
+     */
+    void render(const HUDData& hudData);
+    
+    /**
+     * @brief The panels whose data render() needs in the next snapshot
      */
-    void render(const HUDData& hudData,
-                const World* world = nullptr,
-                const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures = nullptr);
+    PanelRequest panelRequest() const;
     
     /**
      * @brief End ImGui frame and render draw data
@@ -243,6 +249,13 @@ public:
      */
     void clearCenterRequest() { _pendingCenterX = -1; _pendingCenterY = -1; }
     
+    /**
+     * @brief Set the region of the world currently on screen
+     *
+     * Drawn as a rectangle on the minimap.
+     */
+    void setViewport(const Viewport& viewport) { _viewport = viewport; }
+    
     //==========================================================================
     // Menu Methods (Unified Start/Pause Menu System)
     //==========================================================================
@@ -458,6 +471,14 @@ private:
     float _frameTimes[FRAME_TIME_HISTORY_SIZE];
     int _frameTimeIndex;
     
+    // Tick metrics scratch space, so the dashboard never allocates
+    static constexpr int TICK_HISTOGRAM_BINS = 24;
+    std::array<float, logging::TickMetrics::HISTORY_SIZE> _tickTimesSorted;
+    std::array<float, TICK_HISTOGRAM_BINS> _tickHistogram;
+    
+    // Minimap resolution: cells along the longer side of the world
+    static constexpr unsigned int MINIMAP_MIN_CELLS = 48;
+    
     // Population dynamics history for graphing
     static constexpr int HISTORY_SIZE = 120;
     float _populationHistory[HISTORY_SIZE];
@@ -465,6 +486,9 @@ private:
     float _deathsHistory[HISTORY_SIZE];
     int _historyIndex;
     
+    // Resolution tier shown in the long-run history graph (SeriesTier index)
+    int _historyTier = 1;
+    
     // Previous frame cumulative values for delta calculation
     unsigned int _lastBirths;
     unsigned int _lastDeaths;
@@ -473,6 +497,9 @@ private:
     int _pendingCenterX;
     int _pendingCenterY;
     
+    // World region on screen, outlined on the minimap
+    Viewport _viewport;
+    
     // Unified menu state (replaces _showPauseMenu)
     MenuMode _menuMode = MenuMode::NONE;
     bool _shouldQuit = false;
@@ -518,27 +545,54 @@ private:
     
     /**
      * @brief Render the world information window
-     * @param world World pointer (can be null)
-     * @param creatures Creatures pointer for population stats
+     * @param hudData HUD data for the world size
+     * @param world World details copied by the snapshot (can be null)
+     */
+    void renderWorldInfoWindow(const HUDData& hudData, const WorldDetails* world);
+    
+    /**
+     * @brief Render the minimap: overview terrain plus the on-screen region
+     *
+     * Clicking it requests the view be centered on that point.
      */
-    void renderWorldInfoWindow(const World* world, const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures = nullptr);
+    void renderMinimap(const EcoSim::WorldOverview& overview);
     
     /**
      * @brief Render the performance metrics window
+     * @param metrics Tick metrics copied by the snapshot (can be null)
+     */
+    void renderPerformanceWindow(const logging::TickMetrics::History* metrics);
+    
+    /**
+     * @brief Render tick duration percentiles and histogram
+     */
+    void renderTickTimeSection(const logging::TickMetrics::History& metrics);
+    
+    /**
+     * @brief Render the phase flame graph and per-tick stacked bars
+     *
+     * The flame graph shows the mean tick over the history: phases in the
+     * order they run, with behavior costs beneath creature turns.
+     */
+    void renderPhaseSection(const logging::TickMetrics::History& metrics);
+    
+    /**
+     * @brief Render behavior, pathfinding, spatial index, allocation and
+     *        memory counters
      */
-    void renderPerformanceWindow();
+    void renderCounterSections(const logging::TickMetrics::History& metrics);
     
     /**
      * @brief Render the creature list window
-     * @param creatures Pointer to creatures vector
+     * @param creatures Rows copied by the snapshot (can be null)
      */
-    void renderCreatureListWindow(const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures);
+    void renderCreatureListWindow(const std::vector<CreatureRow>* creatures);
     
     /**
      * @brief Render the creature inspector window
-     * @param creature Pointer to the selected creature
+     * @param creature Details of the selected creature copied by the snapshot
      */
-    void renderCreatureInspectorWindow(const EcoSim::Genetics::Organism* creature);
+    void renderCreatureInspectorWindow(const CreatureDetails* creature);
     
     /**
      * @brief Render the controls panel
@@ -0,0 +1,70 @@
+/**
+ * @file SDL2BitmapFont.hpp
+ * @brief Built-in 5x7 bitmap font rasterized into a texture atlas
+ *
+ * The 128 ASCII glyphs are rasterized once into a white-on-transparent
+ * atlas, so a glyph is one textured quad whose color comes from vertex
+ * modulation rather than up to 35 filled rectangles. Text is queued into an
+ * SDL2GeometryBatch and a whole string is drawn with one call.
+ */
+
+#ifndef ECOSIM_SDL2_BITMAP_FONT_HPP
+#define ECOSIM_SDL2_BITMAP_FONT_HPP
+
+#include "SDL2GeometryBatch.hpp"
+#include <SDL.h>
+#include <string>
+
+/**
+ * @brief Owner of the font atlas texture
+ */
+class SDL2BitmapFont {
+public:
+    static constexpr int GLYPH_WIDTH = 5;
+    static constexpr int GLYPH_HEIGHT = 7;
+    static constexpr int GLYPH_SPACING = 1;   // Columns between characters
+
+    SDL2BitmapFont();
+    ~SDL2BitmapFont();
+
+    SDL2BitmapFont(const SDL2BitmapFont&) = delete;
+    SDL2BitmapFont& operator=(const SDL2BitmapFont&) = delete;
+
+    /**
+     * @brief Rasterize the glyphs into an atlas on the given renderer
+     * @return true if the atlas texture was created
+     */
+    bool create(SDL_Renderer* renderer);
+
+    /**
+     * @brief Destroy the atlas texture
+     */
+    void destroy();
+
+    /**
+     * @brief Atlas texture, or nullptr if create() failed or was not called
+     */
+    SDL_Texture* texture() const { return _atlas; }
+
+    /**
+     * @brief Queue a string into a batch
+     *
+     * With an atlas each glyph is one textured quad and the batch must be
+     * flushed with texture(). Without one, lit glyph pixels are queued as
+     * solid quads and the batch is flushed without a texture.
+     *
+     * @param batch Batch to add quads to
+     * @param text Text to draw (characters above 127 draw as '?')
+     * @param x Left edge in pixels
+     * @param y Top edge in pixels
+     * @param color Text color
+     * @param scale Pixels per glyph pixel
+     */
+    void queueText(SDL2GeometryBatch& batch, const std::string& text,
+                   int x, int y, SDL_Color color, int scale) const;
+
+private:
+    SDL_Texture* _atlas;
+};
+
+#endif // ECOSIM_SDL2_BITMAP_FONT_HPP
@@ -16,6 +16,7 @@
 
 // Forward declarations
 class Creature;
+class Tile;
 namespace EcoSim { namespace Genetics { class Organism; } }
 
 #include "genetics/core/MotivationAction.hpp"
@@ -72,6 +73,17 @@ public:
      * @return SDL_Color blended between shallow and deep colors for that water type
      */
     static SDL_Color waterToColor(float depth, WaterType type);
+    
+    /**
+     * @brief Terrain color of a tile
+     *
+     * Water tiles are shaded by depth, with sources (lakes and rivers) using
+     * the freshwater palettes; other tiles use terrainToColor().
+     *
+     * @param tile The tile to color
+     * @return SDL_Color for the tile's terrain
+     */
+    static SDL_Color tileToColor(const Tile& tile);
 
     //==========================================================================
     // Entity Color Mapping
@@ -0,0 +1,68 @@
+/**
+ * @file SDL2GeometryBatch.hpp
+ * @brief Accumulates quads and submits them with one SDL_RenderGeometry call
+ *
+ * Every SDL_RenderFillRect is a separate draw call, which limits how many
+ * plants, corpses and creatures can be drawn per frame. A batch collects
+ * the quads of a whole layer into vertex and index buffers and submits them
+ * together. Quads are drawn in the order they were added, so overlapping
+ * shapes layer the same way the individual calls did.
+ *
+ * Requires SDL 2.0.18 or newer (as does the ImGui SDL renderer backend).
+ */
+
+#ifndef ECOSIM_SDL2_GEOMETRY_BATCH_HPP
+#define ECOSIM_SDL2_GEOMETRY_BATCH_HPP
+
+#include <SDL.h>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Vertex/index buffers of colored and textured quads
+ */
+class SDL2GeometryBatch {
+public:
+    /**
+     * @brief Add a solid rectangle
+     */
+    void fillRect(int x, int y, int w, int h, SDL_Color color);
+
+    /**
+     * @brief Add a one pixel wide rectangle outline (same pixels as SDL_RenderDrawRect)
+     */
+    void outlineRect(int x, int y, int w, int h, SDL_Color color);
+
+    /**
+     * @brief Add a textured rectangle
+     *
+     * @param dst Destination in pixels
+     * @param u0 Left texture coordinate (0-1)
+     * @param v0 Top texture coordinate (0-1)
+     * @param u1 Right texture coordinate (0-1)
+     * @param v1 Bottom texture coordinate (0-1)
+     * @param color Color the texture is modulated by
+     */
+    void texturedRect(const SDL_Rect& dst, float u0, float v0, float u1, float v1,
+                      SDL_Color color);
+
+    /**
+     * @brief Submit all queued quads and empty the batch
+     *
+     * @param renderer Renderer to draw with
+     * @param texture Texture for textured quads, or nullptr for solid ones
+     */
+    void flush(SDL_Renderer* renderer, SDL_Texture* texture = nullptr);
+
+    bool empty() const { return _vertices.empty(); }
+    std::size_t quadCount() const { return _vertices.size() / 4; }
+
+private:
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices;
+
+    void addQuad(float x0, float y0, float x1, float y1, SDL_Color color,
+                 float u0, float v0, float u1, float v1);
+};
+
+#endif // ECOSIM_SDL2_GEOMETRY_BATCH_HPP
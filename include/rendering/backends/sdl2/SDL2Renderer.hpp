@@ -13,6 +13,9 @@
 
 #include "../../../rendering/IRenderer.hpp"
 #include "../../../rendering/RenderTypes.hpp"
+#include "SDL2TerrainCache.hpp"
+#include "SDL2GeometryBatch.hpp"
+#include "SDL2BitmapFont.hpp"
 #include <SDL.h>
 #include <string>
 #include <vector>
@@ -38,6 +41,8 @@ class ImGuiOverlay;
  * - Full color support (32-bit RGBA)
  * - Mouse input support
  * - Scalable tile size
+ * - Terrain pre-rendered into chunk textures (SDL2TerrainCache)
+ * - Entities and text submitted in batches (SDL2GeometryBatch, SDL2BitmapFont)
  * - HUD display with simulation statistics
  * - Menu rendering with keyboard/mouse navigation
  */
@@ -94,7 +99,8 @@ public:
     /**
      * @brief Render the world grid within the viewport
      * 
-     * Renders terrain as colored rectangles.
+     * Blits terrain from cached chunk textures, then draws plants and
+     * corpses over it as colored shapes.
      * 
      * @param world The world to render
      * @param viewport The viewport configuration
@@ -128,6 +134,17 @@ public:
      */
     void renderCreature(const EcoSim::Genetics::Organism& creature,
                        int screenX, int screenY) override;
+    
+    /**
+     * @brief Render terrain, plants, corpses and creatures from a snapshot
+     * 
+     * Terrain comes from the chunk texture cache, which is updated from the
+     * snapshot's dirty tile list; all entities are drawn in one batch.
+     * 
+     * @param snapshot Snapshot published by the simulation thread
+     * @param viewport The viewport configuration
+     */
+    void renderSnapshot(const RenderSnapshot& snapshot, const Viewport& viewport) override;
 
     //==========================================================================
     // UI Rendering Methods
@@ -142,6 +159,11 @@ public:
      */
     void renderHUD(const HUDData& data) override;
     
+    /**
+     * @brief The ImGui panels that are open, nothing without ImGui
+     */
+    PanelRequest panelRequest() const override;
+    
     /**
      * @brief Render a menu
      * 
@@ -265,14 +287,16 @@ public:
     /**
      * @brief Zoom in (increase tile size)
      *
-     * Increases tile size by 2 pixels up to maximum.
+     * Steps back down the overview levels first, then increases tile size
+     * by 2 pixels up to maximum.
      */
     void zoomIn() override;
     
     /**
      * @brief Zoom out (decrease tile size)
      *
-     * Decreases tile size by 2 pixels down to minimum.
+     * Decreases tile size by 2 pixels down to minimum, then switches to
+     * the world overview and steps up its levels.
      */
     void zoomOut() override;
     
@@ -283,6 +307,11 @@ public:
      */
     int getZoomLevel() const override { return _tileSize; }
     
+    /**
+     * @brief Get the WorldOverview level drawn, or -1 when drawing tiles
+     */
+    int getOverviewLevel() const override { return _overviewLevel; }
+    
     /**
      * @brief Check if there's a pending viewport center request from ImGui
      *
@@ -467,14 +496,11 @@ public:
                                int screenX, int screenY);
     
     /**
-     * @brief Render ImGui overlay with creature data
+     * @brief Render ImGui overlay
      *
-     * Should be called after creatures are rendered so ImGui has access to creature data
-     *
-     * @param data HUD data structure
-     * @param world World pointer for world info
+     * @param data HUD data structure; its panels feed the inspection windows
      */
-    void renderImGuiOverlay(const HUDData& data, const World* world = nullptr);
+    void renderImGuiOverlay(const HUDData& data);
 
 private:
     // SDL2 objects
@@ -484,32 +510,49 @@ private:
     // ImGui overlay
     ImGuiOverlay* _imguiOverlay;
     
-    // Current creatures reference for ImGui
-    const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* _currentCreatures;
+    // Pre-rendered terrain layer
+    SDL2TerrainCache _terrainCache;
     
-    // Current world reference for ImGui
-    const World* _currentWorld;
+    // Batched geometry for entities and text
+    SDL2GeometryBatch _entityBatch;
+    SDL2GeometryBatch _textBatch;
+    SDL2BitmapFont _font;
     
     // Screen state
     bool _initialized;
     int _screenWidth;
     int _screenHeight;
     int _tileSize;  // Pixels per tile
+    int _overviewLevel;  // WorldOverview level drawn past MIN_TILE_SIZE, or -1
     
     // UI layout constants
     static constexpr int DEFAULT_TILE_SIZE = 8;      // Smaller for more zoomed-out default view
     static constexpr int MIN_TILE_SIZE = 4;          // Minimum zoom (most zoomed out)
     static constexpr int MAX_TILE_SIZE = 32;         // Maximum zoom (most zoomed in)
+    static constexpr int OVERVIEW_CELL_SIZE = 8;     // Pixels per overview cell (level 0: 1 tile per pixel)
+    static constexpr int MAX_OVERVIEW_LEVEL = 6;     // 512 tiles per overview cell
     static constexpr int DEFAULT_SCREEN_WIDTH = 1920;  // Will be overridden by display mode
     static constexpr int DEFAULT_SCREEN_HEIGHT = 1080; // Will be overridden by display mode
     static constexpr int HUD_HEIGHT = 150;
     static constexpr int HUD_PADDING = 10;
+    static constexpr int TEXT_SCALE = 2;             // Screen pixels per font pixel
     
     // Helper methods for rendering
     void drawFilledRect(int x, int y, int w, int h, SDL_Color color);
     void drawRect(int x, int y, int w, int h, SDL_Color color);
     void drawText(const std::string& text, int x, int y, SDL_Color color);
     
+    // Queue shapes into _entityBatch (caller flushes)
+    void queueCreature(SDL_Color creatureColor, int screenX, int screenY);
+    void queueSelectedCreature(SDL_Color creatureColor, int screenX, int screenY);
+    void queuePlant(EntityType type, int screenX, int screenY);
+    void queueCorpse(float decay, int pixelX, int pixelY);
+    void queueOverviewCell(const EcoSim::WorldOverview::Cell& cell, unsigned int blockTiles,
+                           int pixelX, int pixelY, int size);
+    
+    // Pixels per tile, fractional when the overview is drawn
+    float pixelsPerTile() const;
+    
     // Color helper methods
     SDL_Color getTerrainColor(TerrainType terrain) const;
     SDL_Color getProfileColor(BehaviorProfile profile) const;
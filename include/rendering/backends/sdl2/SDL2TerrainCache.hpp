@@ -0,0 +1,142 @@
+/**
+ * @file SDL2TerrainCache.hpp
+ * @brief Pre-rendered terrain textures for the SDL2 renderer
+ *
+ * Terrain almost never changes, yet drawing it tile by tile costs one
+ * SDL_RenderFillRect per visible tile per frame. The cache instead bakes
+ * the terrain into one texture per CHUNK_TILES x CHUNK_TILES block of the
+ * world, with one texel per tile, and blits the visible chunks scaled up to
+ * the current tile size with nearest filtering. The same textures therefore
+ * serve every zoom level, and a frame costs one copy per visible chunk.
+ *
+ * Chunks are baked lazily the first time they are visible. The cache
+ * follows World's terrain revision, taken from the world or from a
+ * RenderSnapshot: a new revision means the world was regenerated, so every
+ * chunk is rebaked when it is next visible.
+ */
+
+#ifndef ECOSIM_SDL2_TERRAIN_CACHE_HPP
+#define ECOSIM_SDL2_TERRAIN_CACHE_HPP
+
+#include "../../../rendering/RenderTypes.hpp"
+#include "../../../rendering/RenderSnapshot.hpp"
+#include <SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Forward declarations
+class World;
+namespace EcoSim { class WorldGrid; }
+
+/**
+ * @brief Chunked texture cache of a world's terrain layer
+ */
+class SDL2TerrainCache {
+public:
+    static constexpr unsigned int CHUNK_TILES = 64;   // Tiles along each side of a chunk texture
+
+    SDL2TerrainCache();
+    ~SDL2TerrainCache();
+
+    SDL2TerrainCache(const SDL2TerrainCache&) = delete;
+    SDL2TerrainCache& operator=(const SDL2TerrainCache&) = delete;
+
+    /**
+     * @brief Set the renderer textures are created on
+     *
+     * Releases any textures created on a previous renderer.
+     */
+    void setRenderer(SDL_Renderer* renderer);
+
+    /**
+     * @brief Draw the terrain inside the viewport
+     *
+     * @param world The world to draw
+     * @param viewport The viewport configuration (tile units)
+     * @param tileSize Pixels per tile
+     * @param baseScreenX Pixel X of the viewport origin
+     * @param baseScreenY Pixel Y of the viewport origin
+     */
+    void render(const World& world, const Viewport& viewport,
+                int tileSize, int baseScreenX, int baseScreenY);
+
+    /**
+     * @brief Draw the terrain inside the viewport from a simulation snapshot
+     *
+     * Reads terrain through the snapshot's grid and applies its dirty tiles.
+     *
+     * @param snapshot Snapshot published by the simulation thread
+     * @param viewport The viewport configuration (tile units)
+     * @param tileSize Pixels per tile
+     * @param baseScreenX Pixel X of the viewport origin
+     * @param baseScreenY Pixel Y of the viewport origin
+     */
+    void render(const RenderSnapshot& snapshot, const Viewport& viewport,
+                int tileSize, int baseScreenX, int baseScreenY);
+
+    /**
+     * @brief Match the cache to the world's size and terrain revision
+     *
+     * render() does this itself; call it directly to keep up with terrain
+     * regeneration while something else is drawn (e.g. the world overview).
+     */
+    void sync(const World& world);
+
+    /**
+     * @brief Match the cache to a snapshot's grid and terrain revision
+     */
+    void sync(const RenderSnapshot& snapshot);
+
+    /**
+     * @brief Destroy all textures; they are rebaked when next visible
+     */
+    void clear();
+
+    /**
+     * @brief Number of chunks currently baked into textures
+     */
+    std::size_t bakedChunkCount() const;
+
+private:
+    struct ChunkTexture {
+        SDL_Texture* texture = nullptr;
+        bool dirty = true;
+    };
+
+    SDL_Renderer* _renderer;
+    const EcoSim::WorldGrid* _grid;      // Grid the chunks were baked from
+    std::uint64_t _terrainRevision;
+    unsigned int _worldWidth;
+    unsigned int _worldHeight;
+    unsigned int _chunksX;
+    unsigned int _chunksY;
+    std::vector<ChunkTexture> _chunks;   // Row-major by chunk coordinates
+    std::vector<Uint32> _pixels;         // Staging buffer for one chunk
+
+    /**
+     * @brief Start over for a different grid or size
+     * @return true if the cache was reset
+     */
+    bool reset(const EcoSim::WorldGrid* grid, unsigned int width, unsigned int height,
+               std::uint64_t revision);
+
+    /**
+     * @brief Mark every chunk for rebaking
+     */
+    void markAllDirty();
+
+    /**
+     * @brief Blit the visible chunks, baking any that are dirty
+     */
+    void draw(const EcoSim::WorldGrid& grid, const Viewport& viewport,
+              int tileSize, int baseScreenX, int baseScreenY);
+
+    /**
+     * @brief Upload the terrain colors of one chunk into its texture
+     * @return false if the texture could not be created
+     */
+    bool bake(const EcoSim::WorldGrid& grid, unsigned int cx, unsigned int cy, ChunkTexture& chunk);
+};
+
+#endif // ECOSIM_SDL2_TERRAIN_CACHE_HPP
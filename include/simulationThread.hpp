@@ -0,0 +1,332 @@
+/**
+ * @file simulationThread.hpp
+ * @brief Runs the simulation on its own thread and publishes render snapshots
+ * @author Gary Ferguson
+ *
+ * The game loop used to poll input, advance the simulation and render on one
+ * thread, so a slow tick (a breeding boom, a daily statistics dump) froze the
+ * window and every frame drawn was time taken from the simulation.
+ * SimulationThread moves the fixed-timestep tick loop onto a thread of its
+ * own. After every tick it captures a RenderSnapshot into a triple buffer,
+ * and the main thread draws whichever snapshot is newest at display rate.
+ *
+ * Key concepts:
+ * - Ticks run at a fixed rate using the same GameClock as before
+ * - The world belongs to the simulation thread. Anything else that reads or
+ *   changes it (saving, loading, adding creatures) goes through withWorld(),
+ *   which waits for the tick in progress to finish and holds the next one
+ *   back until the callback returns
+ * - HUD panels read copies the capture makes after each tick; the render
+ *   thread names the ones it has open with setPanelRequest()
+ * - setViewRegion(), setPanelRequest() and requestSnapshot() make the thread
+ *   publish a fresh snapshot even while paused, so scrolling a paused world
+ *   still updates
+ *
+ * Usage:
+ * @code
+ * EcoSim::SimulationThread sim(tickMs, [&]() { advance(); },
+ *     [&](RenderSnapshot& s, const Viewport& region, const PanelRequest&) {
+ *         captureRenderSnapshot(world, creatures, region, s);
+ *     });
+ * sim.start();
+ * while (running) {
+ *     sim.setViewRegion(viewport);
+ *     sim.updateSnapshot();
+ *     renderer.renderSnapshot(sim.snapshot(), viewport);
+ * }
+ * sim.stop();
+ * @endcode
+ */
+
+#ifndef ECOSIM_SIMULATION_THREAD_HPP
+#define ECOSIM_SIMULATION_THREAD_HPP
+
+#include "timing.hpp"
+#include "tripleBuffer.hpp"
+#include "rendering/RenderSnapshot.hpp"
+#include "logging/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace EcoSim {
+
+/**
+ * @brief Fixed-timestep simulation loop running on a background thread
+ *
+ * @note Thread Safety: every public method is meant for the one thread that
+ * owns the SimulationThread (the main/render thread). The tick and capture
+ * callbacks run on the simulation thread, never concurrently with withWorld().
+ */
+class SimulationThread {
+public:
+    /// Advances the simulation by one tick
+    using TickFunction = std::function<void()>;
+
+    /// Fills a snapshot for the given region and HUD panels
+    using CaptureFunction = std::function<void(RenderSnapshot& snapshot,
+                                               const Viewport& region,
+                                               const PanelRequest& panels)>;
+
+    /**
+     * @param tickDurationMs Time per simulation tick
+     * @param tick Called once per tick on the simulation thread
+     * @param capture Called after each tick (and on request) to fill a snapshot
+     */
+    SimulationThread(double tickDurationMs, TickFunction tick, CaptureFunction capture)
+        : tickDurationMs_(tickDurationMs)
+        , tick_(std::move(tick))
+        , capture_(std::move(capture)) {}
+
+    ~SimulationThread() {
+        stop();
+    }
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    //==========================================================================
+    // Lifecycle
+    //==========================================================================
+
+    /**
+     * @brief Start ticking; a first snapshot is published straight away
+     */
+    void start() {
+        if (thread_.joinable()) {
+            return;
+        }
+        stopping_ = false;
+        refresh_ = true;
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    /**
+     * @brief Finish the tick in progress and join the thread
+     */
+    void stop() {
+        if (!thread_.joinable()) {
+            return;
+        }
+        stopping_ = true;
+        wake();
+        thread_.join();
+    }
+
+    bool isRunning() const { return thread_.joinable(); }
+
+    //==========================================================================
+    // Control
+    //==========================================================================
+
+    /**
+     * @brief Pause or resume ticking
+     *
+     * Time spent paused is discarded rather than caught up on resume.
+     */
+    void setPaused(bool paused) {
+        if (paused_.exchange(paused) != paused) {
+            wake();
+        }
+    }
+
+    bool isPaused() const { return paused_; }
+
+    /**
+     * @brief Area snapshots collect entities from
+     *
+     * Publishes a new snapshot if the region changed.
+     */
+    void setViewRegion(const Viewport& region) {
+        {
+            std::lock_guard<std::mutex> lock(requestMutex_);
+            if (region.originX == region_.originX && region.originY == region_.originY &&
+                region.width == region_.width && region.height == region_.height &&
+                region.overviewLevel == region_.overviewLevel) {
+                return;
+            }
+            region_ = region;
+        }
+        requestSnapshot();
+    }
+
+    /**
+     * @brief HUD panels snapshots fill
+     *
+     * Publishes a new snapshot if the request changed, so a panel opened or
+     * a creature selected while paused still shows up.
+     */
+    void setPanelRequest(const PanelRequest& panels) {
+        {
+            std::lock_guard<std::mutex> lock(requestMutex_);
+            if (panels == panels_) {
+                return;
+            }
+            panels_ = panels;
+        }
+        requestSnapshot();
+    }
+
+    /**
+     * @brief Publish a new snapshot soon, even if paused
+     *
+     * Call after changing the world through withWorld().
+     */
+    void requestSnapshot() {
+        refresh_ = true;
+        wake();
+    }
+
+    /**
+     * @brief Run fn with exclusive access to the world
+     *
+     * Waits for the tick in progress (if any) and keeps the simulation from
+     * starting another until fn returns.
+     */
+    template<typename Fn>
+    void withWorld(Fn&& fn) {
+        ++waiting_;
+        {
+            std::unique_lock<std::mutex> lock(worldMutex_);
+            // Decrement before the lock is released, even if fn throws, so the
+            // simulation thread never sees a stale count after waking
+            struct Release {
+                std::atomic<int>& waiting;
+                ~Release() { --waiting; }
+            } release{waiting_};
+            fn();
+        }
+        worldFree_.notify_all();
+    }
+
+    //==========================================================================
+    // Snapshots
+    //==========================================================================
+
+    /**
+     * @brief Take the newest published snapshot
+     * @return true if snapshot() changed
+     */
+    bool updateSnapshot() { return snapshots_.update(); }
+
+    /**
+     * @brief Snapshot taken by the last updateSnapshot() (empty before the first)
+     */
+    const RenderSnapshot& snapshot() const { return snapshots_.front(); }
+
+    /**
+     * @brief Ticks run since construction
+     */
+    std::uint64_t ticksRun() const { return ticksRun_; }
+
+private:
+    /// Longest sleep while paused; requests wake the thread earlier
+    static constexpr double IDLE_WAIT_MS = 50.0;
+
+    double tickDurationMs_;
+    TickFunction tick_;
+    CaptureFunction capture_;
+
+    std::thread thread_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<bool> paused_{false};
+    std::atomic<bool> refresh_{false};
+    std::atomic<std::uint64_t> ticksRun_{0};
+    std::uint64_t sequence_ = 0;            // Simulation thread only
+
+    // World access handoff between ticks
+    std::mutex worldMutex_;
+    std::condition_variable worldFree_;
+    std::atomic<int> waiting_{0};
+
+    // Wakeups and the requested view region and panels
+    std::mutex requestMutex_;
+    std::condition_variable wakeup_;
+    bool woken_ = false;
+    Viewport region_;
+    PanelRequest panels_;
+
+    TripleBuffer<RenderSnapshot> snapshots_;
+
+    void wake() {
+        {
+            std::lock_guard<std::mutex> lock(requestMutex_);
+            woken_ = true;
+        }
+        wakeup_.notify_one();
+    }
+
+    /**
+     * @brief Lock the world, giving way to any withWorld() caller first
+     */
+    std::unique_lock<std::mutex> lockWorld() {
+        std::unique_lock<std::mutex> lock(worldMutex_);
+        worldFree_.wait(lock, [this]() { return waiting_ == 0; });
+        return lock;
+    }
+
+    void publish() {
+        Viewport region;
+        PanelRequest panels;
+        {
+            std::lock_guard<std::mutex> lock(requestMutex_);
+            region = region_;
+            panels = panels_;
+        }
+        RenderSnapshot& snapshot = snapshots_.back();
+        capture_(snapshot, region, panels);
+        snapshot.sequence = ++sequence_;
+        snapshots_.publish();
+    }
+
+    void run() {
+        logging::Profiler::getInstance().setThreadName("simulation");
+        Timing::GameClock clock(tickDurationMs_);
+        clock.start();
+
+        while (!stopping_) {
+            clock.tick();
+
+            if (paused_) {
+                // Discard time spent paused so resuming does not catch up
+                while (clock.shouldUpdate()) {
+                    clock.consumeTick();
+                }
+            } else {
+                while (clock.shouldUpdate() && !stopping_ && !paused_) {
+                    std::unique_lock<std::mutex> lock = lockWorld();
+                    tick_();
+                    ++ticksRun_;
+                    refresh_ = false;
+                    publish();
+                    clock.consumeTick();
+                }
+            }
+
+            if (refresh_.exchange(false)) {
+                std::unique_lock<std::mutex> lock = lockWorld();
+                publish();
+            }
+
+            // Sleep until the next tick is due or a request comes in
+            double waitMs = paused_
+                ? IDLE_WAIT_MS
+                : std::max(0.0, tickDurationMs_ - clock.getAccumulator());
+            std::unique_lock<std::mutex> lock(requestMutex_);
+            wakeup_.wait_for(lock, std::chrono::duration<double, std::milli>(waitMs),
+                             [this]() { return woken_; });
+            woken_ = false;
+        }
+    }
+};
+
+} // namespace EcoSim
+
+#endif // ECOSIM_SIMULATION_THREAD_HPP
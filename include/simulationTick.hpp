@@ -0,0 +1,52 @@
+/**
+ * @file simulationTick.hpp
+ * @brief One simulation tick, shared by the game and the benchmarks
+ * @author Gary Ferguson
+ *
+ * advanceSimulation() runs every phase of a tick in order: environment
+ * cache, creature spatial index, world objects, scent decay, corpses,
+ * breeding scents, creature turns, offspring and removal of the dead.
+ * Each phase is timed with ECOSIM_TICK_PHASE, so callers get the live
+ * performance dashboard and profiling zones.
+ *
+ * The game loop calls it through SimulationThread; the benchmarks call it
+ * directly so they always measure the tick the game actually runs.
+ */
+
+#ifndef ECOSIM_SIMULATION_TICK_HPP
+#define ECOSIM_SIMULATION_TICK_HPP
+
+#include "world/world.hpp"
+#include "statistics/statistics.hpp"
+#include "genetics/organisms/OrganismStore.hpp"
+
+#include <vector>
+
+/**
+ * @brief Run one creature's turn
+ *
+ * Creatures the turn scheduler holds back this tick do nothing. A creature
+ * that fails its death check is counted in gs, logged, leaves a corpse and
+ * is marked dead; removal is left to the end of the tick.
+ *
+ * @param w      The world.
+ * @param gs     Statistics for the current tick.
+ * @param c      Every creature.
+ * @param cIndex The creature taking its turn.
+ * @return True if the creature died this turn.
+ */
+bool takeTurn(World& w, GeneralStats& gs,
+              std::vector<EcoSim::Genetics::OrganismPtr>& c,
+              const unsigned int& cIndex);
+
+/**
+ * @brief Advance the simulation by one tick
+ *
+ * @param w  The world.
+ * @param c  The store holding every creature.
+ * @param gs Statistics for this tick; births, deaths and population are
+ *           added to it.
+ */
+void advanceSimulation(World& w, EcoSim::Genetics::OrganismStore& c, GeneralStats& gs);
+
+#endif // ECOSIM_SIMULATION_TICK_HPP
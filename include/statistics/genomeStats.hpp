@@ -2,6 +2,7 @@
 #define GENOME_STATS_H
 
 #include "../objects/creature/creature.hpp"
+#include "genomeStatsEngine.hpp"
 
 #include <vector>
 #include <sstream>
@@ -28,6 +29,9 @@
  * - ComfInc: Rate of comfort increase
  * - ComfDec: Rate of comfort decrease
  *
+ * For statistics over every registered gene, histograms or per-archetype
+ * breakdowns, see GenomeStatsEngine.
+ *
  * @note Thread Safety: This class is NOT thread-safe. All methods must be called
  * from a single thread, or external synchronization must be provided by the caller.
  *
@@ -85,42 +89,14 @@ class GenomeStats {
                     {}
     };
 
-    /**
-     * @struct SGenome
-     * @brief Accumulator for genome trait sums during statistical calculations.
-     *
-     * Used internally to sum all trait values before computing means and variances.
-     */
-    struct SGenome {
-      unsigned int  lifespan = 0, sight = 0, flee = 0, pursue = 0;
-      float         hunger = 0.0f, thirst = 0.0f, mate = 0.0f, comfInc = 0.0f, comfDec = 0.0f;
-    };
-
     unsigned int  time;                                        ///< Simulation time when statistics were calculated
     UIGeneStat    lifespan, sight, flee, pursue;              ///< Statistics for integer traits
     FGeneStat     hunger, thirst, mate, comfInc, comfDec;     ///< Statistics for float traits
-  
-    /// Helper to update maximum value during min/max scanning
-    void checkMaxValue  (unsigned int &current, const unsigned int &value);
-    /// Helper to update minimum value during min/max scanning
-    void checkMinValue  (unsigned int &current, const unsigned int &value);
-    /// Helper to update maximum value during min/max scanning (float version)
-    void checkMaxValue  (float &current,        const float &value);
-    /// Helper to update minimum value during min/max scanning (float version)
-    void checkMinValue  (float &current,        const float &value);
-    /// Scan creature for maximum trait values
-    void checkMaxValues (const EcoSim::Genetics::Organism &c);
-    /// Scan creature for minimum trait values
-    void checkMinValues (const EcoSim::Genetics::Organism &c);
-    /// Calculate mean values from accumulated sums
-    void setMeans       (const SGenome &sums, const size_t &size);
-    /// Calculate standard deviations from variances
-    void setStdDev      (const size_t &size);
-    /// Calculate variances using two-pass algorithm
-    void setVariances   (const std::vector<EcoSim::Genetics::OrganismPtr> &c,
-                         const SGenome &sums, const size_t &size);
-    /// Add creature trait values to running sums
-    void accumulateSum  (SGenome &sums, const EcoSim::Genetics::Organism &c);
+
+    /// Copy a finished accumulator into an integer trait summary
+    static void setStat (UIGeneStat &stat, const RunningStat &acc);
+    /// Copy a finished accumulator into a float trait summary
+    static void setStat (FGeneStat &stat,  const RunningStat &acc);
 
   public:
     /**
@@ -129,7 +105,8 @@ class GenomeStats {
      * @param time Simulation time (typically in hours) when analysis occurred
      *
      * Performs complete statistical analysis in constructor, calculating min, max,
-     * mean, variance, and standard deviation for all genetic traits.
+     * mean, variance, and standard deviation for all genetic traits in a
+     * single Welford pass over the population.
      *
      * @note If population is empty, all statistics will remain at default values.
      */
@@ -0,0 +1,147 @@
+#ifndef GENOME_STATS_ENGINE_H
+#define GENOME_STATS_ENGINE_H
+
+/**
+ *  Title   : Ecosim - Genome Stats Engine
+ *  Author  : Gary Ferguson
+ *	Purpose	: Population-wide statistics over every registered gene, computed
+ *	          in a single parallel pass against a snapshot of the genomes.
+ */
+
+#include "../genetics/organisms/Organism.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * @struct RunningStat
+ * @brief Welford accumulator for count, mean, variance, min and max.
+ *
+ * Values are folded in one at a time with add() and partial results from
+ * separate chunks are combined with merge() (Chan et al.), so a population
+ * can be reduced in parallel without a second pass for the variance.
+ */
+struct RunningStat {
+  std::uint64_t count = 0;
+  double        mean  = 0.0;
+  double        m2    = 0.0;   ///< Sum of squared differences from the mean
+  float         min   = std::numeric_limits<float>::max ();
+  float         max   = std::numeric_limits<float>::lowest ();
+
+  void add   (float value);
+  void merge (const RunningStat &other);
+
+  /// Population variance (divides by count, as GenomeStats always has).
+  double variance () const { return count > 0 ? m2 / static_cast<double>(count) : 0.0; }
+  double stdDev   () const;
+};
+
+/**
+ * @struct GenomeSnapshot
+ * @brief Dense copy of the expressed gene values of a population.
+ *
+ * Captured on the simulation thread so the statistics can be computed on
+ * another thread while the organisms keep changing. Values are stored
+ * row-major, one row of geneIds.size() floats per organism; a gene an
+ * organism does not carry is stored as NaN and skipped by the engine.
+ */
+struct GenomeSnapshot {
+  unsigned int               time = 0;
+  std::vector<std::string>   geneIds;       ///< Column order, sorted by id
+  std::vector<float>         lowerLimits;   ///< Registered range of each gene
+  std::vector<float>         upperLimits;
+  std::vector<std::string>   archetypes;    ///< Distinct archetype labels
+  std::vector<std::uint32_t> archetypeOf;   ///< Index into archetypes per organism
+  std::vector<float>         values;
+
+  std::size_t organismCount () const { return archetypeOf.size (); }
+  std::size_t geneCount     () const { return geneIds.size (); }
+
+  /**
+   * @brief Copies the genes of every organism in the population.
+   * @param organisms Population to snapshot.
+   * @param registry  Defines the gene columns, their limits and dominance.
+   * @param time      Simulation time recorded with the results.
+   */
+  static GenomeSnapshot capture (const std::vector<EcoSim::Genetics::OrganismPtr> &organisms,
+                                 const EcoSim::Genetics::GeneRegistry &registry,
+                                 unsigned int time);
+};
+
+/**
+ * @struct GenomeStatsOptions
+ * @brief What the engine computes beyond the per-gene summary.
+ */
+struct GenomeStatsOptions {
+  unsigned int histogramBins = 0;      ///< Fixed bins over each gene's limits; 0 disables
+  bool         perArchetype  = false;  ///< Also summarise each archetype separately
+  std::size_t  grain         = 4096;   ///< Organisms per parallel work item
+};
+
+/**
+ * @struct GenomeStatsReport
+ * @brief Result of one engine run.
+ */
+struct GenomeStatsReport {
+  struct GeneSummary {
+    std::string                id;
+    RunningStat                stat;
+    float                      lower = 0.0f;  ///< Histogram range
+    float                      upper = 0.0f;
+    std::vector<std::uint32_t> histogram;     ///< Empty unless bins were requested
+  };
+
+  struct ArchetypeSummary {
+    std::string              label;
+    std::uint64_t            organisms = 0;
+    std::vector<RunningStat> genes;           ///< Parallel to GenomeStatsReport::genes
+  };
+
+  unsigned int                  time      = 0;
+  std::uint64_t                 organisms = 0;
+  std::vector<GeneSummary>      genes;
+  std::vector<ArchetypeSummary> archetypes;
+
+  /// Index of a gene in genes, or -1 if it was not in the snapshot.
+  int findGene (const std::string &id) const;
+
+  /**
+   * @brief Summary rows as CSV: Time,Archetype,Gene,Count,Min,Max,Mean,Variance,StdDev
+   *
+   * The whole population is reported under the archetype "All", followed
+   * by one block per archetype when they were computed.
+   */
+  std::string toString (bool includeHeader = false) const;
+
+  /// Histogram rows as CSV: Time,Gene,BinLow,BinHigh,Count
+  std::string histogramsToString (bool includeHeader = false) const;
+};
+
+/**
+ * @class GenomeStatsEngine
+ * @brief Computes a GenomeStatsReport in one parallel pass over a snapshot.
+ *
+ * Organisms are split into fixed-size chunks that are reduced independently
+ * on the shared thread pool and merged in chunk order, so the result does
+ * not depend on the number of threads.
+ */
+class GenomeStatsEngine {
+  public:
+    static GenomeStatsReport compute (const GenomeSnapshot &snapshot,
+                                      const GenomeStatsOptions &options = GenomeStatsOptions ());
+
+    /**
+     * @brief Runs compute() on a background thread.
+     *
+     * The snapshot is moved into the task, so the caller may continue
+     * mutating the population immediately.
+     */
+    static std::future<GenomeStatsReport> computeAsync (GenomeSnapshot snapshot,
+                                                        GenomeStatsOptions options = GenomeStatsOptions ());
+};
+
+#endif
@@ -10,6 +10,7 @@
  */
 
 #include "../calendar.hpp"
+#include "timeSeries.hpp"
 
 #include <vector>
 #include <iterator>
@@ -55,6 +56,11 @@ struct GeneralStats {
  * and exported for analysis. Supports both raw tick-by-tick recording and
  * aggregation into hourly summaries.
  *
+ * Every added record is also appended to a bounded TimeSeriesStore which
+ * keeps columnar tick, hour, day and season tiers. Unlike the record list it
+ * is not affected by accumulate() or clearRecords(), so graphs and long-run
+ * analysis should read from series() rather than getRecords().
+ *
  * @note Thread Safety: This class is NOT thread-safe. All methods must be called
  * from a single thread, or external synchronization must be provided by the caller.
  *
@@ -73,6 +79,7 @@ struct GeneralStats {
 class Statistics {
   private:
     std::vector<GeneralStats> _records;  ///< Time-series of statistical snapshots
+    TimeSeriesStore           _series;   ///< Downsampled columnar history of every record
 
   public:
     //============================================================================
@@ -111,6 +118,19 @@ class Statistics {
      */
     const std::vector<GeneralStats>& getRecords () const;
 
+    /**
+     * @brief Bytes held by the records and the downsampled history.
+     */
+    std::size_t memoryUsage () const;
+
+    /**
+     * @brief Returns the multi-resolution history of all records added.
+     *
+     * The non-const overload allows opening a memory-mapped stream.
+     */
+    const TimeSeriesStore& series () const;
+    TimeSeriesStore&       series ();
+
     //============================================================================
     //  Accumulate
     //============================================================================
@@ -0,0 +1,260 @@
+#ifndef TIME_SERIES_H
+#define TIME_SERIES_H
+
+/**
+ *  Title   : Ecosim - Time Series
+ *  Author  : Gary Ferguson
+ *	Purpose	: Columnar, bounded-memory storage for the per-tick simulation
+ *	          statistics with automatic hour, day and season downsampling.
+ */
+
+#include "../calendar.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct GeneralStats;
+
+/**
+ * @enum StatMetric
+ * @brief The columns tracked by a TimeSeriesStore, one per GeneralStats field.
+ *
+ * Population is a level and is downsampled by taking the last sample of each
+ * bucket (matching Statistics::accumulateByHour); every other metric is an
+ * event count and is summed.
+ */
+enum class StatMetric : std::size_t {
+  Population = 0,
+  Births,
+  FoodAte,
+  Feeding,
+  OldAge,
+  Starved,
+  Dehydrated,
+  Discomfort,
+  Predator,
+  Count
+};
+
+/**
+ * @enum SeriesTier
+ * @brief Resolution levels kept by a TimeSeriesStore.
+ *
+ * Tick holds raw samples; Hour, Day and Season hold one sample per calendar
+ * hour, day and season (three months) respectively.
+ */
+enum class SeriesTier : std::size_t {
+  Tick = 0,
+  Hour,
+  Day,
+  Season,
+  Count
+};
+
+constexpr std::size_t STAT_METRIC_COUNT = static_cast<std::size_t>(StatMetric::Count);
+constexpr std::size_t SERIES_TIER_COUNT = static_cast<std::size_t>(SeriesTier::Count);
+
+/// One row of metric values, indexed by StatMetric.
+using MetricRow = std::array<float, STAT_METRIC_COUNT>;
+
+/**
+ * @brief Column name used for headers and the ImGui graphs.
+ */
+const char* statMetricName (StatMetric metric);
+
+/**
+ * @brief Display name of a resolution tier.
+ */
+const char* seriesTierName (SeriesTier tier);
+
+/**
+ * @class SeriesRing
+ * @brief Fixed-capacity ring buffer holding one contiguous array per metric.
+ *
+ * Each sample stores the tick index at which its bucket started, so range
+ * queries can be answered with a binary search. When full, the oldest sample
+ * is overwritten. The raw column pointer together with offset() can be handed
+ * straight to ImGui::PlotLines, which understands ring buffers natively.
+ */
+class SeriesRing {
+  private:
+    std::size_t                                       _capacity;
+    std::size_t                                       _size;
+    std::size_t                                       _head;     ///< Slot the next sample is written to
+    std::vector<std::uint64_t>                        _stamps;   ///< First tick of each sample
+    std::array<std::vector<float>, STAT_METRIC_COUNT> _columns;
+
+    std::size_t slot (std::size_t i) const;
+
+  public:
+    explicit SeriesRing (std::size_t capacity);
+
+    void push  (std::uint64_t stamp, const MetricRow &values);
+    void clear ();
+
+    std::size_t capacity () const { return _capacity; }
+    std::size_t size     () const { return _size; }
+    bool        empty    () const { return _size == 0; }
+
+    /// Ring index of the oldest sample (ImGui::PlotLines values_offset).
+    std::size_t offset () const;
+
+    /// Raw storage of one metric, capacity() elements long.
+    const float* column (StatMetric metric) const;
+
+    /// Value of the i-th oldest sample.
+    float         at      (StatMetric metric, std::size_t i) const;
+    std::uint64_t stampAt (std::size_t i) const;
+
+    /// Chronological index of the first sample whose stamp is >= tick.
+    std::size_t lowerBound (std::uint64_t tick) const;
+
+    /// Bytes held by the ring and its columns.
+    std::size_t memoryUsage () const;
+};
+
+/**
+ * @struct SeriesConfig
+ * @brief Capacity of each resolution tier, in samples.
+ *
+ * The defaults keep a day of raw ticks, a season of hours, four years of days
+ * and a century of seasons: roughly 250 KB regardless of run length.
+ */
+struct SeriesConfig {
+  std::size_t tickCapacity   = 1440;
+  std::size_t hourCapacity   = 24 * 92;
+  std::size_t dayCapacity    = 365 * 4;
+  std::size_t seasonCapacity = 400;
+};
+
+/**
+ * @class TimeSeriesStore
+ * @brief Multi-resolution columnar history of GeneralStats records.
+ *
+ * Every appended record is written to the Tick tier and folded into an open
+ * bucket for each coarser tier. A bucket is closed and pushed to its tier
+ * as soon as a record arrives whose calendar hour, day or season differs, so
+ * the coarse tiers are always up to date without re-scanning any history.
+ * Memory is bounded by SeriesConfig.
+ *
+ * Optionally, every raw tick row can be streamed to a memory-mapped file
+ * (see openStream) so the full-resolution history survives without being
+ * kept resident.
+ *
+ * @note Thread Safety: This class is NOT thread-safe.
+ */
+class TimeSeriesStore {
+  private:
+    struct Bucket {
+      bool          open  = false;
+      std::uint64_t key   = 0;
+      std::uint64_t stamp = 0;
+      MetricRow     values {};
+    };
+
+    /**
+     * @brief Append-only binary file mapped into memory.
+     *
+     * Layout: a 24 byte header ("ECOTS001", metric count, row count)
+     * followed by rows of { uint64 tick, float[STAT_METRIC_COUNT] }.
+     */
+    struct MappedStream {
+      int           fd        = -1;
+      unsigned char *data     = nullptr;
+      std::size_t   mapped    = 0;
+      std::uint64_t rows      = 0;
+    };
+
+    std::vector<SeriesRing>                _tiers;
+    std::array<Bucket, SERIES_TIER_COUNT>  _buckets;
+    std::uint64_t                          _ticks;
+    MappedStream                           _stream;
+
+    static std::uint64_t bucketKey (SeriesTier tier, const Calendar &cal);
+    static void          fold      (MetricRow &into, const MetricRow &row);
+
+    bool growStream  (std::size_t bytes);
+    void writeStream (std::uint64_t tick, const MetricRow &row);
+
+  public:
+    explicit TimeSeriesStore (const SeriesConfig &config = SeriesConfig ());
+    ~TimeSeriesStore ();
+
+    TimeSeriesStore (const TimeSeriesStore&)            = delete;
+    TimeSeriesStore& operator= (const TimeSeriesStore&) = delete;
+
+    //============================================================================
+    //  Recording
+    //============================================================================
+    /**
+     * @brief Appends one tick worth of statistics.
+     * @param gs Per-tick record; its calendar drives tier bucketing.
+     */
+    void append (const GeneralStats &gs);
+
+    /**
+     * @brief Drops all history and resets the tick counter.
+     *
+     * An open stream is left open and keeps its rows.
+     */
+    void clear ();
+
+    //============================================================================
+    //  Queries
+    //============================================================================
+    /// Number of ticks appended since construction or the last clear().
+    std::uint64_t tickCount () const { return _ticks; }
+
+    /// Read-only access to a tier, e.g. for direct plotting.
+    const SeriesRing& tier (SeriesTier id) const;
+
+    /**
+     * @brief Copies the samples of a tier whose bucket started in [fromTick, toTick).
+     * @param out Cleared and filled in chronological order.
+     * @return Number of samples copied.
+     *
+     * Buckets still open (the current hour, day or season) are not included.
+     */
+    std::size_t query (SeriesTier tier, StatMetric metric,
+                       std::uint64_t fromTick, std::uint64_t toTick,
+                       std::vector<float> &out) const;
+
+    /**
+     * @brief Copies the most recent count samples of a tier.
+     */
+    std::size_t latest (SeriesTier tier, StatMetric metric, std::size_t count,
+                        std::vector<float> &out) const;
+
+    /**
+     * @brief Bytes held in memory by every tier.
+     *
+     * The memory-mapped stream is file backed and not counted.
+     */
+    std::size_t memoryUsage () const;
+
+    //============================================================================
+    //  Memory-mapped Stream
+    //============================================================================
+    /**
+     * @brief Starts streaming every appended tick to a memory-mapped file.
+     * @param path File to create or truncate.
+     * @return True if the file could be created and mapped.
+     */
+    bool openStream  (const std::string &path);
+    void closeStream ();
+    bool isStreaming () const { return _stream.data != nullptr; }
+
+    /// Rows written to the stream so far.
+    std::uint64_t streamedRows () const { return _stream.rows; }
+
+    /// Size in bytes of one streamed row.
+    static constexpr std::size_t STREAM_ROW_BYTES   = sizeof (std::uint64_t) +
+                                                      STAT_METRIC_COUNT * sizeof (float);
+    /// Size in bytes of the stream file header.
+    static constexpr std::size_t STREAM_HEADER_BYTES = 24;
+};
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file tripleBuffer.hpp
+ * @brief Lock-free single-producer/single-consumer triple buffer
+ * @author Gary Ferguson
+ *
+ * Hands the most recent value from one thread to another without either
+ * side ever waiting. The writer fills the back slot and publishes it; the
+ * reader picks up whatever was published last. Values the reader was too
+ * slow to see are overwritten, so it always gets the newest one.
+ *
+ * Key concepts:
+ * - back(): slot only the writer touches; publish() makes it the newest
+ * - front(): slot only the reader touches; update() swaps in the newest
+ * - The third slot sits between them, tagged with a "fresh" bit when it
+ *   holds something the reader has not taken yet
+ *
+ * Slots are reused, so a writer that clear()s and refills containers keeps
+ * their capacity from one publish to the next.
+ *
+ * Usage:
+ * @code
+ * EcoSim::TripleBuffer<Frame> frames;
+ * // Writer thread
+ * fill(frames.back());
+ * frames.publish();
+ * // Reader thread
+ * if (frames.update()) draw(frames.front());
+ * @endcode
+ */
+
+#ifndef ECOSIM_TRIPLE_BUFFER_HPP
+#define ECOSIM_TRIPLE_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+
+namespace EcoSim {
+
+/**
+ * @brief Three slots of T shared by exactly one writer and one reader
+ *
+ * @note Thread Safety: back() and publish() must only be called from the
+ * writer thread, front() and update() only from the reader thread.
+ */
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Slot the writer fills before calling publish()
+     */
+    T& back() { return slots_[back_]; }
+
+    /**
+     * @brief Make the back slot the newest value and take a new back slot
+     *
+     * The slot handed back may hold an older value the reader skipped.
+     */
+    void publish() {
+        unsigned int previous = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel);
+        back_ = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Take the newest published value if there is one
+     * @return true if front() changed since the last call
+     */
+    bool update() {
+        if ((middle_.load(std::memory_order_acquire) & FRESH) == 0) {
+            return false;
+        }
+        unsigned int previous = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_ = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Value the reader currently holds (default-constructed until
+     *        the first update() that returns true)
+     */
+    const T& front() const { return slots_[front_]; }
+
+private:
+    static constexpr unsigned int INDEX_MASK = 3u;
+    static constexpr unsigned int FRESH = 4u;
+
+    std::array<T, 3> slots_{};
+    unsigned int back_ = 0;                  // Writer only
+    unsigned int front_ = 1;                 // Reader only
+    std::atomic<unsigned int> middle_{2};    // Shared: slot index | FRESH
+};
+
+} // namespace EcoSim
+
+#endif // ECOSIM_TRIPLE_BUFFER_HPP
@@ -0,0 +1,235 @@
+#ifndef ECOSIM_WORLD_CHUNKEDWORLD_HPP
+#define ECOSIM_WORLD_CHUNKEDWORLD_HPP
+
+/**
+ * @file ChunkedWorld.hpp
+ * @brief Lazily generated world split into fixed-size chunks
+ *
+ * A dense WorldGrid of a 16k x 16k world would hold 256M tiles and take
+ * minutes to generate. ChunkedWorld instead keeps the world as chunks of
+ * chunkSize x chunkSize tiles that are generated from the seed the first
+ * time they are touched, and evicts the least recently used ones when too
+ * many are resident.
+ *
+ * Key concepts:
+ * - Overview: a whole-world ClimateWorldGenerator run at a stride chosen so
+ *   its maps are at most overviewResolution tiles across. It settles the
+ *   globally coupled features (inland seas, distance to water, rivers and
+ *   lakes), so startup cost does not depend on the world size.
+ * - Chunks: each is generated as a padded region against the overview and
+ *   only the core is kept. Everything else is a function of world
+ *   coordinates, so a chunk is the same whatever order chunks are touched in
+ *   and neighbouring chunks meet without seams.
+ * - Cache: evicted chunks are written to cacheDirectory (when set) and read
+ *   back instead of being regenerated, by this instance or any later one.
+ *   Files are never deleted. File names and headers carry a key of the
+ *   generator parameters, world size and chunk size, so worlds sharing a
+ *   directory never pick up each other's chunks.
+ * - Edits: the cache holds generated climate only, so it can be shared.
+ *   Tiles that no longer match their climate are kept in memory when their
+ *   chunk is evicted and put back when it is loaded again.
+ * - Plants: chunks holding plants are never evicted. Whoever adds or
+ *   removes plants reports it through plantsChanged().
+ *
+ * @note Thread Safety: not thread-safe. References returned by tile() and
+ * chunk() stay valid until another chunk is loaded or chunks are evicted.
+ */
+
+#include "ClimateWorldGenerator.hpp"
+#include "tile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace EcoSim {
+
+/**
+ * @brief Configuration for a ChunkedWorld
+ *
+ * climate.width and climate.height give the size of the whole world.
+ */
+struct ChunkedWorldConfig {
+    ClimateGeneratorConfig climate;
+
+    unsigned int chunkSize = 64;             // Tiles along each side of a chunk
+    unsigned int overviewResolution = 512;   // Longest side of the overview maps
+    unsigned int waterApron = 32;            // Padding searched exactly for water
+    std::size_t maxResidentChunks = 1024;    // LRU limit (chunks with plants are kept)
+    std::string cacheDirectory;              // Where evicted chunks go; empty regenerates
+    unsigned int evictionRadius = 2;         // Chunks kept around organisms by the tick
+};
+
+/**
+ * @class ChunkedWorld
+ * @brief Tiles and climate of a large world, generated one chunk at a time
+ */
+class ChunkedWorld {
+public:
+    /**
+     * @brief One generated chunk, stored x-major like WorldGrid
+     */
+    struct Chunk {
+        unsigned int cx = 0;
+        unsigned int cy = 0;
+        unsigned int width = 0;     // Smaller than chunkSize on the last column/row
+        unsigned int height = 0;
+        std::vector<Tile> tiles;
+        std::vector<PackedTileClimate> climate;
+        std::uint64_t lastUse = 0;
+        std::size_t plants = 0;     // Reported through plantsChanged()
+
+        Tile& tile(unsigned int lx, unsigned int ly) { return tiles[lx * height + ly]; }
+        TileClimate climateAt(unsigned int lx, unsigned int ly) const {
+            return climate[lx * height + ly].unpack();
+        }
+    };
+
+    /**
+     * @brief Counters for how chunks were obtained and released
+     */
+    struct Stats {
+        std::size_t generated = 0;
+        std::size_t loadedFromCache = 0;
+        std::size_t evicted = 0;
+        std::size_t spilled = 0;    // Evicted chunks written to the cache
+        std::size_t editsKept = 0;  // Edited tiles held back on eviction
+    };
+
+    /**
+     * @brief Create the world and generate its overview
+     *
+     * No chunk is generated until it is first accessed.
+     */
+    explicit ChunkedWorld(const ChunkedWorldConfig& config);
+
+    ChunkedWorld(const ChunkedWorld&) = delete;
+    ChunkedWorld& operator=(const ChunkedWorld&) = delete;
+
+    //==========================================================================
+    // Dimensions
+    //==========================================================================
+
+    unsigned int width() const { return _config.climate.width; }
+    unsigned int height() const { return _config.climate.height; }
+    unsigned int chunkSize() const { return _config.chunkSize; }
+    unsigned int chunksX() const { return _chunksX; }
+    unsigned int chunksY() const { return _chunksY; }
+
+    //==========================================================================
+    // Access (loads the containing chunk on demand)
+    //==========================================================================
+
+    /**
+     * @brief Tile at world coordinates (unchecked)
+     */
+    Tile& tile(unsigned int x, unsigned int y);
+
+    /**
+     * @brief Climate at world coordinates (unchecked)
+     */
+    TileClimate climate(unsigned int x, unsigned int y);
+
+    /**
+     * @brief Packed climate at world coordinates (unchecked)
+     */
+    PackedTileClimate packedClimate(unsigned int x, unsigned int y);
+
+    /**
+     * @brief Chunk at chunk coordinates, loading it if needed
+     */
+    Chunk& chunk(unsigned int cx, unsigned int cy);
+
+    /**
+     * @brief Load several chunks at once, generating them in parallel
+     * @param chunks Chunk coordinates; already resident ones are skipped
+     */
+    void prefetch(const std::vector<std::pair<unsigned int, unsigned int>>& chunks);
+
+    bool isResident(unsigned int cx, unsigned int cy) const;
+    std::size_t residentCount() const { return _chunks.size(); }
+
+    /**
+     * @brief Chunk coordinates of every resident chunk, sorted by x then y
+     */
+    std::vector<std::pair<unsigned int, unsigned int>> residentChunks() const;
+
+    //==========================================================================
+    // Residency
+    //==========================================================================
+
+    /**
+     * @brief Evict chunks with no organism nearby
+     *
+     * A chunk is kept if it holds plants or lies within radius chunks
+     * (Chebyshev distance) of the chunk containing any of the positions.
+     *
+     * @param positions World tile coordinates of organisms
+     * @param radius Chunks kept around each position
+     * @return Number of chunks evicted
+     */
+    std::size_t evictDistantChunks(const std::vector<std::pair<int, int>>& positions,
+                                   unsigned int radius);
+
+    /**
+     * @brief Record plants added to (delta > 0) or removed from a tile
+     *
+     * Loads the tile's chunk if needed. A chunk is kept resident while its
+     * count is above zero.
+     */
+    void plantsChanged(unsigned int x, unsigned int y, int delta);
+
+    //==========================================================================
+    // Information
+    //==========================================================================
+
+    const ChunkedWorldConfig& getConfig() const { return _config; }
+    const Stats& stats() const { return _stats; }
+
+    /**
+     * @brief Bytes held by resident chunks, their plant lists and kept edits
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * @brief Whole-world generator the chunks are generated against
+     */
+    const ClimateWorldGenerator& overview() const { return *_overview; }
+
+private:
+    ChunkedWorldConfig _config;
+    unsigned int _chunksX = 0;
+    unsigned int _chunksY = 0;
+
+    std::unique_ptr<ClimateWorldGenerator> _overview;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Chunk>> _chunks;
+    std::unordered_set<std::uint64_t> _cached;    // Chunks known to have a cache file
+    std::unordered_map<std::uint64_t, std::vector<std::pair<std::uint32_t, Tile>>> _edits;
+    std::uint64_t _cacheKey = 0;                   // Names and validates cache files
+    std::uint64_t _clock = 0;
+    Chunk* _lastChunk = nullptr;                   // Fast path for tile()
+    Stats _stats;
+
+    std::uint64_t key(unsigned int cx, unsigned int cy) const {
+        return static_cast<std::uint64_t>(cy) * _chunksX + cx;
+    }
+    Chunk& locate(unsigned int x, unsigned int y);
+
+    std::unique_ptr<Chunk> generateChunk(unsigned int cx, unsigned int cy) const;
+    Chunk& insert(std::unique_ptr<Chunk> chunk);
+    void evictLeastRecentlyUsed();
+    void evict(std::uint64_t chunkKey);
+
+    std::string cachePath(unsigned int cx, unsigned int cy) const;
+    bool writeToCache(const Chunk& chunk) const;
+    std::unique_ptr<Chunk> readFromCache(unsigned int cx, unsigned int cy) const;
+};
+
+} // namespace EcoSim
+
+#endif // ECOSIM_WORLD_CHUNKEDWORLD_HPP
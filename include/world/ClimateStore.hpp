@@ -0,0 +1,106 @@
+#ifndef ECOSIM_WORLD_CLIMATESTORE_HPP
+#define ECOSIM_WORLD_CLIMATESTORE_HPP
+
+/**
+ * @file ClimateStore.hpp
+ * @brief Quantized, contiguous storage for per-tile climate
+ *
+ * TileClimate is 56 bytes of floats and enums, which is convenient while a
+ * world is being generated but wasteful once it only needs to be read. The
+ * store keeps each tile as a 16-byte PackedTileClimate in one x-major array
+ * (four tiles per cache line) and dequantizes on read.
+ *
+ * Quantization:
+ * - elevation, moisture, waterLevel: 16-bit fractions of [0, 1]
+ * - temperature: 16-bit fixed point in 1/256 °C (about ±128 °C)
+ * - biome blend: 5-bit biome and 8-bit weight per contribution
+ * - blend count and terrain feature share the biome word
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EcoSim {
+
+struct TileClimate;
+enum class Biome;
+enum class TerrainFeature;
+
+/**
+ * @brief One tile of a ClimateStore
+ */
+struct PackedTileClimate {
+    static constexpr float FRACTION_SCALE = 65535.0f;
+    static constexpr float TEMPERATURE_SCALE = 256.0f;
+    static constexpr float WEIGHT_SCALE = 255.0f;
+
+    std::uint16_t elevation = 0;
+    std::int16_t temperature = 0;
+    std::uint16_t moisture = 0;
+    std::uint16_t waterLevel = 0;
+    std::uint32_t classes = 0;        // 4 x 5-bit biomes, 3-bit count, 4-bit feature
+    std::uint8_t weights[4] = {};
+
+    static PackedTileClimate pack(const TileClimate& climate);
+    TileClimate unpack() const;
+
+    float getElevation() const { return elevation / FRACTION_SCALE; }
+    float getTemperature() const { return temperature / TEMPERATURE_SCALE; }
+    float getMoisture() const { return moisture / FRACTION_SCALE; }
+    float getWaterLevel() const { return waterLevel / FRACTION_SCALE; }
+    Biome biome() const { return static_cast<Biome>(classes & 0x1Fu); }
+    int blendCount() const { return static_cast<int>((classes >> 20) & 0x7u); }
+    TerrainFeature feature() const { return static_cast<TerrainFeature>((classes >> 23) & 0xFu); }
+};
+
+/**
+ * @brief Width x height grid of PackedTileClimate, indexed like WorldGrid
+ */
+class ClimateStore {
+public:
+    ClimateStore() = default;
+    ClimateStore(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Pack a generator-style [x][y] climate map
+     */
+    explicit ClimateStore(const std::vector<std::vector<TileClimate>>& map);
+
+    unsigned int width() const { return _width; }
+    unsigned int height() const { return _height; }
+    bool empty() const { return _tiles.empty(); }
+
+    /**
+     * @brief Dequantized climate of a tile (unchecked)
+     */
+    TileClimate get(unsigned int x, unsigned int y) const;
+    void set(unsigned int x, unsigned int y, const TileClimate& climate);
+
+    const PackedTileClimate& packed(unsigned int x, unsigned int y) const {
+        return _tiles[static_cast<std::size_t>(x) * _height + y];
+    }
+
+    // Single fields, without unpacking the whole tile
+    float elevation(unsigned int x, unsigned int y) const { return packed(x, y).getElevation(); }
+    float temperature(unsigned int x, unsigned int y) const { return packed(x, y).getTemperature(); }
+    float moisture(unsigned int x, unsigned int y) const { return packed(x, y).getMoisture(); }
+    Biome biome(unsigned int x, unsigned int y) const { return packed(x, y).biome(); }
+
+    const std::vector<PackedTileClimate>& tiles() const { return _tiles; }
+    std::vector<PackedTileClimate>& tiles() { return _tiles; }
+
+    /**
+     * @brief Bytes held by the tile array
+     */
+    std::size_t memoryBytes() const { return _tiles.capacity() * sizeof(PackedTileClimate); }
+
+private:
+    unsigned int _width = 0;
+    unsigned int _height = 0;
+    std::vector<PackedTileClimate> _tiles;
+};
+
+} // namespace EcoSim
+
+#endif // ECOSIM_WORLD_CLIMATESTORE_HPP
@@ -15,9 +15,11 @@
  */
 
 #include "WorldGrid.hpp"
+#include "ClimateStore.hpp"
 #include "SimplexNoise.hpp"
 #include "tile.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <cmath>
@@ -245,6 +247,31 @@ struct ClimateGeneratorConfig {
     
     // Random seed
     unsigned int seed = 0;
+    
+    // Run the per-tile stages on the shared thread pool. The output is
+    // identical either way; serial runs are kept for testing and profiling.
+    bool parallel = true;
+};
+
+/**
+ * @brief Part of the world covered by a generator's maps
+ *
+ * Map tile (x, y) is world tile (originX + x * stride, originY + y * stride)
+ * of a world worldWidth x worldHeight tiles, while the map itself is
+ * config.width x config.height. Noise, latitude, island falloff and ridges
+ * are all evaluated in world coordinates, so overlapping regions agree.
+ * generate() covers the whole world at stride 1.
+ */
+struct GenerationRegion {
+    unsigned int worldWidth = 0;
+    unsigned int worldHeight = 0;
+    unsigned int originX = 0;
+    unsigned int originY = 0;
+    unsigned int stride = 1;
+    
+    // Tiles the map extends beyond the part the caller keeps. Water within
+    // this distance is found exactly; beyond it the overview is used.
+    unsigned int apron = 0;
 };
 
 /**
@@ -284,6 +311,71 @@ public:
      */
     void generate(WorldGrid& grid, unsigned int seed);
     
+    /**
+     * @brief Generate one region of a larger world
+     *
+     * Without an overview the region is generated on its own, which is how
+     * a coarse whole-world overview (stride > 1) is built. With one, the
+     * globally coupled steps take their results from it instead: inland
+     * seas it filled are filled here, distances to water beyond the apron
+     * come from its water distance map, and its rivers and lakes are drawn
+     * into the region. Regions generated against an overview must use
+     * stride 1.
+     *
+     * @param grid WorldGrid to populate (resized to config.width x config.height)
+     * @param region Where the maps lie in the world
+     * @param overview Coarse whole-world generator, or nullptr
+     */
+    void generateRegion(WorldGrid& grid, const GenerationRegion& region,
+                        const ClimateWorldGenerator* overview = nullptr);
+    
+    const GenerationRegion& getRegion() const { return _region; }
+
+    //=========================================================================
+    // Generation Cache
+    //=========================================================================
+
+    /**
+     * @brief Stable hash of everything that determines the generated world
+     *
+     * Covers every config field except parallel (which does not change the
+     * output), the region, and the cache file format version.
+     */
+    std::uint64_t generationKey() const;
+
+    /**
+     * @brief generate(), reusing an earlier run's output when one is cached
+     *
+     * Looks for the file named by generationKey() in directory and loads it
+     * if it is valid; otherwise generates the world and writes the file so
+     * later runs with the same config and seed can skip generation. An empty
+     * directory disables the cache.
+     *
+     * @return true if the world was loaded rather than generated
+     */
+    bool generateCached(WorldGrid& grid, const std::string& directory);
+
+    /**
+     * @brief Write every generated map, the climate and the water features
+     * @return false if the file could not be written
+     */
+    bool saveGenerated(const std::string& path) const;
+
+    /**
+     * @brief Restore the state written by saveGenerated() and fill the grid
+     *
+     * The file must have been written by a generator with the same config
+     * (the region is restored from the file); otherwise nothing is changed.
+     *
+     * @return true if the file was valid and has been loaded
+     */
+    bool loadGenerated(const std::string& path, WorldGrid& grid);
+
+    /**
+     * @brief Cache directory named by ECOSIM_WORLD_CACHE, or empty if unset
+     */
+    static std::string defaultCacheDirectory();
+
     //=========================================================================
     // Data Access (for visualization/debugging)
     //=========================================================================
@@ -292,15 +384,53 @@ public:
      * @brief Get climate data for a specific tile
      * @param x X coordinate
      * @param y Y coordinate
-     * @return Climate data for that tile
+     * @return Climate data for that tile, dequantized from the climate store
      */
-    const TileClimate& getClimate(unsigned int x, unsigned int y) const;
+    TileClimate getClimate(unsigned int x, unsigned int y) const;
     
     /**
      * @brief Get the full climate map
-     * @return 2D vector of climate data
+     * @return Quantized climate of every tile
+     */
+    const ClimateStore& getClimateMap() const { return _climate; }
+    
+    /**
+     * @brief Wall time of one stage of the generation pipeline
+     */
+    struct StageTiming {
+        const char* stage;
+        double milliseconds;
+    };
+    
+    /**
+     * @brief Stage timings of the last generation, in pipeline order
+     *
+     * Only stages that ran are listed (rivers are absent when disabled).
+     */
+    const std::vector<StageTiming>& getStageTimings() const { return _stageTimings; }
+    
+    /**
+     * @brief Free the intermediate generation maps
+     *
+     * Only the climate store is needed once a world has been generated.
+     * Afterwards the raw map getters below return empty maps, and the
+     * generator can no longer serve as a ChunkedWorld overview or be
+     * written with saveGenerated() until it generates again.
+     */
+    void releaseIntermediateMaps();
+    
+    /**
+     * @brief Bytes held by the generator: the climate store and any
+     *        intermediate maps not yet released
+     */
+    size_t memoryUsage() const;
+    
+    /**
+     * @brief Build the grid tile for a tile's climate, as generate() does
+     * @param climate Climate data of the tile
+     * @return Tile with terrain, passability and water depth set
      */
-    const std::vector<std::vector<TileClimate>>& getClimateMap() const { return _climateMap; }
+    Tile makeTile(const TileClimate& climate) const;
     
     /**
      * @brief Get raw elevation map (for debugging)
@@ -317,6 +447,37 @@ public:
      */
     const std::vector<std::vector<float>>& getMoistureMap() const { return _moistureMap; }
     
+    /**
+     * @brief Get moisture multiplier from upwind mountains (for debugging)
+     */
+    const std::vector<std::vector<float>>& getRainShadowMap() const { return _rainShadowMap; }
+    
+    /**
+     * @brief Get strength-weighted distance to the nearest ridge in tiles (for debugging)
+     */
+    const std::vector<std::vector<float>>& getRidgeDistanceMap() const { return _ridgeDistanceMap; }
+    
+    //=========================================================================
+    // Tectonic Ridges
+    //=========================================================================
+    
+    /**
+     * @brief Quadratic Bezier plate boundary in normalized (0-1) coordinates
+     */
+    struct PlateRidge {
+        float startX, startY;  // Starting point (normalized 0-1)
+        float endX, endY;      // Ending point (normalized 0-1)
+        float controlX, controlY;  // Bezier control point for curvature
+        float strength;        // Ridge intensity multiplier
+    };
+    
+    // Points sampled along each ridge when measuring distance to it
+    static constexpr int RIDGE_SAMPLES = 50;
+    
+    const std::vector<PlateRidge>& getPlateRidges() const { return _plateRidges; }
+    
+    static float bezierPoint(float t, float p0, float p1, float p2);
+    
     //=========================================================================
     // Biome Utilities
     //=========================================================================
@@ -338,6 +499,7 @@ public:
     
 private:
     ClimateGeneratorConfig _config;
+    GenerationRegion _region;
     std::mt19937 _rng;
     
     // Intermediate generation maps
@@ -345,11 +507,18 @@ private:
     std::vector<std::vector<float>> _elevationMap;
     std::vector<std::vector<float>> _temperatureMap;
     std::vector<std::vector<float>> _moistureMap;
+    std::vector<std::vector<float>> _rainShadowMap;
+    
+    // Full precision climate while generating; packed into _climate and
+    // freed when generation finishes
     std::vector<std::vector<TileClimate>> _climateMap;
+    ClimateStore _climate;
     
     // Distance to water cache
     std::vector<std::vector<float>> _waterDistanceMap;
     
+    std::vector<StageTiming> _stageTimings;
+    
     //=========================================================================
     // Generation Phases
     //=========================================================================
@@ -358,7 +527,8 @@ private:
     void generateContinentMap();
     void generateElevationMap();
     void calculateTemperature();
-    void calculateWaterDistance();
+    void calculateWaterDistance(const ClimateWorldGenerator* overview);
+    void calculateRainShadow();
     void calculateMoisture();
     void determineBiomes();
     void generateRivers();
@@ -368,30 +538,26 @@ private:
     // Noise Functions
     //=========================================================================
     
-    float continentNoise(int x, int y) const;
-    float coastlineDetailNoise(int x, int y) const;
+    // Column helpers sample the tiles (x, rows[i]) as one noise batch
+    void continentNoise(unsigned int x, const std::vector<unsigned int>& rows,
+                        std::vector<float>& out) const;
+    void coastlineDetailNoise(unsigned int x, const std::vector<unsigned int>& rows,
+                              std::vector<float>& out) const;
     float elevationNoise(int x, int y) const;
     float ridgedNoise(float x, float y) const;
-    float ridgedMultifractal(float x, float y, int octaves, float lacunarity, float gain) const;
+    void ridgedMultifractal(const std::vector<float>& x, const std::vector<float>& y,
+                            int octaves, float lacunarity, float gain,
+                            std::vector<float>& out) const;
     
     //=========================================================================
     // Tectonic Ridge Generation
     //=========================================================================
     
-    struct PlateRidge {
-        float startX, startY;  // Starting point (normalized 0-1)
-        float endX, endY;      // Ending point (normalized 0-1)
-        float controlX, controlY;  // Bezier control point for curvature
-        float strength;        // Ridge intensity multiplier
-    };
-    
     std::vector<PlateRidge> _plateRidges;
     std::vector<std::vector<float>> _ridgeDistanceMap;
     
     void generatePlateRidges();
     void calculateRidgeDistanceMap();
-    float distanceToRidge(float x, float y, const PlateRidge& ridge) const;
-    float bezierPoint(float t, float p0, float p1, float p2) const;
     float ridgeInfluence(int x, int y) const;
     
     //=========================================================================
@@ -400,15 +566,25 @@ private:
     
     void removeInlandSeas();
     void floodFillOcean(std::vector<std::vector<bool>>& oceanMask);
+    float inlandSeaFillElevation(unsigned int x, unsigned int y) const;
+    
+    //=========================================================================
+    // Overview Lookups (regions generated against a coarse overview)
+    //=========================================================================
+    
+    void fillInlandSeasFrom(const ClimateWorldGenerator& overview);
+    void applyWaterFrom(const ClimateWorldGenerator& overview);
+    bool overviewHasWaterNear(unsigned int worldX, unsigned int worldY) const;
+    float overviewWaterDistance(float worldX, float worldY) const;
     
     //=========================================================================
     // Climate Calculations
     //=========================================================================
     
-    float calculateTileTemperature(int x, int y) const;
-    float calculateTileMoisture(int x, int y) const;
+    // noise is the tile's raw SimplexNoise sample, taken in column batches
+    float calculateTileTemperature(int x, int y, float noise) const;
+    float calculateTileMoisture(int x, int y, float noise) const;
     float calculateWindMoisture(int x, int y) const;
-    float calculateRainShadow(int x, int y) const;
     
     //=========================================================================
     // Biome Lookup
@@ -434,6 +610,21 @@ private:
         float flow;
     };
     
+    // River tiles with their flow direction, and lake tiles with their
+    // water surface, kept so regions can redraw them at full resolution
+    struct RiverCell {
+        int x, y;
+        int dx, dy;
+        float waterLevel;
+        bool major;
+    };
+    struct LakeCell {
+        int x, y;
+        float surface;
+    };
+    std::vector<RiverCell> _riverCells;
+    std::vector<LakeCell> _lakeCells;
+    
     void findRiverSources(std::vector<RiverSource>& sources);
     void traceRiver(int x, int y, float flow);
     void floodFillLake(int x, int y, float inflow);
@@ -445,6 +636,14 @@ private:
     
     bool inBounds(int x, int y) const;
     float distanceToEdge(int x, int y) const;
+    
+    // World coordinates of a map tile, as floats for noise and gradients
+    float worldX(unsigned int x) const {
+        return static_cast<float>(_region.originX + x * _region.stride);
+    }
+    float worldY(unsigned int y) const {
+        return static_cast<float>(_region.originY + y * _region.stride);
+    }
     float smoothstep(float edge0, float edge1, float x) const;
     int getColorPairForBiome(Biome biome, TerrainFeature feature) const;
     
@@ -174,6 +174,12 @@ public:
      */
     float getTotalNutritionAt(int x, int y) const;
     
+    /**
+     * @brief Get the bytes held by the manager and its corpses
+     * @return Size of the manager, the corpse list and every corpse
+     */
+    size_t memoryUsage() const;
+    
 private:
     std::vector<std::unique_ptr<world::Corpse>> _corpses;
     size_t _maxCorpses = MAX_CORPSES;
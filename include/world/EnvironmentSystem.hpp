@@ -2,6 +2,7 @@
 
 #include "world/SeasonManager.hpp"
 #include "world/WorldGrid.hpp"
+#include "world/ClimateStore.hpp"
 #include "genetics/expression/EnvironmentState.hpp"
 
 #include <vector>
@@ -11,6 +12,7 @@ namespace EcoSim {
 // Forward declarations
 struct TileClimate;
 enum class Biome;
+class ChunkedWorld;
 
 /**
  * Central environmental query system with climate map integration.
@@ -62,24 +64,46 @@ public:
      */
     void updateTickCache(int tickId);
     
+    /**
+     * @brief Time of day cached by updateTickCache() (0.0-1.0)
+     */
+    float getDayProgress() const { return _cachedDayProgress; }
+    
+    /**
+     * @brief Seasonal temperature offset in Celsius (+10 summer, -10 winter)
+     *
+     * Climate temperatures are annual means; this is the season's shift
+     * from them.
+     */
+    float getSeasonalTemperatureOffset() const { return _seasonManager.getBaseTemperatureModifier(); }
+    
     //==========================================================================
     // Climate Map Connection
     //==========================================================================
     
     /**
      * @brief Connect to climate data from world generator
-     * @param climateMap Pointer to the climate map (non-owning)
+     * @param climateMap Pointer to the packed climate store (non-owning)
      * 
      * Must be called after world generation to enable per-tile queries.
      * Passing nullptr disables climate-based queries (falls back to defaults).
      */
-    void setClimateMap(const std::vector<std::vector<TileClimate>>* climateMap);
+    void setClimateMap(const ClimateStore* climateMap);
+    
+    /**
+     * @brief Read climate from a chunked world instead of a climate map
+     * @param chunks The chunked world (non-owning), or nullptr to disconnect
+     *
+     * Queries load the containing chunk on demand. Takes precedence over
+     * setClimateMap().
+     */
+    void setChunkedClimate(ChunkedWorld* chunks);
     
     /**
      * @brief Check if climate data is available
-     * @return true if climate map is connected
+     * @return true if a climate map or chunked world is connected
      */
-    bool hasClimateData() const { return _climateMap != nullptr; }
+    bool hasClimateData() const { return _climateMap != nullptr || _chunks != nullptr; }
     
     //==========================================================================
     // Complete Environment Query (for organisms)
@@ -106,11 +130,11 @@ public:
      * @brief Get raw climate data for a tile
      * @param x X coordinate
      * @param y Y coordinate
-     * @return Reference to TileClimate, or default climate if unavailable
+     * @return Dequantized TileClimate, or default climate if unavailable
      * 
      * Use this for direct access to biome blend data (e.g., for rendering).
      */
-    const TileClimate& getClimateAt(int x, int y) const;
+    TileClimate getClimateAt(int x, int y) const;
     
     //==========================================================================
     // Individual Property Queries (Enhanced with climate data)
@@ -213,10 +237,8 @@ public:
 private:
     const SeasonManager& _seasonManager;
     const WorldGrid& _grid;
-    const std::vector<std::vector<TileClimate>>* _climateMap = nullptr;
-    
-    // Default climate for out-of-bounds or missing data
-    static TileClimate _defaultClimate;
+    const ClimateStore* _climateMap = nullptr;
+    ChunkedWorld* _chunks = nullptr;
     
     // Per-tick cached values (call updateTickCache() at start of each tick)
     // These avoid recomputing expensive sin() calculations for every query
@@ -226,6 +248,9 @@ private:
     
     // Helper to validate coordinates
     bool isValidPosition(int x, int y) const;
+    
+    // Climate of a valid position from whichever source is connected
+    PackedTileClimate packedClimate(int x, int y) const;
 };
 
 } // namespace EcoSim
@@ -7,17 +7,23 @@
 #include "WorldGrid.hpp"
 #include "ScentLayer.hpp"
 #include "PlantSpatialIndex.hpp"
+#include "VegetationField.hpp"
 #include "ClimateWorldGenerator.hpp"
 #include "../genetics/core/GeneRegistry.hpp"
+#include "../genetics/core/RandomEngine.hpp"
 #include "../genetics/organisms/Plant.hpp"
 #include "../genetics/organisms/PlantFactory.hpp"
+#include "../genetics/organisms/PlantRecordStore.hpp"
 #include "../genetics/defaults/UniversalGenes.hpp"
 #include "../genetics/expression/EnvironmentState.hpp"
 #include "../genetics/interactions/SeedDispersal.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <random>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <iostream>
 #include <functional>
@@ -26,6 +32,7 @@ namespace EcoSim {
 
 // Forward declarations
 class EnvironmentSystem;
+class WorldOverview;
 
 namespace Genetics {
     class BiomeVariantFactory;
@@ -42,6 +49,8 @@ namespace Genetics {
  * - Seed dispersal and reproduction
  * - Environment state management
  * - Plant scent emission
+ * - Optionally, ground cover as a biomass field (see setGroundCoverField())
+ * - Optionally, individual plants as compact records (see setCompactPlants())
  */
 class PlantManager {
 public:
@@ -71,6 +80,12 @@ public:
      */
     void setEnvironmentSystem(const EnvironmentSystem* envSystem);
     
+    /**
+     * @brief Set the overview whose plant layer is refilled every tick
+     * @param overview Pointer to the world overview (non-owning), or nullptr
+     */
+    void setOverview(WorldOverview* overview);
+    
     //==========================================================================
     // Initialization
     //==========================================================================
@@ -139,6 +154,60 @@ public:
      */
     bool addBiomePlant(int x, int y);
     
+    //==========================================================================
+    // Ground Cover
+    //==========================================================================
+    
+    /**
+     * @brief Model ground-cover species as a biomass field
+     * @param enabled true to use the field
+     *
+     * When enabled, addPlantsByBiome() and addBiomePlant() put grass and
+     * tundra moss into groundCover() instead of creating Plant objects, and
+     * tick() steps the field. Trees, shrubs and plants added by species name
+     * stay individual. Call before populating the world; disabling clears
+     * the field.
+     */
+    void setGroundCoverField(bool enabled);
+    
+    /**
+     * @brief Check if ground cover is modeled as a field
+     */
+    bool hasGroundCoverField() const { return _groundCoverField; }
+    
+    /**
+     * @brief Get the ground-cover field (empty unless enabled)
+     */
+    VegetationField& groundCover() { return _groundCover; }
+    const VegetationField& groundCover() const { return _groundCover; }
+    
+    //==========================================================================
+    // Compact Plants
+    //==========================================================================
+    
+    /**
+     * @brief Keep individual plants as records instead of Plant objects
+     * @param enabled true to use the record store
+     *
+     * When enabled, plants added to the world go into records() rather than
+     * onto their tiles, and tick() advances the records. A full Plant is
+     * built only to disperse seeds or when a creature looks for one through
+     * nearestPlant() or queryPlantsInRadius(); changes to it reach its
+     * record at the start of the next tick. Call before populating the
+     * world; disabling drops the records.
+     */
+    void setCompactPlants(bool enabled);
+    
+    /**
+     * @brief Check if individual plants are kept as records
+     */
+    bool compactPlants() const { return _compactPlants; }
+    
+    /**
+     * @brief Get the plant records (empty unless compact)
+     */
+    const Genetics::PlantRecordStore& records() const { return _records; }
+    
     //==========================================================================
     // Lifecycle
     //==========================================================================
@@ -194,6 +263,17 @@ public:
      */
     std::vector<Genetics::Plant*> queryPlantsInRadius(int x, int y, float radius);
     
+    /**
+     * @brief Find the living plant nearest a position
+     * @param x Center X position
+     * @param y Center Y position
+     * @param radius Search radius in tiles
+     * @return The nearest plant, or nullptr if none is within radius
+     *
+     * With compact plants only the plant returned is materialized.
+     */
+    Genetics::Plant* nearestPlant(int x, int y, float radius);
+    
     /**
      * @brief Rebuild the plant spatial index.
      *
@@ -209,6 +289,23 @@ public:
     PlantSpatialIndex* getPlantIndex();
     const PlantSpatialIndex* getPlantIndex() const;
     
+    //==========================================================================
+    // Memory
+    //==========================================================================
+    
+    /**
+     * @brief Number of plants on the grid or in the records
+     */
+    size_t plantCount() const;
+    
+    /**
+     * @brief Bytes held by the plants, the spatial index and the factories
+     * 
+     * Walks every plant, so it is O(plants); meant for periodic reporting.
+     * The tiles' plant lists are counted by WorldGrid::memoryUsage().
+     */
+    size_t memoryUsage() const;
+    
     //==========================================================================
     // Access
     //==========================================================================
@@ -241,6 +338,7 @@ private:
     WorldGrid& _grid;
     ScentLayer& _scents;
     const EnvironmentSystem* _environmentSystem = nullptr;
+    WorldOverview* _overview = nullptr;
     
     std::shared_ptr<Genetics::GeneRegistry> _plantRegistry;
     std::unique_ptr<Genetics::PlantFactory> _plantFactory;
@@ -249,15 +347,90 @@ private:
     Genetics::EnvironmentState _currentEnvironment;  // Fallback when no environment system
     Genetics::SeedDispersal _seedDispersal;
     
-    std::mt19937 _rng;
+    Genetics::RandomStream _rng;  // Keyed on the constructing thread's seed
     bool _spatialIndexDirty = true;  // Track if index needs rebuild
     
+    bool _groundCoverField = false;
+    VegetationField _groundCover;
+    
+    bool _compactPlants = false;
+    Genetics::PlantRecordStore _records;
+    std::unordered_map<std::uint64_t, std::uint32_t> _recordAt;  // Tile key -> record
+    std::unordered_map<std::uint32_t, std::unique_ptr<Genetics::Plant>> _views;  // Materialized records
+    
+    using DispersalEvents = std::vector<std::pair<Genetics::DispersalEvent, std::shared_ptr<Genetics::Plant>>>;
+    
     /**
      * @brief Helper to select plant species based on biome
      * @param biome The biome at the target location
-     * @return Function that creates the appropriate plant at given coordinates
+     * @return Species name for createBiomePlant(), or empty for water biomes
+     */
+    std::string selectSpeciesForBiome(Biome biome);
+    
+    /**
+     * @brief Create a plant of a species chosen by selectSpeciesForBiome()
+     */
+    Genetics::Plant createBiomePlant(const std::string& species, int x, int y);
+    
+    /**
+     * @brief The ground-cover species a biome supports
+     * @return Species name, or nullptr when none grows there
+     */
+    static const char* groundCoverForBiome(Biome biome);
+    
+    /**
+     * @brief Register the ground-cover species with the field (once)
+     */
+    void registerGroundCoverSpecies();
+    
+    /**
+     * @brief Make a tile habitat for its biome's ground-cover species
+     */
+    void addGroundCoverHabitat(int x, int y);
+    
+    /**
+     * @brief Fill a tile's ground cover when the species is one the field models
+     * @return true if the species went into the field
+     */
+    bool seedGroundCover(int x, int y, const std::string& species);
+    
+    /**
+     * @brief Advance the plant records one tick
+     *
+     * Writes back the plants materialized since the last tick, then grows,
+     * scents and disperses each record as tick() does a tile's plants, and
+     * drops the dead.
+     */
+    void tickRecords(unsigned currentTick, DispersalEvents& dispersalEvents);
+    
+    /**
+     * @brief Key of a tile in _recordAt
+     */
+    static std::uint64_t recordKey(int x, int y) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+               static_cast<std::uint32_t>(y);
+    }
+    
+    /**
+     * @brief Map every record to its tile
+     */
+    void rebuildRecordIndex();
+    
+    /**
+     * @brief Whether a record is alive, counting changes to its Plant
+     */
+    bool recordAlive(std::uint32_t index) const;
+    
+    /**
+     * @brief The Plant materialized for a record, built on first use
+     */
+    Genetics::Plant* recordView(std::uint32_t index);
+    
+    /**
+     * @brief Add a plant to a tile, or to the records, and report it to the grid
+     * @return true if the tile accepted the plant
      */
-    std::function<Genetics::Plant(int, int)> selectPlantForBiome(Biome biome);
+    bool placePlant(Tile& tile, int x, int y, std::shared_ptr<Genetics::Plant> plant);
     
     /**
      * @brief Add a plant to the spatial index
@@ -105,6 +105,11 @@ public:
      */
     int getCellSize() const { return cellSize_; }
     
+    /**
+     * @brief Bytes held by the index (the cell map and its lists).
+     */
+    size_t memoryUsage() const;
+    
 private:
     struct CellKey {
         int x, y;
@@ -22,6 +22,7 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <cstddef>
 #include <cstdint>
 
 namespace EcoSim {
@@ -238,6 +239,18 @@ public:
     std::vector<std::tuple<ScentDeposit, int, int>> getScentsInRadius(
         int centerX, int centerY, int radius, ScentType type) const;
     
+    /**
+     * @brief Check for any scent of any type within a radius
+     * @param centerX Center X coordinate
+     * @param centerY Center Y coordinate
+     * @param radius Search radius in tiles
+     * @param ignoreCreatureId Scents left by this creature are not counted
+     * @return true if a scent from another creature is within radius
+     *
+     * Walks whichever is smaller, the scented tiles or the search area.
+     */
+    bool hasScentNear(int centerX, int centerY, int radius, int ignoreCreatureId = -1) const;
+    
     /**
      * @brief Update scent decay and remove expired scents
      * @param currentTick Current simulation tick
@@ -270,6 +283,12 @@ public:
      */
     size_t getTotalScentCount() const;
     
+    /**
+     * @brief Get the bytes held by the layer
+     * @return Size of the layer, its tile map and every deposit list
+     */
+    size_t memoryUsage() const;
+    
     /**
      * @brief Get world dimensions
      */
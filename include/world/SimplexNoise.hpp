@@ -27,6 +27,44 @@ public:
     float fractal(size_t octaves, float x) const;
     float fractal(size_t octaves, float x, float y) const;
 
+    /// Instruction sets the batched 2D noise can use, narrowest first
+    enum class Kernel {
+        Scalar,  ///< One sample at a time through noise(x, y)
+        SSE2,    ///< 4 samples per step
+        AVX2     ///< 8 samples per step, with gathered permutation lookups
+    };
+
+    /// Widest kernel supported by the running CPU, used by default
+    static Kernel bestKernel();
+
+    /**
+     * 2D noise for many points at once
+     *
+     * out[i] is bit-identical to noise(x[i], y[i]) whichever kernel is used.
+     *
+     * @param[in]  x      x coordinates
+     * @param[in]  y      y coordinates
+     * @param[in]  count  number of points
+     * @param[out] out    count noise values
+     */
+    static void noiseBatch(const float* x, const float* y, size_t count, float* out);
+    /// As above with an explicit kernel (falls back to a narrower one if unsupported)
+    static void noiseBatch(const float* x, const float* y, size_t count, float* out, Kernel kernel);
+
+    /**
+     * 2D noise along a row: out[i] = noise(x0 + i * dx, y)
+     *
+     * @param[in]  x0     x coordinate of the first sample
+     * @param[in]  dx     x step between samples
+     * @param[in]  y      y coordinate shared by the row
+     * @param[in]  count  number of samples
+     * @param[out] out    count noise values
+     */
+    static void noiseRow(float x0, float dx, float y, size_t count, float* out);
+
+    /// fBm along a row: out[i] = fractal(octaves, x0 + i * dx, y)
+    void fractalRow(size_t octaves, float x0, float dx, float y, size_t count, float* out) const;
+
     /**
      * Constructor of to initialize a fractal noise summation
      *
@@ -125,6 +125,17 @@ public:
         float x, float y, float maxRadius,
         std::function<bool(const EcoSim::Genetics::Organism*)> predicate) const;
     
+    /**
+     * @brief Check for any creature within radius, stopping at the first.
+     * @param x Center X position
+     * @param y Center Y position
+     * @param radius Search radius in tiles
+     * @param ignore Creature to leave out (usually the one asking), or nullptr
+     * @return true if another creature is within radius
+     */
+    bool anyInRadius(float x, float y, float radius,
+                     const EcoSim::Genetics::Organism* ignore = nullptr) const;
+    
     //==========================================================================
     // Utility
     //==========================================================================
@@ -152,6 +163,26 @@ public:
      */
     int getCellSize() const { return cellSize_; }
     
+    /**
+     * @brief Number of cells covering the world.
+     */
+    size_t cellCount() const { return static_cast<size_t>(cellsX_) * static_cast<size_t>(cellsY_); }
+    
+    /**
+     * @brief Number of cells holding at least one creature.
+     */
+    size_t occupiedCellCount() const;
+    
+    /**
+     * @brief Creatures in the fullest cell.
+     */
+    size_t largestCellSize() const;
+    
+    /**
+     * @brief Bytes held by the index (the cell map and its lists).
+     */
+    size_t memoryUsage() const;
+    
 private:
     struct CellKey {
         int x, y;
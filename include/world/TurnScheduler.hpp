@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file TurnScheduler.hpp
+ * @brief Level-of-detail scheduling of creature turns
+ */
+
+#include <cstdint>
+
+namespace EcoSim {
+
+class SpatialIndex;
+class ScentLayer;
+
+namespace Genetics {
+class Organism;
+struct BehaviorResult;
+}
+
+/**
+ * @brief Limits for level-of-detail turn scheduling
+ *
+ * The intervals bound how long an organism can go without reacting to
+ * something new in its surroundings; maxNeedDrift bounds how far its
+ * needs can move before it next decides what to do.
+ */
+struct TurnSchedulerConfig {
+    bool enabled = false;
+    unsigned restingInterval = 4;   ///< Most ticks between turns while resting or idle
+    unsigned isolatedInterval = 8;  ///< Most ticks between turns while wandering alone
+    float maxNeedDrift = 0.5f;      ///< Most any need (0-10 scale) may change between turns
+};
+
+/**
+ * @class TurnScheduler
+ * @brief Decides which organisms take a full turn each tick
+ *
+ * Without it, every organism runs the full turn pipeline (environment
+ * lookup, phenotype context, behavior context, behavior selection) every
+ * tick. With it enabled, organisms that are resting or idle, or wandering with no
+ * other creature or scent within sight range, take a full turn only every
+ * few ticks. The ticks they skip are integrated when their next turn
+ * starts: hunger, thirst, fatigue, mate drive, growth and age all advance
+ * as they would have at full rate.
+ *
+ * Any interaction brings an organism straight back to full rate: taking
+ * damage, entering combat or fleeing, or being hunted or courted by
+ * another organism (see Organism::wake()).
+ *
+ * @code
+ * unsigned elapsed = scheduler.beginTurn(organism, tick);
+ * if (elapsed == 0) return;              // not due this tick
+ * ctx.deltaTime = static_cast<float>(elapsed);
+ * BehaviorResult result = organism.updateWithBehaviors(ctx);
+ * scheduler.endTurn(organism, result, tick, world.getCreatureIndex(), world.getScentLayer());
+ * @endcode
+ */
+class TurnScheduler {
+public:
+    //==========================================================================
+    // Configuration
+    //==========================================================================
+
+    /**
+     * @brief Replace the limits
+     *
+     * Disabling takes effect at each organism's next turn, which catches
+     * up on the ticks it skipped and returns it to full rate.
+     */
+    void setConfig(const TurnSchedulerConfig& config) { _config = config; }
+    const TurnSchedulerConfig& getConfig() const { return _config; }
+    bool isEnabled() const { return _config.enabled; }
+
+    //==========================================================================
+    // Scheduling
+    //==========================================================================
+
+    /**
+     * @brief Start an organism's turn if it is due
+     * @param organism The organism about to act
+     * @param currentTick Current simulation tick
+     * @return Ticks since its last full turn (1 at full rate), or 0 if it
+     *         skips this tick. Skipped ticks are integrated before returning.
+     */
+    unsigned beginTurn(Genetics::Organism& organism, unsigned currentTick);
+
+    /**
+     * @brief Schedule an organism's next turn from the one it just took
+     * @param organism The organism that acted
+     * @param result What its behavior controller did this turn
+     * @param currentTick Current simulation tick
+     * @param creatures Creature index for the isolation check (may be null)
+     * @param scents Scent layer for the isolation check
+     */
+    void endTurn(Genetics::Organism& organism, const Genetics::BehaviorResult& result,
+                 unsigned currentTick, const SpatialIndex* creatures, const ScentLayer& scents);
+
+    //==========================================================================
+    // Statistics
+    //==========================================================================
+
+    /** @brief Full turns taken since the last resetCounts() */
+    std::uint64_t turnsTaken() const { return _turnsTaken; }
+
+    /** @brief Turns skipped since the last resetCounts() */
+    std::uint64_t turnsSkipped() const { return _turnsSkipped; }
+
+    void resetCounts() { _turnsTaken = 0; _turnsSkipped = 0; }
+
+private:
+    /**
+     * @brief Ticks until the organism's next turn, from what it is doing
+     *        and the limits
+     */
+    unsigned chooseInterval(const Genetics::Organism& organism, float heldEnergyCost,
+                            const SpatialIndex* creatures, const ScentLayer& scents) const;
+
+    /**
+     * @brief No other creature and no other creature's scent within sight
+     */
+    bool isIsolated(const Genetics::Organism& organism,
+                    const SpatialIndex* creatures, const ScentLayer& scents) const;
+
+    TurnSchedulerConfig _config;
+    std::uint64_t _turnsTaken = 0;
+    std::uint64_t _turnsSkipped = 0;
+};
+
+} // namespace EcoSim
@@ -0,0 +1,187 @@
+#pragma once
+/**
+ * @file VegetationField.hpp
+ * @brief Ground-cover plants modeled as per-tile biomass density
+ */
+
+#include "../genetics/organisms/Plant.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace EcoSim {
+
+/**
+ * @class VegetationField
+ * @brief Biomass of ground-cover species on every tile
+ *
+ * Grass and tundra moss are the most numerous plants, yet none of them is
+ * individually interesting. In aggregate mode (see
+ * PlantManager::setGroundCoverField) they are not placed as Plant objects:
+ * each tile holds the biomass of the one ground-cover species its biome
+ * supports, from 0 up to the species' mature size. Trees and shrubs stay
+ * individual plants.
+ *
+ * step() runs two passes over the whole field each tick. The field is kept
+ * as separate contiguous per-tile arrays so both loops vectorize:
+ * - growth and die-back: logistic growth at the species' growth rate,
+ *   scaled by daylight and the tile's moisture; while the season puts the
+ *   tile outside the species' temperature tolerance, biomass dies back
+ *   instead, faster the further outside it is
+ * - spread: each tile is colonised towards the mean of its four neighbours
+ *   at the species' runner rate
+ *
+ * Herbivores remove biomass directly with graze().
+ *
+ * Each species keeps one representative mature Plant, used wherever a
+ * Plant is needed (feeding rules, glyph, color).
+ */
+class VegetationField {
+public:
+    static constexpr int NONE = -1;                     ///< No species on a tile
+    static constexpr unsigned BLOCK = 8;                ///< Tiles per side of a search block
+    static constexpr float GRAZEABLE_FRACTION = 0.2f;   ///< Share of capacity worth grazing
+    static constexpr float SPREAD_SCALE = 0.05f;        ///< Spread per tick at runner production 1
+    static constexpr float DIE_BACK_RATE = 0.05f;       ///< Share lost per tick 10°C outside tolerance
+
+    //==========================================================================
+    // Setup
+    //==========================================================================
+
+    /**
+     * @brief Size the field to the world and clear every tile
+     */
+    void resize(unsigned width, unsigned height);
+
+    /**
+     * @brief Register a ground-cover species
+     * @param name Species name (e.g. "grass", "tundra_moss")
+     * @param prototype Representative plant; its genes set the growth,
+     *        spread and tolerance parameters. It is kept at mature size.
+     * @return Species index
+     */
+    int addSpecies(const std::string& name, Genetics::Plant prototype);
+
+    /** @return Species index for a name, or NONE */
+    int findSpecies(const std::string& name) const;
+
+    /**
+     * @brief Make a tile habitat for a species
+     * @param temperature Tile's climate temperature (°C, before seasons)
+     * @param humidity Tile's humidity (0-1)
+     *
+     * The tile's biomass is left as it is.
+     */
+    void setHabitat(int x, int y, int species, float temperature, float humidity);
+
+    /** @brief Set a tile's biomass, clamped to its capacity */
+    void setBiomass(int x, int y, float biomass);
+
+    //==========================================================================
+    // Simulation
+    //==========================================================================
+
+    /**
+     * @brief Advance the whole field one tick
+     * @param timeOfDay 0.0-1.0, drives daylight
+     * @param temperatureOffset Seasonal offset added to every tile (°C)
+     */
+    void step(float timeOfDay, float temperatureOffset);
+
+    /**
+     * @brief Remove biomass from a tile
+     * @return Biomass actually removed
+     */
+    float graze(int x, int y, float amount);
+
+    //==========================================================================
+    // Queries
+    //==========================================================================
+
+    /** @brief No tile is habitat for any species */
+    bool empty() const { return _habitatTiles == 0; }
+
+    unsigned width() const { return _width; }
+    unsigned height() const { return _height; }
+
+    float biomassAt(int x, int y) const;
+    float capacityAt(int x, int y) const;
+
+    /** @return Species index on a tile, or NONE */
+    int speciesAt(int x, int y) const;
+
+    /** @brief Biomass is at least GRAZEABLE_FRACTION of capacity */
+    bool isGrazeable(int x, int y) const;
+
+    /**
+     * @brief Nearest grazeable tile within a radius
+     * @param[out] outX, outY The tile found
+     * @return false when there is none
+     */
+    bool findNearestGrazeable(int x, int y, float radius, int& outX, int& outY) const;
+
+    std::size_t speciesCount() const { return _species.size(); }
+    const std::string& speciesName(int species) const;
+    const Genetics::Plant& prototype(int species) const;
+
+    /** @brief Sum of biomass over every tile */
+    double totalBiomass() const;
+
+    /** @brief Tiles that are habitat for some species */
+    std::size_t habitatTiles() const { return _habitatTiles; }
+
+    /** @brief Bytes held by the arrays and the prototypes */
+    std::size_t memoryUsage() const;
+
+private:
+    struct Species {
+        std::string name;
+        Genetics::Plant prototype;
+        float capacity;
+        float growthRate;
+        float spreadRate;
+        float lightNeed;
+        float waterNeed;
+        float tempLow;
+        float tempHigh;
+    };
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && y >= 0 && x < static_cast<int>(_width) && y < static_cast<int>(_height);
+    }
+    std::size_t index(int x, int y) const {
+        return static_cast<std::size_t>(y) * _width + static_cast<std::size_t>(x);
+    }
+
+    void growAndDieBack(float daylight, float temperatureOffset);
+    void spread();
+    void countGrazeableBlocks();
+
+    unsigned _width = 0;
+    unsigned _height = 0;
+    std::size_t _habitatTiles = 0;
+    std::vector<Species> _species;
+
+    // Per tile, row-major. Habitat parameters are baked in by setHabitat()
+    // so the kernels read no species table.
+    std::vector<float> _biomass;
+    std::vector<float> _next;           // Spread output, swapped with _biomass
+    std::vector<float> _capacity;       // 0 where nothing grows
+    std::vector<float> _invCapacity;    // 0 where nothing grows
+    std::vector<float> _growth;         // Growth rate x moisture factor
+    std::vector<float> _spread;         // Colonisation rate
+    std::vector<float> _lightNeed;
+    std::vector<float> _coldMargin;     // Tile temperature above tolerance low
+    std::vector<float> _heatMargin;     // Tolerance high above tile temperature
+    std::vector<std::int8_t> _cover;    // Species index, or NONE
+
+    // Grazeable tiles per BLOCK x BLOCK block at the last step(); grazing
+    // since then only makes these overestimates
+    std::vector<std::uint16_t> _grazeableBlocks;
+    unsigned _blockCols = 0;
+    unsigned _blockRows = 0;
+};
+
+} // namespace EcoSim
@@ -194,12 +194,12 @@ private:
     void initializeDefaultTerrainRules();
     
     /**
-     * @brief Add octaves to a base noise value
-     * @param noise Base noise value (modified in place)
-     * @param nx X coordinate in noise space
-     * @param ny Y coordinate in noise space
+     * @brief Add octaves to the base noise values of one row
+     * @param noise Base noise value of each column (modified in place)
+     * @param nx X coordinate in noise space of each column
+     * @param ny Y coordinate in noise space shared by the row
      */
-    void addOctaves(double& noise, double nx, double ny) const;
+    void addOctaves(std::vector<double>& noise, const std::vector<double>& nx, double ny) const;
     
     /**
      * @brief Assign terrain tile based on elevation
@@ -7,6 +7,9 @@
  * 
  * WorldGrid provides a clean interface for tile storage and access,
  * separating storage concerns from world generation and simulation logic.
+ *
+ * Tiles are either stored densely or, for worlds too large to generate up
+ * front, read through a ChunkedWorld (see attachChunks()).
  */
 
 #include "tile.hpp"
@@ -15,6 +18,8 @@
 
 namespace EcoSim {
 
+class ChunkedWorld;
+
 /**
  * @class WorldGrid
  * @brief 2D grid of tiles with bounds-checked access
@@ -24,9 +29,22 @@ namespace EcoSim {
  * - Fast unchecked access via operator()
  * - Dimension queries
  * - Iteration support for range-based for loops
+ *
+ * When chunks are attached, access loads the containing chunk on demand
+ * and references stay valid only until another chunk is loaded.
  */
 class WorldGrid {
 public:
+    /**
+     * @brief A rectangle of tiles
+     */
+    struct Region {
+        unsigned int x = 0;
+        unsigned int y = 0;
+        unsigned int width = 0;
+        unsigned int height = 0;
+    };
+
     //==========================================================================
     // Construction
     //==========================================================================
@@ -114,7 +132,7 @@ public:
      * @note No bounds checking - undefined behavior if out of bounds
      */
     Tile& operator()(unsigned int x, unsigned int y) {
-        return _tiles[x][y];
+        return _chunks ? chunkTile(x, y) : _tiles[x][y];
     }
     
     /**
@@ -125,7 +143,7 @@ public:
      * @note No bounds checking - undefined behavior if out of bounds
      */
     const Tile& operator()(unsigned int x, unsigned int y) const {
-        return _tiles[x][y];
+        return _chunks ? chunkTile(x, y) : _tiles[x][y];
     }
     
     //==========================================================================
@@ -148,6 +166,47 @@ public:
      */
     void resize(unsigned int width, unsigned int height, const Tile& defaultTile);
     
+    /**
+     * @brief Bytes held by the grid: the tiles and their plant lists
+     * @note The plants themselves are counted by PlantManager::memoryUsage()
+     * @note Attached chunks are counted by ChunkedWorld::memoryUsage()
+     */
+    size_t memoryUsage() const;
+    
+    //==========================================================================
+    // Chunked Storage
+    //==========================================================================
+    
+    /**
+     * @brief Read tiles through a chunked world instead of dense storage
+     * @param chunks The chunked world (non-owning), or nullptr to detach
+     * @note Dense tiles are released and the grid takes the chunks' size
+     */
+    void attachChunks(ChunkedWorld* chunks);
+    
+    /**
+     * @brief The attached chunked world, or nullptr for dense storage
+     */
+    ChunkedWorld* chunks() const { return _chunks; }
+    
+    /**
+     * @brief Tiles that can be visited without generating anything
+     *
+     * The whole grid for dense storage, otherwise one region per resident
+     * chunk. Loops over "every tile" use these so a chunked world is not
+     * generated in full.
+     */
+    std::vector<Region> residentRegions() const;
+    
+    /**
+     * @brief Record plants added to (delta > 0) or removed from a tile
+     *
+     * Chunks holding plants are never evicted; dense storage ignores it.
+     */
+    void plantsChanged(unsigned int x, unsigned int y, int delta) {
+        if (_chunks) chunkPlantsChanged(x, y, delta);
+    }
+    
     //==========================================================================
     // Raw Access (for backward compatibility and performance-critical code)
     //==========================================================================
@@ -256,6 +315,10 @@ private:
     std::vector<std::vector<Tile>> _tiles;
     unsigned int _width = 0;
     unsigned int _height = 0;
+    ChunkedWorld* _chunks = nullptr;
+    
+    Tile& chunkTile(unsigned int x, unsigned int y) const;
+    void chunkPlantsChanged(unsigned int x, unsigned int y, int delta);
 };
 
 } // namespace EcoSim
@@ -0,0 +1,160 @@
+#ifndef ECOSIM_WORLD_WORLDOVERVIEW_HPP
+#define ECOSIM_WORLD_WORLDOVERVIEW_HPP
+
+/**
+ * @file WorldOverview.hpp
+ * @brief Multi-resolution summary of the world for zoomed-out views
+ *
+ * WorldOverview is a mip pyramid over the tile grid. Level 0 summarises
+ * blocks of BASE_BLOCK x BASE_BLOCK tiles and every level above merges 2x2
+ * cells of the one below, up to a single cell for the whole world. A
+ * zoomed-out view draws one cell per screen block from the level whose
+ * block size matches the zoom, so its cost depends on the screen size
+ * rather than the world size.
+ *
+ * The layers are kept up to date incrementally:
+ * - Terrain: rebuilt when the world is regenerated; a single edited tile
+ *   only recounts its level 0 block and the cells above it.
+ * - Plants, creatures and corpses: cleared, refilled at level 0 by the
+ *   system that already visits them each tick, then propagated upwards.
+ */
+
+#include "../rendering/RenderTypes.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace EcoSim {
+
+class WorldGrid;
+
+/**
+ * @class WorldOverview
+ * @brief Pyramid of per-block terrain and population summaries
+ */
+class WorldOverview {
+public:
+    /// Tiles along each side of a level 0 cell
+    static constexpr unsigned int BASE_BLOCK = 8;
+
+    /**
+     * @brief Summary of one block of tiles
+     */
+    struct Cell {
+        TerrainType terrain = TerrainType::PLAINS;  ///< Dominant terrain
+        std::uint32_t terrainTiles = 0;     ///< Tiles of the dominant terrain (estimated above level 0)
+        std::uint32_t plants = 0;           ///< Living plants
+        float plantBiomass = 0.0f;          ///< Sum of plant sizes
+        std::uint32_t creatures = 0;        ///< Living creatures
+        std::uint32_t herbivores = 0;       ///< Creatures of a plant-eating archetype
+        std::uint32_t carnivores = 0;       ///< Creatures of a hunting or scavenging archetype
+        std::uint32_t corpses = 0;
+    };
+
+    /**
+     * @brief Population layers refreshed independently of each other
+     */
+    enum class Layer {
+        Plants,
+        Creatures,
+        Corpses
+    };
+
+    //==========================================================================
+    // Levels
+    //==========================================================================
+
+    /**
+     * @brief Tiles along each side of a cell at a level
+     */
+    static unsigned int blockSize(unsigned int level) { return BASE_BLOCK << level; }
+
+    /** @brief Number of levels (0 when no grid has been summarised) */
+    unsigned int levelCount() const { return static_cast<unsigned int>(_levels.size()); }
+
+    /** @brief Cells along X at a level */
+    unsigned int levelWidth(unsigned int level) const { return _levels[level].width; }
+
+    /** @brief Cells along Y at a level */
+    unsigned int levelHeight(unsigned int level) const { return _levels[level].height; }
+
+    /**
+     * @brief Cell at a level, in that level's cell coordinates (unchecked)
+     */
+    const Cell& cell(unsigned int level, unsigned int cx, unsigned int cy) const {
+        const Level& l = _levels[level];
+        return l.cells[cy * l.width + cx];
+    }
+
+    /**
+     * @brief Coarsest level that still has at least minCells cells along
+     *        the longer side of the world
+     */
+    unsigned int levelFitting(unsigned int minCells) const;
+
+    /** @brief Bytes held by the overview and its cell pyramid */
+    std::size_t memoryUsage() const;
+
+    //==========================================================================
+    // Terrain
+    //==========================================================================
+
+    /**
+     * @brief Resize to the grid and summarise all of its terrain
+     *
+     * Population layers are cleared.
+     */
+    void rebuildTerrain(const WorldGrid& grid);
+
+    /**
+     * @brief Recount the terrain of the block containing one edited tile
+     */
+    void updateTerrain(const WorldGrid& grid, unsigned int x, unsigned int y);
+
+    //==========================================================================
+    // Population
+    //==========================================================================
+
+    /**
+     * @brief Zero a layer at every level before refilling it
+     */
+    void clear(Layer layer);
+
+    /** @brief Count a living plant on tile (x, y) at level 0 */
+    void addPlant(int x, int y, float biomass);
+
+    /** @brief Count a living creature on tile (x, y) at level 0 */
+    void addCreature(int x, int y, bool herbivore, bool carnivore);
+
+    /** @brief Count a corpse on tile (x, y) at level 0 */
+    void addCorpse(int x, int y);
+
+    /**
+     * @brief Sum a refilled layer from level 0 into every level above
+     */
+    void propagate(Layer layer);
+
+private:
+    struct Level {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<Cell> cells;
+    };
+
+    unsigned int _worldWidth = 0;
+    unsigned int _worldHeight = 0;
+    std::vector<Level> _levels;
+
+    /** @brief Level 0 cell for a tile, or nullptr outside the world */
+    Cell* baseCell(int x, int y);
+
+    /** @brief Count the terrain of one level 0 block */
+    void summariseBlock(const WorldGrid& grid, unsigned int cx, unsigned int cy);
+
+    /** @brief Merge the terrain of the 2x2 children of one cell */
+    void mergeTerrain(unsigned int level, unsigned int cx, unsigned int cy);
+};
+
+} // namespace EcoSim
+
+#endif // ECOSIM_WORLD_WORLDOVERVIEW_HPP
@@ -17,6 +17,9 @@
  * - SeasonManager: Time and season tracking
  * - EnvironmentSystem: Environmental queries
  * - PlantManager: Plant lifecycle management
+ * - WorldOverview: Multi-resolution summary for zoomed-out views
+ * - TurnScheduler: Level-of-detail scheduling of creature turns
+ * - ChunkedWorld: Optional lazily generated terrain for very large worlds
  * 
  * Access subsystems via their accessor methods (e.g., grid(), plants(), corpses()).
  */
@@ -24,21 +27,28 @@
 #include "WorldGrid.hpp"
 #include "WorldGenerator.hpp"
 #include "ClimateWorldGenerator.hpp"
+#include "ChunkedWorld.hpp"
 #include "ScentLayer.hpp"
 #include "SpatialIndex.hpp"
 #include "CorpseManager.hpp"
 #include "SeasonManager.hpp"
 #include "EnvironmentSystem.hpp"
 #include "PlantManager.hpp"
+#include "WorldOverview.hpp"
+#include "TurnScheduler.hpp"
 #include "tile.hpp"
 #include "Corpse.hpp"
 
 #include "../objects/creature/creature.hpp"
 #include "../rendering/RenderTypes.hpp"
+#include "../logging/MemoryReport.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
+#include <utility>
 
 // Use struct definitions from WorldGenerator.hpp
 using EcoSim::MapGen;
@@ -64,6 +74,20 @@ public:
      * @param octaveGen Octave generation configuration
      */
     World(const MapGen& mapGen, const OctaveGen& octaveGen);
+    
+    /**
+     * @brief Construct a World whose terrain is generated one chunk at a time
+     *
+     * Nothing is generated up front: grid() and environment() load chunks
+     * as they are touched and the tick evicts the ones no creature is near.
+     * The overview is left empty and regenerateClimate() does nothing.
+     *
+     * @param mapGen Map generation configuration (size, seed and island flag
+     *        override the climate settings in chunks)
+     * @param octaveGen Octave generation configuration
+     * @param chunks Chunk size, residency limit and cache directory
+     */
+    World(const MapGen& mapGen, const OctaveGen& octaveGen, const EcoSim::ChunkedWorldConfig& chunks);
 
     //============================================================================
     // Core Subsystem Accessors
@@ -111,6 +135,24 @@ public:
     EcoSim::PlantManager& plants();
     const EcoSim::PlantManager& plants() const;
     
+    /**
+     * @brief Get the multi-resolution overview used by zoomed-out views
+     *
+     * Terrain follows every regeneration. Plants
+     * are recounted by each plant tick, creatures by rebuildCreatureIndex()
+     * and corpses by tickCorpses().
+     *
+     * @return Const reference to the WorldOverview
+     */
+    const EcoSim::WorldOverview& overview() const;
+    
+    /**
+     * @brief Get the TurnScheduler deciding which creatures act each tick
+     * @return Reference to the TurnScheduler (disabled by default)
+     */
+    EcoSim::TurnScheduler& turnScheduler();
+    const EcoSim::TurnScheduler& turnScheduler() const;
+    
     //============================================================================
     // Spatial Indexing
     //============================================================================
@@ -130,11 +172,58 @@ public:
     
     /**
      * @brief Rebuild the spatial index from a creature vector
-     * Call after loading saves or major population changes.
+     * Call after loading saves or major population changes. Also recounts
+     * the overview's creature layer.
      * @param creatures Vector of all creatures
      */
     void rebuildCreatureIndex(std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures);
     
+    //============================================================================
+    // Chunked Terrain
+    //============================================================================
+    
+    /** @brief True if terrain is generated one chunk at a time */
+    bool isChunked() const;
+    
+    /**
+     * @brief Get the chunked terrain
+     * @return Pointer to the ChunkedWorld, or nullptr for a dense world
+     */
+    EcoSim::ChunkedWorld* chunks();
+    const EcoSim::ChunkedWorld* chunks() const;
+    
+    /**
+     * @brief Load every chunk within radius chunks of a tile, in parallel
+     * Does nothing for a dense world.
+     */
+    void prefetchChunks(int x, int y, unsigned int radius);
+    
+    /**
+     * @brief Evict chunks that no living creature is near
+     *
+     * Chunks within the configured evictionRadius of a creature, and chunks
+     * holding plants, stay resident. Does nothing for a dense world.
+     *
+     * @return Number of chunks evicted
+     */
+    std::size_t evictDistantChunks(const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures);
+    
+    //============================================================================
+    // Memory
+    //============================================================================
+    
+    /**
+     * @brief Add the size of each world subsystem to a report
+     *
+     * Entries: world, grid, climate, plants, scents, creature index,
+     * corpses and overview. Walks every plant, so it is O(plants).
+     * Creatures are owned by the caller and reported there.
+     */
+    void reportMemory(logging::MemoryReport& report) const;
+    
+    /** @brief Bytes held by the world and its subsystems */
+    size_t memoryUsage() const;
+    
     //============================================================================
     // Terrain Generation Configuration
     //============================================================================
@@ -191,7 +280,9 @@ public:
     /**
      * @brief Regenerate world using ClimateWorldGenerator
      * This generates a full climate-based world with biomes, rivers, etc.
-     * Call after changing generation parameters.
+     * Call after changing generation parameters. When ECOSIM_WORLD_CACHE
+     * names a directory, a world generated earlier with the same config and
+     * seed is loaded from it instead.
      */
     void regenerateClimate();
     
@@ -208,6 +299,18 @@ public:
     EcoSim::ClimateWorldGenerator& climateGenerator();
     const EcoSim::ClimateWorldGenerator& climateGenerator() const;
 
+    //============================================================================
+    // Terrain Revisions
+    //============================================================================
+    // Renderers cache terrain and redraw it when the revision changes.
+    // Terrain only changes through whole-world generation, which always
+    // moves to a new revision.
+    
+    /**
+     * @brief Revision of the terrain, unique across all World instances
+     */
+    std::uint64_t getTerrainRevision() const;
+
     //============================================================================
     // Simulation Update
     //============================================================================
@@ -255,7 +358,7 @@ public:
     // These methods are kept for backward compatibility with existing code.
     // Prefer using grid() accessor for new code.
     
-    /** @brief Get raw 2D grid (legacy - prefer grid() accessor) */
+    /** @brief Get raw 2D grid (legacy - prefer grid() accessor; empty when chunked) */
     std::vector<std::vector<Tile>>& getGrid();
     
     /** @brief Get scent layer (legacy - prefer scentLayer() accessor) */
@@ -267,9 +370,12 @@ private:
     // Core Components
     //============================================================================
     EcoSim::WorldGrid _grid;
+    std::unique_ptr<EcoSim::ChunkedWorld> _chunks;
     std::unique_ptr<EcoSim::WorldGenerator> _generator;
     std::unique_ptr<EcoSim::ClimateWorldGenerator> _climateGenerator;
     EcoSim::ScentLayer _scentLayer;
+    EcoSim::WorldOverview _overview;
+    EcoSim::TurnScheduler _turnScheduler;
     
     //============================================================================
     // Subsystem Managers
@@ -284,6 +390,7 @@ private:
     // State
     //============================================================================
     unsigned int _currentTick;
+    std::uint64_t _terrainRevision;
     
     //============================================================================
     // Private Methods
@@ -291,6 +398,15 @@ private:
     
     /** @brief Initialize 2D grid dimensions */
     void set2Dgrid();
+    
+    /** @brief Climate generator settings for the MapGen */
+    static EcoSim::ClimateGeneratorConfig climateConfigFor(const MapGen& mapGen);
+    
+    /** @brief Create the environment and plant systems once terrain is ready */
+    void createSubsystems();
+    
+    /** @brief Move to a new terrain revision that invalidates every tile */
+    void terrainReplaced();
 };
 
 #endif  // ECOSIM_WORLD_WORLD_HPP
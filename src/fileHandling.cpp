@@ -12,6 +12,7 @@
 #include "../include/fileHandling.hpp"
 #include "../include/genetics/defaults/PlantGenes.hpp"
 #include "../include/objects/creature/CreatureSerialization.hpp"
+#include "../include/logging/Profiler.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <iomanip>
@@ -72,10 +73,15 @@ FileHandling::FileHandling (const string &directory) {
   changeDirectory (directory);
 }
 
+FileHandling::~FileHandling () {
+  waitForGenomeStats ();
+}
+
 //================================================================================
 //  Setters
 //================================================================================
 void FileHandling::changeDirectory (const string &directory) {
+  waitForGenomeStats ();
   saveDir   = SAVE_DIR  + directory;
   genomeDir = saveDir   + GENOME_FILEPATH;
   statDir   = saveDir   + STAT_DIR;
@@ -197,6 +203,7 @@ bool FileHandling::appendStats (const string &stats) {
  */
 bool FileHandling::saveGenomes (const string &filename,
                                 const vector<EcoSim::Genetics::OrganismPtr> &creatures) {
+  ECOSIM_PROFILE_ZONE("FileHandling::saveGenomes");
   const string filepath = genomeDir + filename;
   ofstream file (filepath);
 
@@ -225,6 +232,69 @@ bool FileHandling::saveGenomes (const string &filename,
   return false;
 }
 
+/**
+ *  Saves a genome statistics report next to the per-creature genome files,
+ *  as "<name>_stats.csv" and, when histograms were computed, "<name>_hist.csv".
+ *
+ *  @param filename Base name of the files, e.g. the date; ".csv" is stripped.
+ *  @param report   Statistics produced by GenomeStatsEngine.
+ *  @return   If the files were successfully saved.
+ */
+bool FileHandling::saveGenomeStats (const string &filename, const GenomeStatsReport &report) {
+  string base = genomeDir + filename;
+  if (base.size () >= 4 && base.compare (base.size () - 4, 4, ".csv") == 0) {
+    base.resize (base.size () - 4);
+  }
+
+  ofstream statsFile (base + "_stats.csv");
+  if (!statsFile.is_open ()) {
+    std::cerr << "Error: Failed to open genome stats file: " << base << "_stats.csv" << std::endl;
+    return false;
+  }
+  statsFile << report.toString (true);
+
+  bool hasHistograms = !report.genes.empty () && !report.genes.front ().histogram.empty ();
+  if (hasHistograms) {
+    ofstream histFile (base + "_hist.csv");
+    if (!histFile.is_open ()) {
+      std::cerr << "Error: Failed to open genome histogram file: " << base << "_hist.csv" << std::endl;
+      return false;
+    }
+    histFile << report.histogramsToString (true);
+  }
+  return true;
+}
+
+/**
+ *  Computes and saves genome statistics on a background thread. Only one
+ *  job runs at a time; a previous job is waited on before the next starts.
+ *
+ *  @param filename Passed to saveGenomeStats.
+ *  @param snapshot Population captured with GenomeSnapshot::capture.
+ */
+void FileHandling::saveGenomeStatsAsync (const string &filename, GenomeSnapshot snapshot) {
+  waitForGenomeStats ();
+
+  GenomeStatsOptions options;
+  options.histogramBins = 20;
+  options.perArchetype  = true;
+
+  genomeStatsJob = std::async (std::launch::async,
+    [this, filename, options, snap = std::move (snapshot)]() {
+      return saveGenomeStats (filename, GenomeStatsEngine::compute (snap, options));
+    });
+}
+
+/**
+ *  Blocks until any background genome statistics job has finished.
+ *
+ *  @return   False if the last job failed to save, true otherwise.
+ */
+bool FileHandling::waitForGenomeStats () {
+  if (!genomeStatsJob.valid ()) return true;
+  return genomeStatsJob.get ();
+}
+
 //================================================================================
 //  Saving - Legacy CSV Format (deprecated)
 //================================================================================
@@ -244,6 +314,7 @@ bool FileHandling::saveState (const World &w,
                               const vector<EcoSim::Genetics::OrganismPtr> &creatures,
                               const Calendar &calendar,
                               const Statistics &stats) {
+  ECOSIM_PROFILE_ZONE("FileHandling::saveState");
   //  Define temporary file paths
   const string worldTemp     = saveDir + WORLD_FILEPATH + ".tmp";
   const string creaturesTemp = saveDir + CREATURES_FILEPATH + ".tmp";
@@ -316,6 +387,7 @@ bool FileHandling::saveGameJson(
     int mapWidth,
     int mapHeight
 ) {
+  ECOSIM_PROFILE_ZONE("FileHandling::saveGameJson");
   try {
     // Build the root JSON object
     json saveData;
@@ -1,4 +1,6 @@
 #include "genetics/behaviors/BehaviorController.hpp"
+#include "logging/TickMetrics.hpp"
+#include "memoryUsage.hpp"
 #include <algorithm>
 #include <sstream>
 
@@ -56,7 +58,14 @@ BehaviorResult BehaviorController::update(Organism& organism, BehaviorContext& c
     IBehavior* selected = applicable.front();
     currentBehaviorId_ = selected->getId();
     
-    return selected->execute(organism, ctx);
+    if (!logging::TickMetrics::isEnabled()) {
+        return selected->execute(organism, ctx);
+    }
+    const std::int64_t start = logging::TickMetrics::now();
+    BehaviorResult result = selected->execute(organism, ctx);
+    logging::TickMetrics::getInstance().recordBehavior(
+        currentBehaviorId_, logging::TickMetrics::now() - start);
+    return result;
 }
 
 const std::string& BehaviorController::getCurrentBehaviorId() const {
@@ -122,5 +131,19 @@ std::size_t BehaviorController::getPassiveTickCount() const {
     return passiveTicks_.size();
 }
 
+std::size_t BehaviorController::memoryUsage() const {
+    std::size_t bytes = sizeof(*this)
+                      + Memory::heapBytes(behaviors_)
+                      + Memory::heapBytes(passiveTicks_)
+                      + Memory::heapBytes(currentBehaviorId_);
+    for (const auto& behavior : behaviors_) {
+        bytes += behavior->memoryUsage();
+    }
+    for (const auto& tick : passiveTicks_) {
+        bytes += tick->memoryUsage();
+    }
+    return bytes;
+}
+
 } // namespace Genetics
 } // namespace EcoSim
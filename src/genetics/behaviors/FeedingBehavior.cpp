@@ -10,8 +10,8 @@
 #include "world/tile.hpp"
 #include "world/PlantManager.hpp"
 #include "world/PlantSpatialIndex.hpp"
+#include <algorithm>
 #include <cmath>
-#include <limits>
 #include <vector>
 #include <sstream>
 
@@ -87,6 +87,13 @@ BehaviorResult FeedingBehavior::execute(Organism& organism,
     // Find nearest edible plant
     Plant* targetPlant = findNearestEdiblePlant(organism, ctx);
 
+    // Ground cover closer than any individual plant is grazed instead
+    int grazeX = 0;
+    int grazeY = 0;
+    if (findNearerGroundCover(organism, ctx, targetPlant, grazeX, grazeY)) {
+        return graze(organism, ctx, grazeX, grazeY);
+    }
+
     if (!targetPlant) {
         result.executed = true;
         result.completed = false;
@@ -162,27 +169,66 @@ Plant* FeedingBehavior::findNearestEdiblePlant(const Organism& organism,
     const int iy = static_cast<int>(organism.getWorldY());
     const float detectionRange = getDetectionRange(organism);
 
-    // Use PlantManager::queryPlantsInRadius which triggers a rebuild
-    // of the spatial index if it's dirty. Direct getPlantIndex() skips
-    // the rebuild and returns stale or empty data.
-    auto candidates = ctx.world->plants().queryPlantsInRadius(ix, iy, detectionRange);
-    if (candidates.empty()) return nullptr;
-
-    const float cx = static_cast<float>(ix);
-    const float cy = static_cast<float>(iy);
-    Plant* best = nullptr;
-    float bestDist2 = std::numeric_limits<float>::max();
-    for (Plant* p : candidates) {
-        if (!p || !p->isAlive()) continue;
-        float dx = static_cast<float>(p->getX()) - cx;
-        float dy = static_cast<float>(p->getY()) - cy;
-        float d2 = dx * dx + dy * dy;
-        if (d2 < bestDist2) {
-            bestDist2 = d2;
-            best = p;
-        }
+    // Goes through PlantManager, which rebuilds a dirty spatial index and,
+    // with compact plants, materializes only the plant it returns. Direct
+    // getPlantIndex() skips the rebuild and returns stale or empty data.
+    return ctx.world->plants().nearestPlant(ix, iy, detectionRange);
+}
+
+bool FeedingBehavior::findNearerGroundCover(const Organism& organism,
+                                            const BehaviorContext& ctx,
+                                            const Plant* targetPlant,
+                                            int& outX, int& outY) const {
+    const VegetationField& field = ctx.world->plants().groundCover();
+    if (field.empty()) return false;
+
+    const int ix = static_cast<int>(organism.getWorldX());
+    const int iy = static_cast<int>(organism.getWorldY());
+    float radius = getDetectionRange(organism);
+    if (targetPlant) {
+        radius = std::min(radius, calculateDistance(ix, iy, targetPlant->getX(), targetPlant->getY()));
     }
-    return best;
+    if (!field.findNearestGrazeable(ix, iy, radius, outX, outY)) return false;
+
+    // Ties go to the individual plant
+    return !targetPlant ||
+           calculateDistance(ix, iy, outX, outY) <
+           calculateDistance(ix, iy, targetPlant->getX(), targetPlant->getY());
+}
+
+BehaviorResult FeedingBehavior::graze(Organism& organism, BehaviorContext& ctx,
+                                      int x, int y) {
+    BehaviorResult result;
+    VegetationField& field = ctx.world->plants().groundCover();
+    const Plant& prototype = field.prototype(field.speciesAt(x, y));
+
+    float hungerLevel = 1.0f - getHungerLevel(organism);
+    FeedingResult feedingResult = feeding_.attemptToEatPlant(
+        organism.getPhenotype(), prototype, hungerLevel
+    );
+
+    result.executed = true;
+    if (!feedingResult.success) {
+        result.completed = false;
+        result.energyCost = BASE_ENERGY_COST;
+        result.debugInfo = "Grazing failed: " + feedingResult.description;
+        return result;
+    }
+
+    // A bite takes the same share of the tile as it would of a mature
+    // plant; nutrition shrinks with what is actually left to eat
+    const float bite = feedingResult.plantDamage * field.capacityAt(x, y);
+    const float eaten = field.graze(x, y, bite);
+    const float nutrition = bite > 0.0f ? feedingResult.nutritionGained * eaten / bite : 0.0f;
+
+    result.completed = true;
+    result.energyCost = BASE_ENERGY_COST - nutrition;
+
+    std::ostringstream ss;
+    ss << "Grazed " << field.speciesName(field.speciesAt(x, y))
+       << ", gained " << nutrition << " nutrition";
+    result.debugInfo = ss.str();
+    return result;
 }
 
 float FeedingBehavior::getHungerLevel(const Organism& organism) const {
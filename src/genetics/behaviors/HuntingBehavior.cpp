@@ -8,6 +8,8 @@
 #include "genetics/organisms/Organism.hpp"
 #include "genetics/defaults/UniversalGenes.hpp"
 #include "genetics/core/Genome.hpp"
+#include "genetics/core/RandomEngine.hpp"
+#include "memoryUsage.hpp"
 #include <cmath>
 #include <sstream>
 #include <functional>
@@ -89,7 +91,10 @@ BehaviorResult HuntingBehavior::execute(Organism& organism,
         return result;
     }
     
-    if (attemptEscape(organism, *prey)) {
+    // Hunted prey responds at full rate even if it was resting
+    prey->wake();
+    
+    if (attemptEscape(organism, *prey, ctx.currentTick)) {
         result.completed = false;
         
         float escapeChance = calculateEscapeChance(organism, *prey);
@@ -127,6 +132,10 @@ float HuntingBehavior::getEnergyCost(const Organism& organism) const {
     return HUNT_COST;
 }
 
+std::size_t HuntingBehavior::memoryUsage() const {
+    return sizeof(*this) + Memory::heapBytes(lastHuntTick_);
+}
+
 bool HuntingBehavior::canHunt(const Organism& organism) const {
     const Phenotype& phenotype = organism.getPhenotype();
     float huntInstinct = getTraitSafe(phenotype, UniversalGenes::HUNT_INSTINCT, 0.0f);
@@ -182,11 +191,15 @@ float HuntingBehavior::calculateEscapeChance(const Organism& predator,
 }
 
 bool HuntingBehavior::attemptEscape(const Organism& predator,
-                                     const Organism& prey) const {
+                                     const Organism& prey,
+                                     unsigned int tick) const {
     float escapeChance = calculateEscapeChance(predator, prey);
     
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    float roll = dist(rng_);
+    // Keyed by the organism ID rather than getOrganismId(), which hashes
+    // an address and so differs between runs
+    RandomStream rng = RandomEngine::stream(
+        RandomSystem::Hunting, static_cast<std::uint64_t>(predator.getId()), tick);
+    float roll = rng.uniform();
     
     return roll < escapeChance;
 }
@@ -79,6 +79,9 @@ BehaviorResult MatingBehavior::execute(Organism& organism,
         return result;
     }
 
+    // A courted mate responds at full rate even if it was resting
+    mate->wake();
+
     float distance = calculateDistance(organism, *mate);
     if (distance > 2.5f) {
         // Step toward the mate. Without actual movement, "found mate but
@@ -68,8 +68,10 @@ BehaviorResult MovementBehavior::execute(Organism& organism,
             return result;
         }
         
+        // A deltaTime above 1 covers ticks the TurnScheduler skipped; their
+        // energy was charged then, so the cost below stays per tick
         float speed = getMovementSpeed(organism);
-        float moveAmount = std::min(speed, distToTarget);
+        float moveAmount = std::min(speed * ctx.deltaTime, distToTarget);
         
         float normX = dx / distToTarget;
         float normY = dy / distToTarget;
@@ -77,7 +79,7 @@ BehaviorResult MovementBehavior::execute(Organism& organism,
         newX = currentX + normX * moveAmount;
         newY = currentY + normY * moveAmount;
         
-        distance = moveAmount;
+        distance = std::min(speed, distToTarget);
         
         if (std::abs(dx) > 0.1f && std::abs(dy) > 0.1f) {
             distance *= DIAGONAL_COST_MULTIPLIER;
@@ -88,8 +90,10 @@ BehaviorResult MovementBehavior::execute(Organism& organism,
         result.debugInfo = ss.str();
         
     } else {
-        float wanderX = RandomEngine::randomFloat(-1.0f, 1.0f);
-        float wanderY = RandomEngine::randomFloat(-1.0f, 1.0f);
+        RandomStream rng = RandomEngine::stream(
+            RandomSystem::Movement, static_cast<std::uint64_t>(organism.getId()), ctx.currentTick);
+        float wanderX = rng.uniform(-1.0f, 1.0f);
+        float wanderY = rng.uniform(-1.0f, 1.0f);
         
         float wanderMag = std::sqrt(wanderX * wanderX + wanderY * wanderY);
         if (wanderMag < 0.1f) {
@@ -101,9 +105,11 @@ BehaviorResult MovementBehavior::execute(Organism& organism,
         wanderX /= wanderMag;
         wanderY /= wanderMag;
         
+        // deltaTime random steps cover about sqrt(deltaTime) steps of ground
         float speed = getMovementSpeed(organism);
-        newX = currentX + wanderX * speed;
-        newY = currentY + wanderY * speed;
+        float stride = speed * std::sqrt(std::max(1.0f, ctx.deltaTime));
+        newX = currentX + wanderX * stride;
+        newY = currentY + wanderY * stride;
         
         distance = speed;
         if (std::abs(wanderX) > 0.1f && std::abs(wanderY) > 0.1f) {
@@ -114,7 +114,7 @@ bool ThirstBehavior::isWaterTile(int x, int y, const BehaviorContext& ctx) const
     if (x < 0 || x >= ctx.worldCols || y < 0 || y >= ctx.worldRows) {
         return false;
     }
-    return ctx.world->getGrid()[x][y].isSource();
+    return ctx.world->grid()(static_cast<unsigned int>(x), static_cast<unsigned int>(y)).isSource();
 }
 
 bool ThirstBehavior::tryDrinkAdjacent(Organism& organism, BehaviorContext& ctx) const {
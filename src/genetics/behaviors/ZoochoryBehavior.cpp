@@ -5,6 +5,8 @@
 #include "genetics/defaults/UniversalGenes.hpp"
 #include "genetics/core/Genome.hpp"
 #include "genetics/core/RandomEngine.hpp"
+#include "memoryUsage.hpp"
+#include <algorithm>
 #include <sstream>
 #include <functional>
 
@@ -41,8 +43,14 @@ BehaviorResult ZoochoryBehavior::execute(Organism& organism,
     int currentX = organism.getX();
     int currentY = organism.getY();
 
-    // Process seeds (burr detachment + gut passage)
-    auto events = processOrganismSeeds(organismId, currentX, currentY, 1);
+    // Process seeds (burr detachment + gut passage), once per tick since the
+    // last turn so idle organisms the TurnScheduler skipped keep pace
+    std::vector<DispersalEvent> events;
+    const int ticks = std::max(1, static_cast<int>(ctx.deltaTime));
+    for (int tick = 0; tick < ticks; ++tick) {
+        auto tickEvents = processOrganismSeeds(organismId, currentX, currentY, 1);
+        events.insert(events.end(), tickEvents.begin(), tickEvents.end());
+    }
 
     std::ostringstream debugInfo;
     debugInfo << "Zoochory passive for organism " << organismId;
@@ -70,6 +78,15 @@ float ZoochoryBehavior::getEnergyCost(const Organism& organism) const {
     return 0.0f;
 }
 
+std::size_t ZoochoryBehavior::memoryUsage() const {
+    std::size_t bytes = sizeof(*this)
+                      + Memory::heapBytes(attachedBurrs_)
+                      + Memory::heapBytes(gutSeeds_);
+    for (const auto& entry : attachedBurrs_) bytes += Memory::heapBytes(entry.second);
+    for (const auto& entry : gutSeeds_) bytes += Memory::heapBytes(entry.second);
+    return bytes;
+}
+
 void ZoochoryBehavior::attachBurr(unsigned int organismId,
                                         int plantX, int plantY,
                                         int strategy) {
@@ -1,5 +1,6 @@
 #include "genetics/core/Chromosome.hpp"
 #include "genetics/core/RandomEngine.hpp"
+#include "memoryUsage.hpp"
 #include <nlohmann/json.hpp>
 #include <stdexcept>
 #include <algorithm>
@@ -119,6 +120,14 @@ Chromosome Chromosome::crossover(const Chromosome& parent1,
     return offspring;
 }
 
+std::size_t Chromosome::heapUsage() const {
+    std::size_t bytes = Memory::heapBytes(genes_) + Memory::heapBytesWithKeys(gene_index_);
+    for (const Gene& gene : genes_) {
+        bytes += gene.heapUsage();
+    }
+    return bytes;
+}
+
 // ============================================================================
 // Chromosome Serialization
 // ============================================================================
@@ -1,5 +1,6 @@
 #include "genetics/core/Gene.hpp"
 #include "genetics/core/RandomEngine.hpp"
+#include "memoryUsage.hpp"
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <variant>
@@ -110,6 +111,16 @@ void Gene::setAlleleValues(float value1, float value2) {
     allele2_.value = GeneValue(value2);
 }
 
+std::size_t Gene::heapUsage() const {
+    std::size_t bytes = Memory::heapBytes(id_);
+    for (const Allele* allele : {&allele1_, &allele2_}) {
+        if (const auto* text = std::get_if<std::string>(&allele->value)) {
+            bytes += Memory::heapBytes(*text);
+        }
+    }
+    return bytes;
+}
+
 // ============================================================================
 // Gene Serialization
 // ============================================================================
@@ -1,4 +1,5 @@
 #include "genetics/core/Genome.hpp"
+#include "memoryUsage.hpp"
 #include <nlohmann/json.hpp>
 #include <stdexcept>
 #include <cmath>
@@ -138,6 +139,14 @@ size_t Genome::getTotalGeneCount() const {
     return count;
 }
 
+size_t Genome::heapUsage() const {
+    size_t bytes = Memory::heapBytesWithKeys(gene_cache_);
+    for (const auto& chromosome : chromosomes_) {
+        bytes += chromosome.heapUsage();
+    }
+    return bytes;
+}
+
 Genome Genome::crossover(const Genome& parent1, const Genome& parent2,
                           float recombination_rate) {
     Genome offspring;
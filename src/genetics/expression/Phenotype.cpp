@@ -2,6 +2,7 @@
 #include "genetics/expression/PhenotypeUtils.hpp"
 #include "genetics/core/Genome.hpp"
 #include "genetics/core/Gene.hpp"
+#include "memoryUsage.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -186,6 +187,10 @@ float Phenotype::getCacheHitRate() const {
     return cache_.getCacheHitRate();
 }
 
+std::size_t Phenotype::heapUsage() const {
+    return cache_.heapUsage() + Memory::heapBytesWithKeys(computed_traits_);
+}
+
 bool Phenotype::isValid() const {
     return genome_ != nullptr && registry_ != nullptr;
 }
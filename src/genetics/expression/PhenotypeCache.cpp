@@ -1,6 +1,7 @@
 #include "genetics/expression/PhenotypeCache.hpp"
 #include "genetics/expression/EnvironmentState.hpp"
 #include "genetics/expression/OrganismState.hpp"
+#include "memoryUsage.hpp"
 #include <cmath>
 
 namespace EcoSim {
@@ -53,5 +54,9 @@ float PhenotypeCache::getCacheHitRate() const {
     return static_cast<float>(cache_hits_) / static_cast<float>(total);
 }
 
+std::size_t PhenotypeCache::heapUsage() const {
+    return Memory::heapBytesWithKeys(cache_);
+}
+
 } // namespace Genetics
 } // namespace EcoSim
@@ -5,7 +5,6 @@
 #include "objects/creature/creature.hpp"
 #include <cmath>
 #include <algorithm>
-#include <numeric>
 
 namespace EcoSim {
 namespace Genetics {
@@ -16,20 +15,20 @@ namespace Genetics {
 
 CoevolutionTracker::CoevolutionTracker()
     : currentGeneration_(0)
-    , cacheValid_(false)
 {
     initializeDefaultPairs();
+    rebuildPairs();
 }
 
 CoevolutionTracker::CoevolutionTracker(const ArmsRaceConfig& config)
     : config_(config)
     , currentGeneration_(0)
-    , cacheValid_(false)
 {
     // If no pairs specified in config, use defaults
     if (config_.trackedPairs.empty()) {
         initializeDefaultPairs();
     }
+    rebuildPairs();
 }
 
 void CoevolutionTracker::initializeDefaultPairs() {
@@ -75,114 +74,175 @@ void CoevolutionTracker::initializeDefaultPairs() {
 }
 
 // ============================================================================
-// Population Recording
+// Accumulators
 // ============================================================================
 
-void CoevolutionTracker::recordCreatureGeneration(const std::vector<OrganismPtr>& creatures) {
-    currentCreatureData_ = GeneFrequencyRecord();
-    currentCreatureData_.generation = currentGeneration_;
+void CoevolutionTracker::GeneAccumulator::add(float value) {
+    count++;
+    double delta = static_cast<double>(value) - mean;
+    mean += delta / count;
+    m2 += delta * (static_cast<double>(value) - mean);
+}
 
-    if (creatures.empty()) {
-        return;
+size_t CoevolutionTracker::GeneTable::intern(const std::string& name) {
+    auto it = index.find(name);
+    if (it != index.end()) {
+        return it->second;
     }
+    size_t id = names.size();
+    names.push_back(name);
+    index.emplace(name, id);
+    current.emplace_back();
+    return id;
+}
 
-    // Collect values for each tracked creature gene
-    std::map<std::string, std::vector<float>> geneValues;
+int CoevolutionTracker::GeneTable::find(const std::string& name) const {
+    auto it = index.find(name);
+    return it == index.end() ? -1 : static_cast<int>(it->second);
+}
 
-    for (const auto& pair : config_.trackedPairs) {
-        geneValues[pair.first] = std::vector<float>();
+void CoevolutionTracker::PairState::push(const PairSample& sample) {
+    double k = static_cast<double>(firstOrdinal + static_cast<long long>(samples.size()));
+    samples.push_back(sample);
+    sumX += sample.x;
+    sumY += sample.y;
+    sumXX += sample.x * sample.x;
+    sumYY += sample.y * sample.y;
+    sumXY += sample.x * sample.y;
+    sumKX += k * sample.x;
+    sumKY += k * sample.y;
+}
+
+void CoevolutionTracker::PairState::popFront() {
+    const PairSample& sample = samples.front();
+    double k = static_cast<double>(firstOrdinal);
+    sumX -= sample.x;
+    sumY -= sample.y;
+    sumXX -= sample.x * sample.x;
+    sumYY -= sample.y * sample.y;
+    sumXY -= sample.x * sample.y;
+    sumKX -= k * sample.x;
+    sumKY -= k * sample.y;
+    samples.pop_front();
+    firstOrdinal++;
+    
+    // Subtracting evicted samples slowly accumulates rounding error; once a
+    // full window has been evicted, recompute the sums exactly.
+    if (++evictions >= samples.size() + 1) {
+        rebuild();
     }
+}
 
-    // Extract gene values from each creature
-    for (const auto& creature : creatures) {
-        const Phenotype& phenotype = creature->getPhenotype();
-        
-        for (const auto& pair : config_.trackedPairs) {
-            const std::string& geneName = pair.first;
-            if (phenotype.hasTrait(geneName.c_str())) {
-                geneValues[geneName].push_back(phenotype.getTrait(geneName.c_str()));
-            }
-        }
+void CoevolutionTracker::PairState::rebuild() {
+    std::deque<PairSample> kept;
+    kept.swap(samples);
+    sumX = sumY = sumXX = sumYY = sumXY = sumKX = sumKY = 0.0;
+    firstOrdinal = 0;
+    evictions = 0;
+    for (const auto& sample : kept) {
+        push(sample);
     }
-    
-    // Calculate statistics for each gene
-    for (auto& kv : geneValues) {
-        const std::string& geneName = kv.first;
-        const std::vector<float>& values = kv.second;
-        
-        if (!values.empty()) {
-            currentCreatureData_.meanValues[geneName] = calculateMean(values);
-            currentCreatureData_.variances[geneName] = calculateVariance(values);
-            currentCreatureData_.sampleCounts[geneName] = static_cast<int>(values.size());
+}
+
+// ============================================================================
+// Population Recording
+// ============================================================================
+
+void CoevolutionTracker::addSample(GeneTable& table, const Phenotype& phenotype) {
+    for (size_t i = 0; i < table.names.size(); ++i) {
+        const std::string& geneName = table.names[i];
+        if (phenotype.hasTrait(geneName)) {
+            table.current[i].add(phenotype.getTrait(geneName));
         }
     }
-    
-    cacheValid_ = false;
 }
 
-void CoevolutionTracker::recordPlantGeneration(const std::vector<Plant>& plants) {
-    currentPlantData_ = GeneFrequencyRecord();
-    currentPlantData_.generation = currentGeneration_;
-    
-    if (plants.empty()) {
-        return;
-    }
-    
-    // Collect values for each tracked plant gene
-    std::map<std::string, std::vector<float>> geneValues;
-    
-    for (const auto& pair : config_.trackedPairs) {
-        geneValues[pair.second] = std::vector<float>();
+void CoevolutionTracker::beginCreatureGeneration() {
+    std::fill(creatureGenes_.current.begin(), creatureGenes_.current.end(), GeneAccumulator());
+}
+
+void CoevolutionTracker::beginPlantGeneration() {
+    std::fill(plantGenes_.current.begin(), plantGenes_.current.end(), GeneAccumulator());
+}
+
+void CoevolutionTracker::addCreatureSample(const Phenotype& phenotype) {
+    addSample(creatureGenes_, phenotype);
+}
+
+void CoevolutionTracker::addPlantSample(const Phenotype& phenotype) {
+    addSample(plantGenes_, phenotype);
+}
+
+void CoevolutionTracker::recordCreatureGeneration(const std::vector<OrganismPtr>& creatures) {
+    beginCreatureGeneration();
+    for (const auto& creature : creatures) {
+        addCreatureSample(creature->getPhenotype());
     }
-    
-    // Extract gene values from each plant
+}
+
+void CoevolutionTracker::recordPlantGeneration(const std::vector<Plant>& plants) {
+    beginPlantGeneration();
     for (const auto& plant : plants) {
-        const Phenotype& phenotype = plant.getPhenotype();
-        
-        for (const auto& pair : config_.trackedPairs) {
-            const std::string& geneName = pair.second;
-            if (phenotype.hasTrait(geneName.c_str())) {
-                geneValues[geneName].push_back(phenotype.getTrait(geneName.c_str()));
-            }
-        }
+        addPlantSample(plant.getPhenotype());
     }
-    
-    // Calculate statistics for each gene
-    for (auto& kv : geneValues) {
-        const std::string& geneName = kv.first;
-        const std::vector<float>& values = kv.second;
-        
-        if (!values.empty()) {
-            currentPlantData_.meanValues[geneName] = calculateMean(values);
-            currentPlantData_.variances[geneName] = calculateVariance(values);
-            currentPlantData_.sampleCounts[geneName] = static_cast<int>(values.size());
+}
+
+GeneFrequencyRecord CoevolutionTracker::finalize(const GeneTable& table) const {
+    GeneFrequencyRecord record;
+    record.generation = currentGeneration_;
+    size_t genes = table.current.size();
+    record.meanValues.assign(genes, 0.0f);
+    record.variances.assign(genes, 0.0f);
+    record.sampleCounts.assign(genes, 0);
+    
+    for (size_t i = 0; i < genes; ++i) {
+        const GeneAccumulator& acc = table.current[i];
+        record.sampleCounts[i] = acc.count;
+        if (acc.count > 0) {
+            record.meanValues[i] = static_cast<float>(acc.mean);
+        }
+        if (acc.count > 1) {
+            record.variances[i] = static_cast<float>(acc.m2 / (acc.count - 1));
         }
     }
-    
-    cacheValid_ = false;
+    return record;
 }
 
 void CoevolutionTracker::advanceGeneration() {
     // Store current data in history
-    creatureHistory_.push_back(currentCreatureData_);
-    plantHistory_.push_back(currentPlantData_);
+    creatureHistory_.push_back(finalize(creatureGenes_));
+    plantHistory_.push_back(finalize(plantGenes_));
+    
+    const GeneFrequencyRecord& creatureRecord = creatureHistory_.back();
+    const GeneFrequencyRecord& plantRecord = plantHistory_.back();
+    for (auto& pair : pairs_) {
+        if (creatureRecord.has(pair.creature) && plantRecord.has(pair.plant)) {
+            pair.push({currentGeneration_,
+                       creatureRecord.meanValues[pair.creature],
+                       plantRecord.meanValues[pair.plant]});
+        }
+    }
     
     // Trim history if too long
     while (creatureHistory_.size() > static_cast<size_t>(config_.maxHistoryGenerations)) {
         creatureHistory_.pop_front();
-    }
-    while (plantHistory_.size() > static_cast<size_t>(config_.maxHistoryGenerations)) {
         plantHistory_.pop_front();
     }
+    if (!creatureHistory_.empty()) {
+        int oldest = creatureHistory_.front().generation;
+        for (auto& pair : pairs_) {
+            while (!pair.samples.empty() && pair.samples.front().generation < oldest) {
+                pair.popFront();
+            }
+        }
+    }
     
     // Advance generation counter
     currentGeneration_++;
     
     // Reset current data
-    currentCreatureData_ = GeneFrequencyRecord();
-    currentPlantData_ = GeneFrequencyRecord();
-    
-    cacheValid_ = false;
+    beginCreatureGeneration();
+    beginPlantGeneration();
 }
 
 // ============================================================================
@@ -198,68 +258,29 @@ bool CoevolutionTracker::isArmsRaceActive(
         return false;
     }
     
-    // Get correlation
-    float strength = getCoevolutionStrength(creatureGene, plantGene);
-    
-    if (strength < config_.correlationThreshold) {
+    const PairState* pair = findPair(creatureGene, plantGene);
+    if (!pair || pair->samples.size() < 2) {
         return false;
     }
     
-    // Get trend
-    CoevolutionStats stats = getCoevolutionStats(creatureGene, plantGene);
+    if (std::abs(calculateCorrelation(*pair)) < config_.correlationThreshold) {
+        return false;
+    }
     
     // Arms race is active if escalating or oscillating
-    return stats.trend == "escalating" || stats.trend == "oscillating";
+    std::string trend = detectTrend(*pair);
+    return trend == "escalating" || trend == "oscillating";
 }
 
 float CoevolutionTracker::getCoevolutionStrength(
     const std::string& creatureGene,
     const std::string& plantGene
 ) const {
-    // Check cache
-    auto cacheKey = std::make_pair(creatureGene, plantGene);
-    if (cacheValid_) {
-        auto it = correlationCache_.find(cacheKey);
-        if (it != correlationCache_.end()) {
-            return it->second;
-        }
-    }
-    
-    // Build value vectors from history
-    std::vector<float> creatureValues;
-    std::vector<float> plantValues;
-    
-    for (const auto& record : creatureHistory_) {
-        auto it = record.meanValues.find(creatureGene);
-        if (it != record.meanValues.end()) {
-            creatureValues.push_back(it->second);
-        }
-    }
-    
-    for (const auto& record : plantHistory_) {
-        auto it = record.meanValues.find(plantGene);
-        if (it != record.meanValues.end()) {
-            plantValues.push_back(it->second);
-        }
-    }
-    
-    // Need matching data points
-    size_t minSize = std::min(creatureValues.size(), plantValues.size());
-    if (minSize < 2) {
+    const PairState* pair = findPair(creatureGene, plantGene);
+    if (!pair || pair->samples.size() < 2) {
         return 0.0f;
     }
-    
-    creatureValues.resize(minSize);
-    plantValues.resize(minSize);
-    
-    // Calculate correlation
-    float correlation = calculateCorrelation(creatureValues, plantValues);
-    float strength = std::abs(correlation);
-    
-    // Cache result
-    correlationCache_[cacheKey] = strength;
-    
-    return strength;
+    return std::abs(calculateCorrelation(*pair));
 }
 
 // ============================================================================
@@ -274,48 +295,25 @@ CoevolutionStats CoevolutionTracker::getCoevolutionStats(
     stats.creatureGene = creatureGene;
     stats.plantGene = plantGene;
     
-    // Build value vectors from history
-    std::vector<float> creatureValues;
-    std::vector<float> plantValues;
-    
-    for (const auto& record : creatureHistory_) {
-        auto it = record.meanValues.find(creatureGene);
-        if (it != record.meanValues.end()) {
-            creatureValues.push_back(it->second);
-        }
-    }
-    
-    for (const auto& record : plantHistory_) {
-        auto it = record.meanValues.find(plantGene);
-        if (it != record.meanValues.end()) {
-            plantValues.push_back(it->second);
-        }
-    }
-    
-    // Need matching data points
-    size_t minSize = std::min(creatureValues.size(), plantValues.size());
-    if (minSize < 2) {
+    const PairState* pair = findPair(creatureGene, plantGene);
+    if (!pair || pair->samples.size() < 2) {
         stats.generationsTracked = 0;
         stats.trend = "insufficient_data";
         return stats;
     }
     
-    creatureValues.resize(minSize);
-    plantValues.resize(minSize);
+    double n = static_cast<double>(pair->samples.size());
+    stats.generationsTracked = static_cast<int>(pair->samples.size());
+    stats.correlationCoefficient = calculateCorrelation(*pair);
+    stats.trend = detectTrend(*pair);
     
-    stats.generationsTracked = static_cast<int>(minSize);
-    stats.correlationCoefficient = calculateCorrelation(creatureValues, plantValues);
-    stats.trend = detectTrend(creatureValues, plantValues);
-    
-    // Current values (most recent)
-    if (!creatureValues.empty()) {
-        stats.creatureMeanValue = creatureValues.back();
-        stats.creatureVariance = calculateVariance(creatureValues);
-    }
-    if (!plantValues.empty()) {
-        stats.plantMeanValue = plantValues.back();
-        stats.plantVariance = calculateVariance(plantValues);
-    }
+    // Current values (most recent) and variance of the mean over the window
+    stats.creatureMeanValue = static_cast<float>(pair->samples.back().x);
+    stats.plantMeanValue = static_cast<float>(pair->samples.back().y);
+    stats.creatureVariance = static_cast<float>(
+        std::max(0.0, (pair->sumXX - pair->sumX * pair->sumX / n) / (n - 1.0)));
+    stats.plantVariance = static_cast<float>(
+        std::max(0.0, (pair->sumYY - pair->sumY * pair->sumY / n) / (n - 1.0)));
     
     return stats;
 }
@@ -358,43 +356,93 @@ void CoevolutionTracker::addTrackedPair(
     }
     
     config_.trackedPairs.push_back({creatureGene, plantGene});
-    cacheValid_ = false;
+    addPairState(creatureGene, plantGene);
 }
 
 void CoevolutionTracker::removeTrackedPair(
     const std::string& creatureGene,
     const std::string& plantGene
 ) {
-    auto it = std::remove_if(
-        config_.trackedPairs.begin(),
-        config_.trackedPairs.end(),
-        [&](const std::pair<std::string, std::string>& pair) {
-            return pair.first == creatureGene && pair.second == plantGene;
+    for (size_t i = 0; i < config_.trackedPairs.size(); ) {
+        const auto& pair = config_.trackedPairs[i];
+        if (pair.first == creatureGene && pair.second == plantGene) {
+            config_.trackedPairs.erase(config_.trackedPairs.begin() + static_cast<std::ptrdiff_t>(i));
+            pairs_.erase(pairs_.begin() + static_cast<std::ptrdiff_t>(i));
+        } else {
+            ++i;
         }
-    );
-    
-    config_.trackedPairs.erase(it, config_.trackedPairs.end());
-    cacheValid_ = false;
+    }
 }
 
 void CoevolutionTracker::setConfig(const ArmsRaceConfig& config) {
     config_ = config;
-    cacheValid_ = false;
+    rebuildPairs();
+}
+
+void CoevolutionTracker::addPairState(const std::string& creatureGene, const std::string& plantGene) {
+    PairState state;
+    state.creature = creatureGenes_.intern(creatureGene);
+    state.plant = plantGenes_.intern(plantGene);
+    
+    for (size_t i = 0; i < creatureHistory_.size(); ++i) {
+        const GeneFrequencyRecord& c = creatureHistory_[i];
+        const GeneFrequencyRecord& p = plantHistory_[i];
+        if (c.has(state.creature) && p.has(state.plant)) {
+            state.push({c.generation, c.meanValues[state.creature], p.meanValues[state.plant]});
+        }
+    }
+    pairs_.push_back(std::move(state));
+}
+
+void CoevolutionTracker::rebuildPairs() {
+    pairs_.clear();
+    for (const auto& pair : config_.trackedPairs) {
+        addPairState(pair.first, pair.second);
+    }
+}
+
+const CoevolutionTracker::PairState* CoevolutionTracker::findPair(
+    const std::string& creatureGene,
+    const std::string& plantGene
+) const {
+    int creature = creatureGenes_.find(creatureGene);
+    int plant = plantGenes_.find(plantGene);
+    if (creature < 0 || plant < 0) {
+        return nullptr;
+    }
+    for (const auto& pair : pairs_) {
+        if (pair.creature == static_cast<size_t>(creature) &&
+            pair.plant == static_cast<size_t>(plant)) {
+            return &pair;
+        }
+    }
+    return nullptr;
 }
 
 // ============================================================================
 // History Access
 // ============================================================================
 
+int CoevolutionTracker::creatureGeneIndex(const std::string& geneName) const {
+    return creatureGenes_.find(geneName);
+}
+
+int CoevolutionTracker::plantGeneIndex(const std::string& geneName) const {
+    return plantGenes_.find(geneName);
+}
+
 std::vector<std::pair<int, float>> CoevolutionTracker::getCreatureGeneHistory(
     const std::string& geneName
 ) const {
     std::vector<std::pair<int, float>> history;
+    int gene = creatureGenes_.find(geneName);
+    if (gene < 0) {
+        return history;
+    }
     
     for (const auto& record : creatureHistory_) {
-        auto it = record.meanValues.find(geneName);
-        if (it != record.meanValues.end()) {
-            history.push_back({record.generation, it->second});
+        if (record.has(static_cast<size_t>(gene))) {
+            history.push_back({record.generation, record.meanValues[static_cast<size_t>(gene)]});
         }
     }
     
@@ -405,11 +453,14 @@ std::vector<std::pair<int, float>> CoevolutionTracker::getPlantGeneHistory(
     const std::string& geneName
 ) const {
     std::vector<std::pair<int, float>> history;
+    int gene = plantGenes_.find(geneName);
+    if (gene < 0) {
+        return history;
+    }
     
     for (const auto& record : plantHistory_) {
-        auto it = record.meanValues.find(geneName);
-        if (it != record.meanValues.end()) {
-            history.push_back({record.generation, it->second});
+        if (record.has(static_cast<size_t>(gene))) {
+            history.push_back({record.generation, record.meanValues[static_cast<size_t>(gene)]});
         }
     }
     
@@ -419,66 +470,75 @@ std::vector<std::pair<int, float>> CoevolutionTracker::getPlantGeneHistory(
 void CoevolutionTracker::clearHistory() {
     creatureHistory_.clear();
     plantHistory_.clear();
-    correlationCache_.clear();
-    cacheValid_ = false;
+    for (auto& pair : pairs_) {
+        pair.samples.clear();
+        pair.rebuild();
+    }
 }
 
 void CoevolutionTracker::reset() {
     clearHistory();
     currentGeneration_ = 0;
-    currentCreatureData_ = GeneFrequencyRecord();
-    currentPlantData_ = GeneFrequencyRecord();
+    beginCreatureGeneration();
+    beginPlantGeneration();
 }
 
 // ============================================================================
 // Internal Methods
 // ============================================================================
 
-float CoevolutionTracker::calculateCorrelation(
-    const std::vector<float>& creatureValues,
-    const std::vector<float>& plantValues
-) const {
-    if (creatureValues.size() != plantValues.size() || creatureValues.size() < 2) {
+float CoevolutionTracker::calculateCorrelation(const PairState& pair) {
+    double n = static_cast<double>(pair.samples.size());
+    if (n < 2.0) {
         return 0.0f;
     }
     
-    size_t n = creatureValues.size();
-    
-    // Calculate means
-    float meanX = calculateMean(creatureValues);
-    float meanY = calculateMean(plantValues);
+    // Covariance and variances from the running sums
+    double covariance = pair.sumXY - pair.sumX * pair.sumY / n;
+    double varX = pair.sumXX - pair.sumX * pair.sumX / n;
+    double varY = pair.sumYY - pair.sumY * pair.sumY / n;
     
-    // Calculate covariance and standard deviations
-    float covariance = 0.0f;
-    float varX = 0.0f;
-    float varY = 0.0f;
+    double denominator = std::sqrt(std::max(0.0, varX) * std::max(0.0, varY));
+    if (denominator < 0.0001) {
+        return 0.0f;
+    }
     
-    for (size_t i = 0; i < n; ++i) {
-        float dx = creatureValues[i] - meanX;
-        float dy = plantValues[i] - meanY;
-        covariance += dx * dy;
-        varX += dx * dx;
-        varY += dy * dy;
+    return static_cast<float>(std::clamp(covariance / denominator, -1.0, 1.0));
+}
+
+void CoevolutionTracker::calculateSlopes(const PairState& pair, float& creatureSlope, float& plantSlope) {
+    creatureSlope = 0.0f;
+    plantSlope = 0.0f;
+    double n = static_cast<double>(pair.samples.size());
+    if (n < 2.0) {
+        return;
     }
     
-    float denominator = std::sqrt(varX * varY);
-    if (denominator < 0.0001f) {
-        return 0.0f;
+    // Linear regression against position j = 0..n-1 in the window:
+    // m = (n*sum(jy) - sum(j)*sum(y)) / (n*sum(j^2) - (sum(j))^2)
+    double sumJ = n * (n - 1.0) / 2.0;
+    double sumJ2 = (n - 1.0) * n * (2.0 * n - 1.0) / 6.0;
+    double first = static_cast<double>(pair.firstOrdinal);
+    double sumJX = pair.sumKX - first * pair.sumX;
+    double sumJY = pair.sumKY - first * pair.sumY;
+    
+    double denominator = n * sumJ2 - sumJ * sumJ;
+    if (std::abs(denominator) < 0.0001) {
+        return;
     }
     
-    return covariance / denominator;
+    creatureSlope = static_cast<float>((n * sumJX - sumJ * pair.sumX) / denominator);
+    plantSlope = static_cast<float>((n * sumJY - sumJ * pair.sumY) / denominator);
 }
 
-std::string CoevolutionTracker::detectTrend(
-    const std::vector<float>& creatureValues,
-    const std::vector<float>& plantValues
-) const {
-    if (creatureValues.size() < static_cast<size_t>(config_.minGenerationsForTrend)) {
+std::string CoevolutionTracker::detectTrend(const PairState& pair) const {
+    if (pair.samples.size() < static_cast<size_t>(config_.minGenerationsForTrend)) {
         return "insufficient_data";
     }
     
-    float creatureSlope = calculateSlope(creatureValues);
-    float plantSlope = calculateSlope(plantValues);
+    float creatureSlope = 0.0f;
+    float plantSlope = 0.0f;
+    calculateSlopes(pair, creatureSlope, plantSlope);
     
     // Both increasing = escalating arms race
     if (creatureSlope > config_.escalationThreshold && plantSlope > config_.escalationThreshold) {
@@ -500,62 +560,5 @@ std::string CoevolutionTracker::detectTrend(
     return "stable";
 }
 
-float CoevolutionTracker::calculateSlope(const std::vector<float>& values) const {
-    if (values.size() < 2) {
-        return 0.0f;
-    }
-    
-    size_t n = values.size();
-    
-    // Linear regression: y = mx + b
-    // m = (n*sum(xy) - sum(x)*sum(y)) / (n*sum(x^2) - (sum(x))^2)
-    
-    float sumX = 0.0f;
-    float sumY = 0.0f;
-    float sumXY = 0.0f;
-    float sumX2 = 0.0f;
-    
-    for (size_t i = 0; i < n; ++i) {
-        float x = static_cast<float>(i);
-        float y = values[i];
-        sumX += x;
-        sumY += y;
-        sumXY += x * y;
-        sumX2 += x * x;
-    }
-    
-    float denominator = static_cast<float>(n) * sumX2 - sumX * sumX;
-    if (std::abs(denominator) < 0.0001f) {
-        return 0.0f;
-    }
-    
-    return (static_cast<float>(n) * sumXY - sumX * sumY) / denominator;
-}
-
-float CoevolutionTracker::calculateVariance(const std::vector<float>& values) const {
-    if (values.size() < 2) {
-        return 0.0f;
-    }
-    
-    float mean = calculateMean(values);
-    
-    float sumSquaredDiff = 0.0f;
-    for (float v : values) {
-        float diff = v - mean;
-        sumSquaredDiff += diff * diff;
-    }
-    
-    return sumSquaredDiff / static_cast<float>(values.size() - 1);
-}
-
-float CoevolutionTracker::calculateMean(const std::vector<float>& values) const {
-    if (values.empty()) {
-        return 0.0f;
-    }
-    
-    float sum = std::accumulate(values.begin(), values.end(), 0.0f);
-    return sum / static_cast<float>(values.size());
-}
-
 } // namespace Genetics
 } // namespace EcoSim
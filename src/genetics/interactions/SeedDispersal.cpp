@@ -1,7 +1,7 @@
 #include "genetics/interactions/SeedDispersal.hpp"
 #include "genetics/expression/PhenotypeUtils.hpp"
+#include "genetics/core/RandomEngine.hpp"
 #include "logging/Logger.hpp"
-#include <chrono>
 #include <cmath>
 
 namespace EcoSim {
@@ -13,16 +13,15 @@ using PhenotypeUtils::getTraitSafe;
 // Constructors
 // ============================================================================
 
-SeedDispersal::SeedDispersal() {
-    // Initialize RNG with time-based seed
-    auto seed = static_cast<unsigned int>(
-        std::chrono::system_clock::now().time_since_epoch().count()
-    );
-    rng_.seed(seed);
+SeedDispersal::SeedDispersal() = default;
+
+SeedDispersal::SeedDispersal(unsigned int randomSeed)
+    : rng_(randomSeed, RandomSystem::SeedDispersal)
+    , seeded_(true) {
 }
 
-SeedDispersal::SeedDispersal(unsigned int randomSeed) {
-    rng_.seed(randomSeed);
+RandomStream& SeedDispersal::rng() const {
+    return seeded_ ? rng_ : RandomEngine::get();
 }
 
 // ============================================================================
@@ -74,7 +73,7 @@ DispersalEvent SeedDispersal::disperseByWind(
     
     // Add some randomness to direction (+-30 degrees)
     std::uniform_real_distribution<float> dirVariation(-30.0f, 30.0f);
-    float actualDirection = windDirection + dirVariation(rng_);
+    float actualDirection = windDirection + dirVariation(rng());
     
     // Generate directional offset
     auto offset = generateDirectionalOffset(distance, actualDirection);
@@ -190,7 +189,7 @@ DispersalEvent SeedDispersal::disperseByExplosive(const Plant& plant) const {
     
     // Random direction (360 degrees)
     std::uniform_real_distribution<float> dirDist(0.0f, 360.0f);
-    float direction = dirDist(rng_);
+    float direction = dirDist(rng());
     
     // Generate directional offset
     auto offset = generateDirectionalOffset(distance, direction);
@@ -223,7 +222,7 @@ DispersalEvent SeedDispersal::disperseByVegetative(const Plant& plant) const {
     
     // Random direction
     std::uniform_real_distribution<float> dirDist(0.0f, 360.0f);
-    float direction = dirDist(rng_);
+    float direction = dirDist(rng());
     
     auto offset = generateDirectionalOffset(distance, direction);
     event.targetX = event.originX + offset.first;
@@ -334,7 +333,7 @@ bool SeedDispersal::willBurrAttach(
     
     // Roll for attachment
     std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    return dist(rng_) < attachProbability;
+    return dist(rng()) < attachProbability;
 }
 
 bool SeedDispersal::willBurrDetach(
@@ -354,7 +353,7 @@ bool SeedDispersal::willBurrDetach(
     
     // Roll for detachment
     std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    return dist(rng_) < detachProbability;
+    return dist(rng()) < detachProbability;
 }
 
 float SeedDispersal::calculateExpectedBurrDistance(
@@ -379,11 +378,11 @@ float SeedDispersal::calculateExpectedBurrDistance(
 std::pair<int, int> SeedDispersal::generateRandomOffset(float maxDistance) const {
     // Random direction
     std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * 3.14159f);
-    float angle = angleDist(rng_);
+    float angle = angleDist(rng());
     
     // Random distance (uniform within circle)
     std::uniform_real_distribution<float> distDist(0.0f, maxDistance);
-    float distance = distDist(rng_);
+    float distance = distDist(rng());
     
     int dx = static_cast<int>(std::round(distance * std::cos(angle)));
     int dy = static_cast<int>(std::round(distance * std::sin(angle)));
@@ -10,6 +10,7 @@
 #include "genetics/interactions/SeedDispersal.hpp"
 #include "genetics/systems/PerceptionSystem.hpp"
 #include "genetics/interactions/CombatInteraction.hpp"
+#include "memoryUsage.hpp"
 #include <algorithm>
 #include <cmath>
 #include <sstream>
@@ -38,8 +39,8 @@ namespace EcoSim {
 namespace Genetics {
 
 // Static member initialization
-int Organism::nextId_ = 1;
-int Organism::nextCreatureId_ = 0;
+std::atomic<int> Organism::nextId_{1};
+std::atomic<int> Organism::nextCreatureId_{0};
 
 std::shared_ptr<GeneRegistry>     Organism::s_geneRegistry     = nullptr;
 std::unique_ptr<FeedingInteraction>  Organism::s_feedingInteraction = nullptr;
@@ -72,8 +73,8 @@ std::unique_ptr<Organism> Organism::makeOffspring(
 
 Organism::~Organism() {
     // Release archetype / biome flyweight population counts this
-    // organism was holding. Moved-from organisms have identity_ reset
-    // to nullptr by the move ctor/assignment, so they skip this path.
+    // organism was holding. Moved-from organisms have identity_ emptied
+    // by the move ctor/assignment, so they skip this path.
     if (identity_) {
         if (identity_->archetype) {
             identity_->archetype->decrementPopulation();
@@ -106,6 +107,7 @@ Organism::Organism(Organism&& other) noexcept
     , combat_(std::move(other.combat_))
     , thermal_(std::move(other.thermal_))
     , identity_(std::move(other.identity_))
+    , schedule_(other.schedule_)
     , organismBehaviorController_(std::move(other.organismBehaviorController_))
     , pendingOffspring_(std::move(other.pendingOffspring_))
 {
@@ -115,6 +117,7 @@ Organism::Organism(Organism&& other) noexcept
     // Invalidate moved-from object
     other.alive_ = false;
     other.registry_ = nullptr;
+    other.releaseComponents();
 }
 
 Organism& Organism::operator=(Organism&& other) noexcept {
@@ -152,6 +155,7 @@ Organism& Organism::operator=(Organism&& other) noexcept {
         combat_       = std::move(other.combat_);
         thermal_      = std::move(other.thermal_);
         identity_     = std::move(other.identity_);
+        schedule_     = other.schedule_;
         organismBehaviorController_ = std::move(other.organismBehaviorController_);
         pendingOffspring_ = std::move(other.pendingOffspring_);
 
@@ -161,10 +165,25 @@ Organism& Organism::operator=(Organism&& other) noexcept {
         // Invalidate moved-from object
         other.alive_ = false;
         other.registry_ = nullptr;
+        other.releaseComponents();
     }
     return *this;
 }
 
+void Organism::releaseComponents() {
+    // Moving out of a std::optional leaves it engaged, so empty them
+    // explicitly; otherwise the moved-from destructor would release the
+    // archetype population a second time.
+    mobility_.reset();
+    heterotrophy_.reset();
+    autotrophy_.reset();
+    reproduction_.reset();
+    combat_.reset();
+    thermal_.reset();
+    identity_.reset();
+    schedule_.reset();
+}
+
 void Organism::age(unsigned int ticks) {
     age_ += ticks;
     
@@ -419,6 +438,7 @@ void Organism::setHealth(float health) {
 void Organism::damage(float amount) {
     if (amount > 0.0f) {
         setHealth(health_ - amount);
+        wake();
     }
 }
 
@@ -489,6 +509,28 @@ std::string Organism::toString() const {
     return ss.str();
 }
 
+std::size_t Organism::memoryUsage() const {
+    return sizeof(*this) + heapUsage();
+}
+
+std::size_t Organism::heapUsage() const {
+    std::size_t bytes = genome_.heapUsage() + phenotype_.heapUsage();
+    if (heterotrophy_) {
+        bytes += Memory::heapBytes(heterotrophy_->gutSeeds)
+               + Memory::heapBytes(heterotrophy_->attachedBurrs);
+    }
+    if (identity_) {
+        bytes += Memory::heapBytes(identity_->speciesName);
+    }
+    if (organismBehaviorController_) {
+        bytes += organismBehaviorController_->memoryUsage();
+    }
+    if (pendingOffspring_) {
+        bytes += pendingOffspring_->memoryUsage();
+    }
+    return bytes;
+}
+
 
 void Organism::updatePhenotypeContext(const EnvironmentState& env) {
     OrganismState orgState;
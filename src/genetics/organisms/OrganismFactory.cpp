@@ -85,35 +85,36 @@ void OrganismFactory::attachComponents(Organism& organism,
 
     // ----- Attach components per signature -----
     if (sig.mobility) {
-        organism.attachMobility(std::make_unique<MobilityComponent>());
-        organism.mobility()->worldX = static_cast<float>(x);
-        organism.mobility()->worldY = static_cast<float>(y);
-        organism.mobility()->direction = Direction::none;
+        MobilityComponent mobility;
+        mobility.worldX = static_cast<float>(x);
+        mobility.worldY = static_cast<float>(y);
+        mobility.direction = Direction::none;
+        organism.attachMobility(mobility);
     }
     if (sig.heterotrophy) {
-        organism.attachHeterotrophy(std::make_unique<HeterotrophyComponent>());
-        organism.heterotrophy()->hunger  = Constants::RESOURCE_LIMIT;
-        organism.heterotrophy()->thirst  = Constants::RESOURCE_LIMIT;
-        organism.heterotrophy()->fatigue = Constants::INIT_FATIGUE;
+        HeterotrophyComponent heterotrophy;
+        heterotrophy.hunger  = Constants::RESOURCE_LIMIT;
+        heterotrophy.thirst  = Constants::RESOURCE_LIMIT;
+        heterotrophy.fatigue = Constants::INIT_FATIGUE;
         if (organism.getGenome().hasGene(UniversalGenes::METABOLISM_RATE)) {
-            organism.heterotrophy()->metabolism =
+            heterotrophy.metabolism =
                 organism.getPhenotype().getTrait(UniversalGenes::METABOLISM_RATE) * 0.001f;
         } else {
-            organism.heterotrophy()->metabolism = 0.001f;
+            heterotrophy.metabolism = 0.001f;
         }
+        organism.attachHeterotrophy(std::move(heterotrophy));
     }
     if (sig.autotrophy) {
-        organism.attachAutotrophy(std::make_unique<AutotrophyComponent>());
+        organism.attachAutotrophy();
     }
     if (sig.combat) {
-        organism.attachCombat(std::make_unique<CombatComponent>());
+        organism.attachCombat();
     }
     if (sig.thermal) {
-        organism.attachThermal(std::make_unique<ThermalComponent>());
+        organism.attachThermal();
     }
     // Reproduction and identity: always attached.
-    organism.attachReproduction(std::make_unique<ReproductionComponent>());
-    organism.attachIdentity(std::make_unique<IdentityComponent>());
+    organism.attachReproduction();
 
     // ----- Archetype / biome classification -----
     // Heterotroph + mobility → creature archetypes (apex predator, pack
@@ -121,31 +122,33 @@ void OrganismFactory::attachComponents(Organism& organism,
     // (oak tree, grass, etc.). Everything else (hybrids) falls through
     // to the GenericPlant flyweight until Phase 4 populates the hybrid
     // catalogue (Phototroph, MobilePlant, SessileCreature).
+    IdentityComponent identity;
     if (sig.heterotrophy && sig.mobility) {
-        organism.identity()->archetype =
+        identity.archetype =
             CreatureTaxonomy::classifyArchetype(organism.getGenome());
-        organism.identity()->biomeAdaptation =
+        identity.biomeAdaptation =
             CreatureTaxonomy::classifyBiomeAdaptation(organism.getGenome());
     } else if (sig.autotrophy && !sig.heterotrophy) {
-        organism.identity()->archetype =
+        identity.archetype =
             PlantTaxonomy::classifyArchetype(organism.getGenome());
     } else {
-        organism.identity()->archetype = ArchetypeIdentity::GenericPlant();
+        identity.archetype = ArchetypeIdentity::GenericPlant();
     }
 
-    if (organism.identity()->archetype) {
-        organism.identity()->archetype->incrementPopulation();
+    if (identity.archetype) {
+        identity.archetype->incrementPopulation();
     }
-    if (organism.identity()->biomeAdaptation) {
-        organism.identity()->biomeAdaptation->incrementPopulation();
+    if (identity.biomeAdaptation) {
+        identity.biomeAdaptation->incrementPopulation();
     }
 
     // Species name generation uses diet/flock genes — only meaningful
     // for heterotrophs. Autotrophs fall through to archetype label via
     // Organism::getName().
     if (sig.heterotrophy) {
-        organism.identity()->speciesName = organism.generateName();
+        identity.speciesName = organism.generateName();
     }
+    organism.attachIdentity(std::move(identity));
 
     // ----- Initial state -----
     organism.setCurrentSize(0.1f);
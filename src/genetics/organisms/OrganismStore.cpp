@@ -0,0 +1,179 @@
+/**
+ * @file OrganismStore.cpp
+ * @brief Slot-mapped organism container.
+ *
+ * live_ and denseSlot_ are parallel arrays in turn order; slots_ maps a
+ * handle's slot back to its position in them. Every operation that moves
+ * an organism within live_ updates both directions of that mapping.
+ */
+
+#include "genetics/organisms/OrganismStore.hpp"
+#include "memoryUsage.hpp"
+
+#include <utility>
+
+namespace EcoSim {
+namespace Genetics {
+
+// ============================================================================
+// Insertion and lookup
+// ============================================================================
+
+OrganismStore::Handle OrganismStore::insert(OrganismPtr organism) {
+    if (!organism) return Handle{};
+    live_.push_back(std::move(organism));
+    return bind(live_.size() - 1);
+}
+
+Organism* OrganismStore::get(Handle handle) const {
+    if (handle.slot >= slots_.size()) return nullptr;
+    const Slot& slot = slots_[handle.slot];
+    if (!slot.used || slot.generation != handle.generation) return nullptr;
+    return live_[slot.dense].get();
+}
+
+OrganismStore::Handle OrganismStore::handleOf(int id) const {
+    auto it = idSlot_.find(id);
+    if (it == idSlot_.end()) return Handle{};
+    return Handle{it->second, slots_[it->second].generation};
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+std::size_t OrganismStore::collectOffspring() {
+    const std::size_t parents = live_.size();
+    std::size_t births = 0;
+    for (std::size_t i = 0; i < parents; ++i) {
+        if (!live_[i]->hasPendingOffspring()) continue;
+        OrganismPtr offspring = live_[i]->takePendingOffspring();
+        if (!offspring) continue;
+        insert(std::move(offspring));
+        ++births;
+    }
+    return births;
+}
+
+std::size_t OrganismStore::removeDead() {
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < live_.size(); ++read) {
+        const std::uint32_t slot = denseSlot_[read];
+        if (!live_[read]->isAlive()) {
+            release(slot);
+            continue;
+        }
+        if (write != read) {
+            live_[write] = std::move(live_[read]);
+            denseSlot_[write] = slot;
+            slots_[slot].dense = static_cast<std::uint32_t>(write);
+        }
+        ++write;
+    }
+
+    const std::size_t removed = live_.size() - write;
+    live_.resize(write);
+    denseSlot_.resize(write);
+    return removed;
+}
+
+void OrganismStore::clear() {
+    for (std::uint32_t slot : denseSlot_) {
+        release(slot);
+    }
+    live_.clear();
+    denseSlot_.clear();
+}
+
+void OrganismStore::reindex() {
+    // Detach the old mapping, then re-bind every organism, reusing the
+    // slot its ID held before where there was one
+    std::unordered_map<int, std::uint32_t> previous;
+    previous.swap(idSlot_);
+    std::vector<std::uint32_t> detached;
+    for (std::uint32_t index = 0; index < slots_.size(); ++index) {
+        if (slots_[index].used) {
+            slots_[index].used = false;
+            detached.push_back(index);
+        }
+    }
+
+    denseSlot_.assign(live_.size(), INVALID_SLOT);
+    for (std::size_t i = 0; i < live_.size(); ++i) {
+        auto it = previous.find(live_[i]->getId());
+        if (it == previous.end()) continue;
+
+        Slot& slot = slots_[it->second];
+        slot.used = true;
+        slot.dense = static_cast<std::uint32_t>(i);
+        denseSlot_[i] = it->second;
+        idSlot_.insert(*it);
+        previous.erase(it);
+    }
+
+    for (std::uint32_t index : detached) {
+        if (!slots_[index].used) {
+            ++slots_[index].generation;
+            freeSlots_.push_back(index);
+        }
+    }
+
+    for (std::size_t i = 0; i < live_.size(); ++i) {
+        if (denseSlot_[i] == INVALID_SLOT) {
+            bind(i);
+        }
+    }
+}
+
+std::size_t OrganismStore::memoryUsage() const {
+    std::size_t bytes = sizeof(*this)
+                      + Memory::heapBytes(live_)
+                      + Memory::heapBytes(denseSlot_)
+                      + Memory::heapBytes(slots_)
+                      + Memory::heapBytes(freeSlots_)
+                      + Memory::heapBytes(idSlot_);
+    for (const OrganismPtr& organism : live_) {
+        bytes += organism->memoryUsage();
+    }
+    return bytes;
+}
+
+// ============================================================================
+// Slots
+// ============================================================================
+
+OrganismStore::Handle OrganismStore::bind(std::size_t dense) {
+    std::uint32_t index;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+
+    Slot& slot = slots_[index];
+    slot.used = true;
+    slot.dense = static_cast<std::uint32_t>(dense);
+
+    if (denseSlot_.size() <= dense) {
+        denseSlot_.resize(dense + 1, INVALID_SLOT);
+    }
+    denseSlot_[dense] = index;
+    idSlot_[live_[dense]->getId()] = index;
+    return Handle{index, slot.generation};
+}
+
+void OrganismStore::release(std::uint32_t index) {
+    Slot& slot = slots_[index];
+    auto it = idSlot_.find(live_[slot.dense]->getId());
+    if (it != idSlot_.end() && it->second == index) {
+        idSlot_.erase(it);
+    }
+    slot.used = false;
+    ++slot.generation;
+    freeSlots_.push_back(index);
+}
+
+} // namespace Genetics
+} // namespace EcoSim
@@ -99,7 +99,7 @@ Plant::Plant(const Plant& other)
 
     // Attach a fresh identity with the same archetype classification; the
     // copy is a distinct living instance, so bump the archetype population.
-    attachIdentity(std::make_unique<IdentityComponent>());
+    attachIdentity();
     if (other.identity_) {
         identity_->archetype = other.identity_->archetype;
         identity_->biomeAdaptation = other.identity_->biomeAdaptation;
@@ -145,7 +145,7 @@ Plant& Plant::operator=(const Plant& other) {
         fruitTimer_ = other.fruitTimer_;
 
         // Attach a fresh identity, copying the archetype flyweight pointer
-        attachIdentity(std::make_unique<IdentityComponent>());
+        attachIdentity();
         if (other.identity_) {
             identity_->archetype = other.identity_->archetype;
             identity_->biomeAdaptation = other.identity_->biomeAdaptation;
@@ -303,9 +303,15 @@ bool Plant::canSpreadSeeds() const {
 }
 
 bool Plant::canSurviveTemperature(float temperature) const {
-    float tempLow = getGeneValueFromGenome(UniversalGenes::TEMP_TOLERANCE_LOW, 5.0f);
-    float tempHigh = getGeneValueFromGenome(UniversalGenes::TEMP_TOLERANCE_HIGH, 35.0f);
-    return temperature >= tempLow && temperature <= tempHigh;
+    return temperature >= getTempToleranceLow() && temperature <= getTempToleranceHigh();
+}
+
+float Plant::getTempToleranceLow() const {
+    return getGeneValueFromGenome(UniversalGenes::TEMP_TOLERANCE_LOW, 5.0f);
+}
+
+float Plant::getTempToleranceHigh() const {
+    return getGeneValueFromGenome(UniversalGenes::TEMP_TOLERANCE_HIGH, 35.0f);
 }
 
 // ============================================================================
@@ -674,6 +680,10 @@ std::string Plant::toString() const {
     return toJson().dump();
 }
 
+std::size_t Plant::memoryUsage() const {
+    return sizeof(*this) + heapUsage();
+}
+
 std::unique_ptr<Plant> Plant::fromString(const std::string& data,
                                           const GeneRegistry& registry) {
     try {
@@ -0,0 +1,396 @@
+/**
+ * @file PlantRecordStore.cpp
+ * @brief Compact plant records with shared genotypes.
+ *
+ * update() follows Plant::update() and Plant::grow() step for step, with
+ * the gene reads replaced by the genotype's PlantTraits. Keep the two in
+ * step when either changes.
+ */
+
+#include "genetics/organisms/PlantRecordStore.hpp"
+#include "genetics/organisms/PlantEnergyCalculator.hpp"
+#include "genetics/expression/EnvironmentalStress.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "logging/Logger.hpp"
+#include "memoryUsage.hpp"
+
+#include <algorithm>
+#include <variant>
+
+namespace EcoSim {
+namespace Genetics {
+
+namespace {
+
+/// Floats per gene: value and strength of each allele
+constexpr std::size_t ALLELE_FLOATS = 4;
+
+/// FNV-1a over a genotype's layout and packed alleles
+std::uint64_t fingerprint(std::uint32_t layout, const std::vector<float>& alleles) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    auto add = [&hash](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+    };
+    add(&layout, sizeof(layout));
+    add(alleles.data(), alleles.size() * sizeof(float));
+    return hash;
+}
+
+/// As Plant::getGeneValueFromGenome
+float geneValue(const Genome& genome, const char* geneId, float defaultValue) {
+    if (genome.hasGene(geneId)) {
+        GeneValue value = genome.getGene(geneId).getExpressedValue(DominanceType::Incomplete);
+        if (std::holds_alternative<float>(value)) {
+            return std::get<float>(value);
+        }
+    }
+    return defaultValue;
+}
+
+} // namespace
+
+// ============================================================================
+// PlantTraits
+// ============================================================================
+
+PlantTraits PlantTraits::fromPlant(const Plant& plant) {
+    PlantTraits traits;
+    traits.maxSize = plant.getMaxSize();
+    traits.growthRate = plant.getGrowthRate();
+    traits.lightNeed = plant.getLightNeed();
+    traits.waterNeed = plant.getWaterNeed();
+    traits.tempToleranceLow = plant.getTempToleranceLow();
+    traits.tempToleranceHigh = plant.getTempToleranceHigh();
+    traits.waterStorage = geneValue(plant.getGenome(), UniversalGenes::WATER_STORAGE, 0.0f);
+    traits.hardiness = plant.getHardiness();
+    traits.lifespan = plant.getMaxLifespan();
+    traits.fruitAppeal = plant.getFruitAppeal();
+    traits.toxicity = plant.getToxicity();
+    traits.thornDamage = plant.getThornDamage();
+    traits.scentProductionRate = plant.getScentProductionRate();
+    traits.fruitProductionRate = plant.getFruitProductionRate();
+    traits.runnerProduction = plant.getRunnerProduction();
+    return traits;
+}
+
+// ============================================================================
+// Insertion
+// ============================================================================
+
+std::size_t PlantRecordStore::add(const Plant& plant) {
+    PlantRecord record;
+    record.id = plant.getId();
+    record.x = plant.getX();
+    record.y = plant.getY();
+    record.genotype = internGenotype(plant);
+    record.age = plant.age_;
+    record.fruitTimer = plant.fruitTimer_;
+    record.currentSize = plant.currentSize_;
+    record.health = plant.alive_ ? plant.health_ : 0.0f;
+    record.energy = plant.energyState_.currentEnergy;
+    record.mature = plant.mature_;
+
+    records_.push_back(record);
+    return records_.size() - 1;
+}
+
+std::uint32_t PlantRecordStore::internLayout(const Genome& genome) {
+    auto matches = [&genome](const GeneLayout& layout) {
+        std::size_t i = 0;
+        for (const Chromosome& chromosome : genome) {
+            for (const Gene& gene : chromosome.getGenes()) {
+                if (i >= layout.genes.size() ||
+                    layout.genes[i].first != chromosome.getType() ||
+                    layout.genes[i].second != gene.getId()) {
+                    return false;
+                }
+                ++i;
+            }
+        }
+        return i == layout.genes.size();
+    };
+
+    for (std::size_t i = 0; i < layouts_.size(); ++i) {
+        if (matches(layouts_[i])) return static_cast<std::uint32_t>(i);
+    }
+
+    GeneLayout layout;
+    for (const Chromosome& chromosome : genome) {
+        for (const Gene& gene : chromosome.getGenes()) {
+            layout.genes.emplace_back(chromosome.getType(), gene.getId());
+        }
+    }
+    layout.genes.shrink_to_fit();
+    layouts_.push_back(std::move(layout));
+    return static_cast<std::uint32_t>(layouts_.size() - 1);
+}
+
+std::uint32_t PlantRecordStore::internGenotype(const Plant& plant) {
+    const Genome& genome = plant.getGenome();
+    const std::uint32_t layout = internLayout(genome);
+
+    std::vector<float> alleles;
+    alleles.reserve(layouts_[layout].genes.size() * ALLELE_FLOATS);
+    bool packed = true;
+    for (const Chromosome& chromosome : genome) {
+        for (const Gene& gene : chromosome.getGenes()) {
+            for (const Allele* allele : {&gene.getAllele1(), &gene.getAllele2()}) {
+                const float* value = std::get_if<float>(&allele->value);
+                if (!value) {
+                    packed = false;
+                    break;
+                }
+                alleles.push_back(*value);
+                alleles.push_back(allele->expression_strength);
+            }
+        }
+    }
+
+    // Share an existing genotype when the alleles match exactly
+    std::uint64_t hash = 0;
+    if (packed) {
+        hash = fingerprint(layout, alleles);
+        auto it = genotypeByFingerprint_.find(hash);
+        if (it != genotypeByFingerprint_.end()) {
+            Genotype& existing = genotypes_[it->second];
+            if (existing.plants > 0 && existing.layout == layout && existing.alleles == alleles) {
+                ++existing.plants;
+                return it->second;
+            }
+        }
+    }
+
+    std::uint32_t index;
+    if (!freeGenotypes_.empty()) {
+        index = freeGenotypes_.back();
+        freeGenotypes_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(genotypes_.size());
+        genotypes_.emplace_back();
+    }
+
+    Genotype& genotype = genotypes_[index];
+    genotype.traits = PlantTraits::fromPlant(plant);
+    genotype.layout = layout;
+    genotype.plants = 1;
+    genotype.fingerprint = hash;
+    if (packed) {
+        genotype.alleles = std::move(alleles);
+        genotypeByFingerprint_[hash] = index;
+    } else {
+        // Other value types are rare enough to keep the genome as it is
+        genotype.fullGenome = std::make_unique<Genome>(genome);
+    }
+    return index;
+}
+
+void PlantRecordStore::releaseGenotype(std::uint32_t index) {
+    Genotype& genotype = genotypes_[index];
+    if (--genotype.plants > 0) return;
+
+    if (!genotype.fullGenome) {
+        auto it = genotypeByFingerprint_.find(genotype.fingerprint);
+        if (it != genotypeByFingerprint_.end() && it->second == index) {
+            genotypeByFingerprint_.erase(it);
+        }
+    }
+    std::vector<float>().swap(genotype.alleles);
+    genotype.fullGenome.reset();
+    freeGenotypes_.push_back(index);
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+void PlantRecordStore::update(std::size_t index, const EnvironmentState& env) {
+    PlantRecord& record = records_[index];
+    if (!record.isAlive()) return;
+    const PlantTraits& traits = genotypes_[record.genotype].traits;
+
+    // Grow, as Plant::grow()
+    if (record.currentSize >= traits.maxSize) {
+        record.mature = true;
+    } else {
+        CombinedPlantStress stress = EnvironmentalStressCalculator::calculatePlantStress(
+            env, traits.tempToleranceLow, traits.tempToleranceHigh,
+            traits.waterNeed, traits.waterStorage);
+
+        if (stress.combinedHealthDamage > 0.0f) {
+            takeDamage(index, stress.combinedHealthDamage);
+        }
+
+        bool canSurviveTemp = stress.temperature.severity != StressLevel::Lethal;
+        float effectiveGrowth = PlantEnergyCalculator::calculatePhotosynthesisGrowth(
+            env, traits.lightNeed, traits.waterNeed, traits.growthRate, canSurviveTemp);
+        effectiveGrowth *= stress.combinedGrowthModifier;
+
+        record.currentSize = std::min(record.currentSize + effectiveGrowth, traits.maxSize);
+        if (!record.mature && record.currentSize >= traits.maxSize * 0.5f) {
+            record.mature = true;
+        }
+    }
+
+    ++record.fruitTimer;
+    ++record.age;
+
+    if (record.isAlive() && record.age > traits.lifespan) {
+        die(index, "old_age");
+    }
+}
+
+void PlantRecordStore::takeDamage(std::size_t index, float amount) {
+    PlantRecord& record = records_[index];
+    if (!record.isAlive()) return;
+
+    const float hardiness = genotypes_[record.genotype].traits.hardiness;
+    record.health = std::max(0.0f, record.health - amount * (1.0f - hardiness * 0.5f));
+    if (record.health <= 0.0f) {
+        die(index, "damage");
+    }
+}
+
+void PlantRecordStore::sync(std::size_t index, const Plant& plant) {
+    PlantRecord& record = records_[index];
+    record.age = plant.age_;
+    record.fruitTimer = plant.fruitTimer_;
+    record.currentSize = plant.currentSize_;
+    record.health = plant.alive_ ? plant.health_ : 0.0f;
+    record.energy = plant.energyState_.currentEnergy;
+    record.mature = plant.mature_;
+}
+
+void PlantRecordStore::die(std::size_t index, const char* cause) {
+    PlantRecord& record = records_[index];
+    record.health = 0.0f;
+    logging::Logger::getInstance().plantDied(
+        record.id, "plant", cause, static_cast<int>(record.age));
+}
+
+std::size_t PlantRecordStore::removeDead() {
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < records_.size(); ++read) {
+        if (!records_[read].isAlive()) {
+            releaseGenotype(records_[read].genotype);
+            continue;
+        }
+        if (write != read) records_[write] = records_[read];
+        ++write;
+    }
+    const std::size_t removed = records_.size() - write;
+    records_.resize(write);
+    return removed;
+}
+
+void PlantRecordStore::clear() {
+    records_.clear();
+    genotypes_.clear();
+    freeGenotypes_.clear();
+    genotypeByFingerprint_.clear();
+    layouts_.clear();
+}
+
+// ============================================================================
+// Access
+// ============================================================================
+
+bool PlantRecordStore::canSpreadVegetatively(std::size_t index) const {
+    const PlantRecord& record = records_[index];
+    if (!record.isAlive() || !record.mature) return false;
+
+    const PlantTraits& traits = genotypes_[record.genotype].traits;
+    if (record.currentSize < traits.maxSize * 0.5f) return false;
+
+    float maturityAge = static_cast<float>(traits.lifespan) * 0.10f;
+    if (record.age < static_cast<unsigned int>(maturityAge)) return false;
+
+    if (traits.runnerProduction < 0.5f) return false;
+
+    unsigned int cooldown = static_cast<unsigned int>(150.0f / (traits.runnerProduction + 0.1f));
+    return record.fruitTimer >= cooldown;
+}
+
+std::array<float, 8> PlantRecordStore::scentSignature(std::size_t index) const {
+    const PlantRecord& record = records_[index];
+    const PlantTraits& traits = genotypes_[record.genotype].traits;
+
+    std::array<float, 8> signature;
+    signature[0] = traits.fruitAppeal;
+    signature[1] = traits.toxicity;
+    signature[2] = traits.thornDamage;
+    signature[3] = traits.hardiness;
+    signature[4] = 1.0f;
+
+    unsigned int id = static_cast<unsigned int>(record.id);
+    signature[5] = static_cast<float>(id % 1000) / 1000.0f;
+    signature[6] = static_cast<float>((id / 1000) % 1000) / 1000.0f;
+    signature[7] = static_cast<float>((id / 1000000) % 1000) / 1000.0f;
+    return signature;
+}
+
+// ============================================================================
+// Materialization
+// ============================================================================
+
+Genome PlantRecordStore::genome(std::size_t index) const {
+    const Genotype& genotype = genotypes_[records_[index].genotype];
+    if (genotype.fullGenome) return *genotype.fullGenome;
+
+    Genome genome;
+    const GeneLayout& layout = layouts_[genotype.layout];
+    for (std::size_t i = 0; i < layout.genes.size(); ++i) {
+        const float* a = &genotype.alleles[i * ALLELE_FLOATS];
+        Gene gene(layout.genes[i].second,
+                  Allele(GeneValue(a[0]), a[1]),
+                  Allele(GeneValue(a[2]), a[3]));
+        genome.addGene(gene, layout.genes[i].first);
+    }
+    return genome;
+}
+
+Plant PlantRecordStore::materialize(std::size_t index, const GeneRegistry& registry) const {
+    const PlantRecord& record = records_[index];
+    Plant plant(record.x, record.y, genome(index), registry);
+
+    plant.age_ = record.age;
+    plant.fruitTimer_ = record.fruitTimer;
+    plant.setCurrentSize(record.currentSize);
+    plant.setMature(record.mature);
+    plant.energyState_.currentEnergy = record.energy;
+    plant.health_ = record.health;
+    if (!record.isAlive()) {
+        plant.die();
+    }
+    plant.updatePhenotype();
+    return plant;
+}
+
+std::size_t PlantRecordStore::memoryUsage() const {
+    std::size_t bytes = sizeof(*this)
+                      + Memory::heapBytes(records_)
+                      + Memory::heapBytes(genotypes_)
+                      + Memory::heapBytes(freeGenotypes_)
+                      + Memory::heapBytes(genotypeByFingerprint_)
+                      + Memory::heapBytes(layouts_);
+    for (const Genotype& genotype : genotypes_) {
+        bytes += Memory::heapBytes(genotype.alleles);
+        if (genotype.fullGenome) {
+            bytes += sizeof(Genome) + genotype.fullGenome->heapUsage();
+        }
+    }
+    for (const GeneLayout& layout : layouts_) {
+        bytes += Memory::heapBytes(layout.genes);
+        for (const auto& gene : layout.genes) {
+            bytes += Memory::heapBytes(gene.second);
+        }
+    }
+    return bytes;
+}
+
+} // namespace Genetics
+} // namespace EcoSim
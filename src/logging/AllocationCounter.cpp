@@ -0,0 +1,48 @@
+#include "logging/TickMetrics.hpp"
+
+#include <cstdlib>
+#include <new>
+
+/**
+ * Global operator new replaced to count allocations per thread, for the
+ * allocations-per-tick metric. A thread-local counter keeps threads from
+ * contending on it. operator new[] and the nothrow forms forward to this
+ * one; over-aligned allocations are not counted.
+ */
+
+namespace {
+
+thread_local std::uint64_t t_allocations = 0;
+
+} // namespace
+
+namespace logging {
+
+std::uint64_t threadAllocationCount() {
+    return t_allocations;
+}
+
+} // namespace logging
+
+#if ECOSIM_PROFILING
+
+void* operator new(std::size_t size) {
+    ++t_allocations;
+    if (size == 0) size = 1;
+    for (;;) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#endif
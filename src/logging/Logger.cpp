@@ -1,5 +1,6 @@
 #include "logging/Logger.hpp"
 #include "genetics/interactions/DamageTypes.hpp"
+#include "memoryUsage.hpp"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -533,6 +534,42 @@ void Logger::extinction(const std::string& entityType) {
     log(LogLevel::CRITICAL, "EXTINCTION", -1, entityType, "");
 }
 
+// === Memory ===
+
+void Logger::memoryBudgetExceeded(const std::string& subsystem, size_t bytes, size_t budget) {
+    std::ostringstream details;
+    details << "bytes:" << bytes << ",budget:" << budget
+            << ",over:" << std::fixed << std::setprecision(1)
+            << 100.0 * (static_cast<double>(bytes) / static_cast<double>(budget) - 1.0) << "%";
+    log(LogLevel::WARN, "MEMORY_BUDGET", -1, subsystem, details.str());
+}
+
+size_t Logger::memoryUsage() const {
+    using EcoSim::Memory::heapBytes;
+    using EcoSim::Memory::heapBytesWithKeys;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t bytes = sizeof(*this)
+                 + heapBytesWithKeys(m_deathStats.creatureDeathsByCause)
+                 + heapBytesWithKeys(m_deathStats.plantDeathsByCause)
+                 + heapBytesWithKeys(m_deathStats.creatureDeathsByType)
+                 + heapBytesWithKeys(m_deathStats.plantDeathsBySpecies)
+                 + heapBytesWithKeys(m_feedingStats.feedingsByCreatureType)
+                 + heapBytesWithKeys(m_breedingStats.noMateReasons)
+                 + heapBytes(m_populationHistory)
+                 + heapBytes(m_breedingHistory)
+                 + heapBytes(m_pendingFileWrites)
+                 + heapBytes(m_disabledEventTypes)
+                 + heapBytes(m_enabledEventTypes);
+    for (const BreedingSnapshot& snapshot : m_breedingHistory) {
+        bytes += heapBytes(snapshot.noMateReason);
+    }
+    for (const std::string& line : m_pendingFileWrites) {
+        bytes += heapBytes(line);
+    }
+    return bytes;
+}
+
 // === Energy ===
 
 void Logger::energyChange(int entityId, const std::string& reason, float before, float after) {
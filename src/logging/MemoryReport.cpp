@@ -0,0 +1,107 @@
+#include "logging/MemoryReport.hpp"
+#include "logging/Logger.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace logging {
+
+// ============================================================================
+// MemoryReport
+// ============================================================================
+
+std::size_t MemoryReport::total() const {
+    std::size_t bytes = 0;
+    for (const Entry& entry : entries_) {
+        bytes += entry.bytes;
+    }
+    return bytes;
+}
+
+const MemoryReport::Entry* MemoryReport::find(const std::string& name) const {
+    for (const Entry& entry : entries_) {
+        if (name == entry.name) return &entry;
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// MemoryBudget
+// ============================================================================
+
+void MemoryBudget::setLimit(const std::string& name, std::size_t bytes) {
+    for (Limit& limit : limits_) {
+        if (limit.name == name) {
+            limit.bytes = bytes;
+            limit.over = false;
+            return;
+        }
+    }
+    limits_.push_back({name, bytes});
+}
+
+bool MemoryBudget::parseLimit(const std::string& spec) {
+    const std::size_t equals = spec.find('=');
+    if (equals == 0 || equals == std::string::npos) return false;
+
+    const std::string value = spec.substr(equals + 1);
+    char* end = nullptr;
+    const double megabytes = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || !(megabytes > 0.0)) return false;
+
+    setLimit(spec.substr(0, equals), static_cast<std::size_t>(megabytes * 1024.0 * 1024.0));
+    return true;
+}
+
+MemoryBudget MemoryBudget::fromEnvironment() {
+    MemoryBudget budget;
+    const char* env = std::getenv("ECOSIM_MEMORY_BUDGET");
+    if (!env) return budget;
+
+    std::istringstream items(env);
+    for (std::string item; std::getline(items, item, ',');) {
+        if (!item.empty() && !budget.parseLimit(item)) {
+            std::cerr << "[Memory] Ignoring ECOSIM_MEMORY_BUDGET item '" << item
+                      << "' (expected NAME=MB)" << std::endl;
+        }
+    }
+    return budget;
+}
+
+std::size_t MemoryBudget::limitFor(const std::string& name) const {
+    for (const Limit& limit : limits_) {
+        if (limit.name == name) return limit.bytes;
+    }
+    return 0;
+}
+
+std::vector<MemoryBudget::Overrun> MemoryBudget::check(const MemoryReport& report) {
+    std::vector<Overrun> overruns;
+    for (Limit& limit : limits_) {
+        std::size_t bytes = 0;
+        if (limit.name == TOTAL) {
+            bytes = report.total();
+        } else if (const MemoryReport::Entry* entry = report.find(limit.name)) {
+            bytes = entry->bytes;
+        }
+
+        const bool over = bytes > limit.bytes;
+        if (over && !limit.over) {
+            Logger::getInstance().memoryBudgetExceeded(limit.name, bytes, limit.bytes);
+            overruns.push_back({limit.name, bytes, limit.bytes});
+        }
+        limit.over = over;
+    }
+    return overruns;
+}
+
+std::vector<std::string> MemoryBudget::exceeded() const {
+    std::vector<std::string> names;
+    for (const Limit& limit : limits_) {
+        if (limit.over) names.push_back(limit.name);
+    }
+    return names;
+}
+
+} // namespace logging
@@ -0,0 +1,181 @@
+#include "logging/Profiler.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace logging {
+
+namespace {
+
+// The calling thread's buffer; owned by the Profiler, which never frees a
+// buffer, so the pointer stays valid for the thread's lifetime
+thread_local Profiler::ThreadBuffer* t_buffer = nullptr;
+
+void writeEscaped(std::ostream& out, const char* text) {
+    for (; *text; ++text) {
+        const char c = *text;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+}
+
+/** @brief Nanoseconds as trace microseconds with nanosecond precision */
+void writeMicros(std::ostream& out, std::int64_t ns) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%lld.%03lld",
+                  static_cast<long long>(ns / 1000), static_cast<long long>(ns % 1000));
+    out << text;
+}
+
+} // namespace
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+// ============================================================================
+// Capture control
+// ============================================================================
+
+void Profiler::start() {
+    if (isRecording()) return;
+
+    {
+        // Every zone has closed (stop() waited for them) and none can open
+        // until recording_ is set, so the buffers can be reset here
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& buffer : buffers_) {
+            buffer->events.clear();
+            buffer->dropped = 0;
+        }
+    }
+    captureStartNs_ = now();
+    recording_.store(true);
+}
+
+void Profiler::stop() {
+    if (!isRecording()) return;
+    recording_.store(false);
+
+    // A zone opened on the calling thread is still in its scope and closes
+    // after this returns; only other threads can be mid-write
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& buffer : buffers_) {
+        if (buffer.get() == t_buffer) continue;
+        while (buffer->openZones.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer.threadName = name;
+}
+
+// ============================================================================
+// Zone recording
+// ============================================================================
+
+Profiler::ThreadBuffer* Profiler::beginZone() {
+    ThreadBuffer& buffer = threadBuffer();
+
+    // Count the zone as open before confirming the capture is still running.
+    // stop() clears recording_ before reading openZones, so either it sees
+    // this zone and waits for it, or this sees the capture has stopped.
+    buffer.openZones.fetch_add(1);
+    if (!recording_.load()) {
+        buffer.openZones.fetch_sub(1, std::memory_order_release);
+        return nullptr;
+    }
+    return &buffer;
+}
+
+Profiler::ThreadBuffer& Profiler::threadBuffer() {
+    if (!t_buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_.push_back(std::make_unique<ThreadBuffer>());
+        t_buffer = buffers_.back().get();
+        t_buffer->threadId = static_cast<std::uint32_t>(buffers_.size());
+        t_buffer->threadName = "thread " + std::to_string(t_buffer->threadId);
+    }
+    return *t_buffer;
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+std::size_t Profiler::eventCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t count = 0;
+    for (const auto& buffer : buffers_) {
+        count += buffer->events.size();
+    }
+    return count;
+}
+
+std::size_t Profiler::droppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t count = 0;
+    for (const auto& buffer : buffers_) {
+        count += buffer->dropped;
+    }
+    return count;
+}
+
+std::vector<std::pair<std::uint32_t, ProfileEvent>> Profiler::events() const {
+    std::vector<std::pair<std::uint32_t, ProfileEvent>> result;
+    if (isRecording()) return result;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        for (const ProfileEvent& event : buffer->events) {
+            result.emplace_back(buffer->threadId, event);
+        }
+    }
+    return result;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    if (isRecording()) return false;
+
+    std::ofstream out(path);
+    if (!out) return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& buffer : buffers_) {
+        if (buffer->events.empty()) continue;
+
+        out << (first ? "" : ",\n")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+            << ",\"args\":{\"name\":\"";
+        writeEscaped(out, buffer->threadName.c_str());
+        out << "\"}}";
+        first = false;
+
+        for (const ProfileEvent& event : buffer->events) {
+            out << ",\n{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"ecosim\",\"ph\":\"X\",\"ts\":";
+            writeMicros(out, event.startNs - captureStartNs_);
+            out << ",\"dur\":";
+            writeMicros(out, event.durationNs);
+            out << ",\"pid\":1,\"tid\":" << buffer->threadId << "}";
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace logging
@@ -0,0 +1,135 @@
+#include "logging/TickMetrics.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace logging {
+
+const char* tickPhaseName(TickPhase phase) {
+    switch (phase) {
+        case TickPhase::EnvironmentCache: return "environment_cache";
+        case TickPhase::SpatialIndex:     return "spatial_index";
+        case TickPhase::WorldObjects:     return "world_objects";
+        case TickPhase::ScentLayer:       return "scent_layer";
+        case TickPhase::Corpses:          return "corpses";
+        case TickPhase::BreedingScents:   return "breeding_scents";
+        case TickPhase::CreatureTurns:    return "creature_turns";
+        case TickPhase::Offspring:        return "offspring";
+        case TickPhase::RemoveDead:       return "remove_dead";
+        case TickPhase::Statistics:       return "statistics";
+        default:                          return "unknown";
+    }
+}
+
+TickMetrics& TickMetrics::getInstance() {
+    static TickMetrics instance;
+    return instance;
+}
+
+void TickMetrics::clear() {
+    history_.head_ = 0;
+    history_.size_ = 0;
+    inTick_ = false;
+    for (auto& name : history_.behaviorNames_) {
+        name.clear();
+    }
+    history_.behaviorCount_ = 0;
+    history_.memory_.fill(MemoryGauge{});
+    history_.memoryCount_ = 0;
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void TickMetrics::beginTick(std::uint64_t tick) {
+    inTick_ = isEnabled();
+    if (!inTick_) return;
+
+    current_ = Sample{};
+    current_.tick = tick;
+    tickStartAllocations_ = threadAllocationCount();
+    tickStartNs_ = now();
+}
+
+void TickMetrics::endTick() {
+    if (!inTick_) return;
+    inTick_ = false;
+
+    current_.totalMs = toMs(now() - tickStartNs_);
+    current_.allocations = static_cast<std::uint32_t>(threadAllocationCount() - tickStartAllocations_);
+
+    history_.samples_[history_.head_] = current_;
+    history_.head_ = (history_.head_ + 1) % HISTORY_SIZE;
+    if (history_.size_ < HISTORY_SIZE) ++history_.size_;
+
+    if (current_.tick % MEMORY_SAMPLE_INTERVAL == 0) {
+        sampleProcessMemory();
+    }
+}
+
+void TickMetrics::recordBehavior(const std::string& behaviorId, std::int64_t ns) {
+    if (!inTick_) return;
+
+    std::array<std::string, MAX_BEHAVIORS>& names = history_.behaviorNames_;
+    std::size_t& count = history_.behaviorCount_;
+    std::size_t index = 0;
+    while (index < count && names[index] != behaviorId) {
+        ++index;
+    }
+    if (index == count) {
+        // First sighting; the only allocation, once per behavior ID
+        if (count == MAX_BEHAVIORS) return;
+        names[count++] = behaviorId;
+    }
+
+    ++current_.behaviorCalls[index];
+    current_.behaviorMs[index] += toMs(ns);
+}
+
+void TickMetrics::recordSpatialIndex(std::size_t indexed, std::size_t occupiedCells,
+                                     std::size_t totalCells, std::size_t largestCell) {
+    if (!inTick_) return;
+    current_.indexedCreatures = static_cast<std::uint32_t>(indexed);
+    current_.occupiedCells = static_cast<std::uint32_t>(occupiedCells);
+    current_.totalCells = static_cast<std::uint32_t>(totalCells);
+    current_.largestCell = static_cast<std::uint32_t>(largestCell);
+}
+
+void TickMetrics::setMemory(const char* name, std::size_t bytes,
+                            std::size_t objects, std::size_t budget) {
+    std::array<MemoryGauge, MAX_MEMORY_GAUGES>& gauges = history_.memory_;
+    std::size_t& count = history_.memoryCount_;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::strcmp(gauges[i].name, name) == 0) {
+            gauges[i] = MemoryGauge{name, bytes, objects, budget};
+            return;
+        }
+    }
+    if (count < MAX_MEMORY_GAUGES) {
+        gauges[count++] = MemoryGauge{name, bytes, objects, budget};
+    }
+}
+
+void TickMetrics::sampleProcessMemory() {
+#if defined(__linux__)
+    // statm: total and resident size in pages
+    std::FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) return;
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    const int read = std::fscanf(file, "%lu %lu", &totalPages, &residentPages);
+    std::fclose(file);
+    if (read != 2) return;
+
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    setMemory("process (resident)",
+              residentPages * static_cast<std::size_t>(pageSize));
+#endif
+}
+
+} // namespace logging
@@ -20,23 +20,30 @@
 #include "../include/fileHandling.hpp"
 #include "../include/calendar.hpp"
 #include "../include/timing.hpp"
+#include "../include/simulationThread.hpp"
+#include "../include/simulationTick.hpp"
 
 // RenderSystem includes - abstract rendering interface
 #include "../include/rendering/RenderSystem.hpp"
 #include "../include/rendering/RenderTypes.hpp"
 #include "../include/rendering/IRenderer.hpp"
+#include "../include/rendering/RenderSnapshot.hpp"
 
 // Genetics system integration
+#include "../include/genetics/core/RandomEngine.hpp"
 #include "../include/genetics/defaults/UniversalGenes.hpp"
 #include "../include/genetics/organisms/PlantFactory.hpp"
 #include "../include/genetics/organisms/CreatureFactory.hpp"
 #include "../include/genetics/organisms/BiomeVariantExamples.hpp"
+#include "../include/genetics/organisms/OrganismStore.hpp"
 
 // World systems
 #include "../include/world/ClimateWorldGenerator.hpp"
 
 // Logging system for diagnostics
 #include "../include/logging/Logger.hpp"
+#include "../include/logging/TickMetrics.hpp"
+#include "../include/logging/MemoryReport.hpp"
 
 #include <stdlib.h>
 #include <random>
@@ -51,6 +58,7 @@
 using namespace std;
 using EcoSim::Genetics::Organism;
 using EcoSim::Genetics::OrganismPtr;
+using EcoSim::Genetics::OrganismStore;
 
 // Set by main() when --new-world is passed. Makes runWorldEditor skip its
 // input loop (auto-confirm) so the sim can iterate without user clicks.
@@ -67,6 +75,7 @@ const static unsigned INITIAL_POPULATION      = 200;
 const static float    STARTING_RESOURCE_MIN   = 4.0f;
 const static float    STARTING_RESOURCE_MAX   = 10.0f;
 const static unsigned PLANT_WARMUP            = 100;   // Ticks for plants to mature before creatures spawn
+const static int      MEMORY_REPORT_INTERVAL  = 300;   // Ticks between memory reports (walks every organism)
 
 //================================================================================
 //  World generation defualt values
@@ -120,6 +129,7 @@ const static unsigned THORN_SPAWN_RATE        = 2;
 //================================================================================
 const static unsigned MAP_HORI_BORDER         = 2;
 const static unsigned MAP_VERT_BORDER         = 4;
+const static unsigned SNAPSHOT_MARGIN         = 8;     // Tiles captured beyond the viewport edges
 
 const static vector<string> SAVE_FILES = {
   "SAVE_01",
@@ -132,10 +142,11 @@ const static vector<string> SAVE_FILES = {
 //================================================================================
 class RandomGenerator {
 private:
-  std::mt19937 _gen;
+  EcoSim::Genetics::RandomStream _gen;
   std::mutex _mutex;
   
-  RandomGenerator() : _gen(std::random_device{}()) {}
+  RandomGenerator()
+    : _gen(EcoSim::Genetics::RandomEngine::stream(EcoSim::Genetics::RandomSystem::Spawning)) {}
   
 public:
   // Delete copy constructor and assignment operator
@@ -147,7 +158,7 @@ public:
     return instance;
   }
   
-  std::mt19937& generator() {
+  EcoSim::Genetics::RandomStream& generator() {
     return _gen;
   }
   
@@ -163,15 +174,38 @@ public:
   }
 };
 
-// Convenience function to get the random generator
-static std::mt19937& gen() {
-  return RandomGenerator::instance().generator();
-}
-
 //================================================================================
 //  Structs
 //================================================================================
-struct Settings { bool alive, hudIsOn, isPaused; };
+struct Settings {
+  bool alive, hudIsOn, isPaused;
+  string status;                                    //  HUD status line notice
+  std::chrono::steady_clock::time_point statusUntil;
+};
+
+//  How long a status line notice stays on the HUD
+constexpr std::chrono::seconds STATUS_DURATION(3);
+
+/**
+ *  Shows a short notice on the HUD status line. Input handlers use this
+ *  rather than stdout, which would corrupt the ncurses screen.
+ *
+ *  @param settings   Simulation settings holding the status line.
+ *  @param message    The notice to show.
+ */
+void showStatus(Settings& settings, const string& message) {
+  settings.status = message;
+  settings.statusUntil = std::chrono::steady_clock::now() + STATUS_DURATION;
+}
+
+/**
+ *  @param settings   Simulation settings holding the status line.
+ *  @return           The current status notice, or empty once it expired.
+ */
+string currentStatus(const Settings& settings) {
+  if (std::chrono::steady_clock::now() >= settings.statusUntil) return "";
+  return settings.status;
+}
 
 
 //================================================================================
@@ -223,22 +257,14 @@ void renderWorldDetailsOverlay(const World& world) {
 }
 
 /**
- *  Displays the HUD with simulation statistics.
- *  Uses the RenderSystem interface.
+ *  Collects the HUD numbers for the tick that just finished.
+ *  Viewport position and pause state are filled in by the render side.
  *
  *  @param calendar   An object that tracks the in-game date and time.
  *  @param gs         General data stored on the simulation.
- *  @param creatures  A vector of all creatures.
- *  @param viewport   The current viewport.
- *  @param paused     Whether the simulation is paused.
+ *  @return           HUD data without viewport, pause or history fields.
  */
-void renderHUDDisplay(const Calendar& calendar,
-                      const GeneralStats& gs,
-                      const vector<OrganismPtr>& creatures,
-                      const Viewport& viewport,
-                      bool paused) {
-  IRenderer& renderer = RenderSystem::getInstance().getRenderer();
-  
+HUDData collectHUDData(const Calendar& calendar, const GeneralStats& gs) {
   HUDData hudData;
   hudData.population = gs.population;
   hudData.births = gs.births;
@@ -252,137 +278,36 @@ void renderHUDDisplay(const Calendar& calendar,
   hudData.dateString = calendar.longDate();
   hudData.worldWidth = MAP_COLS;
   hudData.worldHeight = MAP_ROWS;
-  hudData.viewportX = viewport.originX;
-  hudData.viewportY = viewport.originY;
   hudData.tickRate = static_cast<unsigned>(1000.0 / SIMULATION_TICK_MS);  // Ticks per second
-  hudData.paused = paused;
-  
-  renderer.renderHUD(hudData);
+  return hudData;
 }
 
-//================================================================================
-//  Simulation Advancement
-//================================================================================
 /**
- *	This controls the behaviour of each individual creature.
- *  Returns true if the creature died this turn (for deferred removal).
+ *  Displays the HUD with simulation statistics.
+ *  Uses the RenderSystem interface.
  *
- *	@param w        A reference to the world map.
- *	@param gs       General data stored on the simuation.
- *	@param c	      A vector containing all of the creatures.
- *	@param cIndex	  Current creature acting.
- *	@return		      True if creature died and should be removed.
- */
-bool takeTurn (World &w, GeneralStats &gs, vector<OrganismPtr> &c,
-               const unsigned int &cIndex) {
-  Organism *activeC = c.at(cIndex).get();
-
-  short dc = activeC->deathCheck();
-  if (dc != 0) {
-    //  Record death statistic and determine cause string for logging
-    std::string deathCause;
-    switch (dc) {
-      case 1: gs.deaths.oldAge++;     deathCause = "old_age";     break;
-      case 2: gs.deaths.starved++;    deathCause = "starvation";  break;
-      case 3: gs.deaths.dehydrated++; deathCause = "dehydration"; break;
-      case 4: gs.deaths.discomfort++; deathCause = "discomfort";  break;
-      case 5: gs.deaths.predator++;   deathCause = "combat";      break;
-      default:
-        std::cerr << "[ERROR] Unknown death code: " << dc << " for creature "
-                  << activeC->getId() << std::endl;
-        deathCause = "unknown";
-        break;
-    }
-    
-    // Log the death event
-    logging::Logger::getInstance().creatureDied(
-      activeC->getId(),
-      activeC->generateName(),
-      deathCause,
-      activeC->getHunger(),
-      activeC->getAge()
-    );
-
-    //  Create corpse for scavengers
-    //  Size is based on creature's max health (larger creatures = more nutrition)
-    float creatureSize = activeC->getMaxHealth() / 50.0f;  // 50 HP per size unit
-    if (creatureSize > 0.1f) {
-      // Body condition is based on creature's energy level when they died (0-1 range)
-      // Higher energy = better fed = more nutritious corpse
-      // RESOURCE_LIMIT is 10.0f - max hunger value
-      float bodyCondition = std::max(0.0f, std::min(1.0f, activeC->getHunger() / 10.0f));
-      w.addCorpse(activeC->getWorldX(), activeC->getWorldY(), creatureSize, activeC->generateName(), bodyCondition);
-    }
-
-    // Mark creature as dead by setting health below zero.
-    // This ensures deathCheck() returns non-zero and isAlive() returns false.
-    // Actual removal is deferred to end of tick to prevent spatial index
-    // pointer invalidation.
-    activeC->setHealth(-1.0f);
-    return true;  // Creature died
-
-  //  If not dead, run behavior controller
-  } else {
-    // Update creature phenotype with location-specific environment data
-    auto localEnv = w.environment().getEnvironmentStateAt(
-        static_cast<int>(activeC->getWorldX()),
-        static_cast<int>(activeC->getWorldY()));
-    activeC->updatePhenotypeContext(localEnv);
-
-    auto ctx = activeC->buildBehaviorContext(w, w.getScentLayer(), w.getCurrentTick());
-    activeC->updateWithBehaviors(ctx);
-
-    return false;  // Creature survived
-  }
-}
-
-/**
- *  Advances the simulation a singular turn
+ *  Everything shown comes from the snapshot, including the panels the
+ *  renderer asked for, so drawing the HUD never waits for a tick.
  *
- *  @param w The world object.
- *  @param c A vector of creature objects.
+ *  @param snapshot   The snapshot whose HUD numbers and panels are shown.
+ *  @param viewport   The current viewport.
+ *  @param paused     Whether the simulation is paused.
+ *  @param status     Notice for the status line, empty for none.
  */
-void advanceSimulation (World &w, vector<OrganismPtr> &c, GeneralStats &gs) {
-  //  Update environment tick cache before processing any organisms
-  //  This pre-computes expensive calculations like light level (sin-based day/night cycle)
-  unsigned int currentTick = w.getCurrentTick();
-  w.environment().updateTickCache(static_cast<int>(currentTick));
-
-  //  Rebuild spatial index for O(1) neighbor queries (Phase 3 optimization)
-  //  This is called once per tick - O(n) rebuild cost enables O(1) queries
-  w.rebuildCreatureIndex(c);
-
-  //  Push simulation forward
-  w.updateAllObjects ();
-
-  // Update scent layer for pheromone decay (Phase 2: Sensory System)
-  w.updateScentLayer();
-
-  // Update corpses (decay, remove fully decayed)
-  w.tickCorpses();
-  
-  // PRE-PASS: Have ALL breeding creatures deposit scents BEFORE any creature acts
-  // This ensures scents from all potential mates are available during detection
-  // (Phase 2: Gradient Navigation)
-  // (currentTick already retrieved above for updateTickCache)
-  for (auto& creature : c) {
-    if (creature->getMotivation() == Motivation::Amorous) {
-      creature->depositBreedingScent(w.getScentLayer(), currentTick);
-    }
-  }
-
-  for (size_t i = 0; i < c.size(); ++i) {
-    if (!c[i]->isAlive()) continue;
-    takeTurn(w, gs, c, static_cast<unsigned int>(i));
-  }
-
-  c.erase(
-    std::remove_if(c.begin(), c.end(),
-      [](const OrganismPtr& creature) { return !creature->isAlive(); }),
-    c.end()
-  );
-
-  gs.population = c.size ();
+void renderHUDDisplay(const RenderSnapshot& snapshot,
+                      const Viewport& viewport,
+                      bool paused,
+                      const string& status) {
+  IRenderer& renderer = RenderSystem::getInstance().getRenderer();
+  
+  HUDData hudData = snapshot.hud;
+  hudData.viewportX = viewport.originX;
+  hudData.viewportY = viewport.originY;
+  hudData.paused = paused;
+  hudData.statusMessage = status;
+  hudData.panels = &snapshot.panels;
+  
+  renderer.renderHUD(hudData);
 }
 
 /**
@@ -408,10 +333,10 @@ void advanceSimulation (World &w, vector<OrganismPtr> &c, GeneralStats &gs) {
  * - Omnivore Generalist: Adaptable generalists
  *
  * @param w       A reference to the world map.
- * @param c       A vector containing all of the creatures.
+ * @param c       The store holding all of the creatures.
  * @param amount  The amount of creatures to be added.
  */
-void populateWorld (World &w, vector<OrganismPtr> &c, unsigned amount) {
+void populateWorld (World &w, OrganismStore &c, unsigned amount) {
   // Create creature factory with gene registry
   auto registry = std::make_shared<EcoSim::Genetics::GeneRegistry>();
   EcoSim::Genetics::CreatureFactory factory(registry);
@@ -448,7 +373,7 @@ void populateWorld (World &w, vector<OrganismPtr> &c, unsigned amount) {
       creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
     }
 
-    c.push_back(std::move(creature));
+    c.insert(std::move(creature));
   }
   
   std::cout << "[World] Successfully added " << c.size() << " creatures" << std::endl;
@@ -465,10 +390,10 @@ void populateWorld (World &w, vector<OrganismPtr> &c, unsigned amount) {
  * - Temperate/Forest: Standard archetypes (pack hunters, tank herbivores, etc.)
  *
  * @param w       Reference to the world
- * @param c       Vector of creatures to populate
+ * @param c       Store of creatures to populate
  * @param amount  Target total number of creatures
  */
-void populateWorldByBiome(World& w, vector<OrganismPtr>& c, unsigned amount) {
+void populateWorldByBiome(World& w, OrganismStore& c, unsigned amount) {
   using namespace EcoSim;
   using namespace EcoSim::Genetics;
   
@@ -621,7 +546,7 @@ void populateWorldByBiome(World& w, vector<OrganismPtr>& c, unsigned amount) {
       OrganismPtr creature = createHerbivore(x, y);
       creature->setXY(x, y);
       creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
-      c.push_back(std::move(creature));
+      c.insert(std::move(creature));
     }
 
     for (unsigned i = 0; i < carnivoreCount && !positions.empty(); ++i) {
@@ -630,7 +555,7 @@ void populateWorldByBiome(World& w, vector<OrganismPtr>& c, unsigned amount) {
       OrganismPtr creature = createCarnivore(x, y);
       creature->setXY(x, y);
       creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
-      c.push_back(std::move(creature));
+      c.insert(std::move(creature));
     }
   };
   
@@ -662,7 +587,7 @@ void populateWorldByBiome(World& w, vector<OrganismPtr>& c, unsigned amount) {
       auto [x, y] = temperatePositions[idx];
       creature->setXY(x, y);
       creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
-      c.push_back(std::move(creature));
+      c.insert(std::move(creature));
     }
   }
   
@@ -672,34 +597,47 @@ void populateWorldByBiome(World& w, vector<OrganismPtr>& c, unsigned amount) {
 //================================================================================
 //  Input Handling via RenderSystem
 //================================================================================
+/**
+ *	Tiles scrolled per movement key press. Zoomed out into the world
+ *	overview this covers whole overview cells, so panning keeps pace with
+ *	what is on screen.
+ */
+int scrollIncrement() {
+  const int level = RenderSystem::getInstance().getRenderer().getOverviewLevel();
+  if (level < 0) {
+    return 5;
+  }
+  return 5 * static_cast<int>(EcoSim::WorldOverview::blockSize(static_cast<unsigned int>(level)));
+}
+
 /**
  *	This handles user input from a keyboard using the IInputHandler interface.
  *
  *	@param w			    The world object.
- *  @param c          The vector of creatures.
+ *  @param c          The store of creatures.
  *  @param calendar   The calendar object.
- *  @param stats      Statistics tracker.
  *  @param file       File handling object.
  *	@param xOrigin    The left most point displayed.
  *	@param yOrigin    The top most point displayed.
  *	@param settings   Simulation settings.
  *	@param mapHeight	Height of the world map.
  *	@param mapWidth		Width of the world map.
+ *  @param sim        Simulation thread; world changes wait for its tick.
  */
 void takeInput(World& w,
-               vector<OrganismPtr>& c,
+               OrganismStore& c,
                Calendar& calendar,
-               Statistics& stats,
                FileHandling& file,
                int& xOrigin,
                int& yOrigin,
                Settings& settings,
                const unsigned& mapHeight,
-               const unsigned& mapWidth) {
+               const unsigned& mapWidth,
+               EcoSim::SimulationThread& sim) {
   IInputHandler& input = RenderSystem::getInstance().getInputHandler();
   InputEvent event = input.pollInput();
   
-  const int inc = 5;
+  const int inc = scrollIncrement();
   
   // Handle by action first (semantic actions)
   switch (event.action) {
@@ -733,20 +671,53 @@ void takeInput(World& w,
       settings.hudIsOn = !settings.hudIsOn;
       return;
       
+    case InputAction::TOGGLE_TRACE:
+      {
+        //  First press starts a capture, the second writes it out
+        logging::Profiler& profiler = logging::Profiler::getInstance();
+        if (!profiler.isRecording()) {
+          profiler.start();
+          showStatus(settings, "Profile capture started");
+          return;
+        }
+        profiler.stop();
+        const string tracePath = "ecosim_trace.json";
+        if (profiler.writeChromeTrace(tracePath)) {
+          showStatus(settings, "Wrote " + std::to_string(profiler.eventCount())
+                               + " profile zones to '" + tracePath + "'");
+        } else {
+          showStatus(settings, "Failed to write profile trace");
+        }
+      }
+      return;
+      
+    case InputAction::TOGGLE_LOD:
+      sim.withWorld([&]() {
+        EcoSim::TurnScheduler& scheduler = w.turnScheduler();
+        EcoSim::TurnSchedulerConfig config = scheduler.getConfig();
+        config.enabled = !config.enabled;
+        scheduler.setConfig(config);
+        scheduler.resetCounts();
+        showStatus(settings, string("Turn scheduling ") + (config.enabled ? "on" : "off"));
+      });
+      return;
+      
     case InputAction::PAUSE:
       settings.isPaused = !settings.isPaused;
       return;
       
     case InputAction::ADD_CREATURES:
-      populateWorld(w, c, 100);
+      sim.withWorld([&]() { populateWorld(w, c, 100); });
+      sim.requestSnapshot();
       return;
       
     case InputAction::SAVE_STATE:
-      {
+      sim.withWorld([&]() {
         string filepath = "last_save.csv";
-        file.saveGenomes(filepath, c);
-        file.saveState(w, c, calendar, stats);
-      }
+        file.saveGenomes(filepath, c.organisms());
+        file.saveGameJson("quicksave.json", c.organisms(), w, calendar,
+                          w.getCurrentTick(), MAP_COLS, MAP_ROWS);
+      });
       return;
       
     case InputAction::QUIT:
@@ -793,7 +764,7 @@ namespace MapCreator {
 
   void handleMovement(InputAction action, int& xOrigin, int& yOrigin,
                       unsigned mapHeight, unsigned mapWidth) {
-    const int inc = 5;
+    const int inc = scrollIncrement();
     
     switch (action) {
       case InputAction::MOVE_UP:
@@ -1043,7 +1014,7 @@ World initializeWorld () {
  *  Runs the world editor loop for creating/editing a new world.
  *  Uses the RenderSystem interface.
  */
-void runWorldEditor(World& w, vector<OrganismPtr>& creatures,
+void runWorldEditor(World& w, OrganismStore& creatures,
                     int& xOrigin, int& yOrigin) {
   IRenderer& renderer = RenderSystem::getInstance().getRenderer();
   
@@ -1079,7 +1050,7 @@ void runWorldEditor(World& w, vector<OrganismPtr>& creatures,
                     mapWidth, trnSelector, inWorldEdit);
     
     renderer.beginFrame();
-    renderWorldAndCreatures(w, creatures, viewport);
+    renderWorldAndCreatures(w, creatures.organisms(), viewport);
     renderWorldDetailsOverlay(w);
     renderer.endFrame();
   }
@@ -1126,7 +1097,7 @@ void addGeneticsPlants(World& w) {
  *  Handles the New World menu option.
  *  Uses the RenderSystem interface.
  */
-void handleNewWorld(World& w, vector<OrganismPtr>& creatures,
+void handleNewWorld(World& w, OrganismStore& creatures,
                     FileHandling& file, int& xOrigin, int& yOrigin) {
   IRenderer& renderer = RenderSystem::getInstance().getRenderer();
   
@@ -1185,7 +1156,7 @@ void handleNewWorld(World& w, vector<OrganismPtr>& creatures,
       viewport.screenY = starty;
       
       renderer.beginFrame();
-      renderWorldAndCreatures(w, creatures, viewport);
+      renderWorldAndCreatures(w, creatures.organisms(), viewport);
       
       // Show warmup progress message
       int progress = static_cast<int>((i * 100) / PLANT_WARMUP);
@@ -1209,12 +1180,12 @@ void handleNewWorld(World& w, vector<OrganismPtr>& creatures,
 }
 
 /**
- *  Handles loading an existing world.
+ *  Handles loading the quicksave written by the save key.
  *  Uses the RenderSystem interface.
  *  @return True if load was successful, false otherwise.
  */
-bool handleLoadWorld(World& w, vector<OrganismPtr>& creatures,
-                     Calendar& calendar, Statistics& stats,
+bool handleLoadWorld(World& w, OrganismStore& creatures,
+                     Calendar& calendar,
                      FileHandling& file, int& xOrigin, int& yOrigin) {
   IRenderer& renderer = RenderSystem::getInstance().getRenderer();
   IInputHandler& input = RenderSystem::getInstance().getInputHandler();
@@ -1222,7 +1193,11 @@ bool handleLoadWorld(World& w, vector<OrganismPtr>& creatures,
   renderer.renderMessage("LOADING WORLD");
   renderer.endFrame();
   
-  if (file.loadState(w, creatures, calendar, stats)) {
+  unsigned loadedTick = 0;
+  bool loaded = file.loadGameJson("quicksave.json", creatures.organisms(), w, calendar,
+                                  loadedTick, MAP_COLS, MAP_ROWS);
+  creatures.reindex();
+  if (loaded) {
     return true;
   } else {
     renderer.beginFrame();
@@ -1252,6 +1227,10 @@ void processStatistics (Statistics &stats, Calendar &calendar,
       stats.accumulate ();
       string filepath = calendar.shortDate() + ".csv";
       file.saveGenomes (filepath, creatures);
+      // Snapshot on this thread; the reduction and file write run in the background
+      unsigned int tick = static_cast<unsigned int>(stats.series ().tickCount ());
+      file.saveGenomeStatsAsync (filepath, GenomeSnapshot::capture (
+        creatures, Organism::getGeneRegistry (), tick));
       file.appendStats (stats.toString());
       stats.clearRecords ();
     } else {
@@ -1260,45 +1239,135 @@ void processStatistics (Statistics &stats, Calendar &calendar,
   }
 }
 
+/**
+ *  Measures every subsystem, warns about exceeded budgets and shows the
+ *  sizes in the Performance window. Walks every organism, so it only runs
+ *  every MEMORY_REPORT_INTERVAL ticks.
+ */
+void reportMemory (const World &w, const OrganismStore &creatures,
+                   const Statistics &stats, logging::MemoryBudget &budget) {
+  logging::MemoryReport report;
+  w.reportMemory (report);
+  report.add ("creatures", creatures.memoryUsage (), creatures.size ());
+  report.add ("statistics", stats.memoryUsage ());
+  report.add ("logger", logging::Logger::getInstance ().memoryUsage ());
+  budget.check (report);
+
+  logging::TickMetrics& metrics = logging::TickMetrics::getInstance ();
+  for (const auto& entry : report.entries ()) {
+    metrics.setMemory (entry.name, entry.bytes, entry.objects, budget.limitFor (entry.name));
+  }
+  metrics.setMemory ("simulation (total)", report.total (), 0,
+                     budget.limitFor (logging::MemoryBudget::TOTAL));
+}
+
 /**
  *  Runs the main game loop using the "Fix Your Timestep" pattern.
  *  Uses the RenderSystem interface.
  *
- *  This implements a proper game loop where:
- *  - Input is polled EVERY frame (responsive controls, no lag)
- *  - Simulation runs at a FIXED timestep (consistent physics/AI)
- *  - Rendering happens EVERY frame (smooth visuals)
+ *  The simulation runs on its own thread (EcoSim::SimulationThread):
+ *  - Simulation runs at a FIXED timestep (consistent physics/AI) and
+ *    publishes a RenderSnapshot after every tick
+ *  - Input is polled EVERY frame on this thread (responsive controls, no lag)
+ *  - Rendering happens EVERY frame from the newest snapshot, so a slow tick
+ *    no longer freezes the window and drawing no longer delays ticks
  *
- *  The fixed timestep ensures simulation consistency regardless of frame rate,
- *  while input and rendering remain responsive.
+ *  Anything on this thread that reads or changes the world (saving, loading,
+ *  adding creatures) goes through sim.withWorld(), which runs it between two
+ *  ticks. HUD panels read the copies the snapshot makes of whatever the
+ *  renderer reports open through panelRequest().
  *
  *  @see include/timing.hpp for timing utilities and constants
+ *  @see include/simulationThread.hpp for the thread handoff
  */
-void runGameLoop(World& w, vector<OrganismPtr>& creatures,
+void runGameLoop(World& w, OrganismStore& creatures,
                  Calendar& calendar, Statistics& stats, FileHandling& file,
                  int& xOrigin, int& yOrigin, Settings& settings) {
   IRenderer& renderer = RenderSystem::getInstance().getRenderer();
-  
-  // Initialize the game clock for fixed timestep timing
-  EcoSim::Timing::GameClock gameClock(SIMULATION_TICK_MS);
-  gameClock.start();
-  
+
   // Statistics tracking - persists across pause/unpause
-  GeneralStats gs = { calendar, 0, 0, 0, 0 };
-  
+  GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
+
+  // Track tick count for saving/loading and logging
+  static int tickCount = 0;
+
+  // Feeds the Performance window; recording is cheap enough to leave on
+  logging::TickMetrics& metrics = logging::TickMetrics::getInstance();
+  metrics.setEnabled(true);
+
+  // Soft memory limits from ECOSIM_MEMORY_BUDGET, checked with each report
+  logging::MemoryBudget memoryBudget = logging::MemoryBudget::fromEnvironment();
+
+  // =========================================================================
+  // SIMULATION TICK (simulation thread, fixed timestep)
+  // =========================================================================
+  auto runTick = [&]() {
+    // Set current tick for the logger
+    logging::Logger::getInstance().setCurrentTick(tickCount);
+
+    gs = { calendar, 0, 0, 0, 0, {} };  // Reset stats for this tick
+    metrics.beginTick(static_cast<std::uint64_t>(tickCount));
+    advanceSimulation(w, creatures, gs);
+    {
+      ECOSIM_TICK_PHASE(Statistics);
+      processStatistics(stats, calendar, file, creatures.organisms(), gs);
+    }
+    if (const EcoSim::SpatialIndex* index = w.getCreatureIndex();
+        index && metrics.isEnabled()) {
+      metrics.recordSpatialIndex(index->size(), index->occupiedCellCount(),
+                                 index->cellCount(), index->largestCellSize());
+    }
+    metrics.endTick();
+
+    if (tickCount % MEMORY_REPORT_INTERVAL == 0) {
+      reportMemory(w, creatures, stats, memoryBudget);
+    }
+
+    // Population snapshot every 20 ticks
+    if (tickCount % 20 == 0) {
+      // Get actual plant count from PlantManager's spatial index
+      int plantCount = 0;
+      if (auto* plantIndex = w.plants().getPlantIndex()) {
+        plantCount = static_cast<int>(plantIndex->size());
+      }
+      logging::Logger::getInstance().populationSnapshot(
+        tickCount,
+        static_cast<int>(creatures.size()),
+        plantCount
+      );
+    }
+
+    // Check for extinction
+    if (creatures.empty()) {
+      logging::Logger::getInstance().extinction("creatures");
+    }
+
+    // Signal tick completion (flushes logs)
+    logging::Logger::getInstance().onTickEnd();
+
+    calendar++;
+    tickCount++;
+  };
+
+  // Copies what the renderer needs; runs on the simulation thread after a tick
+  auto captureSnapshot = [&](RenderSnapshot& snapshot, const Viewport& region,
+                             const PanelRequest& panels) {
+    captureRenderSnapshot(w, creatures.organisms(), region, snapshot);
+    captureHUDPanels(w, creatures.organisms(), stats.series(), metrics.history(),
+                     panels, snapshot.panels);
+    snapshot.tick = static_cast<unsigned>(tickCount);
+    snapshot.hud = collectHUDData(calendar, gs);
+  };
+
+  EcoSim::SimulationThread sim(SIMULATION_TICK_MS, runTick, captureSnapshot);
+  sim.start();
+
   while (settings.alive) {
-    // Track tick count for saving/loading and logging
-    // Declared at loop scope so it's accessible throughout all sections
-    static int tickCount = 0;
-    
-    // Update timing at the start of each frame
-    gameClock.tick();
-    
     unsigned mapHeight = renderer.getViewportMaxHeight();
     unsigned mapWidth = renderer.getViewportMaxWidth();
     int startx = renderer.getScreenCenterX() - mapWidth / 2;
     int starty = renderer.getScreenCenterY() - mapHeight / 2;
-    
+
     // Create viewport for rendering
     Viewport viewport;
     viewport.originX = xOrigin;
@@ -1307,14 +1376,15 @@ void runGameLoop(World& w, vector<OrganismPtr>& creatures,
     viewport.height = mapHeight;
     viewport.screenX = startx;
     viewport.screenY = starty;
+    viewport.overviewLevel = renderer.getOverviewLevel();
 
     // =========================================================================
     // 1. PROCESS INPUT (every frame - responsive controls)
     // =========================================================================
     // Input is polled every frame regardless of simulation state.
     // This ensures viewport movement and UI controls feel responsive.
-    takeInput(w, creatures, calendar, stats, file,
-              xOrigin, yOrigin, settings, mapHeight, mapWidth);
+    takeInput(w, creatures, calendar, file,
+              xOrigin, yOrigin, settings, mapHeight, mapWidth, sim);
     
     // =========================================================================
     // 1.5 HANDLE PAUSE MENU ACTIONS
@@ -1335,7 +1405,9 @@ void runGameLoop(World& w, vector<OrganismPtr>& creatures,
     // Populate save files list only when dialog FIRST opens (transition from closed to open)
     if ((isSaveOpen && !wasSaveDialogOpen) || (isLoadOpen && !wasLoadDialogOpen)) {
       // Get list of save files and their metadata
-      std::vector<std::string> saveFileNames = file.listSaveFiles();
+      // (FileHandling is shared with the statistics dumps on the simulation thread)
+      std::vector<std::string> saveFileNames;
+      sim.withWorld([&]() { saveFileNames = file.listSaveFiles(); });
       std::vector<SaveFileInfo> saveInfoList;
       
       for (const auto& filename : saveFileNames) {
@@ -1381,15 +1453,18 @@ void runGameLoop(World& w, vector<OrganismPtr>& creatures,
         filename = "quicksave";  // Fallback
       }
       
-      bool success = file.saveGameJson(
-        filename + ".json",
-        creatures,
-        w,
-        calendar,
-        static_cast<unsigned>(tickCount),
-        MAP_COLS,
-        MAP_ROWS
-      );
+      bool success = false;
+      sim.withWorld([&]() {
+        success = file.saveGameJson(
+          filename + ".json",
+          creatures.organisms(),
+          w,
+          calendar,
+          static_cast<unsigned>(tickCount),
+          MAP_COLS,
+          MAP_ROWS
+        );
+      });
       
       if (success) {
         std::cout << "[Save] Game saved to '" << filename << ".json'" << std::endl;
@@ -1408,40 +1483,44 @@ void runGameLoop(World& w, vector<OrganismPtr>& creatures,
         filename = "quicksave";  // Fallback
       }
       
-      unsigned loadedTick = 0;
-      bool success = file.loadGameJson(
-        filename + ".json",
-        creatures,
-        w,
-        calendar,
-        loadedTick,
-        MAP_COLS,
-        MAP_ROWS
-      );
+      sim.withWorld([&]() {
+        unsigned loadedTick = 0;
+        bool success = file.loadGameJson(
+          filename + ".json",
+          creatures.organisms(),
+          w,
+          calendar,
+          loadedTick,
+          MAP_COLS,
+          MAP_ROWS
+        );
+        creatures.reindex();
       
-      if (success) {
-        tickCount = static_cast<int>(loadedTick);
-        std::cout << "[Load] Loaded game from '" << filename << ".json'" << std::endl;
+        if (success) {
+          tickCount = static_cast<int>(loadedTick);
+          std::cout << "[Load] Loaded game from '" << filename << ".json'" << std::endl;
         
-        // Reset creature ID counters to avoid ID conflicts with new creatures
-        // Find the maximum IDs among loaded creatures and set counters to max+1
-        int maxId = 0;
-        int maxCreatureId = 0;
-        for (const auto& creature : creatures) {
-          if (creature->getId() > maxId) {
-            maxId = creature->getId();
-          }
-          if (creature->getSequentialId() > maxCreatureId) {
-            maxCreatureId = creature->getSequentialId();
+          // Reset creature ID counters to avoid ID conflicts with new creatures
+          // Find the maximum IDs among loaded creatures and set counters to max+1
+          int maxId = 0;
+          int maxCreatureId = 0;
+          for (const auto& creature : creatures) {
+            if (creature->getId() > maxId) {
+              maxId = creature->getId();
+            }
+            if (creature->getSequentialId() > maxCreatureId) {
+              maxCreatureId = creature->getSequentialId();
+            }
           }
+          Creature::resetIdCounter(maxId + 1);
+          Creature::resetCreatureIdCounter(maxCreatureId + 1);
+          std::cout << "[Load] Reset organism ID counter to " << (maxId + 1) << std::endl;
+          std::cout << "[Load] Reset creature ID counter to " << (maxCreatureId + 1) << std::endl;
+        } else {
+          std::cerr << "[Load] Failed to load game" << std::endl;
         }
-        Creature::resetIdCounter(maxId + 1);
-        Creature::resetCreatureIdCounter(maxCreatureId + 1);
-        std::cout << "[Load] Reset organism ID counter to " << (maxId + 1) << std::endl;
-        std::cout << "[Load] Reset creature ID counter to " << (maxCreatureId + 1) << std::endl;
-      } else {
-        std::cerr << "[Load] Failed to load game" << std::endl;
-      }
+      });
+      sim.requestSnapshot();
       
       renderer.resetLoadFlag();
       renderer.clearLoadFilename();
@@ -1467,75 +1546,42 @@ void runGameLoop(World& w, vector<OrganismPtr>& creatures,
     }
 
     // =========================================================================
-    // 2. UPDATE SIMULATION (fixed timestep - consistent simulation)
+    // 2. UPDATE SIMULATION (simulation thread - fixed timestep)
     // =========================================================================
-    // Simulation only advances when not paused AND pause menu is not open.
-    // Uses accumulator pattern to run multiple ticks if frame was slow,
-    // or skip ticks if frame was fast, maintaining consistent simulation speed.
-    
     // Pause simulation when either:
     // 1. User has manually paused via SPACE/P key (settings.isPaused)
     // 2. Pause menu is open (ESC menu)
-    bool effectivelyPaused = settings.isPaused || renderer.isPauseMenuOpen();
-    
-    if (!effectivelyPaused) {
-      while (gameClock.shouldUpdate()) {
-        // Set current tick for the logger
-        logging::Logger::getInstance().setCurrentTick(tickCount);
-        
-        gs = { calendar, 0, 0, 0, 0 };  // Reset stats for this tick
-        advanceSimulation(w, creatures, gs);
-        processStatistics(stats, calendar, file, creatures, gs);
-        
-        // Population snapshot every 20 ticks
-        if (tickCount % 20 == 0) {
-          // Get actual plant count from PlantManager's spatial index
-          int plantCount = 0;
-          if (auto* plantIndex = w.plants().getPlantIndex()) {
-            plantCount = static_cast<int>(plantIndex->size());
-          }
-          logging::Logger::getInstance().populationSnapshot(
-            tickCount,
-            static_cast<int>(creatures.size()),
-            plantCount
-          );
-        }
-        
-        // Check for extinction
-        if (creatures.empty()) {
-          logging::Logger::getInstance().extinction("creatures");
-        }
-        
-        // Signal tick completion (flushes logs)
-        logging::Logger::getInstance().onTickEnd();
-        
-        calendar++;
-        tickCount++;
-        gameClock.consumeTick();
-      }
-    } else {
-      // When paused, still consume accumulated time to prevent
-      // simulation "catching up" when unpaused
-      while (gameClock.shouldUpdate()) {
-        gameClock.consumeTick();
-      }
-    }
+    sim.setPaused(settings.isPaused || renderer.isPauseMenuOpen());
+
+    // Snapshots cover the viewport plus a margin, so scrolling never shows
+    // an empty edge while the next snapshot is being captured
+    Viewport region = viewport;
+    region.originX -= static_cast<int>(SNAPSHOT_MARGIN);
+    region.originY -= static_cast<int>(SNAPSHOT_MARGIN);
+    region.width += 2 * SNAPSHOT_MARGIN;
+    region.height += 2 * SNAPSHOT_MARGIN;
+    sim.setViewRegion(region);
+    sim.setPanelRequest(settings.hudIsOn ? renderer.panelRequest() : PanelRequest());
 
     // =========================================================================
-    // 3. RENDER (every frame - smooth visuals)
+    // 3. RENDER (every frame - newest snapshot)
     // =========================================================================
+    sim.updateSnapshot();
+    const RenderSnapshot& snapshot = sim.snapshot();
+
     renderer.beginFrame();
-    renderWorldAndCreatures(w, creatures, viewport);
+    renderer.renderSnapshot(snapshot, viewport);
     if (settings.hudIsOn)
-      renderHUDDisplay(calendar, gs, creatures, viewport, settings.isPaused);
+      renderHUDDisplay(snapshot, viewport, settings.isPaused, currentStatus(settings));
     renderer.endFrame();
-    
-    // Note: No sleep_for() here! The fixed timestep pattern naturally
-    // handles frame pacing. The loop will run as fast as possible for
-    // responsive input, while simulation stays at fixed rate.
-    // If CPU usage is a concern, a small sleep can be added, but it
-    // should be minimal (1-2ms) to avoid input lag.
+
+    // Note: No sleep_for() here! The loop runs as fast as the renderer
+    // presents for responsive input; the simulation thread keeps its own
+    // fixed rate and sleeps between ticks.
   }
+
+  // Finish the tick in progress before the caller touches the world again
+  sim.stop();
 }
 
 //================================================================================
@@ -1606,11 +1652,11 @@ int main(int argc, char** argv) {
   
   World w = initializeWorld();
 
-  std::vector<OrganismPtr> creatures;
+  OrganismStore creatures;
   Calendar calendar;
   Statistics stats;
   FileHandling file(SAVE_FILES.at(1));
-  Settings settings { true, true, false };
+  Settings settings { true, true, false, "", {} };
 
   // Origin coordinates for drawing world map.
   int xOrigin = 0, yOrigin = 0;
@@ -1718,13 +1764,14 @@ int main(int argc, char** argv) {
     unsigned loadedTick = 0;
     bool success = file.loadGameJson(
       filename + ".json",
-      creatures,
+      creatures.organisms(),
       w,
       calendar,
       loadedTick,
       MAP_COLS,
       MAP_ROWS
     );
+    creatures.reindex();
     
     if (success) {
       std::cout << "[Load] Loaded game from '" << filename << ".json'" << std::endl;
@@ -22,6 +22,8 @@
 #include "genetics/interactions/CombatInteraction.hpp"
 #include "genetics/systems/PerceptionSystem.hpp"
 #include "logging/Logger.hpp"
+#include "logging/Profiler.hpp"
+#include <atomic>
 #include <unordered_map>
 #include <optional>
 
@@ -74,7 +76,7 @@ static const DietInfo& getDietInfo(EcoSim::Genetics::DietType diet) {
 //  s_seedDispersal, s_perceptionSystem, s_combatInteraction) and the
 //  nextCreatureId_ counter are defined in src/genetics/organisms/Organism.cpp.
 //================================================================================
-static int s_nextCreatureId = 1;
+static std::atomic<int> s_nextCreatureId{1};
 
 void EcoSim::Genetics::Organism::resetIdCounter(int nextId) {
     s_nextCreatureId = nextId;
@@ -108,24 +110,24 @@ Creature::Creature(const Creature& other)
     maxSize_ = other.maxSize_;
     mature_ = other.mature_;
 
-    // Deep-copy components (unique_ptr can't be copied, Organism copy is disabled)
+    // Copy components individually (Organism copy is disabled)
     if (other.mobility_) {
-        attachMobility(std::make_unique<EcoSim::Genetics::MobilityComponent>(*other.mobility_));
+        attachMobility(*other.mobility_);
     }
     if (other.heterotrophy_) {
-        attachHeterotrophy(std::make_unique<EcoSim::Genetics::HeterotrophyComponent>(*other.heterotrophy_));
+        attachHeterotrophy(*other.heterotrophy_);
     }
     if (other.reproduction_) {
-        attachReproduction(std::make_unique<EcoSim::Genetics::ReproductionComponent>(*other.reproduction_));
+        attachReproduction(*other.reproduction_);
     }
     if (other.combat_) {
-        attachCombat(std::make_unique<EcoSim::Genetics::CombatComponent>(*other.combat_));
+        attachCombat(*other.combat_);
     }
     if (other.thermal_) {
-        attachThermal(std::make_unique<EcoSim::Genetics::ThermalComponent>(*other.thermal_));
+        attachThermal(*other.thermal_);
     }
     // Identity: new copy gets a fresh sequentialId but inherits archetype/biome
-    attachIdentity(std::make_unique<EcoSim::Genetics::IdentityComponent>());
+    attachIdentity();
     identity_->sequentialId = nextCreatureId_++;
     if (other.identity_) {
         identity_->archetype       = other.identity_->archetype;
@@ -399,6 +401,10 @@ void EcoSim::Genetics::Organism::movementCost (const float &distance) {
 //  range, so re-weighting by distance was double counting). Pure genetic
 //  similarity threshold remains.
 //================================================================================
+std::size_t Creature::memoryUsage() const {
+    return sizeof(*this) + heapUsage();
+}
+
 std::unique_ptr<EcoSim::Genetics::Organism> Creature::makeOffspring(
     std::unique_ptr<EcoSim::Genetics::Genome> offspringGenome,
     int x, int y) {
@@ -457,7 +463,9 @@ bool EcoSim::Genetics::Organism::findMateScent(const EcoSim::ScentLayer& scentLa
 
 /**
 	* Initialize shared interaction calculators.
-	* Should be called once at application startup.
+	* Should be called once at application startup, and must be called
+	* before worlds are simulated on more than one thread: the lazy
+	* initialization elsewhere is not synchronised.
 	*/
 void EcoSim::Genetics::Organism::initializeInteractionSystems() {
     if (!s_feedingInteraction) {
@@ -466,6 +474,12 @@ void EcoSim::Genetics::Organism::initializeInteractionSystems() {
     if (!s_seedDispersal) {
         s_seedDispersal = std::make_unique<EcoSim::Genetics::SeedDispersal>();
     }
+    if (!s_perceptionSystem) {
+        s_perceptionSystem = std::make_unique<EcoSim::Genetics::PerceptionSystem>();
+    }
+    if (!s_combatInteraction) {
+        s_combatInteraction = std::make_unique<EcoSim::Genetics::CombatInteraction>();
+    }
 }
 
 /**
@@ -608,6 +622,7 @@ void EcoSim::Genetics::Organism::reclassifyBiomeAdaptation() {
 void EcoSim::Genetics::Organism::takeDamage(float amount) {
     if (amount <= 0.0f) return;
     health_ = std::max(0.0f, health_ - amount);
+    wake();
 }
 
 // Creature::heal removed — Organism::heal does the same thing now that
@@ -615,6 +630,7 @@ void EcoSim::Genetics::Organism::takeDamage(float amount) {
 
 void EcoSim::Genetics::Organism::setInCombat(bool combat) {
     if (combat_) combat_->inCombat = combat;
+    if (combat) wake();
 }
 
 void EcoSim::Genetics::Organism::setTargetId(int targetId) {
@@ -627,6 +643,7 @@ void EcoSim::Genetics::Organism::setCombatCooldown(int cooldown) {
 
 void EcoSim::Genetics::Organism::setFleeing(bool fleeing) {
     if (combat_) combat_->isFleeing = fleeing;
+    if (fleeing) wake();
 }
 
 float EcoSim::Genetics::Organism::getHealthPercent() const {
@@ -818,6 +835,7 @@ EcoSim::Genetics::BehaviorContext EcoSim::Genetics::Organism::buildBehaviorConte
  */
 EcoSim::Genetics::BehaviorResult EcoSim::Genetics::Organism::updateWithBehaviors(EcoSim::Genetics::BehaviorContext& ctx) {
     using namespace EcoSim::Genetics;
+    ECOSIM_PROFILE_ZONE("Organism::updateWithBehaviors");
 
     // Ensure behavior controller is initialized
     if (!organismBehaviorController_) {
@@ -864,17 +882,6 @@ EcoSim::Genetics::BehaviorResult EcoSim::Genetics::Organism::updateWithBehaviors
     {
         EnvironmentState env = phenotype_.getEnvironment();
         updatePhenotypeContext(env);
-        grow();
-
-        // Metabolism: drain energy/hydration, accumulate fatigue
-        float change = heterotrophy_->metabolism;
-        bool isResting = (motivation_ == Motivation::Tired);
-        if (isResting) {
-            heterotrophy_->fatigue -= heterotrophy_->metabolism;
-            change /= 2;
-        } else {
-            heterotrophy_->fatigue += heterotrophy_->metabolism;
-        }
 
         if (thermal_->cacheDirty) {
             updateThermalCache();
@@ -887,39 +894,103 @@ EcoSim::Genetics::BehaviorResult EcoSim::Genetics::Organism::updateWithBehaviors
             thermal_->lastProcessedTemp = currentTemp;
         }
 
-        change *= thermal_->currentStress.energyDrainMultiplier;
-        heterotrophy_->hunger -= change;
-        heterotrophy_->thirst -= change;
+        passiveTick();
+    }
 
-        // Environmental stress: temperature/stress health damage
-        if (thermal_->currentStress.healthDamageRate > 0.0f) {
-            float damage = thermal_->currentStress.healthDamageRate * getMaxHealth();
-            takeDamage(damage);
-        }
+    return result;
+}
+
+/**
+ * Growth, metabolism, thermal stress damage, mate drive and age for one
+ * tick. Thermal stress is the value last computed by updateWithBehaviors.
+ */
+void EcoSim::Genetics::Organism::passiveTick() {
+    using namespace EcoSim::Genetics;
+
+    grow();
+
+    // Metabolism: drain energy/hydration, accumulate fatigue
+    float change = heterotrophy_->metabolism;
+    bool isResting = (motivation_ == Motivation::Tired);
+    if (isResting) {
+        heterotrophy_->fatigue -= heterotrophy_->metabolism;
+        change /= 2;
+    } else {
+        heterotrophy_->fatigue += heterotrophy_->metabolism;
+    }
+
+    change *= thermal_->currentStress.energyDrainMultiplier;
+    heterotrophy_->hunger -= change;
+    heterotrophy_->thirst -= change;
 
-        // Reproductive drive: slow passive accumulation scaled by well-being.
-        // Hungry creatures gain drive slowly; well-fed ones gain faster.
-        // Starving creatures lose drive. Cap at RESOURCE_LIMIT so urge
-        // saturates at the max mating readiness.
-        if (reproduction_) {
-            float wellbeing = 0.5f;  // neutral default
-            if (heterotrophy_) {
-                wellbeing = std::clamp(
-                    heterotrophy_->hunger / Constants::RESOURCE_LIMIT, -0.5f, 1.0f);
-            }
-            // 0.05/tick baseline — a fed creature reaches the mating
-            // threshold (mate=7) in ~140 ticks. Low enough that starving
-            // creatures still deprioritise mating, high enough that healthy
-            // populations produce offspring within a reasonable sim window.
-            float rate = 0.05f * wellbeing;
-            reproduction_->mate = std::clamp(
-                reproduction_->mate + rate, -3.0f, Constants::RESOURCE_LIMIT);
+    // Environmental stress: temperature/stress health damage
+    if (thermal_->currentStress.healthDamageRate > 0.0f) {
+        float damage = thermal_->currentStress.healthDamageRate * getMaxHealth();
+        takeDamage(damage);
+    }
+
+    // Reproductive drive: slow passive accumulation scaled by well-being.
+    // Hungry creatures gain drive slowly; well-fed ones gain faster.
+    // Starving creatures lose drive. Cap at RESOURCE_LIMIT so urge
+    // saturates at the max mating readiness.
+    if (reproduction_) {
+        float wellbeing = 0.5f;  // neutral default
+        if (heterotrophy_) {
+            wellbeing = std::clamp(
+                heterotrophy_->hunger / Constants::RESOURCE_LIMIT, -0.5f, 1.0f);
         }
+        // 0.05/tick baseline — a fed creature reaches the mating
+        // threshold (mate=7) in ~140 ticks. Low enough that starving
+        // creatures still deprioritise mating, high enough that healthy
+        // populations produce offspring within a reasonable sim window.
+        float rate = 0.05f * wellbeing;
+        reproduction_->mate = std::clamp(
+            reproduction_->mate + rate, -3.0f, Constants::RESOURCE_LIMIT);
+    }
+
+    ++age_;
+}
+
+/**
+ * Catch up on ticks skipped by the TurnScheduler. Each skipped tick
+ * charges the held behavior's energy cost (as updateWithBehaviors does)
+ * and runs the passive lifecycle, so needs and age arrive where full-rate
+ * updates would have put them.
+ */
+void EcoSim::Genetics::Organism::integrateSkippedTicks(unsigned ticks, float heldEnergyCost) {
+    using namespace EcoSim::Genetics;
 
-        ++age_;
+    if (!heterotrophy_ || !thermal_) {
+        age_ += ticks;
+        return;
     }
+    for (unsigned i = 0; i < ticks; ++i) {
+        heterotrophy_->hunger = std::min(heterotrophy_->hunger - heldEnergyCost,
+                                         Constants::RESOURCE_LIMIT);
+        passiveTick();
+    }
+}
 
-    return result;
+float EcoSim::Genetics::Organism::needDriftPerTick(float heldEnergyCost) const {
+    using namespace EcoSim::Genetics;
+
+    if (!heterotrophy_ || !thermal_) return 0.0f;
+
+    const bool isResting = (motivation_ == Motivation::Tired);
+    const float drain = heterotrophy_->metabolism * (isResting ? 0.5f : 1.0f)
+                      * thermal_->currentStress.energyDrainMultiplier;
+    float drift = std::max({std::abs(drain + heldEnergyCost), drain, heterotrophy_->metabolism});
+
+    // Mate drive stops changing once clamped
+    if (reproduction_) {
+        const float wellbeing = std::clamp(
+            heterotrophy_->hunger / Constants::RESOURCE_LIMIT, -0.5f, 1.0f);
+        const float rate = 0.05f * wellbeing;
+        const bool saturated = (rate > 0.0f && reproduction_->mate >= Constants::RESOURCE_LIMIT)
+                            || (rate < 0.0f && reproduction_->mate <= -3.0f);
+        if (!saturated) drift = std::max(drift, std::abs(rate));
+    }
+    return drift;
 }
 
 //================================================================================
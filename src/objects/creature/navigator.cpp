@@ -26,9 +26,9 @@
 #include <sstream>
 
 // Throttle logging to avoid spam - only log every Nth failure per creature
-static std::unordered_map<int, int> s_moveFailureCount;
-static std::unordered_map<int, int> s_astarTimeoutCount;
-static std::unordered_map<int, int> s_wanderFailureCount;
+static thread_local std::unordered_map<int, int> s_moveFailureCount;
+static thread_local std::unordered_map<int, int> s_astarTimeoutCount;
+static thread_local std::unordered_map<int, int> s_wanderFailureCount;
 static const int LOG_EVERY_N = 100;  // Log every 100th failure
 
 #define NAV_DEBUG(creatureId, counter, msg) do { \
@@ -47,17 +47,16 @@ static const int LOG_EVERY_N = 100;  // Log every 100th failure
 #define NAV_DEBUG(creatureId, counter, msg) ((void)0)
 #define NAV_DEBUG_ONCE(msg) ((void)0)
 #endif
+#include "genetics/core/RandomEngine.hpp"
 #include "genetics/expression/Phenotype.hpp"
 #include "genetics/expression/EnvironmentalStress.hpp"
 #include "genetics/defaults/UniversalGenes.hpp"
 #include "world/EnvironmentSystem.hpp"
+#include "logging/TickMetrics.hpp"
 
 //  Adjusts movement cost for diagonal
 const float Navigator::DIAG_ADJUST = 1.4f;
 
-//  Static random engine for wander() - avoids recreation every call
-static std::random_device s_rd;
-static std::mt19937 s_wanderGen(s_rd());
 
 using namespace std;
 using namespace EcoSim::Genetics;
@@ -314,6 +313,7 @@ bool Navigator::astarSearch (EcoSim::Genetics::Organism &c,
                              const int &endX,
                              const int &endY,
                              const PathfindingContext* ctx) {
+  ECOSIM_PROFILE_ZONE("Navigator::astarSearch");
   // Clear cost cache at start of new search - environment doesn't change during search
   if (ctx) {
     ctx->clearCache();
@@ -355,6 +355,7 @@ bool Navigator::astarSearch (EcoSim::Genetics::Organism &c,
 
       openSet.erase (iter);
       openSet.clear ();
+      logging::TickMetrics::getInstance().recordPathSearch(static_cast<unsigned>(timeOut));
       return true;
     } else {
       //  Push and Pop first so parent pointers don't get mixed up
@@ -443,27 +444,30 @@ bool Navigator::astarSearch (EcoSim::Genetics::Organism &c,
     NAV_DEBUG(c.getId(), s_astarTimeoutCount, ss.str());
   }
 #endif
+  logging::TickMetrics::getInstance().recordPathSearch(static_cast<unsigned>(timeOut));
   return false;
 }
 
 /**
  *  This method makes a creature move in a random direction using smooth movement.
- *  Uses static random engine for efficiency.
  *
- *  @param c    The creature moving.
- *  @param map  A reference to the 2D grid of the world.
- *  @param rows Number of rows on the map.
- *  @param cols Number of columns on the map.
- *  @return     True if movement succeeded, false if blocked.
+ *  @param c            The creature moving.
+ *  @param map          A reference to the 2D grid of the world.
+ *  @param rows         Number of rows on the map.
+ *  @param cols         Number of columns on the map.
+ *  @param currentTick  Current simulation tick.
+ *  @return             True if movement succeeded, false if blocked.
  */
 bool Navigator::wander (EcoSim::Genetics::Organism &c,
                         const vector<vector<Tile>> &map,
                         const unsigned rows,
-                        const unsigned cols) {
-  static uniform_int_distribution<short> change(-1, 1);
-
-	int targetTileX = c.tileX() + (change(s_wanderGen));
-	int targetTileY = c.tileY() + (change(s_wanderGen));
+                        const unsigned cols,
+                        const unsigned currentTick) {
+  //  Keyed by creature and tick, so the step does not depend on update order
+  RandomStream rng = RandomEngine::stream(
+      RandomSystem::Navigation, static_cast<std::uint64_t>(c.getId()), currentTick);
+	int targetTileX = c.tileX() + rng.uniformInt(-1, 1);
+	int targetTileY = c.tileY() + rng.uniformInt(-1, 1);
   bool success = moveTowards (c, map, rows, cols, targetTileX, targetTileY);
   
 #if NAVIGATOR_DEBUG_LOG
@@ -534,22 +538,24 @@ bool Navigator::moveTowards (EcoSim::Genetics::Organism &c,
  *  Creatures move gradually away from threats, with movement speed
  *  determined by getMovementSpeed().
  *
- *  @param avoidX X-position to move away from.
- *  @param avoidY Y-position to move away from.
- *  @return       True if movement succeeded, false if blocked.
+ *  @param avoidX       X-position to move away from.
+ *  @param avoidY       Y-position to move away from.
+ *  @param currentTick  Current simulation tick, for the random step.
+ *  @return             True if movement succeeded, false if blocked.
  */
 bool Navigator::moveAway (EcoSim::Genetics::Organism &c,
                           const vector<vector<Tile>> &map,
                           const int &rows,
                           const int &cols,
                           const int &avoidX,
-                          const int &avoidY) {
+                          const int &avoidY,
+                          const unsigned currentTick) {
   int curTileX = c.tileX();
   int curTileY = c.tileY();
 
   //  If at same tile location, wander randomly
   if (avoidX == curTileX && avoidY == curTileY) {
-    return wander (c, map, rows, cols);
+    return wander (c, map, rows, cols, currentTick);
 
   } else {
     // Calculate target tile (opposite direction from threat)
@@ -0,0 +1,214 @@
+/**
+ * @file RenderSnapshot.cpp
+ * @brief Copies the renderable state of the live world into a RenderSnapshot
+ * @author Gary Ferguson
+ */
+
+#include "../../include/rendering/RenderSnapshot.hpp"
+#include "../../include/world/world.hpp"
+#include "../../include/world/Corpse.hpp"
+#include "../../include/genetics/organisms/Organism.hpp"
+#include "../../include/genetics/expression/Phenotype.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/// Copy the overview cells covering the region at the requested level
+void captureOverview(const EcoSim::WorldOverview& overview, const Viewport& region,
+                     RenderSnapshot& out) {
+    if (overview.levelCount() == 0) {
+        return;
+    }
+    unsigned int level = std::min(static_cast<unsigned int>(region.overviewLevel),
+                                  overview.levelCount() - 1);
+    int block = static_cast<int>(EcoSim::WorldOverview::blockSize(level));
+    int levelWidth = static_cast<int>(overview.levelWidth(level));
+    int levelHeight = static_cast<int>(overview.levelHeight(level));
+
+    int cx0 = std::max(region.originX, 0) / block;
+    int cy0 = std::max(region.originY, 0) / block;
+    int cx1 = std::min((region.originX + static_cast<int>(region.width) + block - 1) / block, levelWidth);
+    int cy1 = std::min((region.originY + static_cast<int>(region.height) + block - 1) / block, levelHeight);
+    if (cx1 <= cx0 || cy1 <= cy0) {
+        return;
+    }
+
+    out.overviewBlock = static_cast<unsigned int>(block);
+    out.overviewCellX = cx0;
+    out.overviewCellY = cy0;
+    out.overviewCols = static_cast<unsigned int>(cx1 - cx0);
+    out.overviewRows = static_cast<unsigned int>(cy1 - cy0);
+    out.overview.reserve(static_cast<std::size_t>(out.overviewCols) * out.overviewRows);
+    for (int cy = cy0; cy < cy1; ++cy) {
+        for (int cx = cx0; cx < cx1; ++cx) {
+            out.overview.push_back(overview.cell(level, static_cast<unsigned int>(cx),
+                                                 static_cast<unsigned int>(cy)));
+        }
+    }
+}
+
+void fillRow(const EcoSim::Genetics::Organism& creature, CreatureRow& row) {
+    row.id = creature.getSequentialId();
+    row.tileX = creature.getX();
+    row.tileY = creature.getY();
+    row.age = creature.getAge();
+    row.lifespan = creature.getLifespan();
+    row.hunger = creature.getHunger();
+    row.thirst = creature.getThirst();
+    row.fatigue = creature.getFatigue();
+    row.mate = creature.getMate();
+    row.motivation = creature.getMotivation();
+    row.diet = creature.getPhenotype().calculateDietType();
+}
+
+void fillDetails(const EcoSim::Genetics::Organism& creature, CreatureDetails& out) {
+    fillRow(creature, out);
+    out.label = creature.getFullLabel();
+    out.scientificName = creature.getScientificName();
+    out.worldX = creature.getWorldX();
+    out.worldY = creature.getWorldY();
+    out.action = creature.getAction();
+    out.health = creature.getHealth();
+    out.maxHealth = creature.getMaxHealth();
+    out.healthPercent = creature.getHealthPercent();
+    out.woundState = creature.getWoundState();
+    out.woundSeverity = creature.getWoundSeverity();
+    out.healingRate = creature.getHealingRate();
+    out.metabolism = creature.getMetabolism();
+    out.maintenanceCost = creature.getPhenotype().getTotalMaintenanceCost();
+    out.speed = creature.getSpeed();
+    out.inCombat = creature.isInCombat();
+    out.fleeing = creature.isFleeing();
+    out.targetId = creature.getTargetId();
+    out.combatCooldown = creature.getCombatCooldown();
+    out.traits = creature.getPhenotype().getAllTraits();
+}
+
+} // anonymous namespace
+
+void captureRenderSnapshot(const World& world,
+                           const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures,
+                           const Viewport& region,
+                           RenderSnapshot& out) {
+    const EcoSim::WorldGrid& grid = world.grid();
+    out.terrain = &grid;
+    out.worldWidth = world.getCols();
+    out.worldHeight = world.getRows();
+    out.region = region;
+
+    out.terrainRevision = world.getTerrainRevision();
+
+    out.overview.clear();
+    out.overviewCols = 0;
+    out.overviewRows = 0;
+    if (region.overviewLevel >= 0) {
+        // Zoomed out: the overview stands in for every sprite
+        out.plants.clear();
+        out.corpses.clear();
+        out.creatures.clear();
+        captureOverview(world.overview(), region, out);
+        return;
+    }
+
+    // Region clipped to the world, as a half-open tile range
+    int x0 = std::max(region.originX, 0);
+    int y0 = std::max(region.originY, 0);
+    int x1 = std::min(region.originX + static_cast<int>(region.width), static_cast<int>(out.worldWidth));
+    int y1 = std::min(region.originY + static_cast<int>(region.height), static_cast<int>(out.worldHeight));
+    auto inRegion = [&](int x, int y) {
+        return x >= x0 && x < x1 && y >= y0 && y < y1;
+    };
+
+    // Only the first living plant on a tile is drawn; a tile without one
+    // shows its ground cover once that is worth grazing
+    const EcoSim::VegetationField& groundCover = world.plants().groundCover();
+    out.plants.clear();
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            const auto& plants = grid(static_cast<unsigned int>(x), static_cast<unsigned int>(y)).getPlants();
+            if (plants.empty()) {
+                if (groundCover.isGrazeable(x, y)) {
+                    const auto& cover = groundCover.prototype(groundCover.speciesAt(x, y));
+                    out.plants.push_back({x, y, cover.getEntityType(), cover.getChar()});
+                }
+                continue;
+            }
+            const auto& plant = plants.front();
+            if (plant && plant->isAlive()) {
+                out.plants.push_back({x, y, plant->getEntityType(), plant->getChar()});
+            }
+        }
+    }
+
+    out.corpses.clear();
+    for (const auto& corpse : world.getCorpses()) {
+        if (inRegion(corpse->getTileX(), corpse->getTileY())) {
+            out.corpses.push_back({corpse->getX(), corpse->getY(), corpse->getDecayProgress()});
+        }
+    }
+
+    out.creatures.clear();
+    for (const auto& creature : creatures) {
+        if (!creature->isAlive() || !inRegion(creature->getX(), creature->getY())) {
+            continue;
+        }
+        out.creatures.push_back({
+            creature->getSequentialId(),
+            creature->getWorldX(),
+            creature->getWorldY(),
+            creature->getX(),
+            creature->getY(),
+            creature->getMotivation(),
+            creature->getChar()
+        });
+    }
+}
+
+void captureHUDPanels(const World& world,
+                      const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures,
+                      const TimeSeriesStore& series,
+                      const logging::TickMetrics::History& metrics,
+                      const PanelRequest& request,
+                      HUDPanels& out) {
+    out.request = request;
+
+    if (request.history) {
+        out.history = series.tier(request.historyTier);
+    }
+    if (request.metrics) {
+        out.metrics = metrics;
+    }
+
+    if (request.world) {
+        const auto& corpses = world.getCorpses();
+        float decay = 0.0f;
+        for (const auto& corpse : corpses) {
+            decay += corpse->getDecayProgress();
+        }
+        out.world.corpses = corpses.size();
+        out.world.averageDecay = corpses.empty() ? 0.0f : decay / static_cast<float>(corpses.size());
+        out.world.mapGen = world.getMapGen();
+        out.world.octaveGen = world.getOctaveGen();
+        out.world.overview = &world.overview();
+    }
+
+    out.creatures.clear();
+    out.hasSelected = false;
+    if (!request.creatureList && request.selectedCreature < 0) {
+        return;
+    }
+    for (const auto& creature : creatures) {
+        if (!creature->isAlive()) {
+            continue;
+        }
+        if (request.creatureList) {
+            out.creatures.emplace_back();
+            fillRow(*creature, out.creatures.back());
+        }
+        if (creature->getSequentialId() == request.selectedCreature) {
+            fillDetails(*creature, out.selected);
+            out.hasSelected = true;
+        }
+    }
+}
@@ -17,6 +17,9 @@
 #include "../../../../include/colorPairs.hpp"
 
 #include <ncurses.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
 
 //==============================================================================
 // Constructor / Destructor
@@ -63,10 +66,10 @@ bool NCursesRenderer::initialize() {
         _hasColors = true;
     }
     
-    // Get initial screen dimensions
-    getmaxyx(stdscr, _rows, _cols);
-    
     _initialized = true;
+    
+    // Get initial screen dimensions
+    updateDimensions();
     return true;
 }
 
@@ -84,13 +87,23 @@ void NCursesRenderer::beginFrame() {
     if (!_initialized) {
         return;
     }
-    erase();
+    
+    // Follow terminal resizes; the shadow buffer must match stdscr exactly
+    int rows, cols;
+    getmaxyx(stdscr, rows, cols);
+    if (rows != _screen.rows() || cols != _screen.cols()) {
+        updateDimensions();
+    }
+    
+    // Compose into the back buffer; stdscr is only touched by the flush
+    _screen.clear();
 }
 
 void NCursesRenderer::endFrame() {
     if (!_initialized) {
         return;
     }
+    _screen.flush();
     refresh();
 }
 
@@ -139,12 +152,12 @@ void NCursesRenderer::renderWorld(const World& world, const Viewport& viewport)
     for (unsigned int y = viewport.originY; y < yRange; y++) {
         for (unsigned int x = viewport.originX; x < xRange; x++) {
             Tile* curTile = &grid.at(x).at(y);
+            const int screenY = yScreen + static_cast<int>(y);
+            const int screenX = xScreen + static_cast<int>(x);
             
             // Render terrain using TerrainType for renderer-agnostic colors
             int colorPair = NCursesColorMapper::terrainToColorPair(curTile->getTerrainType());
-            attron(COLOR_PAIR(colorPair));
-            mvaddch(yScreen + y, xScreen + x, curTile->getChar());
-            attroff(COLOR_PAIR(colorPair));
+            _screen.put(screenY, screenX, curTile->getChar(), static_cast<short>(colorPair));
             
             // LEGACY REMOVAL: Legacy Spawner rendering disabled
             // const std::vector<Spawner>& spawners = curTile->getSpawners();
@@ -170,9 +183,7 @@ void NCursesRenderer::renderWorld(const World& world, const Viewport& viewport)
                 const auto& plant = plants.front();
                 if (plant && plant->isAlive()) {
                     int plantColor = NCursesColorMapper::entityToColorPair(plant->getEntityType());
-                    attron(COLOR_PAIR(plantColor));
-                    mvaddch(yScreen + y, xScreen + x, plant->getChar());
-                    attroff(COLOR_PAIR(plantColor));
+                    _screen.put(screenY, screenX, plant->getChar(), static_cast<short>(plantColor));
                 }
             }
         }
@@ -186,9 +197,7 @@ void NCursesRenderer::renderTile(const Tile& tile, int screenX, int screenY) {
     
     // Render terrain using TerrainType for renderer-agnostic colors
     int colorPair = NCursesColorMapper::terrainToColorPair(tile.getTerrainType());
-    attron(COLOR_PAIR(colorPair));
-    mvaddch(screenY, screenX, tile.getChar());
-    attroff(COLOR_PAIR(colorPair));
+    _screen.put(screenY, screenX, tile.getChar(), static_cast<short>(colorPair));
     
     // LEGACY REMOVAL: Legacy Spawner rendering disabled
     // const std::vector<Spawner>& spawners = tile.getSpawners();
@@ -214,9 +223,7 @@ void NCursesRenderer::renderTile(const Tile& tile, int screenX, int screenY) {
         const auto& plant = plants.front();
         if (plant && plant->isAlive()) {
             int plantColor = NCursesColorMapper::entityToColorPair(plant->getEntityType());
-            attron(COLOR_PAIR(plantColor));
-            mvaddch(screenY, screenX, plant->getChar());
-            attroff(COLOR_PAIR(plantColor));
+            _screen.put(screenY, screenX, plant->getChar(), static_cast<short>(plantColor));
         }
     }
 }
@@ -242,9 +249,71 @@ void NCursesRenderer::renderCreatures(const std::vector<std::unique_ptr<EcoSim::
 
             int cColor = getColorPairForProfile(creature);
 
-            attron(COLOR_PAIR(cColor));
-            mvaddch(yScreen + cY, xScreen + cX, creature.getChar());
-            attroff(COLOR_PAIR(cColor));
+            _screen.put(yScreen + cY, xScreen + cX, creature.getChar(), static_cast<short>(cColor));
+        }
+    }
+}
+
+void NCursesRenderer::renderSnapshot(const RenderSnapshot& snapshot, const Viewport& viewport) {
+    if (!_initialized || snapshot.terrain == nullptr) {
+        return;
+    }
+
+    const EcoSim::WorldGrid& grid = *snapshot.terrain;
+    unsigned int mapRows = snapshot.worldHeight;
+    unsigned int mapCols = snapshot.worldWidth;
+
+    unsigned int startX = viewport.screenX;
+    unsigned int startY = viewport.screenY;
+
+    // Center small maps within the viewport
+    if (viewport.width > mapCols) {
+        startX += (viewport.width - mapCols) / 2;
+    }
+    if (viewport.height > mapRows) {
+        startY += (viewport.height - mapRows) / 2;
+    }
+
+    // Tile loops run unsigned; the screen offsets below stay signed
+    const unsigned int originX = static_cast<unsigned int>(std::max(viewport.originX, 0));
+    const unsigned int originY = static_cast<unsigned int>(std::max(viewport.originY, 0));
+    unsigned int xRange = viewport.width + originX;
+    unsigned int yRange = viewport.height + originY;
+    if (xRange > mapCols) xRange = mapCols;
+    if (yRange > mapRows) yRange = mapRows;
+
+    int xScreen = static_cast<int>(startX) - viewport.originX;
+    int yScreen = static_cast<int>(startY) - viewport.originY;
+
+    // Terrain fields are safe to read while the simulation runs
+    for (unsigned int y = originY; y < yRange; y++) {
+        for (unsigned int x = originX; x < xRange; x++) {
+            const Tile& tile = grid(x, y);
+            int colorPair = NCursesColorMapper::terrainToColorPair(tile.getTerrainType());
+            _screen.put(yScreen + static_cast<int>(y), xScreen + static_cast<int>(x),
+                        tile.getChar(), static_cast<short>(colorPair));
+        }
+    }
+
+    auto visible = [&](int x, int y) {
+        return x >= viewport.originX && x < static_cast<int>(xRange) &&
+               y >= viewport.originY && y < static_cast<int>(yRange);
+    };
+
+    for (const PlantSprite& plant : snapshot.plants) {
+        if (visible(plant.tileX, plant.tileY)) {
+            int plantColor = NCursesColorMapper::entityToColorPair(plant.type);
+            _screen.put(yScreen + plant.tileY, xScreen + plant.tileX, plant.glyph, static_cast<short>(plantColor));
+        }
+    }
+
+    // Creatures are drawn without the map-centering offset, as in renderCreatures()
+    int cxScreen = static_cast<int>(viewport.screenX) - viewport.originX;
+    int cyScreen = static_cast<int>(viewport.screenY) - viewport.originY;
+    for (const CreatureSprite& creature : snapshot.creatures) {
+        if (visible(creature.tileX, creature.tileY)) {
+            int cColor = NCursesColorMapper::motivationToColorPair(creature.motivation);
+            _screen.put(cyScreen + creature.tileY, cxScreen + creature.tileX, creature.glyph, static_cast<short>(cColor));
         }
     }
 }
@@ -257,9 +326,7 @@ void NCursesRenderer::renderCreature(const EcoSim::Genetics::Organism& creature,
 
     int cColor = getColorPairForProfile(creature);
 
-    attron(COLOR_PAIR(cColor));
-    mvaddch(screenY, screenX, creature.getChar());
-    attroff(COLOR_PAIR(cColor));
+    _screen.put(screenY, screenX, creature.getChar(), static_cast<short>(cColor));
 }
 
 //==============================================================================
@@ -272,25 +339,30 @@ void NCursesRenderer::renderHUD(const HUDData& data) {
     }
     
     // Population statistics
-    mvprintw(1, 2, "Population : %d", data.population);
-    mvprintw(2, 2, "Births :     %d", data.births);
-    mvprintw(3, 2, "Food Ate :   %d", data.foodEaten);
+    printAt(1, 2, "Population : %d", data.population);
+    printAt(2, 2, "Births :     %d", data.births);
+    printAt(3, 2, "Food Ate :   %d", data.foodEaten);
     
     // Death statistics
-    mvprintw(5, 2, "Deaths");
-    mvprintw(6, 2, "Old Age :    %d", data.deaths.oldAge);
-    mvprintw(7, 2, "Starved :    %d", data.deaths.starved);
-    mvprintw(8, 2, "Dehydrated : %d", data.deaths.dehydrated);
-    mvprintw(9, 2, "Discomfort : %d", data.deaths.discomfort);
-    mvprintw(10, 2, "Predator :   %d", data.deaths.predator);
+    printAt(5, 2, "Deaths");
+    printAt(6, 2, "Old Age :    %d", data.deaths.oldAge);
+    printAt(7, 2, "Starved :    %d", data.deaths.starved);
+    printAt(8, 2, "Dehydrated : %d", data.deaths.dehydrated);
+    printAt(9, 2, "Discomfort : %d", data.deaths.discomfort);
+    printAt(10, 2, "Predator :   %d", data.deaths.predator);
     
     // Time display
-    mvprintw(_rows - 1, 2, "%s", data.timeString.c_str());
-    mvprintw(_rows - 1, 8, "%s", data.dateString.c_str());
+    printAt(_rows - 1, 2, "%s", data.timeString.c_str());
+    printAt(_rows - 1, 8, "%s", data.dateString.c_str());
+    
+    // Status line
+    if (!data.statusMessage.empty()) {
+        printAt(_rows - 2, 2, "%s", data.statusMessage.c_str());
+    }
     
     // Pause indicator
     if (data.paused) {
-        mvprintw(_rows - 1, _cols - 10, "[PAUSED]");
+        printAt(_rows - 1, _cols - 10, "[PAUSED]");
     }
 }
 
@@ -300,16 +372,21 @@ int NCursesRenderer::renderMenu(const std::string& title,
         return -1;
     }
     
+    const int titleX = static_cast<int>(getScreenCenterX()) - static_cast<int>(title.length()) / 2;
     unsigned int startX = getScreenCenterX() - title.size() / 2;
     unsigned int startY = getScreenCenterY() - (options.size() + 1) / 2;
     unsigned int selected = 0;
     size_t optionCount = options.size();
     
+    // The menu draws straight to stdscr, so the shadow buffer no longer
+    // knows what is on screen
+    _screen.invalidate();
+    
     while (true) {
         clear();
         
         // Render title
-        printCentered(title, startY);
+        mvprintw(static_cast<int>(startY), titleX, "%s", title.c_str());
         
         // Render options
         for (size_t i = 0; i < optionCount; i++) {
@@ -351,17 +428,17 @@ void NCursesRenderer::renderWorldDetails(const World& world) {
         return;
     }
     
-    mvprintw(1,  2, "Seed      : %f", world.getSeed());
-    mvprintw(2,  2, "Scale     : %f", world.getScale());
-    mvprintw(3,  2, "Freq      : %f", world.getFreq());
-    mvprintw(4,  2, "Exponent  : %f", world.getExponent());
-    mvprintw(5,  2, "Terraces  : %d", world.getTerraces());
+    printAt(1,  2, "Seed      : %f", world.getSeed());
+    printAt(2,  2, "Scale     : %f", world.getScale());
+    printAt(3,  2, "Freq      : %f", world.getFreq());
+    printAt(4,  2, "Exponent  : %f", world.getExponent());
+    printAt(5,  2, "Terraces  : %d", world.getTerraces());
     
-    mvprintw(7,  2, "OCTAVES");
-    mvprintw(8,  2, "Quantity        : %d", world.getOctaveGen().quantity);
-    mvprintw(9,  2, "Min Weight      : %f", world.getOctaveGen().minWeight);
-    mvprintw(10, 2, "Max Weight      : %f", world.getOctaveGen().maxWeight);
-    mvprintw(11, 2, "Freq. Interval  : %f", world.getOctaveGen().freqInterval);
+    printAt(7,  2, "OCTAVES");
+    printAt(8,  2, "Quantity        : %d", world.getOctaveGen().quantity);
+    printAt(9,  2, "Min Weight      : %f", world.getOctaveGen().minWeight);
+    printAt(10, 2, "Max Weight      : %f", world.getOctaveGen().maxWeight);
+    printAt(11, 2, "Freq. Interval  : %f", world.getOctaveGen().freqInterval);
 }
 
 void NCursesRenderer::renderMessage(const std::string& message, int row) {
@@ -446,6 +523,8 @@ void NCursesRenderer::setHalfDelay(int tenths) {
 void NCursesRenderer::updateDimensions() {
     if (_initialized) {
         getmaxyx(stdscr, _rows, _cols);
+        _screen.resize(_rows, _cols);
+        clear();  // Repaint everything on the next refresh
     }
 }
 
@@ -455,7 +534,16 @@ void NCursesRenderer::updateDimensions() {
 
 void NCursesRenderer::printCentered(const std::string& str, int y) {
     int x = getScreenCenterX() - str.length() / 2;
-    mvprintw(y, x, "%s", str.c_str());
+    _screen.putText(y, x, str);
+}
+
+void NCursesRenderer::printAt(int y, int x, const char* format, ...) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    _screen.putText(y, x, text);
 }
 
 int NCursesRenderer::getColorPairForProfile(const EcoSim::Genetics::Organism& creature) const {
@@ -0,0 +1,86 @@
+/**
+ * @file NCursesScreenBuffer.cpp
+ * @brief Implementation of NCursesScreenBuffer
+ * @author Gary Ferguson
+ * @date October 2026
+ */
+
+#include "../../../../include/rendering/backends/ncurses/NCursesScreenBuffer.hpp"
+
+#include <ncurses.h>
+#include <algorithm>
+
+constexpr NCursesScreenBuffer::Cell NCursesScreenBuffer::BLANK;
+constexpr NCursesScreenBuffer::Cell NCursesScreenBuffer::UNKNOWN;
+
+NCursesScreenBuffer::NCursesScreenBuffer()
+    : _rows(0)
+    , _cols(0)
+    , _lastFlushCells(0) {
+}
+
+void NCursesScreenBuffer::resize(int rows, int cols) {
+    _rows = rows > 0 ? rows : 0;
+    _cols = cols > 0 ? cols : 0;
+    std::size_t cells = static_cast<std::size_t>(_rows) * static_cast<std::size_t>(_cols);
+    _back.assign(cells, BLANK);
+    _front.assign(cells, UNKNOWN);
+}
+
+void NCursesScreenBuffer::clear() {
+    std::fill(_back.begin(), _back.end(), BLANK);
+}
+
+void NCursesScreenBuffer::put(int y, int x, char glyph, short pair) {
+    if (y < 0 || y >= _rows || x < 0 || x >= _cols) {
+        return;
+    }
+    _back[index(y, x)] = {glyph, pair};
+}
+
+void NCursesScreenBuffer::putText(int y, int x, const std::string& text, short pair) {
+    for (char c : text) {
+        put(y, x++, c, pair);
+    }
+}
+
+void NCursesScreenBuffer::invalidate() {
+    std::fill(_front.begin(), _front.end(), UNKNOWN);
+}
+
+std::size_t NCursesScreenBuffer::flush() {
+    std::size_t written = 0;
+
+    for (int y = 0; y < _rows; y++) {
+        int x = 0;
+        while (x < _cols) {
+            std::size_t i = index(y, x);
+            if (_back[i] == _front[i]) {
+                x++;
+                continue;
+            }
+
+            // Gather the run of changed cells sharing this color pair
+            const short pair = _back[i].pair;
+            const int runStart = x;
+            _run.clear();
+            while (x < _cols) {
+                i = index(y, x);
+                if (_back[i] == _front[i] || _back[i].pair != pair) {
+                    break;
+                }
+                _run.push_back(_back[i].glyph);
+                _front[i] = _back[i];
+                x++;
+            }
+
+            attron(COLOR_PAIR(pair));
+            mvaddnstr(y, runStart, _run.c_str(), static_cast<int>(_run.size()));
+            attroff(COLOR_PAIR(pair));
+            written += _run.size();
+        }
+    }
+
+    _lastFlushCells = written;
+    return written;
+}
@@ -11,10 +11,12 @@
 
 #include "rendering/backends/sdl2/ImGuiOverlay.hpp"
 #include "rendering/IRenderer.hpp"  // For SaveFileInfo struct
+#include "rendering/backends/sdl2/SDL2ColorMapper.hpp"
 #include "world/world.hpp"
 #include "world/Corpse.hpp"
 #include "world/CorpseManager.hpp"
 #include "objects/creature/creature.hpp"
+#include "statistics/timeSeries.hpp"
 
 // New genetics system includes
 #include "genetics/core/Genome.hpp"
@@ -90,6 +92,8 @@ ImGuiOverlay::ImGuiOverlay()
     , _selectedPlantId(-1)
     , _creatureSortMode(0)
     , _frameTimeIndex(0)
+    , _tickTimesSorted()
+    , _tickHistogram()
     , _historyIndex(0)
     , _lastBirths(0)
     , _lastDeaths(0)
@@ -198,14 +202,14 @@ void ImGuiOverlay::beginFrame() {
     ImGui::NewFrame();
 }
 
-void ImGuiOverlay::render(const HUDData& hudData, const World* world,
-                         const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures) {
+void ImGuiOverlay::render(const HUDData& hudData) {
     if (!_initialized) {
         return;
     }
     
     // Store last HUD data for controls panel
     _lastHudData = hudData;
+    const HUDPanels* panels = hudData.panels;
     
     // Don't render HUD elements when start menu is visible - only show the menu itself
     // This creates a clean start screen without stats panels cluttering the view
@@ -213,36 +217,31 @@ void ImGuiOverlay::render(const HUDData& hudData, const World* world,
         // Render main menu bar
         renderMainMenuBar();
         
-        // Render windows based on visibility flags
+        // Render windows based on visibility flags. Panel data only covers
+        // what panelRequest() asked for when the snapshot was captured, so a
+        // window opened this frame shows a placeholder until the next one.
         if (_showStatistics) {
             renderStatisticsWindow(hudData);
         }
         
         if (_showWorldInfo) {
-            renderWorldInfoWindow(world, creatures);
+            renderWorldInfoWindow(hudData, panels && panels->request.world ? &panels->world : nullptr);
         }
         
         if (_showPerformance) {
-            renderPerformanceWindow();
+            renderPerformanceWindow(panels && panels->request.metrics ? &panels->metrics : nullptr);
         }
         
-        if (_showCreatureList && creatures) {
-            renderCreatureListWindow(creatures);
+        if (_showCreatureList) {
+            renderCreatureListWindow(panels && panels->request.creatureList ? &panels->creatures : nullptr);
         }
         
-        // Find and render selected creature inspector
-        if (_showCreatureInspector && creatures && _selectedCreatureId >= 0) {
-            const EcoSim::Genetics::Organism* selectedCreature = nullptr;
-
-            for (const auto& c : *creatures) {
-                if (c->getSequentialId() == _selectedCreatureId) {
-                    selectedCreature = c.get();
-                    break;
-                }
-            }
-            
-            if (selectedCreature) {
-                renderCreatureInspectorWindow(selectedCreature);
+        // Render the selected creature once the snapshot has caught up with
+        // the selection
+        if (_showCreatureInspector && _selectedCreatureId >= 0 && panels &&
+            panels->request.selectedCreature == _selectedCreatureId) {
+            if (panels->hasSelected) {
+                renderCreatureInspectorWindow(&panels->selected);
             } else {
                 // Creature no longer exists (died), deselect
                 _selectedCreatureId = -1;
@@ -273,6 +272,21 @@ void ImGuiOverlay::render(const HUDData& hudData, const World* world,
     renderPostSaveDialog();
 }
 
+PanelRequest ImGuiOverlay::panelRequest() const {
+    PanelRequest request;
+    if (!_initialized || _menuMode == MenuMode::START_MENU) {
+        return request;
+    }
+    
+    request.history = _showStatistics;
+    request.historyTier = static_cast<SeriesTier>(_historyTier);
+    request.metrics = _showPerformance;
+    request.world = _showWorldInfo;
+    request.creatureList = _showCreatureList;
+    request.selectedCreature = _showCreatureInspector ? _selectedCreatureId : -1;
+    return request;
+}
+
 void ImGuiOverlay::endFrame() {
     if (!_initialized) {
         return;
@@ -350,7 +364,13 @@ void ImGuiOverlay::renderMainMenuBar() {
         // Show population
         ImGui::SameLine();
         ImGui::Text("| Pop: %d", _lastHudData.population);
-        
+
+        // Show the latest status notice
+        if (!_lastHudData.statusMessage.empty()) {
+            ImGui::SameLine();
+            ImGui::Text("| %s", _lastHudData.statusMessage.c_str());
+        }
+
         ImGui::EndMainMenuBar();
     }
 }
@@ -492,6 +512,31 @@ void ImGuiOverlay::renderStatisticsWindow(const HUDData& hudData) {
         ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "■"); ImGui::SameLine();
         ImGui::Text("Deaths");
         
+        // Long-run history straight from the downsampled ring buffers
+        if (ImGui::CollapsingHeader("Long-Run History", ImGuiTreeNodeFlags_None)) {
+            ImGui::Combo("Resolution", &_historyTier, "Tick\0Hour\0Day\0Season\0");
+            const HUDPanels* panels = hudData.panels;
+            const bool current = panels && panels->request.history &&
+                panels->request.historyTier == static_cast<SeriesTier>(_historyTier);
+            
+            if (!current) {
+                ImGui::TextDisabled("Loading...");
+            } else if (panels->history.empty()) {
+                ImGui::TextDisabled("No complete %s samples yet", seriesTierName(static_cast<SeriesTier>(_historyTier)));
+            } else {
+                const SeriesRing& ring = panels->history;
+                const int count = static_cast<int>(ring.size());
+                const int offset = static_cast<int>(ring.offset());
+                ImGui::Text("Population (%d samples)", count);
+                ImGui::PlotLines("##SeriesPop", ring.column(StatMetric::Population), count, offset,
+                                nullptr, 0.0f, FLT_MAX, ImVec2(-1, 80));
+                ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.3f, 1.0f, 0.3f, 1.0f));
+                ImGui::PlotLines("##SeriesBirths", ring.column(StatMetric::Births), count, offset,
+                                "Births", 0.0f, FLT_MAX, ImVec2(-1, 60));
+                ImGui::PopStyleColor();
+            }
+        }
+        
         ImGui::Separator();
         
         // Simulation controls display
@@ -504,7 +549,52 @@ void ImGuiOverlay::renderStatisticsWindow(const HUDData& hudData) {
     ImGui::End();
 }
 
-void ImGuiOverlay::renderWorldInfoWindow(const World* world, const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures) {
+void ImGuiOverlay::renderMinimap(const EcoSim::WorldOverview& overview) {
+    if (overview.levelCount() == 0) {
+        return;
+    }
+    
+    unsigned int level = overview.levelFitting(MINIMAP_MIN_CELLS);
+    unsigned int cols = overview.levelWidth(level);
+    unsigned int rows = overview.levelHeight(level);
+    unsigned int block = EcoSim::WorldOverview::blockSize(level);
+    
+    float available = ImGui::GetContentRegionAvail().x;
+    float cellSize = available / static_cast<float>(std::max(cols, rows));
+    ImVec2 size(cellSize * static_cast<float>(cols), cellSize * static_cast<float>(rows));
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    
+    for (unsigned int cy = 0; cy < rows; ++cy) {
+        for (unsigned int cx = 0; cx < cols; ++cx) {
+            SDL_Color color = SDL2ColorMapper::terrainToColor(overview.cell(level, cx, cy).terrain);
+            ImVec2 min(origin.x + static_cast<float>(cx) * cellSize,
+                       origin.y + static_cast<float>(cy) * cellSize);
+            ImVec2 max(min.x + cellSize, min.y + cellSize);
+            drawList->AddRectFilled(min, max, IM_COL32(color.r, color.g, color.b, 255));
+        }
+    }
+    
+    // Outline the part of the world that is on screen
+    float pixelsPerTile = cellSize / static_cast<float>(block);
+    ImVec2 viewMin(origin.x + static_cast<float>(_viewport.originX) * pixelsPerTile,
+                   origin.y + static_cast<float>(_viewport.originY) * pixelsPerTile);
+    ImVec2 viewMax(viewMin.x + static_cast<float>(_viewport.width) * pixelsPerTile,
+                   viewMin.y + static_cast<float>(_viewport.height) * pixelsPerTile);
+    drawList->PushClipRect(origin, ImVec2(origin.x + size.x, origin.y + size.y), true);
+    drawList->AddRect(viewMin, viewMax, IM_COL32(255, 255, 255, 255));
+    drawList->PopClipRect();
+    
+    // Clicking centers the view on that point
+    ImGui::InvisibleButton("##minimap", size);
+    if (ImGui::IsItemClicked(ImGuiMouseButton_Left)) {
+        ImVec2 mouse = ImGui::GetMousePos();
+        _pendingCenterX = static_cast<int>((mouse.x - origin.x) / pixelsPerTile);
+        _pendingCenterY = static_cast<int>((mouse.y - origin.y) / pixelsPerTile);
+    }
+}
+
+void ImGuiOverlay::renderWorldInfoWindow(const HUDData& hudData, const WorldDetails* world) {
     // Calculate right-side position dynamically based on window size
     ImGuiIO& io = ImGui::GetIO();
     const float rightMargin = 10.0f;
@@ -518,20 +608,25 @@ void ImGuiOverlay::renderWorldInfoWindow(const World* world, const std::vector<s
         if (world) {
             // World dimensions
             if (ImGui::CollapsingHeader("Dimensions", ImGuiTreeNodeFlags_DefaultOpen)) {
-                ImGui::Text("Width:  %d tiles", world->getCols());
-                ImGui::Text("Height: %d tiles", world->getRows());
+                ImGui::Text("Width:  %u tiles", hudData.worldWidth);
+                ImGui::Text("Height: %u tiles", hudData.worldHeight);
                 
-                unsigned int totalTiles = world->getCols() * world->getRows();
-                ImGui::Text("Total Tiles: %d", totalTiles);
+                unsigned int totalTiles = hudData.worldWidth * hudData.worldHeight;
+                ImGui::Text("Total Tiles: %u", totalTiles);
+            }
+            
+            ImGui::Spacing();
+            
+            // Minimap drawn from a coarse level of the world overview
+            if (ImGui::CollapsingHeader("Minimap", ImGuiTreeNodeFlags_DefaultOpen)) {
+                renderMinimap(*world->overview);
             }
             
             ImGui::Spacing();
             
-            // Corpse information (cast to non-const to access corpses)
+            // Corpse information
             if (ImGui::CollapsingHeader("Corpses", ImGuiTreeNodeFlags_DefaultOpen)) {
-                World* mutableWorld = const_cast<World*>(world);
-                const auto& corpses = mutableWorld->getCorpses();
-                size_t corpseCount = corpses.size();
+                size_t corpseCount = world->corpses;
                 
                 ImGui::Text("Active Corpses: %zu", corpseCount);
                 ImGui::Text("Max Corpses: %zu", EcoSim::CorpseManager::MAX_CORPSES);
@@ -554,12 +649,7 @@ void ImGuiOverlay::renderWorldInfoWindow(const World* world, const std::vector<s
                 
                 // Optional: Show average decay if corpses exist
                 if (corpseCount > 0) {
-                    float totalDecay = 0.0f;
-                    for (const auto& corpse : corpses) {
-                        totalDecay += corpse->getDecayProgress();
-                    }
-                    float avgDecay = totalDecay / static_cast<float>(corpseCount);
-                    ImGui::Text("Avg Decay: %.0f%%", avgDecay * 100.0f);
+                    ImGui::Text("Avg Decay: %.0f%%", world->averageDecay * 100.0f);
                 }
             }
             
@@ -567,8 +657,8 @@ void ImGuiOverlay::renderWorldInfoWindow(const World* world, const std::vector<s
             
             // Generation parameters
             if (ImGui::CollapsingHeader("Generation", ImGuiTreeNodeFlags_DefaultOpen)) {
-                MapGen mapGen = world->getMapGen();
-                OctaveGen octaveGen = world->getOctaveGen();
+                const MapGen& mapGen = world->mapGen;
+                const OctaveGen& octaveGen = world->octaveGen;
                 
                 ImGui::Text("Seed: %.2f", mapGen.seed);
                 ImGui::Text("Scale: %.4f", mapGen.scale);
@@ -588,9 +678,9 @@ void ImGuiOverlay::renderWorldInfoWindow(const World* world, const std::vector<s
     ImGui::End();
 }
 
-void ImGuiOverlay::renderPerformanceWindow() {
+void ImGuiOverlay::renderPerformanceWindow(const logging::TickMetrics::History* metrics) {
     ImGui::SetNextWindowPos(ImVec2(10, 490), ImGuiCond_FirstUseEver);
-    ImGui::SetNextWindowSize(ImVec2(320, 180), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(420, 560), ImGuiCond_FirstUseEver);
     
     if (ImGui::Begin("Performance", &_showPerformance, ImGuiWindowFlags_NoCollapse)) {
         ImGuiIO& io = ImGui::GetIO();
@@ -620,6 +710,17 @@ void ImGuiOverlay::renderPerformanceWindow() {
         ImGui::PlotLines("##FrameTime", _frameTimes, FRAME_TIME_HISTORY_SIZE, 
                         _frameTimeIndex, nullptr, 0.0f, 33.3f, ImVec2(-1, 60));
         
+        // Simulation side, from the tick metrics ring buffers
+        ImGui::Spacing();
+        ImGui::Separator();
+        if (!metrics || metrics->empty()) {
+            ImGui::TextDisabled("No tick metrics recorded yet");
+        } else {
+            renderTickTimeSection(*metrics);
+            renderPhaseSection(*metrics);
+            renderCounterSections(*metrics);
+        }
+        
         // Memory usage (approximate)
         ImGui::Spacing();
         ImGui::Separator();
@@ -629,7 +730,329 @@ void ImGuiOverlay::renderPerformanceWindow() {
     ImGui::End();
 }
 
-void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>* creatures) {
+//==============================================================================
+// Performance Dashboard Helpers
+//==============================================================================
+
+namespace {
+
+using logging::TickMetrics;
+using MetricHistory = logging::TickMetrics::History;
+using logging::TickPhase;
+using logging::TICK_PHASE_COUNT;
+
+// One color per TickPhase, in phase order
+const ImU32 PHASE_COLORS[TICK_PHASE_COUNT] = {
+    IM_COL32(120, 170, 230, 255),   // environment_cache
+    IM_COL32( 90, 200, 200, 255),   // spatial_index
+    IM_COL32( 90, 200, 110, 255),   // world_objects
+    IM_COL32(180, 210,  90, 255),   // scent_layer
+    IM_COL32(150, 120,  90, 255),   // corpses
+    IM_COL32(230, 130, 190, 255),   // breeding_scents
+    IM_COL32(240, 170,  60, 255),   // creature_turns
+    IM_COL32(200, 110, 230, 255),   // offspring
+    IM_COL32(230,  90,  90, 255),   // remove_dead
+    IM_COL32(160, 160, 160, 255),   // statistics
+};
+
+/**
+ * @brief Sums of every sample in the history, for per-tick means
+ */
+struct MetricTotals {
+    float tickMs = 0.0f;
+    float phaseMs[TICK_PHASE_COUNT] = {};
+    float behaviorMs[TickMetrics::MAX_BEHAVIORS] = {};
+    double behaviorCalls[TickMetrics::MAX_BEHAVIORS] = {};
+    double pathSearches = 0.0;
+    double pathNodes = 0.0;
+    double allocations = 0.0;
+    float samples = 0.0f;
+};
+
+MetricTotals sumHistory(const MetricHistory& metrics) {
+    MetricTotals totals;
+    for (std::size_t i = 0; i < metrics.size(); ++i) {
+        const TickMetrics::Sample& s = metrics.at(i);
+        totals.tickMs += s.totalMs;
+        for (std::size_t p = 0; p < TICK_PHASE_COUNT; ++p) {
+            totals.phaseMs[p] += s.phaseMs[p];
+        }
+        for (std::size_t b = 0; b < metrics.behaviorCount(); ++b) {
+            totals.behaviorMs[b] += s.behaviorMs[b];
+            totals.behaviorCalls[b] += s.behaviorCalls[b];
+        }
+        totals.pathSearches += s.pathSearches;
+        totals.pathNodes += s.pathNodes;
+        totals.allocations += s.allocations;
+    }
+    totals.samples = static_cast<float>(metrics.size());
+    return totals;
+}
+
+float samplePathNodes(void* data, int i) {
+    const auto* metrics = static_cast<const MetricHistory*>(data);
+    return static_cast<float>(metrics->at(static_cast<std::size_t>(i)).pathNodes);
+}
+
+float sampleAllocations(void* data, int i) {
+    const auto* metrics = static_cast<const MetricHistory*>(data);
+    return static_cast<float>(metrics->at(static_cast<std::size_t>(i)).allocations);
+}
+
+/**
+ * @brief One flame graph box, labelled when the label fits, with a tooltip
+ */
+void drawFlameBox(ImDrawList* drawList, ImVec2 min, ImVec2 max, ImU32 color,
+                  const char* label, float ms, float tickMs) {
+    if (max.x - min.x < 1.0f) {
+        return;
+    }
+    drawList->AddRectFilled(min, max, color);
+    drawList->AddRect(min, max, IM_COL32(30, 30, 30, 255));
+    
+    char text[64];
+    std::snprintf(text, sizeof(text), "%s %.2f", label, ms);
+    if (ImGui::CalcTextSize(text).x + 6.0f < max.x - min.x) {
+        drawList->AddText(ImVec2(min.x + 3.0f, min.y + 1.0f), IM_COL32(20, 20, 20, 255), text);
+    }
+    
+    if (ImGui::IsMouseHoveringRect(min, max)) {
+        ImGui::SetTooltip("%s\n%.3f ms (%.1f%% of tick)", label, ms,
+                          tickMs > 0.0f ? 100.0f * ms / tickMs : 0.0f);
+    }
+}
+
+void formatBytes(char* out, std::size_t size, std::size_t bytes) {
+    const double value = static_cast<double>(bytes);
+    if (bytes >= (std::size_t(1) << 30)) {
+        std::snprintf(out, size, "%.2f GB", value / (1024.0 * 1024.0 * 1024.0));
+    } else if (bytes >= (std::size_t(1) << 20)) {
+        std::snprintf(out, size, "%.1f MB", value / (1024.0 * 1024.0));
+    } else {
+        std::snprintf(out, size, "%.1f KB", value / 1024.0);
+    }
+}
+
+} // namespace
+
+void ImGuiOverlay::renderTickTimeSection(const MetricHistory& metrics) {
+    if (!ImGui::CollapsingHeader("Tick Time", ImGuiTreeNodeFlags_DefaultOpen)) {
+        return;
+    }
+    
+    const std::size_t count = metrics.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        _tickTimesSorted[i] = metrics.at(i).totalMs;
+    }
+    std::sort(_tickTimesSorted.begin(), _tickTimesSorted.begin() + static_cast<std::ptrdiff_t>(count));
+    auto percentile = [&](float p) {
+        return _tickTimesSorted[static_cast<std::size_t>(p * static_cast<float>(count - 1) + 0.5f)];
+    };
+    const float maxMs = _tickTimesSorted[count - 1];
+    
+    ImGui::Text("Last tick: %.2f ms  (%zu ticks kept)", metrics.latest().totalMs, count);
+    ImGui::Text("p50 %.2f   p95 %.2f   p99 %.2f   max %.2f ms",
+                percentile(0.50f), percentile(0.95f), percentile(0.99f), maxMs);
+    
+    // Distribution of tick durations, 0 to the slowest tick
+    _tickHistogram.fill(0.0f);
+    const float binWidth = std::max(maxMs, 0.001f) / static_cast<float>(TICK_HISTOGRAM_BINS);
+    for (std::size_t i = 0; i < count; ++i) {
+        int bin = static_cast<int>(_tickTimesSorted[i] / binWidth);
+        _tickHistogram[static_cast<std::size_t>(std::min(bin, TICK_HISTOGRAM_BINS - 1))] += 1.0f;
+    }
+    char overlay[48];
+    std::snprintf(overlay, sizeof(overlay), "0 - %.1f ms", maxMs);
+    ImGui::PlotHistogram("##TickHistogram", _tickHistogram.data(), TICK_HISTOGRAM_BINS, 0,
+                         overlay, 0.0f, FLT_MAX, ImVec2(-1, 60));
+}
+
+void ImGuiOverlay::renderPhaseSection(const MetricHistory& metrics) {
+    if (!ImGui::CollapsingHeader("Tick Phases", ImGuiTreeNodeFlags_DefaultOpen)) {
+        return;
+    }
+    
+    const MetricTotals totals = sumHistory(metrics);
+    const float meanTickMs = totals.tickMs / totals.samples;
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const float width = ImGui::GetContentRegionAvail().x;
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const float msToPixels = meanTickMs > 0.0f ? width / meanTickMs : 0.0f;
+    
+    // Flame graph of the mean tick: tick, then phases, then behaviors
+    ImGui::Text("Mean tick (flame graph)");
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    drawFlameBox(drawList, origin, ImVec2(origin.x + width, origin.y + rowHeight),
+                 IM_COL32(200, 200, 200, 255), "tick", meanTickMs, meanTickMs);
+    
+    float x = origin.x;
+    const float phaseY = origin.y + rowHeight;
+    for (std::size_t p = 0; p < TICK_PHASE_COUNT; ++p) {
+        const float ms = totals.phaseMs[p] / totals.samples;
+        const float w = ms * msToPixels;
+        drawFlameBox(drawList, ImVec2(x, phaseY), ImVec2(x + w, phaseY + rowHeight), PHASE_COLORS[p],
+                     logging::tickPhaseName(static_cast<TickPhase>(p)), ms, meanTickMs);
+        
+        if (static_cast<TickPhase>(p) == TickPhase::CreatureTurns) {
+            float bx = x;
+            const float behaviorY = phaseY + rowHeight;
+            for (std::size_t b = 0; b < metrics.behaviorCount(); ++b) {
+                const float bms = totals.behaviorMs[b] / totals.samples;
+                const float bw = bms * msToPixels;
+                drawFlameBox(drawList, ImVec2(bx, behaviorY), ImVec2(bx + bw, behaviorY + rowHeight),
+                             IM_COL32(250, 210, 120, 255), metrics.behaviorName(b).c_str(), bms, meanTickMs);
+                bx += bw;
+            }
+        }
+        x += w;
+    }
+    ImGui::Dummy(ImVec2(width, rowHeight * 3.0f));
+    
+    // Stacked bar per tick, oldest on the left, scaled to the slowest tick
+    ImGui::Spacing();
+    ImGui::Text("Per tick");
+    float maxMs = 0.0f;
+    for (std::size_t i = 0; i < metrics.size(); ++i) {
+        maxMs = std::max(maxMs, metrics.at(i).totalMs);
+    }
+    const float graphHeight = 80.0f;
+    origin = ImGui::GetCursorScreenPos();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + graphHeight),
+                            ImGui::GetColorU32(ImGuiCol_FrameBg));
+    const float barWidth = width / static_cast<float>(TickMetrics::HISTORY_SIZE);
+    const float msToHeight = maxMs > 0.0f ? graphHeight / maxMs : 0.0f;
+    for (std::size_t i = 0; i < metrics.size(); ++i) {
+        const TickMetrics::Sample& s = metrics.at(i);
+        const float bx = origin.x + static_cast<float>(i) * barWidth;
+        float top = origin.y + graphHeight;
+        for (std::size_t p = 0; p < TICK_PHASE_COUNT; ++p) {
+            const float h = s.phaseMs[p] * msToHeight;
+            drawList->AddRectFilled(ImVec2(bx, top - h), ImVec2(bx + std::max(barWidth, 1.0f), top),
+                                    PHASE_COLORS[p]);
+            top -= h;
+        }
+    }
+    ImGui::Dummy(ImVec2(width, graphHeight));
+    if (ImGui::IsItemHovered() && barWidth > 0.0f) {
+        const float mx = ImGui::GetMousePos().x - origin.x;
+        const std::size_t i = static_cast<std::size_t>(std::max(0.0f, mx / barWidth));
+        if (i < metrics.size()) {
+            const TickMetrics::Sample& s = metrics.at(i);
+            ImGui::SetTooltip("Tick %llu: %.2f ms", static_cast<unsigned long long>(s.tick), s.totalMs);
+        }
+    }
+    
+    // Legend with mean cost per phase
+    if (ImGui::BeginTable("##PhaseLegend", 3, ImGuiTableFlags_SizingStretchProp)) {
+        for (std::size_t p = 0; p < TICK_PHASE_COUNT; ++p) {
+            const float ms = totals.phaseMs[p] / totals.samples;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(PHASE_COLORS[p]), "■");
+            ImGui::SameLine();
+            ImGui::TextUnformatted(logging::tickPhaseName(static_cast<TickPhase>(p)));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f ms", ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f%%", meanTickMs > 0.0f ? 100.0f * ms / meanTickMs : 0.0f);
+        }
+        ImGui::EndTable();
+    }
+}
+
+void ImGuiOverlay::renderCounterSections(const MetricHistory& metrics) {
+    const MetricTotals totals = sumHistory(metrics);
+    const double samples = static_cast<double>(totals.samples);
+    const TickMetrics::Sample& latest = metrics.latest();
+    
+    if (ImGui::CollapsingHeader("Behaviors", ImGuiTreeNodeFlags_None)) {
+        if (metrics.behaviorCount() == 0) {
+            ImGui::TextDisabled("No behaviors executed yet");
+        } else if (ImGui::BeginTable("##Behaviors", 4,
+                                     ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+            ImGui::TableSetupColumn("Behavior");
+            ImGui::TableSetupColumn("Calls/tick");
+            ImGui::TableSetupColumn("ms/tick");
+            ImGui::TableSetupColumn("us/call");
+            ImGui::TableHeadersRow();
+            for (std::size_t b = 0; b < metrics.behaviorCount(); ++b) {
+                const double calls = totals.behaviorCalls[b];
+                const double ms = static_cast<double>(totals.behaviorMs[b]);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(metrics.behaviorName(b).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", calls / samples);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", ms / samples);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", calls > 0.0 ? 1000.0 * ms / calls : 0.0);
+            }
+            ImGui::EndTable();
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Pathfinding", ImGuiTreeNodeFlags_None)) {
+        ImGui::Text("Searches: %u last tick, %.1f mean", latest.pathSearches, totals.pathSearches / samples);
+        ImGui::Text("Nodes expanded: %u last tick, %.0f mean", latest.pathNodes, totals.pathNodes / samples);
+        ImGui::PlotLines("##PathNodes", samplePathNodes, const_cast<MetricHistory*>(&metrics),
+                         static_cast<int>(metrics.size()), 0, "Nodes/tick", 0.0f, FLT_MAX, ImVec2(-1, 50));
+    }
+    
+    if (ImGui::CollapsingHeader("Spatial Index", ImGuiTreeNodeFlags_None)) {
+        const float occupancy = latest.totalCells > 0
+            ? 100.0f * static_cast<float>(latest.occupiedCells) / static_cast<float>(latest.totalCells) : 0.0f;
+        ImGui::Text("Creatures indexed: %u", latest.indexedCreatures);
+        ImGui::Text("Occupied cells: %u / %u (%.1f%%)", latest.occupiedCells, latest.totalCells, occupancy);
+        ImGui::Text("Per occupied cell: %.1f mean, %u max",
+                    latest.occupiedCells > 0
+                        ? static_cast<float>(latest.indexedCreatures) / static_cast<float>(latest.occupiedCells)
+                        : 0.0f,
+                    latest.largestCell);
+    }
+    
+    if (ImGui::CollapsingHeader("Allocations", ImGuiTreeNodeFlags_None)) {
+        ImGui::Text("Heap allocations: %u last tick, %.0f mean", latest.allocations, totals.allocations / samples);
+        ImGui::PlotLines("##Allocations", sampleAllocations, const_cast<MetricHistory*>(&metrics),
+                         static_cast<int>(metrics.size()), 0, "Allocations/tick", 0.0f, FLT_MAX, ImVec2(-1, 50));
+    }
+    
+    if (ImGui::CollapsingHeader("Memory", ImGuiTreeNodeFlags_None)) {
+        if (ImGui::BeginTable("##Memory", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+            ImGui::TableSetupColumn("Subsystem");
+            ImGui::TableSetupColumn("Size");
+            ImGui::TableSetupColumn("Objects");
+            ImGui::TableSetupColumn("Per object");
+            ImGui::TableHeadersRow();
+            for (std::size_t i = 0; i < metrics.memoryGaugeCount(); ++i) {
+                const TickMetrics::MemoryGauge& gauge = metrics.memoryGauge(i);
+                const bool overBudget = gauge.budget > 0 && gauge.bytes > gauge.budget;
+                char text[32];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(gauge.name);
+                ImGui::TableNextColumn();
+                formatBytes(text, sizeof(text), gauge.bytes);
+                if (overBudget) {
+                    ImGui::TextColored(ImVec4(1.0f, 0.35f, 0.3f, 1.0f), "%s", text);
+                } else {
+                    ImGui::TextUnformatted(text);
+                }
+                if (gauge.budget > 0 && ImGui::IsItemHovered()) {
+                    formatBytes(text, sizeof(text), gauge.budget);
+                    ImGui::SetTooltip("Budget: %s%s", text, overBudget ? " (exceeded)" : "");
+                }
+                ImGui::TableNextColumn();
+                if (gauge.objects > 0) ImGui::Text("%zu", gauge.objects);
+                ImGui::TableNextColumn();
+                if (gauge.objects > 0) ImGui::Text("%zu B", gauge.bytes / gauge.objects);
+            }
+            ImGui::EndTable();
+        }
+    }
+}
+
+void ImGuiOverlay::renderCreatureListWindow(const std::vector<CreatureRow>* creatures) {
     // Calculate right-side position dynamically based on window size
     ImGuiIO& io = ImGui::GetIO();
     const float rightMargin = 10.0f;
@@ -653,8 +1076,7 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
         // H=Herbivore, F=Frugivore, O=Omnivore, C=Carnivore, N=Necrovore
         int herbivores = 0, frugivores = 0, omnivores = 0, carnivores = 0, necrovores = 0;
         for (const auto& c : *creatures) {
-            EcoSim::Genetics::DietType diet = c->getPhenotype().calculateDietType();
-            switch (diet) {
+            switch (c.diet) {
                 case EcoSim::Genetics::DietType::HERBIVORE:
                     herbivores++;
                     break;
@@ -707,25 +1129,25 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
                 case 1: // Age
                     std::sort(sortedIndices.begin(), sortedIndices.end(),
                         [creatures](size_t a, size_t b) {
-                            return (*creatures)[a]->getAge() > (*creatures)[b]->getAge();
+                            return (*creatures)[a].age > (*creatures)[b].age;
                         });
                     break;
                 case 2: // Hunger
                     std::sort(sortedIndices.begin(), sortedIndices.end(),
                         [creatures](size_t a, size_t b) {
-                            return (*creatures)[a]->getHunger() < (*creatures)[b]->getHunger();
+                            return (*creatures)[a].hunger < (*creatures)[b].hunger;
                         });
                     break;
                 case 3: // Thirst
                     std::sort(sortedIndices.begin(), sortedIndices.end(),
                         [creatures](size_t a, size_t b) {
-                            return (*creatures)[a]->getThirst() < (*creatures)[b]->getThirst();
+                            return (*creatures)[a].thirst < (*creatures)[b].thirst;
                         });
                     break;
                 case 4: // Fatigue
                     std::sort(sortedIndices.begin(), sortedIndices.end(),
                         [creatures](size_t a, size_t b) {
-                            return (*creatures)[a]->getFatigue() > (*creatures)[b]->getFatigue();
+                            return (*creatures)[a].fatigue > (*creatures)[b].fatigue;
                         });
                     break;
                 default:
@@ -733,13 +1155,13 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
             }
 
             for (size_t idx : sortedIndices) {
-                const EcoSim::Genetics::Organism& creature = *(*creatures)[idx];
-                int creatureId = creature.getSequentialId();
+                const CreatureRow& creature = (*creatures)[idx];
+                int creatureId = creature.id;
                 
                 // Filter check - allow filtering by creature ID or position
                 if (std::strlen(_creatureFilterText) > 0) {
                     std::string idStr = std::to_string(creatureId);
-                    std::string posStr = std::to_string(creature.getX()) + "," + std::to_string(creature.getY());
+                    std::string posStr = std::to_string(creature.tileX) + "," + std::to_string(creature.tileY);
                     if (idStr.find(_creatureFilterText) == std::string::npos &&
                         posStr.find(_creatureFilterText) == std::string::npos) {
                         continue;
@@ -754,7 +1176,7 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
                 // Creature entry - use Selectable for proper click handling in scrollable regions
                 char label[128];
                 snprintf(label, sizeof(label), "#%d [%d,%d] Age:%d",
-                        creatureId, creature.getX(), creature.getY(), creature.getAge());
+                        creatureId, creature.tileX, creature.tileY, creature.age);
                 
                 // Calculate width to leave space for profile text
                 float availWidth = ImGui::GetContentRegionAvail().x;
@@ -773,18 +1195,18 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
                 
                 // Double-click to center viewport on this creature
                 if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
-                    _pendingCenterX = creature.getX();
-                    _pendingCenterY = creature.getY();
+                    _pendingCenterX = creature.tileX;
+                    _pendingCenterY = creature.tileY;
                 }
                 
                 // Show profile on same line as selectable
                 ImGui::SameLine();
                 
                 // Color-coded profile
-                const char* profileStr = getProfileName(static_cast<int>(creature.getMotivation()));
+                const char* profileStr = getProfileName(static_cast<int>(creature.motivation));
                 ImVec4 profileColor;
                 
-                switch (creature.getMotivation()) {
+                switch (creature.motivation) {
                     case Motivation::Hungry:
                         profileColor = ImVec4(1.0f, 0.5f, 0.2f, 1.0f);
                         break;
@@ -811,14 +1233,14 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
                     ImGui::BeginTooltip();
                     ImGui::Text("Creature #%d", creatureId);
                     ImGui::Separator();
-                    ImGui::Text("Position: (%d, %d)", creature.getX(), creature.getY());
-                    ImGui::Text("Age: %d / %d", creature.getAge(), creature.getLifespan());
+                    ImGui::Text("Position: (%d, %d)", creature.tileX, creature.tileY);
+                    ImGui::Text("Age: %d / %d", creature.age, creature.lifespan);
                     ImGui::Text("Profile: %s", profileStr);
                     ImGui::Separator();
-                    ImGui::Text("Hunger: %.1f%%", creature.getHunger() * 10.0f);
-                    ImGui::Text("Thirst: %.1f%%", creature.getThirst() * 10.0f);
-                    ImGui::Text("Fatigue: %.1f%%", creature.getFatigue() * 10.0f);
-                    ImGui::Text("Mate Drive: %.1f%%", creature.getMate() * 10.0f);
+                    ImGui::Text("Hunger: %.1f%%", creature.hunger * 10.0f);
+                    ImGui::Text("Thirst: %.1f%%", creature.thirst * 10.0f);
+                    ImGui::Text("Fatigue: %.1f%%", creature.fatigue * 10.0f);
+                    ImGui::Text("Mate Drive: %.1f%%", creature.mate * 10.0f);
                     ImGui::EndTooltip();
                 }
                 
@@ -834,7 +1256,7 @@ void ImGuiOverlay::renderCreatureListWindow(const std::vector<std::unique_ptr<Ec
 // Creature Inspector Window - New Design with 5 Tabs + Genetics Sub-Tabs
 //==============================================================================
 
-void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organism* creature) {
+void ImGuiOverlay::renderCreatureInspectorWindow(const CreatureDetails* creature) {
     // Calculate bottom-right position dynamically based on window size
     ImGuiIO& io = ImGui::GetIO();
     const float rightMargin = 10.0f;
@@ -859,14 +1281,14 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
         // ============================================
         
         // Common name with biome adaptation prefix (e.g., "Arctic Wolf", "Desert Stalker")
-        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "%s", creature->getFullLabel().c_str());
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "%s", creature->label.c_str());
         
         // Scientific name
-        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.9f, 1.0f), "%s", creature->getScientificName().c_str());
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.9f, 1.0f), "%s", creature->scientificName.c_str());
         
         // ID and Age
-        ImGui::Text("ID: #%d  Age: %d/%d", creature->getSequentialId(),
-                    creature->getAge(), creature->getLifespan());
+        ImGui::Text("ID: #%d  Age: %d/%d", creature->id,
+                    creature->age, creature->lifespan);
         ImGui::Separator();
         
         // ============================================
@@ -885,9 +1307,9 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 // Motivation and Action
-                const char* motivationStr = getProfileName(static_cast<int>(creature->getMotivation()));
+                const char* motivationStr = getProfileName(static_cast<int>(creature->motivation));
                 ImVec4 motivationColor;
-                switch (creature->getMotivation()) {
+                switch (creature->motivation) {
                     case Motivation::Hungry: motivationColor = ImVec4(1.0f, 0.5f, 0.2f, 1.0f); break;
                     case Motivation::Thirsty: motivationColor = ImVec4(0.3f, 0.7f, 1.0f, 1.0f); break;
                     case Motivation::Amorous: motivationColor = ImVec4(1.0f, 0.4f, 0.7f, 1.0f); break;
@@ -900,14 +1322,14 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::TextColored(motivationColor, "%s", motivationStr);
                 
                 // Action display using Action enum
-                Action action = creature->getAction();
+                Action action = creature->action;
                 ImGui::Text("Action:");
                 ImGui::SameLine(100);
                 ImGui::TextColored(getActionColor(action), "%s", getActionName(action));
                 
                 // Show target if in combat
-                if (creature->isInCombat()) {
-                    int targetId = creature->getTargetId();
+                if (creature->inCombat) {
+                    int targetId = creature->targetId;
                     if (targetId >= 0) {
                         ImGui::Text("Target:");
                         ImGui::SameLine(100);
@@ -922,16 +1344,15 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
-                    EcoSim::Genetics::DietType diet = phenotype.calculateDietType();
+                    EcoSim::Genetics::DietType diet = creature->diet;
                     ImGui::Text("Primary:");
                     ImGui::SameLine(100);
                     ImGui::Text("%s", getEmergentDietName(diet));
                     
-                    float plantDigest = phenotype.getTrait(UG::PLANT_DIGESTION_EFFICIENCY);
-                    float meatDigest = phenotype.getTrait(UG::MEAT_DIGESTION_EFFICIENCY);
+                    float plantDigest = creature->trait(UG::PLANT_DIGESTION_EFFICIENCY);
+                    float meatDigest = creature->trait(UG::MEAT_DIGESTION_EFFICIENCY);
                     
                     ImGui::Text("Plant Digest:");
                     ImGui::SameLine(100);
@@ -943,7 +1364,7 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 } else {
                     ImGui::Text("Diet:");
                     ImGui::SameLine(100);
-                    ImGui::Text("%s", getEmergentDietName(creature->getDietType()));
+                    ImGui::Text("%s", getEmergentDietName(creature->diet));
                 }
                 
                 ImGui::Spacing();
@@ -953,7 +1374,7 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    float maxSize = creature->getPhenotype().getTrait(EcoSim::Genetics::UniversalGenes::MAX_SIZE);
+                    float maxSize = creature->trait(EcoSim::Genetics::UniversalGenes::MAX_SIZE);
                     ImGui::Text("Size:");
                     ImGui::SameLine(100);
                     ImGui::Text("%.1f (Max: %.1f)", maxSize * 0.8f, maxSize);
@@ -965,11 +1386,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 
                 ImGui::Text("Position:");
                 ImGui::SameLine(100);
-                ImGui::Text("(%d, %d)", creature->tileX(), creature->tileY());
+                ImGui::Text("(%d, %d)", creature->tileX, creature->tileY);
                 
                 ImGui::Text("World Pos:");
                 ImGui::SameLine(100);
-                ImGui::Text("(%.1f, %.1f)", creature->getWorldX(), creature->getWorldY());
+                ImGui::Text("(%.1f, %.1f)", creature->worldX, creature->worldY);
                 
                 ImGui::Spacing();
                 
@@ -978,9 +1399,9 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 // Health bar
-                float healthPercent = creature->getHealthPercent();
+                float healthPercent = creature->healthPercent;
                 char healthLabel[32];
-                snprintf(healthLabel, sizeof(healthLabel), "%.0f/%.0f", creature->getHealth(), creature->getMaxHealth());
+                snprintf(healthLabel, sizeof(healthLabel), "%.0f/%.0f", creature->health, creature->maxHealth);
                 ImGui::Text("Health:");
                 ImGui::SameLine(80);
                 ImVec4 healthColor = (healthPercent > 0.5f) ? ImVec4(0.3f, 1.0f, 0.3f, 1.0f) :
@@ -991,7 +1412,7 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::PopStyleColor();
                 
                 // Hunger (0-10 scale)
-                float hunger = creature->getHunger();
+                float hunger = creature->hunger;
                 char hungerLabel[16];
                 snprintf(hungerLabel, sizeof(hungerLabel), "%.1f/10", hunger);
                 ImGui::Text("Hunger:");
@@ -1001,7 +1422,7 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::PopStyleColor();
                 
                 // Energy (inverse of fatigue)
-                float energy = 10.0f - creature->getFatigue();
+                float energy = 10.0f - creature->fatigue;
                 char energyLabel[16];
                 snprintf(energyLabel, sizeof(energyLabel), "%.1f/10", energy);
                 ImGui::Text("Energy:");
@@ -1017,17 +1438,16 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
                     int traitCount = 0;
-                    float locomotion = phenotype.getTrait(UG::LOCOMOTION);
-                    float sightRange = phenotype.getTrait(UG::SIGHT_RANGE);
-                    float huntInstinct = phenotype.getTrait(UG::HUNT_INSTINCT);
-                    float aggression = phenotype.getTrait(UG::COMBAT_AGGRESSION);
-                    float teethSharp = phenotype.getTrait(UG::TEETH_SHARPNESS);
-                    float clawLength = phenotype.getTrait(UG::CLAW_LENGTH);
-                    float hardiness = phenotype.getTrait(UG::HARDINESS);
+                    float locomotion = creature->trait(UG::LOCOMOTION);
+                    float sightRange = creature->trait(UG::SIGHT_RANGE);
+                    float huntInstinct = creature->trait(UG::HUNT_INSTINCT);
+                    float aggression = creature->trait(UG::COMBAT_AGGRESSION);
+                    float teethSharp = creature->trait(UG::TEETH_SHARPNESS);
+                    float clawLength = creature->trait(UG::CLAW_LENGTH);
+                    float hardiness = creature->trait(UG::HARDINESS);
                     
                     if (locomotion > 0.75f) { ImGui::BulletText("Fast runner (Locomotion: %.2f)", locomotion); traitCount++; }
                     if (sightRange > 100.0f) { ImGui::BulletText("Excellent vision (Sight: %.0f)", sightRange); traitCount++; }
@@ -1057,10 +1477,10 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::TextColored(ImVec4(0.8f, 0.9f, 0.7f, 1.0f), "VITALS");
                 ImGui::Separator();
                 
-                float healthPercent = creature->getHealthPercent();
-                float currentHealth = creature->getHealth();
-                float maxHealth = creature->getMaxHealth();
-                WoundState woundState = creature->getWoundState();
+                float healthPercent = creature->healthPercent;
+                float currentHealth = creature->health;
+                float maxHealth = creature->maxHealth;
+                WoundState woundState = creature->woundState;
                 
                 ImVec4 healthBarColor;
                 const char* stateText;
@@ -1098,7 +1518,7 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::SameLine();
                 ImGui::TextColored(healthBarColor, "(%s)", stateText);
                 
-                float woundSeverity = creature->getWoundSeverity();
+                float woundSeverity = creature->woundSeverity;
                 if (woundSeverity > 0.0f) {
                     ImGui::Text("Wound Severity:");
                     ImGui::SameLine(120);
@@ -1108,14 +1528,13 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 }
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
-                    ImGui::Text("Regeneration Rate: %.2f", phenotype.getTrait(UG::REGENERATION_RATE));
-                    ImGui::Text("Wound Tolerance: %.2f", phenotype.getTrait(UG::WOUND_TOLERANCE));
-                    ImGui::Text("Bleeding Resistance: %.2f", phenotype.getTrait(UG::BLEEDING_RESISTANCE));
+                    ImGui::Text("Regeneration Rate: %.2f", creature->trait(UG::REGENERATION_RATE));
+                    ImGui::Text("Wound Tolerance: %.2f", creature->trait(UG::WOUND_TOLERANCE));
+                    ImGui::Text("Bleeding Resistance: %.2f", creature->trait(UG::BLEEDING_RESISTANCE));
                 } else {
-                    ImGui::Text("Healing: %.3f/tick", creature->getHealingRate());
+                    ImGui::Text("Healing: %.3f/tick", creature->healingRate);
                 }
                 
                 ImGui::Spacing();
@@ -1125,10 +1544,10 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 // All needs on 0-10 scale with progress bars
-                float hunger = creature->getHunger();
-                float thirst = creature->getThirst();
-                float fatigue = creature->getFatigue();
-                float mate = creature->getMate();
+                float hunger = creature->hunger;
+                float thirst = creature->thirst;
+                float fatigue = creature->fatigue;
+                float mate = creature->mate;
                 
                 char needLabel[32];
                 
@@ -1171,17 +1590,16 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
-                    float maintenanceCost = phenotype.getTotalMaintenanceCost();
-                    float metabolism = phenotype.getTrait(EcoSim::Genetics::UniversalGenes::METABOLISM_RATE);
+                    float maintenanceCost = creature->maintenanceCost;
+                    float metabolism = creature->trait(EcoSim::Genetics::UniversalGenes::METABOLISM_RATE);
                     
                     ImGui::Text("Metabolism: %.3f", metabolism);
                     ImGui::Text("Maintenance Cost: %.3f/tick", maintenanceCost);
                 } else {
-                    ImGui::Text("Metabolism: %.4f", creature->getMetabolism());
+                    ImGui::Text("Metabolism: %.4f", creature->metabolism);
                 }
                 
-                ImGui::Text("Speed: %d", creature->getSpeed());
+                ImGui::Text("Speed: %d", creature->speed);
                 
                 ImGui::Spacing();
                 
@@ -1190,11 +1608,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    float hardiness = creature->getPhenotype().getTrait(EcoSim::Genetics::UniversalGenes::HARDINESS);
+                    float hardiness = creature->trait(EcoSim::Genetics::UniversalGenes::HARDINESS);
                     ImGui::Text("Hardiness: %.2f", hardiness);
                 }
                 
-                ImGui::Text("World Position: (%.1f, %.1f)", creature->getWorldX(), creature->getWorldY());
+                ImGui::Text("World Position: (%.1f, %.1f)", creature->worldX, creature->worldY);
                 
                 ImGui::EndTabItem();
             }
@@ -1209,19 +1627,19 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::TextColored(ImVec4(0.8f, 0.9f, 0.7f, 1.0f), "COMBAT STATUS");
                 ImGui::Separator();
                 
-                if (creature->isInCombat()) {
+                if (creature->inCombat) {
                     ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Status: IN COMBAT");
-                    int targetId = creature->getTargetId();
+                    int targetId = creature->targetId;
                     if (targetId >= 0) {
                         ImGui::Text("Target: #%d", targetId);
                     }
-                } else if (creature->isFleeing()) {
+                } else if (creature->fleeing) {
                     ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Status: FLEEING");
                 } else {
                     ImGui::Text("Status: Peaceful");
                 }
                 
-                int cooldown = creature->getCombatCooldown();
+                int cooldown = creature->combatCooldown;
                 if (cooldown > 0) {
                     ImGui::Text("Cooldown: %d ticks", cooldown);
                 } else {
@@ -1235,13 +1653,12 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
-                    float aggression = phenotype.getTrait(UG::COMBAT_AGGRESSION);
-                    float retreat = phenotype.getTrait(UG::RETREAT_THRESHOLD);
-                    float territorial = phenotype.getTrait(UG::TERRITORIAL_AGGRESSION);
-                    float packCoord = phenotype.getTrait(UG::PACK_COORDINATION);
+                    float aggression = creature->trait(UG::COMBAT_AGGRESSION);
+                    float retreat = creature->trait(UG::RETREAT_THRESHOLD);
+                    float territorial = creature->trait(UG::TERRITORIAL_AGGRESSION);
+                    float packCoord = creature->trait(UG::PACK_COORDINATION);
                     
                     ImGui::Text("Aggression:");
                     ImGui::SameLine(120);
@@ -1285,39 +1702,38 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
                     // Teeth
                     if (ImGui::TreeNode("Teeth")) {
-                        ImGui::Text("%-20s: %.2f", "Sharpness", phenotype.getTrait(UG::TEETH_SHARPNESS));
-                        ImGui::Text("%-20s: %.2f", "Serration", phenotype.getTrait(UG::TEETH_SERRATION));
-                        ImGui::Text("%-20s: %.2f", "Size", phenotype.getTrait(UG::TEETH_SIZE));
+                        ImGui::Text("%-20s: %.2f", "Sharpness", creature->trait(UG::TEETH_SHARPNESS));
+                        ImGui::Text("%-20s: %.2f", "Serration", creature->trait(UG::TEETH_SERRATION));
+                        ImGui::Text("%-20s: %.2f", "Size", creature->trait(UG::TEETH_SIZE));
                         ImGui::TreePop();
                     }
                     
                     // Claws
                     if (ImGui::TreeNode("Claws")) {
-                        ImGui::Text("%-20s: %.2f", "Length", phenotype.getTrait(UG::CLAW_LENGTH));
-                        ImGui::Text("%-20s: %.2f", "Sharpness", phenotype.getTrait(UG::CLAW_SHARPNESS));
-                        ImGui::Text("%-20s: %.2f", "Curvature", phenotype.getTrait(UG::CLAW_CURVATURE));
+                        ImGui::Text("%-20s: %.2f", "Length", creature->trait(UG::CLAW_LENGTH));
+                        ImGui::Text("%-20s: %.2f", "Sharpness", creature->trait(UG::CLAW_SHARPNESS));
+                        ImGui::Text("%-20s: %.2f", "Curvature", creature->trait(UG::CLAW_CURVATURE));
                         ImGui::TreePop();
                     }
                     
                     // Horns
                     if (ImGui::TreeNode("Horns")) {
-                        ImGui::Text("%-20s: %.2f", "Length", phenotype.getTrait(UG::HORN_LENGTH));
-                        ImGui::Text("%-20s: %.2f", "Pointiness", phenotype.getTrait(UG::HORN_POINTINESS));
-                        ImGui::Text("%-20s: %.2f", "Spread", phenotype.getTrait(UG::HORN_SPREAD));
+                        ImGui::Text("%-20s: %.2f", "Length", creature->trait(UG::HORN_LENGTH));
+                        ImGui::Text("%-20s: %.2f", "Pointiness", creature->trait(UG::HORN_POINTINESS));
+                        ImGui::Text("%-20s: %.2f", "Spread", creature->trait(UG::HORN_SPREAD));
                         ImGui::TreePop();
                     }
                     
                     // Tail Weapons
                     if (ImGui::TreeNode("Tail")) {
-                        ImGui::Text("%-20s: %.2f", "Length", phenotype.getTrait(UG::TAIL_LENGTH));
-                        ImGui::Text("%-20s: %.2f", "Mass", phenotype.getTrait(UG::TAIL_MASS));
-                        ImGui::Text("%-20s: %.2f", "Spines", phenotype.getTrait(UG::TAIL_SPINES));
-                        ImGui::Text("%-20s: %.2f", "Body Spines", phenotype.getTrait(UG::BODY_SPINES));
+                        ImGui::Text("%-20s: %.2f", "Length", creature->trait(UG::TAIL_LENGTH));
+                        ImGui::Text("%-20s: %.2f", "Mass", creature->trait(UG::TAIL_MASS));
+                        ImGui::Text("%-20s: %.2f", "Spines", creature->trait(UG::TAIL_SPINES));
+                        ImGui::Text("%-20s: %.2f", "Body Spines", creature->trait(UG::BODY_SPINES));
                         ImGui::TreePop();
                     }
                 } else {
@@ -1331,12 +1747,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Separator();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
-                    float hideThick = phenotype.getTrait(UG::HIDE_THICKNESS);
-                    float scaleCover = phenotype.getTrait(UG::SCALE_COVERAGE);
-                    float fatLayer = phenotype.getTrait(UG::FAT_LAYER_THICKNESS);
+                    float hideThick = creature->trait(UG::HIDE_THICKNESS);
+                    float scaleCover = creature->trait(UG::SCALE_COVERAGE);
+                    float fatLayer = creature->trait(UG::FAT_LAYER_THICKNESS);
                     
                     ImGui::Text("Hide:");
                     ImGui::SameLine(100);
@@ -1380,7 +1795,6 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Spacing();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
                     // --- MORPHOLOGY ---
@@ -1388,16 +1802,16 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                     ImGui::Separator();
                     
                     ImGui::Columns(2, "morphology_cols", false);
-                    ImGui::Text("%-20s: %.2f", "Hide Thickness", phenotype.getTrait(UG::HIDE_THICKNESS));
-                    ImGui::Text("%-20s: %.2f", "Fur Density", phenotype.getTrait(UG::FUR_DENSITY));
-                    ImGui::Text("%-20s: %.2f", "Scale Coverage", phenotype.getTrait(UG::SCALE_COVERAGE));
-                    ImGui::Text("%-20s: %.2f", "Fat Layer", phenotype.getTrait(UG::FAT_LAYER_THICKNESS));
+                    ImGui::Text("%-20s: %.2f", "Hide Thickness", creature->trait(UG::HIDE_THICKNESS));
+                    ImGui::Text("%-20s: %.2f", "Fur Density", creature->trait(UG::FUR_DENSITY));
+                    ImGui::Text("%-20s: %.2f", "Scale Coverage", creature->trait(UG::SCALE_COVERAGE));
+                    ImGui::Text("%-20s: %.2f", "Fat Layer", creature->trait(UG::FAT_LAYER_THICKNESS));
                     ImGui::NextColumn();
-                    ImGui::Text("%-20s: %.2f", "Tooth Sharpness", phenotype.getTrait(UG::TOOTH_SHARPNESS));
-                    ImGui::Text("%-20s: %.2f", "Tooth Grinding", phenotype.getTrait(UG::TOOTH_GRINDING));
-                    ImGui::Text("%-20s: %.2f", "Gut Length", phenotype.getTrait(UG::GUT_LENGTH));
-                    ImGui::Text("%-20s: %.2f", "Jaw Strength", phenotype.getTrait(UG::JAW_STRENGTH));
-                    ImGui::Text("%-20s: %.2f", "Tail Length", phenotype.getTrait(UG::TAIL_LENGTH));
+                    ImGui::Text("%-20s: %.2f", "Tooth Sharpness", creature->trait(UG::TOOTH_SHARPNESS));
+                    ImGui::Text("%-20s: %.2f", "Tooth Grinding", creature->trait(UG::TOOTH_GRINDING));
+                    ImGui::Text("%-20s: %.2f", "Gut Length", creature->trait(UG::GUT_LENGTH));
+                    ImGui::Text("%-20s: %.2f", "Jaw Strength", creature->trait(UG::JAW_STRENGTH));
+                    ImGui::Text("%-20s: %.2f", "Tail Length", creature->trait(UG::TAIL_LENGTH));
                     ImGui::Columns(1);
                     
                     ImGui::Spacing();
@@ -1406,9 +1820,9 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                     ImGui::TextColored(ImVec4(0.8f, 0.9f, 0.7f, 1.0f), "MOBILITY");
                     ImGui::Separator();
                     
-                    ImGui::Text("Locomotion: %.2f", phenotype.getTrait(UG::LOCOMOTION));
-                    ImGui::Text("Navigation: %.2f", phenotype.getTrait(UG::NAVIGATION_ABILITY));
-                    ImGui::Text("Speed: %d", creature->getSpeed());
+                    ImGui::Text("Locomotion: %.2f", creature->trait(UG::LOCOMOTION));
+                    ImGui::Text("Navigation: %.2f", creature->trait(UG::NAVIGATION_ABILITY));
+                    ImGui::Text("Speed: %d", creature->speed);
                     
                     ImGui::Spacing();
                     
@@ -1416,10 +1830,10 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                     ImGui::TextColored(ImVec4(0.8f, 0.9f, 0.7f, 1.0f), "SENSORY ABILITIES");
                     ImGui::Separator();
                     
-                    ImGui::Text("Sight Range: %.1f", phenotype.getTrait(UG::SIGHT_RANGE));
-                    ImGui::Text("Color Vision: %.2f", phenotype.getTrait(UG::COLOR_VISION));
-                    ImGui::Text("Scent Detection: %.2f", phenotype.getTrait(UG::SCENT_DETECTION));
-                    ImGui::Text("Olfactory Acuity: %.2f", phenotype.getTrait(UG::OLFACTORY_ACUITY));
+                    ImGui::Text("Sight Range: %.1f", creature->trait(UG::SIGHT_RANGE));
+                    ImGui::Text("Color Vision: %.2f", creature->trait(UG::COLOR_VISION));
+                    ImGui::Text("Scent Detection: %.2f", creature->trait(UG::SCENT_DETECTION));
+                    ImGui::Text("Olfactory Acuity: %.2f", creature->trait(UG::OLFACTORY_ACUITY));
                     
                     ImGui::Spacing();
                     
@@ -1427,11 +1841,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                     ImGui::TextColored(ImVec4(0.8f, 0.9f, 0.7f, 1.0f), "APPEARANCE");
                     ImGui::Separator();
                     
-                    ImGui::Text("Color Hue: %.2f", phenotype.getTrait(UG::COLOR_HUE));
+                    ImGui::Text("Color Hue: %.2f", creature->trait(UG::COLOR_HUE));
                     
                 } else {
                     ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "Legacy genome - limited physical data");
-                    ImGui::Text("Speed: %d", creature->getSpeed());
+                    ImGui::Text("Speed: %d", creature->speed);
                 }
                 
                 ImGui::EndTabItem();
@@ -1444,7 +1858,6 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                 ImGui::Spacing();
                 
                 if (true) {
-                    const auto& phenotype = creature->getPhenotype();
                     using UG = EcoSim::Genetics::UniversalGenes;
                     
                     // Nested tab bar for chromosome categories
@@ -1455,13 +1868,13 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Universal Genes (7)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "LIFESPAN", phenotype.getTrait(UG::LIFESPAN));
-                            ImGui::Text("%-28s: %.2f", "MAX_SIZE", phenotype.getTrait(UG::MAX_SIZE));
-                            ImGui::Text("%-28s: %.2f", "METABOLISM_RATE", phenotype.getTrait(UG::METABOLISM_RATE));
-                            ImGui::Text("%-28s: %.2f", "COLOR_HUE", phenotype.getTrait(UG::COLOR_HUE));
-                            ImGui::Text("%-28s: %.2f", "HARDINESS", phenotype.getTrait(UG::HARDINESS));
-                            ImGui::Text("%-28s: %.2f", "TEMP_TOLERANCE_LOW", phenotype.getTrait(UG::TEMP_TOLERANCE_LOW));
-                            ImGui::Text("%-28s: %.2f", "TEMP_TOLERANCE_HIGH", phenotype.getTrait(UG::TEMP_TOLERANCE_HIGH));
+                            ImGui::Text("%-28s: %.2f", "LIFESPAN", creature->trait(UG::LIFESPAN));
+                            ImGui::Text("%-28s: %.2f", "MAX_SIZE", creature->trait(UG::MAX_SIZE));
+                            ImGui::Text("%-28s: %.2f", "METABOLISM_RATE", creature->trait(UG::METABOLISM_RATE));
+                            ImGui::Text("%-28s: %.2f", "COLOR_HUE", creature->trait(UG::COLOR_HUE));
+                            ImGui::Text("%-28s: %.2f", "HARDINESS", creature->trait(UG::HARDINESS));
+                            ImGui::Text("%-28s: %.2f", "TEMP_TOLERANCE_LOW", creature->trait(UG::TEMP_TOLERANCE_LOW));
+                            ImGui::Text("%-28s: %.2f", "TEMP_TOLERANCE_HIGH", creature->trait(UG::TEMP_TOLERANCE_HIGH));
                             ImGui::EndTabItem();
                         }
                         
@@ -1470,11 +1883,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Mobility Genes (5)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "LOCOMOTION", phenotype.getTrait(UG::LOCOMOTION));
-                            ImGui::Text("%-28s: %.2f", "SIGHT_RANGE", phenotype.getTrait(UG::SIGHT_RANGE));
-                            ImGui::Text("%-28s: %.2f", "NAVIGATION_ABILITY", phenotype.getTrait(UG::NAVIGATION_ABILITY));
-                            ImGui::Text("%-28s: %.2f", "FLEE_THRESHOLD", phenotype.getTrait(UG::FLEE_THRESHOLD));
-                            ImGui::Text("%-28s: %.2f", "PURSUE_THRESHOLD", phenotype.getTrait(UG::PURSUE_THRESHOLD));
+                            ImGui::Text("%-28s: %.2f", "LOCOMOTION", creature->trait(UG::LOCOMOTION));
+                            ImGui::Text("%-28s: %.2f", "SIGHT_RANGE", creature->trait(UG::SIGHT_RANGE));
+                            ImGui::Text("%-28s: %.2f", "NAVIGATION_ABILITY", creature->trait(UG::NAVIGATION_ABILITY));
+                            ImGui::Text("%-28s: %.2f", "FLEE_THRESHOLD", creature->trait(UG::FLEE_THRESHOLD));
+                            ImGui::Text("%-28s: %.2f", "PURSUE_THRESHOLD", creature->trait(UG::PURSUE_THRESHOLD));
                             ImGui::EndTabItem();
                         }
                         
@@ -1483,16 +1896,16 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Heterotrophy Genes (13)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "PLANT_DIGESTION_EFFICIENCY", phenotype.getTrait(UG::PLANT_DIGESTION_EFFICIENCY));
-                            ImGui::Text("%-28s: %.2f", "MEAT_DIGESTION_EFFICIENCY", phenotype.getTrait(UG::MEAT_DIGESTION_EFFICIENCY));
-                            ImGui::Text("%-28s: %.2f", "CELLULOSE_BREAKDOWN", phenotype.getTrait(UG::CELLULOSE_BREAKDOWN));
-                            ImGui::Text("%-28s: %.2f", "TOXIN_TOLERANCE", phenotype.getTrait(UG::TOXIN_TOLERANCE));
-                            ImGui::Text("%-28s: %.2f", "TOXIN_METABOLISM", phenotype.getTrait(UG::TOXIN_METABOLISM));
-                            ImGui::Text("%-28s: %.2f", "SCENT_DETECTION", phenotype.getTrait(UG::SCENT_DETECTION));
-                            ImGui::Text("%-28s: %.2f", "COLOR_VISION", phenotype.getTrait(UG::COLOR_VISION));
-                            ImGui::Text("%-28s: %.2f", "HUNT_INSTINCT", phenotype.getTrait(UG::HUNT_INSTINCT));
-                            ImGui::Text("%-28s: %.2f", "DIGESTIVE_EFFICIENCY", phenotype.getTrait(UG::DIGESTIVE_EFFICIENCY));
-                            ImGui::Text("%-28s: %.2f", "NUTRIENT_VALUE", phenotype.getTrait(UG::NUTRIENT_VALUE));
+                            ImGui::Text("%-28s: %.2f", "PLANT_DIGESTION_EFFICIENCY", creature->trait(UG::PLANT_DIGESTION_EFFICIENCY));
+                            ImGui::Text("%-28s: %.2f", "MEAT_DIGESTION_EFFICIENCY", creature->trait(UG::MEAT_DIGESTION_EFFICIENCY));
+                            ImGui::Text("%-28s: %.2f", "CELLULOSE_BREAKDOWN", creature->trait(UG::CELLULOSE_BREAKDOWN));
+                            ImGui::Text("%-28s: %.2f", "TOXIN_TOLERANCE", creature->trait(UG::TOXIN_TOLERANCE));
+                            ImGui::Text("%-28s: %.2f", "TOXIN_METABOLISM", creature->trait(UG::TOXIN_METABOLISM));
+                            ImGui::Text("%-28s: %.2f", "SCENT_DETECTION", creature->trait(UG::SCENT_DETECTION));
+                            ImGui::Text("%-28s: %.2f", "COLOR_VISION", creature->trait(UG::COLOR_VISION));
+                            ImGui::Text("%-28s: %.2f", "HUNT_INSTINCT", creature->trait(UG::HUNT_INSTINCT));
+                            ImGui::Text("%-28s: %.2f", "DIGESTIVE_EFFICIENCY", creature->trait(UG::DIGESTIVE_EFFICIENCY));
+                            ImGui::Text("%-28s: %.2f", "NUTRIENT_VALUE", creature->trait(UG::NUTRIENT_VALUE));
                             ImGui::EndTabItem();
                         }
                         
@@ -1501,15 +1914,15 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Morphology Genes (9)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "HIDE_THICKNESS", phenotype.getTrait(UG::HIDE_THICKNESS));
-                            ImGui::Text("%-28s: %.2f", "FUR_DENSITY", phenotype.getTrait(UG::FUR_DENSITY));
-                            ImGui::Text("%-28s: %.2f", "SCALE_COVERAGE", phenotype.getTrait(UG::SCALE_COVERAGE));
-                            ImGui::Text("%-28s: %.2f", "FAT_LAYER_THICKNESS", phenotype.getTrait(UG::FAT_LAYER_THICKNESS));
-                            ImGui::Text("%-28s: %.2f", "TOOTH_SHARPNESS", phenotype.getTrait(UG::TOOTH_SHARPNESS));
-                            ImGui::Text("%-28s: %.2f", "TOOTH_GRINDING", phenotype.getTrait(UG::TOOTH_GRINDING));
-                            ImGui::Text("%-28s: %.2f", "GUT_LENGTH", phenotype.getTrait(UG::GUT_LENGTH));
-                            ImGui::Text("%-28s: %.2f", "JAW_STRENGTH", phenotype.getTrait(UG::JAW_STRENGTH));
-                            ImGui::Text("%-28s: %.2f", "TAIL_LENGTH", phenotype.getTrait(UG::TAIL_LENGTH));
+                            ImGui::Text("%-28s: %.2f", "HIDE_THICKNESS", creature->trait(UG::HIDE_THICKNESS));
+                            ImGui::Text("%-28s: %.2f", "FUR_DENSITY", creature->trait(UG::FUR_DENSITY));
+                            ImGui::Text("%-28s: %.2f", "SCALE_COVERAGE", creature->trait(UG::SCALE_COVERAGE));
+                            ImGui::Text("%-28s: %.2f", "FAT_LAYER_THICKNESS", creature->trait(UG::FAT_LAYER_THICKNESS));
+                            ImGui::Text("%-28s: %.2f", "TOOTH_SHARPNESS", creature->trait(UG::TOOTH_SHARPNESS));
+                            ImGui::Text("%-28s: %.2f", "TOOTH_GRINDING", creature->trait(UG::TOOTH_GRINDING));
+                            ImGui::Text("%-28s: %.2f", "GUT_LENGTH", creature->trait(UG::GUT_LENGTH));
+                            ImGui::Text("%-28s: %.2f", "JAW_STRENGTH", creature->trait(UG::JAW_STRENGTH));
+                            ImGui::Text("%-28s: %.2f", "TAIL_LENGTH", creature->trait(UG::TAIL_LENGTH));
                             ImGui::EndTabItem();
                         }
                         
@@ -1518,8 +1931,8 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Seed Interaction Genes (2)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "GUT_TRANSIT_TIME", phenotype.getTrait(UG::GUT_TRANSIT_TIME));
-                            ImGui::Text("%-28s: %.2f", "SEED_DESTRUCTION_RATE", phenotype.getTrait(UG::SEED_DESTRUCTION_RATE));
+                            ImGui::Text("%-28s: %.2f", "GUT_TRANSIT_TIME", creature->trait(UG::GUT_TRANSIT_TIME));
+                            ImGui::Text("%-28s: %.2f", "SEED_DESTRUCTION_RATE", creature->trait(UG::SEED_DESTRUCTION_RATE));
                             ImGui::EndTabItem();
                         }
                         
@@ -1528,12 +1941,12 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Reproduction Genes (6)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "OFFSPRING_COUNT", phenotype.getTrait(UG::OFFSPRING_COUNT));
-                            ImGui::Text("%-28s: %.2f", "MATE_THRESHOLD", phenotype.getTrait(UG::MATE_THRESHOLD));
-                            ImGui::Text("%-28s: %.2f", "SPREAD_DISTANCE", phenotype.getTrait(UG::SPREAD_DISTANCE));
-                            ImGui::Text("%-28s: %.2f", "FATIGUE_THRESHOLD", phenotype.getTrait(UG::FATIGUE_THRESHOLD));
-                            ImGui::Text("%-28s: %.2f", "COMFORT_INCREASE", phenotype.getTrait(UG::COMFORT_INCREASE));
-                            ImGui::Text("%-28s: %.2f", "COMFORT_DECREASE", phenotype.getTrait(UG::COMFORT_DECREASE));
+                            ImGui::Text("%-28s: %.2f", "OFFSPRING_COUNT", creature->trait(UG::OFFSPRING_COUNT));
+                            ImGui::Text("%-28s: %.2f", "MATE_THRESHOLD", creature->trait(UG::MATE_THRESHOLD));
+                            ImGui::Text("%-28s: %.2f", "SPREAD_DISTANCE", creature->trait(UG::SPREAD_DISTANCE));
+                            ImGui::Text("%-28s: %.2f", "FATIGUE_THRESHOLD", creature->trait(UG::FATIGUE_THRESHOLD));
+                            ImGui::Text("%-28s: %.2f", "COMFORT_INCREASE", creature->trait(UG::COMFORT_INCREASE));
+                            ImGui::Text("%-28s: %.2f", "COMFORT_DECREASE", creature->trait(UG::COMFORT_DECREASE));
                             ImGui::EndTabItem();
                         }
                         
@@ -1542,10 +1955,10 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Olfactory Genes (4)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "SCENT_PRODUCTION", phenotype.getTrait(UG::SCENT_PRODUCTION));
-                            ImGui::Text("%-28s: %.2f", "SCENT_SIGNATURE_VARIANCE", phenotype.getTrait(UG::SCENT_SIGNATURE_VARIANCE));
-                            ImGui::Text("%-28s: %.2f", "OLFACTORY_ACUITY", phenotype.getTrait(UG::OLFACTORY_ACUITY));
-                            ImGui::Text("%-28s: %.2f", "SCENT_MASKING", phenotype.getTrait(UG::SCENT_MASKING));
+                            ImGui::Text("%-28s: %.2f", "SCENT_PRODUCTION", creature->trait(UG::SCENT_PRODUCTION));
+                            ImGui::Text("%-28s: %.2f", "SCENT_SIGNATURE_VARIANCE", creature->trait(UG::SCENT_SIGNATURE_VARIANCE));
+                            ImGui::Text("%-28s: %.2f", "OLFACTORY_ACUITY", creature->trait(UG::OLFACTORY_ACUITY));
+                            ImGui::Text("%-28s: %.2f", "SCENT_MASKING", creature->trait(UG::SCENT_MASKING));
                             ImGui::EndTabItem();
                         }
                         
@@ -1554,11 +1967,11 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Behavior Genes (5)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "CACHING_INSTINCT", phenotype.getTrait(UG::CACHING_INSTINCT));
-                            ImGui::Text("%-28s: %.2f", "GROOMING_FREQUENCY", phenotype.getTrait(UG::GROOMING_FREQUENCY));
-                            ImGui::Text("%-28s: %.2f", "SPATIAL_MEMORY", phenotype.getTrait(UG::SPATIAL_MEMORY));
-                            ImGui::Text("%-28s: %.2f", "SWEETNESS_PREFERENCE", phenotype.getTrait(UG::SWEETNESS_PREFERENCE));
-                            ImGui::Text("%-28s: %.2f", "PAIN_SENSITIVITY", phenotype.getTrait(UG::PAIN_SENSITIVITY));
+                            ImGui::Text("%-28s: %.2f", "CACHING_INSTINCT", creature->trait(UG::CACHING_INSTINCT));
+                            ImGui::Text("%-28s: %.2f", "GROOMING_FREQUENCY", creature->trait(UG::GROOMING_FREQUENCY));
+                            ImGui::Text("%-28s: %.2f", "SPATIAL_MEMORY", creature->trait(UG::SPATIAL_MEMORY));
+                            ImGui::Text("%-28s: %.2f", "SWEETNESS_PREFERENCE", creature->trait(UG::SWEETNESS_PREFERENCE));
+                            ImGui::Text("%-28s: %.2f", "PAIN_SENSITIVITY", creature->trait(UG::PAIN_SENSITIVITY));
                             ImGui::EndTabItem();
                         }
                         
@@ -1567,9 +1980,9 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Health Genes (3)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "REGENERATION_RATE", phenotype.getTrait(UG::REGENERATION_RATE));
-                            ImGui::Text("%-28s: %.2f", "WOUND_TOLERANCE", phenotype.getTrait(UG::WOUND_TOLERANCE));
-                            ImGui::Text("%-28s: %.2f", "BLEEDING_RESISTANCE", phenotype.getTrait(UG::BLEEDING_RESISTANCE));
+                            ImGui::Text("%-28s: %.2f", "REGENERATION_RATE", creature->trait(UG::REGENERATION_RATE));
+                            ImGui::Text("%-28s: %.2f", "WOUND_TOLERANCE", creature->trait(UG::WOUND_TOLERANCE));
+                            ImGui::Text("%-28s: %.2f", "BLEEDING_RESISTANCE", creature->trait(UG::BLEEDING_RESISTANCE));
                             ImGui::EndTabItem();
                         }
                         
@@ -1578,19 +1991,19 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Combat Weapon Genes (13)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "TEETH_SHARPNESS", phenotype.getTrait(UG::TEETH_SHARPNESS));
-                            ImGui::Text("%-28s: %.2f", "TEETH_SERRATION", phenotype.getTrait(UG::TEETH_SERRATION));
-                            ImGui::Text("%-28s: %.2f", "TEETH_SIZE", phenotype.getTrait(UG::TEETH_SIZE));
-                            ImGui::Text("%-28s: %.2f", "CLAW_LENGTH", phenotype.getTrait(UG::CLAW_LENGTH));
-                            ImGui::Text("%-28s: %.2f", "CLAW_SHARPNESS", phenotype.getTrait(UG::CLAW_SHARPNESS));
-                            ImGui::Text("%-28s: %.2f", "CLAW_CURVATURE", phenotype.getTrait(UG::CLAW_CURVATURE));
-                            ImGui::Text("%-28s: %.2f", "HORN_LENGTH", phenotype.getTrait(UG::HORN_LENGTH));
-                            ImGui::Text("%-28s: %.2f", "HORN_POINTINESS", phenotype.getTrait(UG::HORN_POINTINESS));
-                            ImGui::Text("%-28s: %.2f", "HORN_SPREAD", phenotype.getTrait(UG::HORN_SPREAD));
-                            ImGui::Text("%-28s: %.2f", "TAIL_LENGTH", phenotype.getTrait(UG::TAIL_LENGTH));
-                            ImGui::Text("%-28s: %.2f", "TAIL_MASS", phenotype.getTrait(UG::TAIL_MASS));
-                            ImGui::Text("%-28s: %.2f", "TAIL_SPINES", phenotype.getTrait(UG::TAIL_SPINES));
-                            ImGui::Text("%-28s: %.2f", "BODY_SPINES", phenotype.getTrait(UG::BODY_SPINES));
+                            ImGui::Text("%-28s: %.2f", "TEETH_SHARPNESS", creature->trait(UG::TEETH_SHARPNESS));
+                            ImGui::Text("%-28s: %.2f", "TEETH_SERRATION", creature->trait(UG::TEETH_SERRATION));
+                            ImGui::Text("%-28s: %.2f", "TEETH_SIZE", creature->trait(UG::TEETH_SIZE));
+                            ImGui::Text("%-28s: %.2f", "CLAW_LENGTH", creature->trait(UG::CLAW_LENGTH));
+                            ImGui::Text("%-28s: %.2f", "CLAW_SHARPNESS", creature->trait(UG::CLAW_SHARPNESS));
+                            ImGui::Text("%-28s: %.2f", "CLAW_CURVATURE", creature->trait(UG::CLAW_CURVATURE));
+                            ImGui::Text("%-28s: %.2f", "HORN_LENGTH", creature->trait(UG::HORN_LENGTH));
+                            ImGui::Text("%-28s: %.2f", "HORN_POINTINESS", creature->trait(UG::HORN_POINTINESS));
+                            ImGui::Text("%-28s: %.2f", "HORN_SPREAD", creature->trait(UG::HORN_SPREAD));
+                            ImGui::Text("%-28s: %.2f", "TAIL_LENGTH", creature->trait(UG::TAIL_LENGTH));
+                            ImGui::Text("%-28s: %.2f", "TAIL_MASS", creature->trait(UG::TAIL_MASS));
+                            ImGui::Text("%-28s: %.2f", "TAIL_SPINES", creature->trait(UG::TAIL_SPINES));
+                            ImGui::Text("%-28s: %.2f", "BODY_SPINES", creature->trait(UG::BODY_SPINES));
                             ImGui::EndTabItem();
                         }
                         
@@ -1599,8 +2012,8 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Combat Defense Genes (2)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "SCALE_COVERAGE", phenotype.getTrait(UG::SCALE_COVERAGE));
-                            ImGui::Text("%-28s: %.2f", "FAT_LAYER_THICKNESS", phenotype.getTrait(UG::FAT_LAYER_THICKNESS));
+                            ImGui::Text("%-28s: %.2f", "SCALE_COVERAGE", creature->trait(UG::SCALE_COVERAGE));
+                            ImGui::Text("%-28s: %.2f", "FAT_LAYER_THICKNESS", creature->trait(UG::FAT_LAYER_THICKNESS));
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "(HIDE_THICKNESS in Morphology)");
                             ImGui::EndTabItem();
@@ -1611,10 +2024,10 @@ void ImGuiOverlay::renderCreatureInspectorWindow(const EcoSim::Genetics::Organis
                             ImGui::Spacing();
                             ImGui::TextColored(ImVec4(0.7f, 0.9f, 0.7f, 1.0f), "Combat Behavior Genes (4)");
                             ImGui::Separator();
-                            ImGui::Text("%-28s: %.2f", "COMBAT_AGGRESSION", phenotype.getTrait(UG::COMBAT_AGGRESSION));
-                            ImGui::Text("%-28s: %.2f", "RETREAT_THRESHOLD", phenotype.getTrait(UG::RETREAT_THRESHOLD));
-                            ImGui::Text("%-28s: %.2f", "TERRITORIAL_AGGRESSION", phenotype.getTrait(UG::TERRITORIAL_AGGRESSION));
-                            ImGui::Text("%-28s: %.2f", "PACK_COORDINATION", phenotype.getTrait(UG::PACK_COORDINATION));
+                            ImGui::Text("%-28s: %.2f", "COMBAT_AGGRESSION", creature->trait(UG::COMBAT_AGGRESSION));
+                            ImGui::Text("%-28s: %.2f", "RETREAT_THRESHOLD", creature->trait(UG::RETREAT_THRESHOLD));
+                            ImGui::Text("%-28s: %.2f", "TERRITORIAL_AGGRESSION", creature->trait(UG::TERRITORIAL_AGGRESSION));
+                            ImGui::Text("%-28s: %.2f", "PACK_COORDINATION", creature->trait(UG::PACK_COORDINATION));
                             ImGui::EndTabItem();
                         }
                         
@@ -0,0 +1,325 @@
+/**
+ * @file SDL2BitmapFont.cpp
+ * @brief Implementation of the built-in bitmap font and its atlas
+ */
+
+#include "../../../../include/rendering/backends/sdl2/SDL2BitmapFont.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace {
+
+// Bitmap font - 5x7 pixel characters
+// Each character is defined as a 5x7 bitmap where each row is a byte
+// Bit pattern: most significant bit (within the 5-bit width) is leftmost pixel
+const unsigned char FONT_5X7[128][7] = {
+    // Control characters (0-31) - blank
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
+    // Space (32)
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ! (33)
+    {0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00},
+    // " (34)
+    {0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // # (35)
+    {0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x00},
+    // $ (36)
+    {0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04},
+    // % (37)
+    {0x19, 0x19, 0x02, 0x04, 0x08, 0x13, 0x13},
+    // & (38)
+    {0x08, 0x14, 0x14, 0x08, 0x15, 0x12, 0x0D},
+    // ' (39)
+    {0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ( (40)
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02},
+    // ) (41)
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08},
+    // * (42)
+    {0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00},
+    // + (43)
+    {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00},
+    // , (44)
+    {0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08},
+    // - (45)
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},
+    // . (46)
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00},
+    // / (47)
+    {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10},
+    // 0 (48)
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},
+    // 1 (49)
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
+    // 2 (50)
+    {0x0E, 0x11, 0x01, 0x06, 0x08, 0x10, 0x1F},
+    // 3 (51)
+    {0x0E, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0E},
+    // 4 (52)
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},
+    // 5 (53)
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},
+    // 6 (54)
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},
+    // 7 (55)
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
+    // 8 (56)
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},
+    // 9 (57)
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},
+    // : (58)
+    {0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00},
+    // ; (59)
+    {0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x08},
+    // < (60)
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02},
+    // = (61)
+    {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00},
+    // > (62)
+    {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08},
+    // ? (63)
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04},
+    // @ (64)
+    {0x0E, 0x11, 0x17, 0x15, 0x17, 0x10, 0x0E},
+    // A (65)
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
+    // B (66)
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},
+    // C (67)
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},
+    // D (68)
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},
+    // E (69)
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},
+    // F (70)
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},
+    // G (71)
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},
+    // H (72)
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
+    // I (73)
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
+    // J (74)
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},
+    // K (75)
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},
+    // L (76)
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},
+    // M (77)
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},
+    // N (78)
+    {0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11},
+    // O (79)
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+    // P (80)
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},
+    // Q (81)
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},
+    // R (82)
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},
+    // S (83)
+    {0x0E, 0x11, 0x10, 0x0E, 0x01, 0x11, 0x0E},
+    // T (84)
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
+    // U (85)
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+    // V (86)
+    {0x11, 0x11, 0x11, 0x11, 0x0A, 0x0A, 0x04},
+    // W (87)
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x1B, 0x11},
+    // X (88)
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},
+    // Y (89)
+    {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04},
+    // Z (90)
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},
+    // [ (91)
+    {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E},
+    // \ (92)
+    {0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01},
+    // ] (93)
+    {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E},
+    // ^ (94)
+    {0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00},
+    // _ (95)
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F},
+    // ` (96)
+    {0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // a (97)
+    {0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F},
+    // b (98)
+    {0x10, 0x10, 0x1E, 0x11, 0x11, 0x11, 0x1E},
+    // c (99)
+    {0x00, 0x00, 0x0E, 0x11, 0x10, 0x11, 0x0E},
+    // d (100)
+    {0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x0F},
+    // e (101)
+    {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E},
+    // f (102)
+    {0x06, 0x08, 0x1C, 0x08, 0x08, 0x08, 0x08},
+    // g (103)
+    {0x00, 0x00, 0x0F, 0x11, 0x0F, 0x01, 0x0E},
+    // h (104)
+    {0x10, 0x10, 0x1E, 0x11, 0x11, 0x11, 0x11},
+    // i (105)
+    {0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E},
+    // j (106)
+    {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C},
+    // k (107)
+    {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12},
+    // l (108)
+    {0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
+    // m (109)
+    {0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11},
+    // n (110)
+    {0x00, 0x00, 0x1E, 0x11, 0x11, 0x11, 0x11},
+    // o (111)
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E},
+    // p (112)
+    {0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10},
+    // q (113)
+    {0x00, 0x00, 0x0F, 0x11, 0x0F, 0x01, 0x01},
+    // r (114)
+    {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10},
+    // s (115)
+    {0x00, 0x00, 0x0F, 0x10, 0x0E, 0x01, 0x1E},
+    // t (116)
+    {0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06},
+    // u (117)
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0F},
+    // v (118)
+    {0x00, 0x00, 0x11, 0x11, 0x0A, 0x0A, 0x04},
+    // w (119)
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A},
+    // x (120)
+    {0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11},
+    // y (121)
+    {0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E},
+    // z (122)
+    {0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F},
+    // { (123)
+    {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02},
+    // | (124)
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
+    // } (125)
+    {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08},
+    // ~ (126)
+    {0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00},
+    // DEL (127) - blank
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+};
+
+// Atlas layout: 16 x 8 cells, one per ASCII code
+constexpr int ATLAS_COLUMNS = 16;
+constexpr int ATLAS_ROWS = 8;
+constexpr int ATLAS_WIDTH = ATLAS_COLUMNS * SDL2BitmapFont::GLYPH_WIDTH;
+constexpr int ATLAS_HEIGHT = ATLAS_ROWS * SDL2BitmapFont::GLYPH_HEIGHT;
+
+bool glyphPixel(unsigned char c, int col, int row) {
+    return (FONT_5X7[c][row] & (1 << (SDL2BitmapFont::GLYPH_WIDTH - 1 - col))) != 0;
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Constructor / Destructor
+//==============================================================================
+
+SDL2BitmapFont::SDL2BitmapFont()
+    : _atlas(nullptr) {
+}
+
+SDL2BitmapFont::~SDL2BitmapFont() {
+    destroy();
+}
+
+//==============================================================================
+// Atlas
+//==============================================================================
+
+bool SDL2BitmapFont::create(SDL_Renderer* renderer) {
+    destroy();
+    if (renderer == nullptr) {
+        return false;
+    }
+    
+    // White glyph pixels on a transparent background; color comes from the vertices
+    std::vector<Uint32> pixels(static_cast<std::size_t>(ATLAS_WIDTH * ATLAS_HEIGHT), 0u);
+    for (int c = 0; c < 128; ++c) {
+        int cellX = (c % ATLAS_COLUMNS) * GLYPH_WIDTH;
+        int cellY = (c / ATLAS_COLUMNS) * GLYPH_HEIGHT;
+        for (int row = 0; row < GLYPH_HEIGHT; ++row) {
+            for (int col = 0; col < GLYPH_WIDTH; ++col) {
+                if (glyphPixel(static_cast<unsigned char>(c), col, row)) {
+                    pixels[static_cast<std::size_t>((cellY + row) * ATLAS_WIDTH + cellX + col)] = 0xFFFFFFFFu;
+                }
+            }
+        }
+    }
+    
+    _atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                               SDL_TEXTUREACCESS_STATIC, ATLAS_WIDTH, ATLAS_HEIGHT);
+    if (_atlas == nullptr) {
+        std::cerr << "SDL2BitmapFont: SDL_CreateTexture failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (SDL_UpdateTexture(_atlas, nullptr, pixels.data(),
+                          ATLAS_WIDTH * static_cast<int>(sizeof(Uint32))) != 0) {
+        std::cerr << "SDL2BitmapFont: SDL_UpdateTexture failed: " << SDL_GetError() << std::endl;
+        destroy();
+        return false;
+    }
+    SDL_SetTextureBlendMode(_atlas, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void SDL2BitmapFont::destroy() {
+    if (_atlas != nullptr) {
+        SDL_DestroyTexture(_atlas);
+        _atlas = nullptr;
+    }
+}
+
+//==============================================================================
+// Text
+//==============================================================================
+
+void SDL2BitmapFont::queueText(SDL2GeometryBatch& batch, const std::string& text,
+                               int x, int y, SDL_Color color, int scale) const {
+    int cursorX = x;
+    
+    for (size_t i = 0; i < text.length(); i++) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        
+        // Clamp to valid ASCII range
+        if (c > 127) c = '?';
+        
+        if (_atlas != nullptr) {
+            float u0 = static_cast<float>((c % ATLAS_COLUMNS) * GLYPH_WIDTH) / ATLAS_WIDTH;
+            float v0 = static_cast<float>((c / ATLAS_COLUMNS) * GLYPH_HEIGHT) / ATLAS_HEIGHT;
+            float u1 = u0 + static_cast<float>(GLYPH_WIDTH) / ATLAS_WIDTH;
+            float v1 = v0 + static_cast<float>(GLYPH_HEIGHT) / ATLAS_HEIGHT;
+            SDL_Rect dst = {cursorX, y, GLYPH_WIDTH * scale, GLYPH_HEIGHT * scale};
+            batch.texturedRect(dst, u0, v0, u1, v1, color);
+        } else {
+            for (int row = 0; row < GLYPH_HEIGHT; row++) {
+                for (int col = 0; col < GLYPH_WIDTH; col++) {
+                    if (glyphPixel(c, col, row)) {
+                        batch.fillRect(cursorX + col * scale, y + row * scale, scale, scale, color);
+                    }
+                }
+            }
+        }
+        
+        // Move cursor for next character
+        cursorX += (GLYPH_WIDTH + GLYPH_SPACING) * scale;
+    }
+}
@@ -7,6 +7,7 @@
 
 #include "../../../../include/rendering/backends/sdl2/SDL2ColorMapper.hpp"
 #include "../../../../include/objects/creature/creature.hpp"
+#include "../../../../include/world/tile.hpp"
 
 //==============================================================================
 // Terrain Color Mapping
@@ -126,6 +127,29 @@ SDL_Color SDL2ColorMapper::waterToColor(float depth, WaterType type) {
     return blendColors(shallow, deep, depth);
 }
 
+SDL_Color SDL2ColorMapper::tileToColor(const Tile& tile) {
+    TerrainType terrainType = tile.getTerrainType();
+    if (terrainType != TerrainType::DEEP_WATER &&
+        terrainType != TerrainType::WATER &&
+        terrainType != TerrainType::SHALLOW_WATER &&
+        terrainType != TerrainType::SHALLOW_WATER_2) {
+        return terrainToColor(terrainType);
+    }
+    
+    // Sources are freshwater; ocean uses one palette and lets depth handle
+    // the transition from shallow to deep
+    WaterType waterType = WaterType::OCEAN;
+    if (tile.isSource()) {
+        if (terrainType == TerrainType::SHALLOW_WATER ||
+            terrainType == TerrainType::SHALLOW_WATER_2) {
+            waterType = WaterType::RIVER;
+        } else {
+            waterType = WaterType::LAKE;
+        }
+    }
+    return waterToColor(tile.getWaterDepth(), waterType);
+}
+
 //==============================================================================
 // Entity Color Mapping
 //==============================================================================
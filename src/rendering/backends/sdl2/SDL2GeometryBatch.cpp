@@ -0,0 +1,69 @@
+/**
+ * @file SDL2GeometryBatch.cpp
+ * @brief Implementation of SDL2GeometryBatch
+ */
+
+#include "../../../../include/rendering/backends/sdl2/SDL2GeometryBatch.hpp"
+
+//==============================================================================
+// Queuing
+//==============================================================================
+
+void SDL2GeometryBatch::fillRect(int x, int y, int w, int h, SDL_Color color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    addQuad(static_cast<float>(x), static_cast<float>(y),
+            static_cast<float>(x + w), static_cast<float>(y + h),
+            color, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+void SDL2GeometryBatch::outlineRect(int x, int y, int w, int h, SDL_Color color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    if (w <= 2 || h <= 2) {
+        fillRect(x, y, w, h, color);
+        return;
+    }
+    fillRect(x, y, w, 1, color);                  // Top
+    fillRect(x, y + h - 1, w, 1, color);          // Bottom
+    fillRect(x, y + 1, 1, h - 2, color);          // Left
+    fillRect(x + w - 1, y + 1, 1, h - 2, color);  // Right
+}
+
+void SDL2GeometryBatch::texturedRect(const SDL_Rect& dst, float u0, float v0,
+                                     float u1, float v1, SDL_Color color) {
+    addQuad(static_cast<float>(dst.x), static_cast<float>(dst.y),
+            static_cast<float>(dst.x + dst.w), static_cast<float>(dst.y + dst.h),
+            color, u0, v0, u1, v1);
+}
+
+void SDL2GeometryBatch::addQuad(float x0, float y0, float x1, float y1, SDL_Color color,
+                                float u0, float v0, float u1, float v1) {
+    int base = static_cast<int>(_vertices.size());
+    _vertices.push_back({{x0, y0}, color, {u0, v0}});
+    _vertices.push_back({{x1, y0}, color, {u1, v0}});
+    _vertices.push_back({{x1, y1}, color, {u1, v1}});
+    _vertices.push_back({{x0, y1}, color, {u0, v1}});
+
+    const int corners[6] = {0, 1, 2, 0, 2, 3};
+    for (int corner : corners) {
+        _indices.push_back(base + corner);
+    }
+}
+
+//==============================================================================
+// Submission
+//==============================================================================
+
+void SDL2GeometryBatch::flush(SDL_Renderer* renderer, SDL_Texture* texture) {
+    if (!_vertices.empty() && renderer != nullptr) {
+        SDL_RenderGeometry(renderer, texture,
+                           _vertices.data(), static_cast<int>(_vertices.size()),
+                           _indices.data(), static_cast<int>(_indices.size()));
+    }
+    // Keep the capacity for the next frame
+    _vertices.clear();
+    _indices.clear();
+}
@@ -17,6 +17,8 @@
 #include "../../../../include/objects/creature/creature.hpp"
 #include "../../../../include/genetics/organisms/Plant.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
@@ -34,12 +36,11 @@ SDL2Renderer::SDL2Renderer()
     : _window(nullptr)
     , _renderer(nullptr)
     , _imguiOverlay(nullptr)
-    , _currentCreatures(nullptr)
-    , _currentWorld(nullptr)
     , _initialized(false)
     , _screenWidth(DEFAULT_SCREEN_WIDTH)
     , _screenHeight(DEFAULT_SCREEN_HEIGHT)
-    , _tileSize(DEFAULT_TILE_SIZE) {
+    , _tileSize(DEFAULT_TILE_SIZE)
+    , _overviewLevel(-1) {
 }
 
 SDL2Renderer::~SDL2Renderer() {
@@ -105,6 +106,11 @@ bool SDL2Renderer::initialize() {
     // Enable alpha blending
     SDL_SetRenderDrawBlendMode(_renderer, SDL_BLENDMODE_BLEND);
     
+    _terrainCache.setRenderer(_renderer);
+    if (!_font.create(_renderer)) {
+        std::cerr << "SDL2Renderer: font atlas unavailable (drawing text as rectangles)" << std::endl;
+    }
+    
     // Initialize ImGui overlay
 #ifdef ECOSIM_HAS_IMGUI
     _imguiOverlay = new ImGuiOverlay();
@@ -134,6 +140,10 @@ void SDL2Renderer::shutdown() {
     }
 #endif
     
+    // Terrain and font textures belong to the renderer
+    _terrainCache.setRenderer(nullptr);
+    _font.destroy();
+    
     if (_renderer != nullptr) {
         SDL_DestroyRenderer(_renderer);
         _renderer = nullptr;
@@ -189,8 +199,42 @@ void SDL2Renderer::renderWorld(const World& world, const Viewport& viewport) {
         return;
     }
     
-    // Store reference to world for ImGui overlay
-    _currentWorld = &world;
+#ifdef ECOSIM_HAS_IMGUI
+    if (_imguiOverlay) {
+        _imguiOverlay->setViewport(viewport);
+    }
+#endif
+    
+    if (_overviewLevel >= 0) {
+        // Zoomed out: one summarised cell per block, straight from the pyramid
+        _terrainCache.sync(world);
+        const EcoSim::WorldOverview& overview = world.overview();
+        if (overview.levelCount() == 0) {
+            return;
+        }
+        unsigned int level = std::min(static_cast<unsigned int>(_overviewLevel),
+                                      overview.levelCount() - 1);
+        unsigned int block = EcoSim::WorldOverview::blockSize(level);
+        float scale = pixelsPerTile();
+        int size = static_cast<int>(std::ceil(static_cast<float>(block) * scale));
+        int cx0 = std::max(viewport.originX, 0) / static_cast<int>(block);
+        int cy0 = std::max(viewport.originY, 0) / static_cast<int>(block);
+        int cx1 = std::min((viewport.originX + static_cast<int>(viewport.width)) / static_cast<int>(block) + 1,
+                           static_cast<int>(overview.levelWidth(level)));
+        int cy1 = std::min((viewport.originY + static_cast<int>(viewport.height)) / static_cast<int>(block) + 1,
+                           static_cast<int>(overview.levelHeight(level)));
+        for (int cy = cy0; cy < cy1; ++cy) {
+            for (int cx = cx0; cx < cx1; ++cx) {
+                queueOverviewCell(overview.cell(level, static_cast<unsigned int>(cx), static_cast<unsigned int>(cy)),
+                                  block,
+                                  static_cast<int>((cx * static_cast<int>(block) - viewport.originX) * scale),
+                                  static_cast<int>((cy * static_cast<int>(block) - viewport.originY) * scale),
+                                  size);
+            }
+        }
+        _entityBatch.flush(_renderer);
+        return;
+    }
     
     // Get the grid from world (using const_cast temporarily since getGrid() isn't const)
     World& mutableWorld = const_cast<World&>(world);
@@ -210,81 +254,21 @@ void SDL2Renderer::renderWorld(const World& world, const Viewport& viewport) {
     int baseScreenX = static_cast<int>(viewport.screenX) * _tileSize;
     int baseScreenY = static_cast<int>(viewport.screenY) * _tileSize;
     
-    // Render terrain, spawners, and food
+    // Terrain comes from pre-rendered chunk textures, one copy per chunk
+    _terrainCache.render(world, viewport, _tileSize, baseScreenX, baseScreenY);
+    
+    // Render genetics-based plants over the terrain (replaces legacy Food/Spawner)
     for (unsigned int y = viewport.originY; y < yRange; y++) {
         for (unsigned int x = viewport.originX; x < xRange; x++) {
-            Tile* curTile = &grid.at(x).at(y);
-            
-            // Calculate screen position (offset already in pixels, add tile offset)
-            int screenX = baseScreenX + (x - viewport.originX) * _tileSize;
-            int screenY = baseScreenY + (y - viewport.originY) * _tileSize;
-            
-            // Render terrain - use depth-based coloring for water tiles
-            SDL_Color terrainColor;
-            TerrainType terrainType = curTile->getTerrainType();
-            
-            // Check if this is a water tile that should use depth-based coloring
-            if (terrainType == TerrainType::DEEP_WATER ||
-                terrainType == TerrainType::WATER ||
-                terrainType == TerrainType::SHALLOW_WATER ||
-                terrainType == TerrainType::SHALLOW_WATER_2) {
-                
-                float waterDepth = curTile->getWaterDepth();
-                WaterType waterType;
-                
-                // Determine water type based on terrain type and whether it's a source (isSource = freshwater)
-                if (curTile->isSource()) {
-                    // Freshwater bodies (lakes, rivers)
-                    if (terrainType == TerrainType::SHALLOW_WATER ||
-                        terrainType == TerrainType::SHALLOW_WATER_2) {
-                        waterType = WaterType::RIVER;
-                    } else {
-                        waterType = WaterType::LAKE;
-                    }
-                } else {
-                    // Ocean water - use single OCEAN type for smooth gradient
-                    // The depth value handles the transition from shallow to deep
-                    waterType = WaterType::OCEAN;
-                }
-                
-                terrainColor = SDL2ColorMapper::waterToColor(waterDepth, waterType);
-            } else {
-                terrainColor = getTerrainColor(terrainType);
+            const auto& plants = grid[x][y].getPlants();
+            if (plants.empty()) {
+                continue;
             }
-            
-            drawFilledRect(screenX, screenY, _tileSize, _tileSize, terrainColor);
-            
-            // LEGACY REMOVAL: Legacy Spawner rendering disabled
-            // const std::vector<Spawner>& spawners = curTile->getSpawners();
-            // if (!spawners.empty()) {
-            //     SDL_Color spawnerColor = getEntityColor(spawners.begin()->getEntityType());
-            //     int padding = _tileSize / 4;
-            //     drawFilledRect(screenX + padding, screenY + padding,
-            //                   _tileSize - 2 * padding, _tileSize - 2 * padding,
-            //                   spawnerColor);
-            // }
-            
-            // LEGACY REMOVAL: Legacy Food rendering disabled
-            // const std::vector<Food>& food = curTile->getFoodVec();
-            // if (!food.empty()) {
-            //     SDL_Color foodColor = getEntityColor(food.begin()->getEntityType());
-            //     int padding = _tileSize / 3;
-            //     drawFilledRect(screenX + padding, screenY + padding,
-            //                   _tileSize - 2 * padding, _tileSize - 2 * padding,
-            //                   foodColor);
-            // }
-            
-            // Render genetics-based plants (replaces legacy Food/Spawner)
-            const auto& plants = curTile->getPlants();
-            if (!plants.empty()) {
-                const auto& plant = plants.front();
-                if (plant && plant->isAlive()) {
-                    SDL_Color plantColor = getEntityColor(plant->getEntityType());
-                    int padding = _tileSize / 4;
-                    drawFilledRect(screenX + padding, screenY + padding,
-                                  _tileSize - 2 * padding, _tileSize - 2 * padding,
-                                  plantColor);
-                }
+            const auto& plant = plants.front();
+            if (plant && plant->isAlive()) {
+                int screenX = baseScreenX + (x - viewport.originX) * _tileSize;
+                int screenY = baseScreenY + (y - viewport.originY) * _tileSize;
+                queuePlant(plant->getEntityType(), screenX, screenY);
             }
         }
     }
@@ -302,33 +286,13 @@ void SDL2Renderer::renderWorld(const World& world, const Viewport& viewport) {
             // Calculate screen position using float world coordinates for sub-tile positioning
             float screenX = baseScreenX + (corpse->getX() - viewport.originX) * _tileSize;
             float screenY = baseScreenY + (corpse->getY() - viewport.originY) * _tileSize;
-            int pixelX = static_cast<int>(screenX);
-            int pixelY = static_cast<int>(screenY);
-            
-            // Darker color as it decays (brown tones)
-            float decay = corpse->getDecayProgress();
-            Uint8 brightness = static_cast<Uint8>(150 * (1.0f - decay * 0.5f));
-            SDL_Color corpseColor = {brightness, static_cast<Uint8>(brightness / 2), 0, 255};
-            
-            // Draw corpse as an X shape
-            int padding = _tileSize / 4;
-            int size = _tileSize - 2 * padding;
-            SDL_SetRenderDrawColor(_renderer, corpseColor.r, corpseColor.g, corpseColor.b, corpseColor.a);
-            
-            // Draw X lines (two diagonal lines)
-            for (int i = 0; i < size; i++) {
-                // Top-left to bottom-right
-                SDL_RenderDrawPoint(_renderer, pixelX + padding + i, pixelY + padding + i);
-                // Top-right to bottom-left
-                SDL_RenderDrawPoint(_renderer, pixelX + padding + size - 1 - i, pixelY + padding + i);
-                // Make lines thicker
-                if (i > 0) {
-                    SDL_RenderDrawPoint(_renderer, pixelX + padding + i - 1, pixelY + padding + i);
-                    SDL_RenderDrawPoint(_renderer, pixelX + padding + size - i, pixelY + padding + i);
-                }
-            }
+            queueCorpse(corpse->getDecayProgress(),
+                        static_cast<int>(screenX), static_cast<int>(screenY));
         }
     }
+    
+    // Plants and corpses go out in one draw call
+    _entityBatch.flush(_renderer);
 }
 
 void SDL2Renderer::renderTile(const Tile& tile, int screenX, int screenY) {
@@ -337,37 +301,7 @@ void SDL2Renderer::renderTile(const Tile& tile, int screenX, int screenY) {
     }
     
     // Render terrain - use depth-based coloring for water tiles
-    SDL_Color terrainColor;
-    TerrainType terrainType = tile.getTerrainType();
-    
-    // Check if this is a water tile that should use depth-based coloring
-    if (terrainType == TerrainType::DEEP_WATER ||
-        terrainType == TerrainType::WATER ||
-        terrainType == TerrainType::SHALLOW_WATER ||
-        terrainType == TerrainType::SHALLOW_WATER_2) {
-        
-        float waterDepth = tile.getWaterDepth();
-        WaterType waterType;
-        
-        // Determine water type based on terrain type and whether it's a source (isSource = freshwater)
-        if (tile.isSource()) {
-            // Freshwater bodies (lakes, rivers)
-            if (terrainType == TerrainType::SHALLOW_WATER ||
-                terrainType == TerrainType::SHALLOW_WATER_2) {
-                waterType = WaterType::RIVER;
-            } else {
-                waterType = WaterType::LAKE;
-            }
-        } else {
-            // Ocean water - use single OCEAN type for smooth gradient
-            // The depth value handles the transition from shallow to deep
-            waterType = WaterType::OCEAN;
-        }
-        
-        terrainColor = SDL2ColorMapper::waterToColor(waterDepth, waterType);
-    } else {
-        terrainColor = getTerrainColor(terrainType);
-    }
+    SDL_Color terrainColor = SDL2ColorMapper::tileToColor(tile);
     
     drawFilledRect(screenX, screenY, _tileSize, _tileSize, terrainColor);
     
@@ -411,7 +345,10 @@ void SDL2Renderer::renderCreatures(const std::vector<std::unique_ptr<EcoSim::Gen
         return;
     }
 
-    _currentCreatures = &creatures;
+    // The overview drawn by renderWorld() already counts creatures
+    if (_overviewLevel >= 0) {
+        return;
+    }
 
     int xRange = viewport.originX + viewport.width;
     int yRange = viewport.originY + viewport.height;
@@ -443,12 +380,15 @@ void SDL2Renderer::renderCreatures(const std::vector<std::unique_ptr<EcoSim::Gen
             int pixelY = static_cast<int>(screenY);
 
             if (creature.getSequentialId() == selectedId) {
-                renderSelectedCreature(creature, pixelX, pixelY);
+                queueSelectedCreature(getProfileColor(creature), pixelX, pixelY);
             } else {
-                renderCreature(creature, pixelX, pixelY);
+                queueCreature(getProfileColor(creature), pixelX, pixelY);
             }
         }
     }
+    
+    // All visible creatures go out in one draw call
+    _entityBatch.flush(_renderer);
 }
 
 void SDL2Renderer::renderCreature(const EcoSim::Genetics::Organism& creature, int screenX, int screenY) {
@@ -456,14 +396,115 @@ void SDL2Renderer::renderCreature(const EcoSim::Genetics::Organism& creature, in
         return;
     }
     
-    // Get color based on creature's behavior profile
-    SDL_Color creatureColor = getProfileColor(creature);
+    queueCreature(getProfileColor(creature), screenX, screenY);
+    _entityBatch.flush(_renderer);
+}
+
+void SDL2Renderer::renderSelectedCreature(const EcoSim::Genetics::Organism& creature, int screenX, int screenY) {
+    if (!_initialized) {
+        return;
+    }
+    
+    queueSelectedCreature(getProfileColor(creature), screenX, screenY);
+    _entityBatch.flush(_renderer);
+}
+
+void SDL2Renderer::renderSnapshot(const RenderSnapshot& snapshot, const Viewport& viewport) {
+    if (!_initialized) {
+        return;
+    }
+    
+#ifdef ECOSIM_HAS_IMGUI
+    if (_imguiOverlay) {
+        _imguiOverlay->setViewport(viewport);
+    }
+#endif
     
+    if (_overviewLevel >= 0) {
+        // Keep the terrain cache current for when tiles are drawn again
+        _terrainCache.sync(snapshot);
+        
+        // Until a snapshot at overview resolution arrives there is nothing
+        // cheap to draw; tiles at this zoom would mean baking the whole map
+        if (snapshot.overviewBlock == 0) {
+            return;
+        }
+        float scale = pixelsPerTile();
+        int block = static_cast<int>(snapshot.overviewBlock);
+        int size = static_cast<int>(std::ceil(static_cast<float>(block) * scale));
+        for (unsigned int row = 0; row < snapshot.overviewRows; ++row) {
+            int tileY = (snapshot.overviewCellY + static_cast<int>(row)) * block;
+            for (unsigned int col = 0; col < snapshot.overviewCols; ++col) {
+                int tileX = (snapshot.overviewCellX + static_cast<int>(col)) * block;
+                queueOverviewCell(snapshot.overview[row * snapshot.overviewCols + col],
+                                  snapshot.overviewBlock,
+                                  static_cast<int>((tileX - viewport.originX) * scale),
+                                  static_cast<int>((tileY - viewport.originY) * scale),
+                                  size);
+            }
+        }
+        _entityBatch.flush(_renderer);
+        return;
+    }
+    
+    int baseScreenX = static_cast<int>(viewport.screenX) * _tileSize;
+    int baseScreenY = static_cast<int>(viewport.screenY) * _tileSize;
+    int xRange = viewport.originX + static_cast<int>(viewport.width);
+    int yRange = viewport.originY + static_cast<int>(viewport.height);
+    auto visible = [&](int tileX, int tileY) {
+        return tileX >= viewport.originX && tileX < xRange &&
+               tileY >= viewport.originY && tileY < yRange;
+    };
+    
+    _terrainCache.render(snapshot, viewport, _tileSize, baseScreenX, baseScreenY);
+    
+    for (const PlantSprite& plant : snapshot.plants) {
+        if (visible(plant.tileX, plant.tileY)) {
+            queuePlant(plant.type,
+                       baseScreenX + (plant.tileX - viewport.originX) * _tileSize,
+                       baseScreenY + (plant.tileY - viewport.originY) * _tileSize);
+        }
+    }
+    
+    for (const CorpseSprite& corpse : snapshot.corpses) {
+        if (visible(static_cast<int>(corpse.worldX), static_cast<int>(corpse.worldY))) {
+            float screenX = baseScreenX + (corpse.worldX - viewport.originX) * _tileSize;
+            float screenY = baseScreenY + (corpse.worldY - viewport.originY) * _tileSize;
+            queueCorpse(corpse.decay, static_cast<int>(screenX), static_cast<int>(screenY));
+        }
+    }
+    
+    int selectedId = -1;
+#ifdef ECOSIM_HAS_IMGUI
+    if (_imguiOverlay != nullptr) {
+        selectedId = _imguiOverlay->getSelectedCreatureId();
+    }
+#endif
+    
+    for (const CreatureSprite& creature : snapshot.creatures) {
+        if (!visible(static_cast<int>(creature.worldX), static_cast<int>(creature.worldY))) {
+            continue;
+        }
+        float screenX = baseScreenX + (creature.worldX - viewport.originX) * _tileSize;
+        float screenY = baseScreenY + (creature.worldY - viewport.originY) * _tileSize;
+        SDL_Color color = SDL2ColorMapper::motivationToColor(creature.motivation);
+        if (creature.id == selectedId) {
+            queueSelectedCreature(color, static_cast<int>(screenX), static_cast<int>(screenY));
+        } else {
+            queueCreature(color, static_cast<int>(screenX), static_cast<int>(screenY));
+        }
+    }
+    
+    // Plants, corpses and creatures go out in one draw call
+    _entityBatch.flush(_renderer);
+}
+
+void SDL2Renderer::queueCreature(SDL_Color creatureColor, int screenX, int screenY) {
     // Draw creature as a smaller rectangle within the tile (with padding)
     int padding = 2;
-    drawFilledRect(screenX + padding, screenY + padding,
-                  _tileSize - 2 * padding, _tileSize - 2 * padding,
-                  creatureColor);
+    _entityBatch.fillRect(screenX + padding, screenY + padding,
+                          _tileSize - 2 * padding, _tileSize - 2 * padding,
+                          creatureColor);
     
     // Draw a darker outline
     SDL_Color outlineColor = {
@@ -472,27 +513,20 @@ void SDL2Renderer::renderCreature(const EcoSim::Genetics::Organism& creature, in
         static_cast<Uint8>(creatureColor.b / 2),
         255
     };
-    drawRect(screenX + padding, screenY + padding,
-            _tileSize - 2 * padding, _tileSize - 2 * padding,
-            outlineColor);
+    _entityBatch.outlineRect(screenX + padding, screenY + padding,
+                             _tileSize - 2 * padding, _tileSize - 2 * padding,
+                             outlineColor);
 }
 
-void SDL2Renderer::renderSelectedCreature(const EcoSim::Genetics::Organism& creature, int screenX, int screenY) {
-    if (!_initialized) {
-        return;
-    }
-    
+void SDL2Renderer::queueSelectedCreature(SDL_Color creatureColor, int screenX, int screenY) {
     // Two-color highlight ring for visibility against any backdrop
     SDL_Color outerColor = {0, 0, 0, 255};        // Black outer ring
     SDL_Color innerColor = {255, 255, 100, 255};  // Yellow inner ring
     
     // Black outer ring (provides contrast against light backgrounds)
-    drawRect(screenX - 2, screenY - 2, _tileSize + 4, _tileSize + 4, outerColor);
+    _entityBatch.outlineRect(screenX - 2, screenY - 2, _tileSize + 4, _tileSize + 4, outerColor);
     // Yellow inner ring (provides contrast against dark backgrounds)
-    drawRect(screenX - 1, screenY - 1, _tileSize + 2, _tileSize + 2, innerColor);
-    
-    // Get color based on creature's behavior profile
-    SDL_Color creatureColor = getProfileColor(creature);
+    _entityBatch.outlineRect(screenX - 1, screenY - 1, _tileSize + 2, _tileSize + 2, innerColor);
     
     // Make the creature slightly brighter when selected
     creatureColor.r = std::min(255, creatureColor.r + 30);
@@ -501,21 +535,88 @@ void SDL2Renderer::renderSelectedCreature(const EcoSim::Genetics::Organism& crea
     
     // Draw creature as a smaller rectangle within the tile (with padding)
     int padding = 2;
-    drawFilledRect(screenX + padding, screenY + padding,
-                  _tileSize - 2 * padding, _tileSize - 2 * padding,
-                  creatureColor);
+    _entityBatch.fillRect(screenX + padding, screenY + padding,
+                          _tileSize - 2 * padding, _tileSize - 2 * padding,
+                          creatureColor);
     
     // Draw a brighter outline
     SDL_Color outlineColor = innerColor;
-    drawRect(screenX + padding, screenY + padding,
-            _tileSize - 2 * padding, _tileSize - 2 * padding,
-            outlineColor);
+    _entityBatch.outlineRect(screenX + padding, screenY + padding,
+                             _tileSize - 2 * padding, _tileSize - 2 * padding,
+                             outlineColor);
 }
 
-void SDL2Renderer::renderImGuiOverlay(const HUDData& data, const World* world) {
+void SDL2Renderer::queuePlant(EntityType type, int screenX, int screenY) {
+    int padding = _tileSize / 4;
+    _entityBatch.fillRect(screenX + padding, screenY + padding,
+                          _tileSize - 2 * padding, _tileSize - 2 * padding,
+                          getEntityColor(type));
+}
+
+void SDL2Renderer::queueCorpse(float decay, int pixelX, int pixelY) {
+    // Darker color as it decays (brown tones)
+    Uint8 brightness = static_cast<Uint8>(150 * (1.0f - decay * 0.5f));
+    SDL_Color corpseColor = {brightness, static_cast<Uint8>(brightness / 2), 0, 255};
+    
+    // Draw corpse as an X shape
+    int padding = _tileSize / 4;
+    int size = _tileSize - 2 * padding;
+    
+    // Draw X lines (two diagonal lines), two pixels thick below the first row
+    for (int i = 0; i < size; i++) {
+        int thickness = (i > 0) ? 2 : 1;
+        int rowY = pixelY + padding + i;
+        // Top-left to bottom-right
+        _entityBatch.fillRect(pixelX + padding + i - (thickness - 1), rowY, thickness, 1, corpseColor);
+        // Top-right to bottom-left
+        _entityBatch.fillRect(pixelX + padding + size - 1 - i, rowY, thickness, 1, corpseColor);
+    }
+}
+
+void SDL2Renderer::queueOverviewCell(const EcoSim::WorldOverview::Cell& cell, unsigned int blockTiles,
+                                     int pixelX, int pixelY, int size) {
+    // Terrain, tinted towards plant green by how much of the block is covered
+    SDL_Color color = getTerrainColor(cell.terrain);
+    float tiles = static_cast<float>(blockTiles) * static_cast<float>(blockTiles);
+    float cover = std::min(1.0f, static_cast<float>(cell.plants) / tiles) * 0.6f;
+    SDL_Color plantColor = getEntityColor(EntityType::PLANT_GENERIC);
+    color.r = static_cast<Uint8>(color.r + (plantColor.r - color.r) * cover);
+    color.g = static_cast<Uint8>(color.g + (plantColor.g - color.g) * cover);
+    color.b = static_cast<Uint8>(color.b + (plantColor.b - color.b) * cover);
+    _entityBatch.fillRect(pixelX, pixelY, size, size, color);
+    
+    // Creatures as a centred marker colored by which archetypes dominate
+    if (cell.creatures > 0) {
+        SDL_Color marker = {230, 230, 230, 255};        // Mostly omnivores
+        if (cell.carnivores > cell.herbivores) {
+            marker = {220, 60, 60, 255};                // Hunters dominate
+        } else if (cell.herbivores > 0) {
+            marker = {240, 220, 90, 255};               // Grazers dominate
+        }
+        int markerSize = std::max(2, size / 2);
+        int offset = (size - markerSize) / 2;
+        _entityBatch.fillRect(pixelX + offset, pixelY + offset, markerSize, markerSize, marker);
+    }
+    
+    // Corpses as a small brown mark in the corner
+    if (cell.corpses > 0) {
+        int markSize = std::max(2, size / 4);
+        _entityBatch.fillRect(pixelX, pixelY, markSize, markSize, SDL_Color{120, 60, 0, 255});
+    }
+}
+
+float SDL2Renderer::pixelsPerTile() const {
+    if (_overviewLevel >= 0) {
+        return static_cast<float>(OVERVIEW_CELL_SIZE) /
+               static_cast<float>(EcoSim::WorldOverview::blockSize(static_cast<unsigned int>(_overviewLevel)));
+    }
+    return static_cast<float>(_tileSize);
+}
+
+void SDL2Renderer::renderImGuiOverlay(const HUDData& data) {
 #ifdef ECOSIM_HAS_IMGUI
     if (_imguiOverlay != nullptr) {
-        _imguiOverlay->render(data, world, _currentCreatures);
+        _imguiOverlay->render(data);
     }
 #endif
 }
@@ -533,7 +634,7 @@ void SDL2Renderer::renderHUD(const HUDData& data) {
     // Skip SDL2 text HUD when ImGui is active - ImGui panels show this info
     if (_imguiOverlay && _imguiOverlay->isInitialized()) {
         // Only render ImGui overlay
-        renderImGuiOverlay(data, _currentWorld);
+        renderImGuiOverlay(data);
         return;
     }
 #endif
@@ -582,6 +683,11 @@ void SDL2Renderer::renderHUD(const HUDData& data) {
     worldInfo << "World: " << data.worldWidth << "x" << data.worldHeight;
     drawText(worldInfo.str(), col3X, textY + 4 * lineHeight, textColor);
     
+    // Status line
+    if (!data.statusMessage.empty()) {
+        drawText(data.statusMessage, col3X, textY + 5 * lineHeight, valueColor);
+    }
+    
     // Pause indicator
     if (data.paused) {
         SDL_Color pauseColor = {255, 100, 100, 255};
@@ -589,6 +695,15 @@ void SDL2Renderer::renderHUD(const HUDData& data) {
     }
 }
 
+PanelRequest SDL2Renderer::panelRequest() const {
+#ifdef ECOSIM_HAS_IMGUI
+    if (_imguiOverlay != nullptr && _imguiOverlay->isInitialized()) {
+        return _imguiOverlay->panelRequest();
+    }
+#endif
+    return PanelRequest();
+}
+
 int SDL2Renderer::renderMenu(const std::string& title,
                              const std::vector<MenuOption>& options) {
     if (!_initialized || options.empty()) {
@@ -798,19 +913,19 @@ unsigned int SDL2Renderer::getScreenHeight() const {
 
 unsigned int SDL2Renderer::getViewportMaxWidth() const {
     // Full screen width in tiles - world renders full screen, ImGui overlays on top
-    return static_cast<unsigned int>(_screenWidth / _tileSize);
+    return static_cast<unsigned int>(static_cast<float>(_screenWidth) / pixelsPerTile());
 }
 
 unsigned int SDL2Renderer::getViewportMaxHeight() const {
 #ifdef ECOSIM_HAS_IMGUI
     // When ImGui is active, use full screen height (ImGui overlays on top)
     if (_imguiOverlay && _imguiOverlay->isInitialized()) {
-        return static_cast<unsigned int>(_screenHeight / _tileSize);
+        return static_cast<unsigned int>(static_cast<float>(_screenHeight) / pixelsPerTile());
     }
 #endif
     // For non-ImGui builds, subtract HUD height at bottom
     int availableHeight = _screenHeight - HUD_HEIGHT;
-    return static_cast<unsigned int>(availableHeight / _tileSize);
+    return static_cast<unsigned int>(static_cast<float>(availableHeight) / pixelsPerTile());
 }
 
 unsigned int SDL2Renderer::getScreenCenterX() const {
@@ -866,6 +981,11 @@ void SDL2Renderer::handleResize() {
 }
 
 void SDL2Renderer::zoomIn() {
+    if (_overviewLevel >= 0) {
+        // Level 0 steps back to drawing tiles at MIN_TILE_SIZE
+        --_overviewLevel;
+        return;
+    }
     if (_tileSize < MAX_TILE_SIZE) {
         _tileSize += 2;
         if (_tileSize > MAX_TILE_SIZE) {
@@ -880,6 +1000,9 @@ void SDL2Renderer::zoomOut() {
         if (_tileSize < MIN_TILE_SIZE) {
             _tileSize = MIN_TILE_SIZE;
         }
+    } else if (_overviewLevel < MAX_OVERVIEW_LEVEL) {
+        // Past the smallest tiles, draw the world overview instead
+        ++_overviewLevel;
     }
 }
 
@@ -1137,252 +1260,9 @@ void SDL2Renderer::drawRect(int x, int y, int w, int h, SDL_Color color) {
 }
 
 void SDL2Renderer::drawText(const std::string& text, int x, int y, SDL_Color color) {
-    // Bitmap font rendering - 5x7 pixel characters
-    // Each character is defined as a 5x7 bitmap where each row is a byte
-    // Bit pattern: most significant bit (within the 5-bit width) is leftmost pixel
-    
-    static const unsigned char FONT_5X7[128][7] = {
-        // Control characters (0-31) - blank
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0}, {0,0,0,0,0,0,0},
-        // Space (32)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-        // ! (33)
-        {0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00},
-        // " (34)
-        {0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00},
-        // # (35)
-        {0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x00},
-        // $ (36)
-        {0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04},
-        // % (37)
-        {0x19, 0x19, 0x02, 0x04, 0x08, 0x13, 0x13},
-        // & (38)
-        {0x08, 0x14, 0x14, 0x08, 0x15, 0x12, 0x0D},
-        // ' (39)
-        {0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
-        // ( (40)
-        {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02},
-        // ) (41)
-        {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08},
-        // * (42)
-        {0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00},
-        // + (43)
-        {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00},
-        // , (44)
-        {0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08},
-        // - (45)
-        {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},
-        // . (46)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00},
-        // / (47)
-        {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10},
-        // 0 (48)
-        {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},
-        // 1 (49)
-        {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
-        // 2 (50)
-        {0x0E, 0x11, 0x01, 0x06, 0x08, 0x10, 0x1F},
-        // 3 (51)
-        {0x0E, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0E},
-        // 4 (52)
-        {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},
-        // 5 (53)
-        {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},
-        // 6 (54)
-        {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},
-        // 7 (55)
-        {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
-        // 8 (56)
-        {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},
-        // 9 (57)
-        {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},
-        // : (58)
-        {0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00},
-        // ; (59)
-        {0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x08},
-        // < (60)
-        {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02},
-        // = (61)
-        {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00},
-        // > (62)
-        {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08},
-        // ? (63)
-        {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04},
-        // @ (64)
-        {0x0E, 0x11, 0x17, 0x15, 0x17, 0x10, 0x0E},
-        // A (65)
-        {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
-        // B (66)
-        {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},
-        // C (67)
-        {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},
-        // D (68)
-        {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},
-        // E (69)
-        {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},
-        // F (70)
-        {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},
-        // G (71)
-        {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},
-        // H (72)
-        {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
-        // I (73)
-        {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
-        // J (74)
-        {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},
-        // K (75)
-        {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},
-        // L (76)
-        {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},
-        // M (77)
-        {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},
-        // N (78)
-        {0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11},
-        // O (79)
-        {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
-        // P (80)
-        {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},
-        // Q (81)
-        {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},
-        // R (82)
-        {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},
-        // S (83)
-        {0x0E, 0x11, 0x10, 0x0E, 0x01, 0x11, 0x0E},
-        // T (84)
-        {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
-        // U (85)
-        {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
-        // V (86)
-        {0x11, 0x11, 0x11, 0x11, 0x0A, 0x0A, 0x04},
-        // W (87)
-        {0x11, 0x11, 0x11, 0x15, 0x15, 0x1B, 0x11},
-        // X (88)
-        {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},
-        // Y (89)
-        {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04},
-        // Z (90)
-        {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},
-        // [ (91)
-        {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E},
-        // \ (92)
-        {0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01},
-        // ] (93)
-        {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E},
-        // ^ (94)
-        {0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00},
-        // _ (95)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F},
-        // ` (96)
-        {0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
-        // a (97)
-        {0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F},
-        // b (98)
-        {0x10, 0x10, 0x1E, 0x11, 0x11, 0x11, 0x1E},
-        // c (99)
-        {0x00, 0x00, 0x0E, 0x11, 0x10, 0x11, 0x0E},
-        // d (100)
-        {0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x0F},
-        // e (101)
-        {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E},
-        // f (102)
-        {0x06, 0x08, 0x1C, 0x08, 0x08, 0x08, 0x08},
-        // g (103)
-        {0x00, 0x00, 0x0F, 0x11, 0x0F, 0x01, 0x0E},
-        // h (104)
-        {0x10, 0x10, 0x1E, 0x11, 0x11, 0x11, 0x11},
-        // i (105)
-        {0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E},
-        // j (106)
-        {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C},
-        // k (107)
-        {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12},
-        // l (108)
-        {0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
-        // m (109)
-        {0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11},
-        // n (110)
-        {0x00, 0x00, 0x1E, 0x11, 0x11, 0x11, 0x11},
-        // o (111)
-        {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E},
-        // p (112)
-        {0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10},
-        // q (113)
-        {0x00, 0x00, 0x0F, 0x11, 0x0F, 0x01, 0x01},
-        // r (114)
-        {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10},
-        // s (115)
-        {0x00, 0x00, 0x0F, 0x10, 0x0E, 0x01, 0x1E},
-        // t (116)
-        {0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06},
-        // u (117)
-        {0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0F},
-        // v (118)
-        {0x00, 0x00, 0x11, 0x11, 0x0A, 0x0A, 0x04},
-        // w (119)
-        {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A},
-        // x (120)
-        {0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11},
-        // y (121)
-        {0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E},
-        // z (122)
-        {0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F},
-        // { (123)
-        {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02},
-        // | (124)
-        {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
-        // } (125)
-        {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08},
-        // ~ (126)
-        {0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00},
-        // DEL (127) - blank
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
-    };
-    
-    const int charWidth = 5;
-    const int charHeight = 7;
-    const int charSpacing = 1;  // Space between characters
-    const int scale = 2;  // Scale up for better visibility
-    
-    SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a);
-    
-    int cursorX = x;
-    
-    for (size_t i = 0; i < text.length(); i++) {
-        unsigned char c = static_cast<unsigned char>(text[i]);
-        
-        // Clamp to valid ASCII range
-        if (c > 127) c = '?';
-        
-        // Get the glyph
-        const unsigned char* glyph = FONT_5X7[c];
-        
-        // Render each pixel of the character
-        for (int row = 0; row < charHeight; row++) {
-            unsigned char rowData = glyph[row];
-            for (int col = 0; col < charWidth; col++) {
-                if (rowData & (1 << (charWidth - 1 - col))) {
-                    // Draw scaled pixel
-                    SDL_Rect pixel = {
-                        cursorX + col * scale,
-                        y + row * scale,
-                        scale,
-                        scale
-                    };
-                    SDL_RenderFillRect(_renderer, &pixel);
-                }
-            }
-        }
-        
-        // Move cursor for next character
-        cursorX += (charWidth + charSpacing) * scale;
-    }
+    // Glyphs come from the font atlas; the whole string is one draw call
+    _font.queueText(_textBatch, text, x, y, color, TEXT_SCALE);
+    _textBatch.flush(_renderer, _font.texture());
 }
 
 SDL_Color SDL2Renderer::getTerrainColor(TerrainType terrain) const {
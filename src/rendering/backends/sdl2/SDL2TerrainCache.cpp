@@ -0,0 +1,204 @@
+/**
+ * @file SDL2TerrainCache.cpp
+ * @brief Implementation of the chunked terrain texture cache
+ */
+
+#include "../../../../include/rendering/backends/sdl2/SDL2TerrainCache.hpp"
+#include "../../../../include/rendering/backends/sdl2/SDL2ColorMapper.hpp"
+#include "../../../../include/world/world.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+//==============================================================================
+// Constructor / Destructor
+//==============================================================================
+
+SDL2TerrainCache::SDL2TerrainCache()
+    : _renderer(nullptr)
+    , _grid(nullptr)
+    , _terrainRevision(0)
+    , _worldWidth(0)
+    , _worldHeight(0)
+    , _chunksX(0)
+    , _chunksY(0) {
+}
+
+SDL2TerrainCache::~SDL2TerrainCache() {
+    clear();
+}
+
+void SDL2TerrainCache::setRenderer(SDL_Renderer* renderer) {
+    if (renderer != _renderer) {
+        clear();
+        _renderer = renderer;
+    }
+}
+
+void SDL2TerrainCache::clear() {
+    for (ChunkTexture& chunk : _chunks) {
+        if (chunk.texture != nullptr) {
+            SDL_DestroyTexture(chunk.texture);
+        }
+    }
+    _chunks.clear();
+    _grid = nullptr;
+    _chunksX = 0;
+    _chunksY = 0;
+}
+
+std::size_t SDL2TerrainCache::bakedChunkCount() const {
+    return static_cast<std::size_t>(std::count_if(_chunks.begin(), _chunks.end(),
+        [](const ChunkTexture& chunk) { return chunk.texture != nullptr && !chunk.dirty; }));
+}
+
+//==============================================================================
+// Rendering
+//==============================================================================
+
+void SDL2TerrainCache::render(const World& world, const Viewport& viewport,
+                              int tileSize, int baseScreenX, int baseScreenY) {
+    if (_renderer == nullptr) {
+        return;
+    }
+    sync(world);
+    draw(world.grid(), viewport, tileSize, baseScreenX, baseScreenY);
+}
+
+void SDL2TerrainCache::render(const RenderSnapshot& snapshot, const Viewport& viewport,
+                              int tileSize, int baseScreenX, int baseScreenY) {
+    if (_renderer == nullptr || snapshot.terrain == nullptr) {
+        return;
+    }
+    sync(snapshot);
+    draw(*snapshot.terrain, viewport, tileSize, baseScreenX, baseScreenY);
+}
+
+//==============================================================================
+// Private Methods
+//==============================================================================
+
+void SDL2TerrainCache::draw(const EcoSim::WorldGrid& grid, const Viewport& viewport,
+                            int tileSize, int baseScreenX, int baseScreenY) {
+    if (_chunks.empty()) {
+        return;
+    }
+
+    // Visible tile range, clipped to the world
+    unsigned int x0 = static_cast<unsigned int>(std::max(viewport.originX, 0));
+    unsigned int y0 = static_cast<unsigned int>(std::max(viewport.originY, 0));
+    unsigned int x1 = std::min(x0 + viewport.width, _worldWidth);
+    unsigned int y1 = std::min(y0 + viewport.height, _worldHeight);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    for (unsigned int cy = y0 / CHUNK_TILES; cy <= (y1 - 1) / CHUNK_TILES; ++cy) {
+        for (unsigned int cx = x0 / CHUNK_TILES; cx <= (x1 - 1) / CHUNK_TILES; ++cx) {
+            ChunkTexture& chunk = _chunks[cy * _chunksX + cx];
+            if (chunk.dirty && !bake(grid, cx, cy, chunk)) {
+                continue;
+            }
+
+            // Part of the chunk inside the viewport, in world tiles
+            unsigned int left = std::max(x0, cx * CHUNK_TILES);
+            unsigned int top = std::max(y0, cy * CHUNK_TILES);
+            unsigned int right = std::min(x1, (cx + 1) * CHUNK_TILES);
+            unsigned int bottom = std::min(y1, (cy + 1) * CHUNK_TILES);
+
+            SDL_Rect src = {
+                static_cast<int>(left - cx * CHUNK_TILES),
+                static_cast<int>(top - cy * CHUNK_TILES),
+                static_cast<int>(right - left),
+                static_cast<int>(bottom - top)
+            };
+            SDL_Rect dst = {
+                baseScreenX + static_cast<int>(left - x0) * tileSize,
+                baseScreenY + static_cast<int>(top - y0) * tileSize,
+                src.w * tileSize,
+                src.h * tileSize
+            };
+            SDL_RenderCopy(_renderer, chunk.texture, &src, &dst);
+        }
+    }
+}
+
+void SDL2TerrainCache::sync(const World& world) {
+    std::uint64_t revision = world.getTerrainRevision();
+    if (reset(&world.grid(), world.getCols(), world.getRows(), revision) ||
+        revision == _terrainRevision) {
+        return;
+    }
+    markAllDirty();
+    _terrainRevision = revision;
+}
+
+void SDL2TerrainCache::sync(const RenderSnapshot& snapshot) {
+    if (reset(snapshot.terrain, snapshot.worldWidth, snapshot.worldHeight, snapshot.terrainRevision) ||
+        snapshot.terrainRevision == _terrainRevision) {
+        return;
+    }
+    markAllDirty();
+    _terrainRevision = snapshot.terrainRevision;
+}
+
+bool SDL2TerrainCache::reset(const EcoSim::WorldGrid* grid, unsigned int width, unsigned int height,
+                             std::uint64_t revision) {
+    if (grid == _grid && width == _worldWidth && height == _worldHeight) {
+        return false;
+    }
+    clear();
+    _grid = grid;
+    _worldWidth = width;
+    _worldHeight = height;
+    _chunksX = (width + CHUNK_TILES - 1) / CHUNK_TILES;
+    _chunksY = (height + CHUNK_TILES - 1) / CHUNK_TILES;
+    _chunks.resize(static_cast<std::size_t>(_chunksX) * _chunksY);
+    _terrainRevision = revision;
+    return true;
+}
+
+void SDL2TerrainCache::markAllDirty() {
+    // Textures are kept and overwritten when the chunks are next visible
+    for (ChunkTexture& chunk : _chunks) {
+        chunk.dirty = true;
+    }
+}
+
+bool SDL2TerrainCache::bake(const EcoSim::WorldGrid& grid, unsigned int cx, unsigned int cy,
+                            ChunkTexture& chunk) {
+    unsigned int left = cx * CHUNK_TILES;
+    unsigned int top = cy * CHUNK_TILES;
+    int w = static_cast<int>(std::min(CHUNK_TILES, _worldWidth - left));
+    int h = static_cast<int>(std::min(CHUNK_TILES, _worldHeight - top));
+
+    if (chunk.texture == nullptr) {
+        chunk.texture = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                          SDL_TEXTUREACCESS_STATIC, w, h);
+        if (chunk.texture == nullptr) {
+            std::cerr << "SDL2TerrainCache: SDL_CreateTexture failed: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        // Terrain is opaque; skip blending when copying it
+        SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_NONE);
+    }
+
+    // One texel per tile, rows of the texture are world rows
+    _pixels.resize(static_cast<std::size_t>(w) * static_cast<std::size_t>(h));
+    for (int ly = 0; ly < h; ++ly) {
+        for (int lx = 0; lx < w; ++lx) {
+            SDL_Color c = SDL2ColorMapper::tileToColor(grid(left + static_cast<unsigned int>(lx),
+                                                           top + static_cast<unsigned int>(ly)));
+            _pixels[static_cast<std::size_t>(ly * w + lx)] =
+                (Uint32(c.a) << 24) | (Uint32(c.r) << 16) | (Uint32(c.g) << 8) | Uint32(c.b);
+        }
+    }
+
+    if (SDL_UpdateTexture(chunk.texture, nullptr, _pixels.data(),
+                          w * static_cast<int>(sizeof(Uint32))) != 0) {
+        std::cerr << "SDL2TerrainCache: SDL_UpdateTexture failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    chunk.dirty = false;
+    return true;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file simulationTick.cpp
+ * @brief One simulation tick, shared by the game and the benchmarks
+ * @author Gary Ferguson
+ */
+
+#include "../include/simulationTick.hpp"
+#include "../include/objects/creature/creature.hpp"
+#include "../include/logging/Logger.hpp"
+#include "../include/logging/Profiler.hpp"
+#include "../include/logging/TickMetrics.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+using std::vector;
+using EcoSim::Genetics::Organism;
+using EcoSim::Genetics::OrganismPtr;
+using EcoSim::Genetics::OrganismStore;
+
+/**
+ *	This controls the behaviour of each individual creature.
+ *  Returns true if the creature died this turn (for deferred removal).
+ *
+ *	@param w        A reference to the world map.
+ *	@param gs       General data stored on the simuation.
+ *	@param c	      A vector containing all of the creatures.
+ *	@param cIndex	  Current creature acting.
+ *	@return		      True if creature died and should be removed.
+ */
+bool takeTurn (World &w, GeneralStats &gs, vector<OrganismPtr> &c,
+               const unsigned int &cIndex) {
+  Organism *activeC = c.at(cIndex).get();
+
+  //  Level-of-detail scheduling: skipped ticks are integrated here
+  const unsigned elapsed = w.turnScheduler().beginTurn(*activeC, w.getCurrentTick());
+  if (elapsed == 0) return false;
+
+  short dc = activeC->deathCheck();
+  if (dc != 0) {
+    //  Record death statistic and determine cause string for logging
+    std::string deathCause;
+    switch (dc) {
+      case 1: gs.deaths.oldAge++;     deathCause = "old_age";     break;
+      case 2: gs.deaths.starved++;    deathCause = "starvation";  break;
+      case 3: gs.deaths.dehydrated++; deathCause = "dehydration"; break;
+      case 4: gs.deaths.discomfort++; deathCause = "discomfort";  break;
+      case 5: gs.deaths.predator++;   deathCause = "combat";      break;
+      default:
+        std::cerr << "[ERROR] Unknown death code: " << dc << " for creature "
+                  << activeC->getId() << std::endl;
+        deathCause = "unknown";
+        break;
+    }
+    
+    // Log the death event
+    logging::Logger::getInstance().creatureDied(
+      activeC->getId(),
+      activeC->generateName(),
+      deathCause,
+      activeC->getHunger(),
+      activeC->getAge()
+    );
+
+    //  Create corpse for scavengers
+    //  Size is based on creature's max health (larger creatures = more nutrition)
+    float creatureSize = activeC->getMaxHealth() / 50.0f;  // 50 HP per size unit
+    if (creatureSize > 0.1f) {
+      // Body condition is based on creature's energy level when they died (0-1 range)
+      // Higher energy = better fed = more nutritious corpse
+      // RESOURCE_LIMIT is 10.0f - max hunger value
+      float bodyCondition = std::max(0.0f, std::min(1.0f, activeC->getHunger() / 10.0f));
+      w.addCorpse(activeC->getWorldX(), activeC->getWorldY(), creatureSize, activeC->generateName(), bodyCondition);
+    }
+
+    // Mark creature as dead by setting health below zero.
+    // This ensures deathCheck() returns non-zero and isAlive() returns false.
+    // Actual removal is deferred to end of tick to prevent spatial index
+    // pointer invalidation.
+    activeC->setHealth(-1.0f);
+    return true;  // Creature died
+
+  //  If not dead, run behavior controller
+  } else {
+    // Update creature phenotype with location-specific environment data
+    auto localEnv = w.environment().getEnvironmentStateAt(
+        static_cast<int>(activeC->getWorldX()),
+        static_cast<int>(activeC->getWorldY()));
+    activeC->updatePhenotypeContext(localEnv);
+
+    auto ctx = activeC->buildBehaviorContext(w, w.getScentLayer(), w.getCurrentTick());
+    ctx.deltaTime = static_cast<float>(elapsed);
+    auto result = activeC->updateWithBehaviors(ctx);
+    w.turnScheduler().endTurn(*activeC, result, w.getCurrentTick(),
+                              w.getCreatureIndex(), w.getScentLayer());
+
+    return false;  // Creature survived
+  }
+}
+
+/**
+ *  Advances the simulation a singular turn
+ *
+ *  @param w The world object.
+ *  @param c The store holding every creature.
+ */
+void advanceSimulation (World &w, OrganismStore &c, GeneralStats &gs) {
+  ECOSIM_PROFILE_ZONE("tick");
+
+  //  Update environment tick cache before processing any organisms
+  //  This pre-computes expensive calculations like light level (sin-based day/night cycle)
+  unsigned int currentTick = w.getCurrentTick();
+  {
+    ECOSIM_TICK_PHASE(EnvironmentCache);
+    w.environment().updateTickCache(static_cast<int>(currentTick));
+  }
+
+  //  Rebuild spatial index for O(1) neighbor queries (Phase 3 optimization)
+  //  This is called once per tick - O(n) rebuild cost enables O(1) queries
+  //  Chunked worlds also drop the chunks no creature is near
+  {
+    ECOSIM_TICK_PHASE(SpatialIndex);
+    w.rebuildCreatureIndex(c.organisms());
+    w.evictDistantChunks(c.organisms());
+  }
+
+  //  Push simulation forward
+  {
+    ECOSIM_TICK_PHASE(WorldObjects);
+    w.updateAllObjects ();
+  }
+
+  // Update scent layer for pheromone decay (Phase 2: Sensory System)
+  {
+    ECOSIM_TICK_PHASE(ScentLayer);
+    w.updateScentLayer();
+  }
+
+  // Update corpses (decay, remove fully decayed)
+  {
+    ECOSIM_TICK_PHASE(Corpses);
+    w.tickCorpses();
+  }
+  
+  // PRE-PASS: Have ALL breeding creatures deposit scents BEFORE any creature acts
+  // This ensures scents from all potential mates are available during detection
+  // (Phase 2: Gradient Navigation)
+  // (currentTick already retrieved above for updateTickCache)
+  {
+    ECOSIM_TICK_PHASE(BreedingScents);
+    for (auto& creature : c) {
+      if (creature->getMotivation() == Motivation::Amorous) {
+        creature->depositBreedingScent(w.getScentLayer(), currentTick);
+      }
+    }
+  }
+
+  {
+    ECOSIM_TICK_PHASE(CreatureTurns);
+    vector<OrganismPtr> &organisms = c.organisms();
+    for (size_t i = 0; i < organisms.size(); ++i) {
+      if (!organisms[i]->isAlive()) continue;
+      takeTurn(w, gs, organisms, static_cast<unsigned int>(i));
+    }
+  }
+
+  //  Offspring from this tick's matings join as one batch, then the dead
+  //  are dropped in a single pass that keeps the survivors' turn order
+  {
+    ECOSIM_TICK_PHASE(Offspring);
+    gs.births += static_cast<unsigned>(c.collectOffspring());
+  }
+  {
+    ECOSIM_TICK_PHASE(RemoveDead);
+    c.removeDead();
+  }
+
+  gs.population = c.size ();
+}
@@ -6,10 +6,8 @@
  * It calculates descriptive statistics (min, max, mean, variance, standard deviation) for
  * all genetic traits, enabling analysis of genetic diversity and evolutionary trends.
  *
- * The implementation uses a two-pass algorithm:
- * 1. First pass: Find min/max values and accumulate sums for means
- * 2. Second pass: Calculate variances using computed means
- * 3. Finally: Compute standard deviations from variances
+ * Each trait is reduced with a Welford accumulator, so min, max, mean and
+ * variance all come out of a single pass over the population.
  */
 
 #include "../../include/statistics/genomeStats.hpp"
@@ -18,141 +16,52 @@ using std::vector;
 using std::string;
 using std::ostringstream;
 using std::endl;
-using std::sqrt;
 
 GenomeStats::GenomeStats (const vector<EcoSim::Genetics::OrganismPtr> &c, const unsigned int &t) : time(t) {
-  SGenome sumValues;
-
-  size_t cSize = c.size ();
-
-  if (cSize == 0) return;
-
-  for (size_t i = 0; i < cSize; i++) {
-    const EcoSim::Genetics::Organism& creature = *c.at(i);
-
-    checkMaxValues  (creature);
-    checkMinValues  (creature);
-    accumulateSum   (sumValues, creature);
+  if (c.empty ()) return;
+
+  RunningStat accLifespan, accSight, accFlee, accPursue;
+  RunningStat accHunger, accThirst, accMate, accComfInc, accComfDec;
+
+  for (const auto &organism : c) {
+    const EcoSim::Genetics::Organism& creature = *organism;
+
+    accLifespan.add (static_cast<float>(creature.getLifespan()));
+    accSight.add    (static_cast<float>(creature.getSightRange()));
+    accFlee.add     (static_cast<float>(creature.getFlee()));
+    accPursue.add   (static_cast<float>(creature.getPursue()));
+    accHunger.add   (creature.getTHunger());
+    accThirst.add   (creature.getTThirst());
+    accMate.add     (creature.getTMate());
+    accComfInc.add  (creature.getComfInc());
+    accComfDec.add  (creature.getComfDec());
   }
-  //  Means
-  setMeans (sumValues, cSize);
-  setVariances (c, sumValues, cSize);
-  setStdDev (cSize);
-}
-
-void GenomeStats::checkMaxValue (unsigned int &current, const unsigned int &value) {
-  if (value > current) current = value;
-}
-
-void GenomeStats::checkMaxValue (float &current, const float &value) {
-  if (value > current) current = value;
-}
 
-void GenomeStats::checkMinValue (unsigned int &current, const unsigned int &value) {
-  if (value < current) current = value;
+  setStat (lifespan, accLifespan);
+  setStat (sight,    accSight);
+  setStat (flee,     accFlee);
+  setStat (pursue,   accPursue);
+  setStat (hunger,   accHunger);
+  setStat (thirst,   accThirst);
+  setStat (mate,     accMate);
+  setStat (comfInc,  accComfInc);
+  setStat (comfDec,  accComfDec);
 }
 
-void GenomeStats::checkMinValue (float &current, const float &value) {
-  if (value < current) current = value;
-}
-
-void GenomeStats::checkMaxValues (const EcoSim::Genetics::Organism &c) {
-  checkMaxValue (lifespan.max, c.getLifespan());
-  checkMaxValue (sight.max,    c.getSightRange());
-  checkMaxValue (flee.max,     c.getFlee());
-  checkMaxValue (pursue.max,   c.getPursue());
-  checkMaxValue (hunger.max,   c.getTHunger());
-  checkMaxValue (thirst.max,   c.getTThirst());
-  checkMaxValue (mate.max,     c.getTMate());
-  checkMaxValue (comfInc.max,  c.getComfInc());
-  checkMaxValue (comfDec.max,  c.getComfDec());
-}
-
-void GenomeStats::checkMinValues (const EcoSim::Genetics::Organism &c) {
-  checkMinValue (lifespan.min, c.getLifespan());
-  checkMinValue (sight.min,    c.getSightRange());
-  checkMinValue (flee.min,     c.getFlee());
-  checkMinValue (pursue.min,   c.getPursue());
-  checkMinValue (hunger.min,   c.getTHunger());
-  checkMinValue (thirst.min,   c.getTThirst());
-  checkMinValue (mate.min,     c.getTMate());
-  checkMinValue (comfInc.min,  c.getComfInc());
-  checkMinValue (comfDec.min,  c.getComfDec());
-}
-
-void GenomeStats::accumulateSum (SGenome &sums, const EcoSim::Genetics::Organism &c) {
-  sums.lifespan += c.getLifespan();
-  sums.sight    += c.getSightRange();
-  sums.flee     += c.getFlee();
-  sums.pursue   += c.getPursue();
-  sums.hunger   += c.getTHunger();
-  sums.thirst   += c.getTThirst();
-  sums.mate     += c.getTMate();
-  sums.comfInc  += c.getComfInc();
-  sums.comfDec  += c.getComfDec();
-}
-
-void GenomeStats::setMeans (const SGenome &sums, const size_t &size) {
-  lifespan.mean  = sums.lifespan / size;
-  sight.mean     = sums.sight    / size;
-  flee.mean      = sums.flee     / size;
-  pursue.mean    = sums.pursue   / size;
-  hunger.mean    = sums.hunger   / size;
-  thirst.mean    = sums.thirst   / size;
-  mate.mean      = sums.mate     / size;
-  comfInc.mean   = sums.comfInc  / size;
-  comfDec.mean   = sums.comfDec  / size;
-}
-
-void GenomeStats::setVariances (const std::vector<EcoSim::Genetics::OrganismPtr> &c,
-                                const SGenome &sums, const size_t &size) {
-  for (size_t i = 0; i < c.size(); i++) {
-    const EcoSim::Genetics::Organism& creature = *c.at(i);
-
-    // Variance = sum of squared differences from mean
-    float lifespanDiff = creature.getLifespan() - lifespan.mean;
-    float sightDiff    = creature.getSightRange() - sight.mean;
-    float fleeDiff     = creature.getFlee()     - flee.mean;
-    float pursueDiff   = creature.getPursue()   - pursue.mean;
-    float hungerDiff   = creature.getTHunger()  - hunger.mean;
-    float thirstDiff   = creature.getTThirst()  - thirst.mean;
-    float mateDiff     = creature.getTMate()    - mate.mean;
-    float comfIncDiff  = creature.getComfInc()  - comfInc.mean;
-    float comfDecDiff  = creature.getComfDec()  - comfDec.mean;
-
-    lifespan.variance += lifespanDiff * lifespanDiff;
-    sight.variance    += sightDiff    * sightDiff;
-    flee.variance     += fleeDiff     * fleeDiff;
-    pursue.variance   += pursueDiff   * pursueDiff;
-    hunger.variance   += hungerDiff   * hungerDiff;
-    thirst.variance   += thirstDiff   * thirstDiff;
-    mate.variance     += mateDiff     * mateDiff;
-    comfInc.variance  += comfIncDiff  * comfIncDiff;
-    comfDec.variance  += comfDecDiff  * comfDecDiff;
-  }
-
-  // Divide by count to get variance
-  lifespan.variance = lifespan.variance / size;
-  sight.variance    = sight.variance    / size;
-  flee.variance     = flee.variance     / size;
-  pursue.variance   = pursue.variance   / size;
-  hunger.variance   = hunger.variance   / size;
-  thirst.variance   = thirst.variance   / size;
-  mate.variance     = mate.variance     / size;
-  comfInc.variance  = comfInc.variance  / size;
-  comfDec.variance  = comfDec.variance  / size;
+void GenomeStats::setStat (UIGeneStat &stat, const RunningStat &acc) {
+  stat.min      = static_cast<unsigned int>(acc.min);
+  stat.max      = static_cast<unsigned int>(acc.max);
+  stat.mean     = static_cast<unsigned int>(acc.mean);
+  stat.variance = static_cast<unsigned int>(acc.variance ());
+  stat.stdDev   = static_cast<unsigned int>(acc.stdDev ());
 }
 
-void GenomeStats::setStdDev (const size_t &size) {
-  lifespan.stdDev = sqrt (lifespan.variance);
-  sight.stdDev    = sqrt (sight.variance   );
-  flee.stdDev     = sqrt (flee.variance    );
-  pursue.stdDev   = sqrt (pursue.variance  );
-  hunger.stdDev   = sqrt (hunger.variance  );
-  thirst.stdDev   = sqrt (thirst.variance  );
-  mate.stdDev     = sqrt (mate.variance    );
-  comfInc.stdDev  = sqrt (comfInc.variance );
-  comfDec.stdDev  = sqrt (comfDec.variance );
+void GenomeStats::setStat (FGeneStat &stat, const RunningStat &acc) {
+  stat.min      = acc.min;
+  stat.max      = acc.max;
+  stat.mean     = static_cast<float>(acc.mean);
+  stat.variance = static_cast<float>(acc.variance ());
+  stat.stdDev   = static_cast<float>(acc.stdDev ());
 }
 
 string GenomeStats::toString(bool includeHeader) const {
@@ -0,0 +1,298 @@
+/**
+ * @file genomeStatsEngine.cpp
+ * @brief Single-pass, parallel genome statistics over every registered gene.
+ *
+ * A snapshot flattens the population into an organism x gene matrix so the
+ * reduction never touches live organisms. Each chunk of organisms is reduced
+ * with Welford accumulators (plus optional histograms and per-archetype
+ * accumulators) into its own partial result, and the partials are merged in
+ * chunk order afterwards.
+ */
+
+#include "../../include/statistics/genomeStatsEngine.hpp"
+#include "../../include/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <unordered_map>
+
+using std::size_t;
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+using EcoSim::Genetics::DominanceType;
+using EcoSim::Genetics::Gene;
+using EcoSim::Genetics::GeneRegistry;
+using EcoSim::Genetics::OrganismPtr;
+
+//================================================================================
+//  RunningStat
+//================================================================================
+void RunningStat::add (float value) {
+  count++;
+  double delta = static_cast<double>(value) - mean;
+  mean += delta / static_cast<double>(count);
+  m2   += delta * (static_cast<double>(value) - mean);
+  if (value < min) min = value;
+  if (value > max) max = value;
+}
+
+void RunningStat::merge (const RunningStat &other) {
+  if (other.count == 0) return;
+  if (count == 0) {
+    *this = other;
+    return;
+  }
+  double n     = static_cast<double>(count + other.count);
+  double delta = other.mean - mean;
+  mean += delta * static_cast<double>(other.count) / n;
+  m2   += other.m2 + delta * delta *
+          static_cast<double>(count) * static_cast<double>(other.count) / n;
+  count += other.count;
+  min = std::min (min, other.min);
+  max = std::max (max, other.max);
+}
+
+double RunningStat::stdDev () const {
+  return std::sqrt (variance ());
+}
+
+//================================================================================
+//  GenomeSnapshot
+//================================================================================
+GenomeSnapshot GenomeSnapshot::capture (const vector<OrganismPtr> &organisms,
+                                        const GeneRegistry &registry,
+                                        unsigned int t) {
+  GenomeSnapshot snap;
+  snap.time    = t;
+  snap.geneIds = registry.getAllGeneIds ();
+  std::sort (snap.geneIds.begin (), snap.geneIds.end ());
+
+  const size_t genes = snap.geneIds.size ();
+  std::unordered_map<string, uint32_t> column;
+  vector<DominanceType> dominance (genes);
+  snap.lowerLimits.resize (genes);
+  snap.upperLimits.resize (genes);
+  for (size_t g = 0; g < genes; g++) {
+    const auto &def = registry.getDefinition (snap.geneIds[g]);
+    column[snap.geneIds[g]] = static_cast<uint32_t>(g);
+    dominance[g]            = def.getDominance ();
+    snap.lowerLimits[g]     = def.getLimits ().min_value;
+    snap.upperLimits[g]     = def.getLimits ().max_value;
+  }
+
+  // Archetype labels are interned on this thread; there are only a handful
+  std::unordered_map<string, uint32_t> archetypeIndex;
+  snap.archetypeOf.resize (organisms.size ());
+  for (size_t i = 0; i < organisms.size (); i++) {
+    string label = organisms[i]->getArchetypeLabel ();
+    auto found = archetypeIndex.find (label);
+    if (found == archetypeIndex.end ()) {
+      found = archetypeIndex.emplace (label, static_cast<uint32_t>(snap.archetypes.size ())).first;
+      snap.archetypes.push_back (label);
+    }
+    snap.archetypeOf[i] = found->second;
+  }
+
+  snap.values.assign (organisms.size () * genes, std::numeric_limits<float>::quiet_NaN ());
+  if (genes == 0) return snap;
+
+  // Genomes built from the same registry share a layout, so remember the
+  // column of each (chromosome, position) and only fall back to the hash
+  // lookup when the gene found there has a different id.
+  EcoSim::parallelFor (0, organisms.size (), 512, [&](size_t first, size_t last) {
+    vector<vector<uint32_t>> layout;
+    for (size_t i = first; i < last; i++) {
+      float *row = &snap.values[i * genes];
+      size_t c = 0;
+      for (const auto &chromosome : organisms[i]->getGenome ()) {
+        if (layout.size () <= c) layout.emplace_back ();
+        vector<uint32_t> &slots = layout[c];
+        const vector<Gene> &chromosomeGenes = chromosome.getGenes ();
+        if (slots.size () < chromosomeGenes.size ()) {
+          slots.resize (chromosomeGenes.size (), static_cast<uint32_t>(genes));
+        }
+
+        for (size_t p = 0; p < chromosomeGenes.size (); p++) {
+          const Gene &gene = chromosomeGenes[p];
+          uint32_t col = slots[p];
+          if (col >= genes || snap.geneIds[col] != gene.getId ()) {
+            auto found = column.find (gene.getId ());
+            if (found == column.end ()) continue;
+            col = slots[p] = found->second;
+          }
+          row[col] = gene.getNumericValue (dominance[col]);
+        }
+        c++;
+      }
+    }
+  });
+
+  return snap;
+}
+
+//================================================================================
+//  GenomeStatsEngine
+//================================================================================
+namespace {
+  /// Everything one chunk of organisms contributes to the report.
+  struct Partial {
+    vector<RunningStat> genes;
+    vector<uint32_t>    histograms;    ///< genes x bins
+    vector<RunningStat> archetypes;    ///< archetypes x genes
+    vector<uint64_t>    archetypeCounts;
+  };
+
+  size_t binOf (float value, float lower, float upper, unsigned int bins) {
+    if (!(upper > lower)) return 0;
+    float scaled = (value - lower) / (upper - lower) * static_cast<float>(bins);
+    if (!(scaled > 0.0f)) return 0;
+    size_t bin = static_cast<size_t>(scaled);
+    return std::min (bin, static_cast<size_t>(bins - 1));
+  }
+}
+
+GenomeStatsReport GenomeStatsEngine::compute (const GenomeSnapshot &snapshot,
+                                              const GenomeStatsOptions &options) {
+  const size_t genes      = snapshot.geneCount ();
+  const size_t organisms  = snapshot.organismCount ();
+  const size_t archetypes = options.perArchetype ? snapshot.archetypes.size () : 0;
+  const unsigned int bins = options.histogramBins;
+  const size_t grain      = std::max<size_t>(options.grain, 1);
+  const size_t chunks     = (organisms + grain - 1) / grain;
+
+  vector<Partial> partials (chunks);
+
+  EcoSim::parallelFor (0, chunks, 1, [&](size_t firstChunk, size_t lastChunk) {
+    for (size_t chunk = firstChunk; chunk < lastChunk; chunk++) {
+      Partial &part = partials[chunk];
+      part.genes.assign (genes, RunningStat ());
+      part.histograms.assign (genes * bins, 0);
+      part.archetypes.assign (archetypes * genes, RunningStat ());
+      part.archetypeCounts.assign (archetypes, 0);
+
+      size_t first = chunk * grain;
+      size_t last  = std::min (organisms, first + grain);
+      for (size_t i = first; i < last; i++) {
+        const float *row = &snapshot.values[i * genes];
+        RunningStat *byArchetype = nullptr;
+        if (archetypes > 0) {
+          uint32_t a = snapshot.archetypeOf[i];
+          part.archetypeCounts[a]++;
+          byArchetype = &part.archetypes[a * genes];
+        }
+
+        for (size_t g = 0; g < genes; g++) {
+          float value = row[g];
+          if (std::isnan (value)) continue;
+          part.genes[g].add (value);
+          if (byArchetype) byArchetype[g].add (value);
+          if (bins > 0) {
+            size_t bin = binOf (value, snapshot.lowerLimits[g], snapshot.upperLimits[g], bins);
+            part.histograms[g * bins + bin]++;
+          }
+        }
+      }
+    }
+  });
+
+  GenomeStatsReport report;
+  report.time      = snapshot.time;
+  report.organisms = organisms;
+  report.genes.resize (genes);
+  for (size_t g = 0; g < genes; g++) {
+    GenomeStatsReport::GeneSummary &summary = report.genes[g];
+    summary.id    = snapshot.geneIds[g];
+    summary.lower = snapshot.lowerLimits[g];
+    summary.upper = snapshot.upperLimits[g];
+    summary.histogram.assign (bins, 0);
+  }
+  report.archetypes.resize (archetypes);
+  for (size_t a = 0; a < archetypes; a++) {
+    report.archetypes[a].label = snapshot.archetypes[a];
+    report.archetypes[a].genes.assign (genes, RunningStat ());
+  }
+
+  for (const Partial &part : partials) {
+    for (size_t g = 0; g < genes; g++) {
+      report.genes[g].stat.merge (part.genes[g]);
+      for (unsigned int b = 0; b < bins; b++) {
+        report.genes[g].histogram[b] += part.histograms[g * bins + b];
+      }
+    }
+    for (size_t a = 0; a < archetypes; a++) {
+      report.archetypes[a].organisms += part.archetypeCounts[a];
+      for (size_t g = 0; g < genes; g++) {
+        report.archetypes[a].genes[g].merge (part.archetypes[a * genes + g]);
+      }
+    }
+  }
+
+  return report;
+}
+
+std::future<GenomeStatsReport> GenomeStatsEngine::computeAsync (GenomeSnapshot snapshot,
+                                                                GenomeStatsOptions options) {
+  return std::async (std::launch::async,
+                     [snap = std::move (snapshot), options]() {
+                       return compute (snap, options);
+                     });
+}
+
+//================================================================================
+//  GenomeStatsReport
+//================================================================================
+int GenomeStatsReport::findGene (const string &id) const {
+  for (size_t g = 0; g < genes.size (); g++) {
+    if (genes[g].id == id) return static_cast<int>(g);
+  }
+  return -1;
+}
+
+namespace {
+  void writeStatRow (std::ostringstream &ss, unsigned int time, const string &archetype,
+                     const string &gene, const RunningStat &stat) {
+    ss << time << "," << archetype << "," << gene << "," << stat.count << ",";
+    if (stat.count > 0) {
+      ss << stat.min << "," << stat.max << ",";
+    } else {
+      ss << "0,0,";
+    }
+    ss << stat.mean << "," << stat.variance () << "," << stat.stdDev () << "\n";
+  }
+}
+
+string GenomeStatsReport::toString (bool includeHeader) const {
+  std::ostringstream ss;
+  if (includeHeader) {
+    ss << "Time,Archetype,Gene,Count,Min,Max,Mean,Variance,StdDev\n";
+  }
+  for (const GeneSummary &gene : genes) {
+    writeStatRow (ss, time, "All", gene.id, gene.stat);
+  }
+  for (const ArchetypeSummary &archetype : archetypes) {
+    for (size_t g = 0; g < genes.size (); g++) {
+      writeStatRow (ss, time, archetype.label, genes[g].id, archetype.genes[g]);
+    }
+  }
+  return ss.str ();
+}
+
+string GenomeStatsReport::histogramsToString (bool includeHeader) const {
+  std::ostringstream ss;
+  if (includeHeader) {
+    ss << "Time,Gene,BinLow,BinHigh,Count\n";
+  }
+  for (const GeneSummary &gene : genes) {
+    const size_t bins = gene.histogram.size ();
+    float width = bins > 0 ? (gene.upper - gene.lower) / static_cast<float>(bins) : 0.0f;
+    for (size_t b = 0; b < bins; b++) {
+      float low = gene.lower + width * static_cast<float>(b);
+      ss << time << "," << gene.id << "," << low << "," << low + width << ","
+         << gene.histogram[b] << "\n";
+    }
+  }
+  return ss.str ();
+}
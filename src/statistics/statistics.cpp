@@ -16,6 +16,7 @@
  */
 
 #include "../../include/statistics/statistics.hpp"
+#include "../../include/memoryUsage.hpp"
 
 using std::vector;
 using std::string;
@@ -32,6 +33,7 @@ void Statistics::addRecord (const GeneralStats &gs) {
     // Continue anyway as this might be valid during initialization
   }
   _records.push_back (gs);
+  _series.append (gs);
 }
 
 //================================================================================
@@ -46,6 +48,15 @@ const vector<GeneralStats>& Statistics::getRecords () const {
   return _records;
 }
 
+const TimeSeriesStore& Statistics::series () const { return _series; }
+TimeSeriesStore&       Statistics::series ()       { return _series; }
+
+size_t Statistics::memoryUsage () const {
+  return sizeof (*this) - sizeof (_series)
+       + EcoSim::Memory::heapBytes (_records)
+       + _series.memoryUsage ();
+}
+
 //================================================================================
 //  Accumulate
 //================================================================================
@@ -54,7 +65,7 @@ void Statistics::accumulate () {
   
   size_t rSize = _records.size ();
 
-  GeneralStats accum;
+  GeneralStats accum {};
   accum.calendar   = _records.at(rSize-1).calendar;
   accum.population = _records.at(rSize-1).population;
 
@@ -68,8 +79,9 @@ void Statistics::accumulate () {
     accum.deaths.predator   += record.deaths.predator;
   }
 
+  // Bypass addRecord: the summary must not be appended to the series twice
   clearRecords ();
-  addRecord (accum);
+  _records.push_back (accum);
 }
 
 void Statistics::accumulateByHour () {
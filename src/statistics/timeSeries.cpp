@@ -0,0 +1,326 @@
+/**
+ * @file timeSeries.cpp
+ * @brief Implementation of the columnar, multi-resolution statistics history.
+ *
+ * Records are appended once and folded into open hour, day and season
+ * buckets as they arrive, so no history is ever re-scanned. Each tier is a
+ * fixed-capacity ring of per-metric columns, keeping memory bounded no matter
+ * how long the simulation runs. Raw tick rows can additionally be streamed to
+ * a memory-mapped file for offline analysis.
+ */
+
+#include "../../include/statistics/timeSeries.hpp"
+#include "../../include/statistics/statistics.hpp"
+#include "../../include/memoryUsage.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::size_t;
+using std::string;
+using std::uint64_t;
+using std::vector;
+
+namespace {
+  const char STREAM_MAGIC[8] = { 'E', 'C', 'O', 'T', 'S', '0', '0', '1' };
+
+  /// Initial mapping size; doubled whenever a row would not fit.
+  const size_t STREAM_INITIAL_BYTES = 1 << 20;
+
+  MetricRow toRow (const GeneralStats &gs) {
+    MetricRow row {};
+    row[static_cast<size_t>(StatMetric::Population)] = static_cast<float>(gs.population);
+    row[static_cast<size_t>(StatMetric::Births)]     = static_cast<float>(gs.births);
+    row[static_cast<size_t>(StatMetric::FoodAte)]    = static_cast<float>(gs.foodAte);
+    row[static_cast<size_t>(StatMetric::Feeding)]    = static_cast<float>(gs.feeding);
+    row[static_cast<size_t>(StatMetric::OldAge)]     = static_cast<float>(gs.deaths.oldAge);
+    row[static_cast<size_t>(StatMetric::Starved)]    = static_cast<float>(gs.deaths.starved);
+    row[static_cast<size_t>(StatMetric::Dehydrated)] = static_cast<float>(gs.deaths.dehydrated);
+    row[static_cast<size_t>(StatMetric::Discomfort)] = static_cast<float>(gs.deaths.discomfort);
+    row[static_cast<size_t>(StatMetric::Predator)]   = static_cast<float>(gs.deaths.predator);
+    return row;
+  }
+}
+
+//================================================================================
+//  Names
+//================================================================================
+const char* statMetricName (StatMetric metric) {
+  switch (metric) {
+    case StatMetric::Population: return "Population";
+    case StatMetric::Births:     return "Births";
+    case StatMetric::FoodAte:    return "FoodAte";
+    case StatMetric::Feeding:    return "Feeding";
+    case StatMetric::OldAge:     return "OldAge";
+    case StatMetric::Starved:    return "Starved";
+    case StatMetric::Dehydrated: return "Dehydrated";
+    case StatMetric::Discomfort: return "Discomfort";
+    case StatMetric::Predator:   return "Predator";
+    default:                     return "Unknown";
+  }
+}
+
+const char* seriesTierName (SeriesTier tier) {
+  switch (tier) {
+    case SeriesTier::Tick:   return "Tick";
+    case SeriesTier::Hour:   return "Hour";
+    case SeriesTier::Day:    return "Day";
+    case SeriesTier::Season: return "Season";
+    default:                 return "Unknown";
+  }
+}
+
+//================================================================================
+//  SeriesRing
+//================================================================================
+SeriesRing::SeriesRing (size_t capacity)
+  : _capacity (std::max<size_t>(capacity, 1)), _size (0), _head (0),
+    _stamps (_capacity, 0) {
+  for (auto &col : _columns) col.assign (_capacity, 0.0f);
+}
+
+size_t SeriesRing::slot (size_t i) const {
+  return (offset () + i) % _capacity;
+}
+
+void SeriesRing::push (uint64_t stamp, const MetricRow &values) {
+  _stamps[_head] = stamp;
+  for (size_t m = 0; m < STAT_METRIC_COUNT; m++) {
+    _columns[m][_head] = values[m];
+  }
+  _head = (_head + 1) % _capacity;
+  if (_size < _capacity) _size++;
+}
+
+void SeriesRing::clear () {
+  _size = 0;
+  _head = 0;
+}
+
+size_t SeriesRing::offset () const {
+  return (_size < _capacity) ? 0 : _head;
+}
+
+const float* SeriesRing::column (StatMetric metric) const {
+  return _columns[static_cast<size_t>(metric)].data ();
+}
+
+float SeriesRing::at (StatMetric metric, size_t i) const {
+  return _columns[static_cast<size_t>(metric)][slot (i)];
+}
+
+uint64_t SeriesRing::stampAt (size_t i) const {
+  return _stamps[slot (i)];
+}
+
+size_t SeriesRing::lowerBound (uint64_t tick) const {
+  size_t lo = 0, hi = _size;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (stampAt (mid) < tick) lo = mid + 1;
+    else                      hi = mid;
+  }
+  return lo;
+}
+
+size_t SeriesRing::memoryUsage () const {
+  size_t bytes = sizeof (*this) + EcoSim::Memory::heapBytes (_stamps);
+  for (const auto &column : _columns) {
+    bytes += EcoSim::Memory::heapBytes (column);
+  }
+  return bytes;
+}
+
+//================================================================================
+//  TimeSeriesStore - Construction
+//================================================================================
+TimeSeriesStore::TimeSeriesStore (const SeriesConfig &config) : _ticks (0) {
+  _tiers.reserve (SERIES_TIER_COUNT);
+  _tiers.emplace_back (config.tickCapacity);
+  _tiers.emplace_back (config.hourCapacity);
+  _tiers.emplace_back (config.dayCapacity);
+  _tiers.emplace_back (config.seasonCapacity);
+}
+
+TimeSeriesStore::~TimeSeriesStore () {
+  closeStream ();
+}
+
+//================================================================================
+//  TimeSeriesStore - Recording
+//================================================================================
+uint64_t TimeSeriesStore::bucketKey (SeriesTier tier, const Calendar &cal) {
+  uint64_t year  = cal.getYear ();
+  uint64_t month = cal.getMonth ();
+  uint64_t day   = cal.getDay ();
+  uint64_t hour  = cal.getHour ();
+
+  switch (tier) {
+    case SeriesTier::Hour:   return (((year * 12 + month) * 32 + day) * 24) + hour;
+    case SeriesTier::Day:    return (year * 12 + month) * 32 + day;
+    case SeriesTier::Season: return year * 4 + month / 3;
+    default:                 return 0;
+  }
+}
+
+void TimeSeriesStore::fold (MetricRow &into, const MetricRow &row) {
+  for (size_t m = 0; m < STAT_METRIC_COUNT; m++) {
+    if (m == static_cast<size_t>(StatMetric::Population)) {
+      into[m] = row[m];
+    } else {
+      into[m] += row[m];
+    }
+  }
+}
+
+void TimeSeriesStore::append (const GeneralStats &gs) {
+  const MetricRow row = toRow (gs);
+  const uint64_t tick = _ticks++;
+
+  _tiers[static_cast<size_t>(SeriesTier::Tick)].push (tick, row);
+
+  for (size_t t = static_cast<size_t>(SeriesTier::Hour); t < SERIES_TIER_COUNT; t++) {
+    Bucket &bucket = _buckets[t];
+    uint64_t key = bucketKey (static_cast<SeriesTier>(t), gs.calendar);
+
+    if (bucket.open && bucket.key != key) {
+      _tiers[t].push (bucket.stamp, bucket.values);
+      bucket.open = false;
+    }
+    if (!bucket.open) {
+      bucket.open   = true;
+      bucket.key    = key;
+      bucket.stamp  = tick;
+      bucket.values = MetricRow {};
+    }
+    fold (bucket.values, row);
+  }
+
+  if (isStreaming ()) writeStream (tick, row);
+}
+
+void TimeSeriesStore::clear () {
+  for (auto &ring : _tiers) ring.clear ();
+  for (auto &bucket : _buckets) bucket = Bucket ();
+  _ticks = 0;
+}
+
+//================================================================================
+//  TimeSeriesStore - Queries
+//================================================================================
+const SeriesRing& TimeSeriesStore::tier (SeriesTier id) const {
+  return _tiers[static_cast<size_t>(id)];
+}
+
+size_t TimeSeriesStore::query (SeriesTier tierId, StatMetric metric,
+                               uint64_t fromTick, uint64_t toTick,
+                               vector<float> &out) const {
+  out.clear ();
+  const SeriesRing &ring = tier (tierId);
+  if (fromTick >= toTick) return 0;
+
+  size_t first = ring.lowerBound (fromTick);
+  size_t last  = ring.lowerBound (toTick);
+  out.reserve (last - first);
+  for (size_t i = first; i < last; i++) {
+    out.push_back (ring.at (metric, i));
+  }
+  return out.size ();
+}
+
+size_t TimeSeriesStore::latest (SeriesTier tierId, StatMetric metric, size_t count,
+                                vector<float> &out) const {
+  out.clear ();
+  const SeriesRing &ring = tier (tierId);
+  size_t n = std::min (count, ring.size ());
+  out.reserve (n);
+  for (size_t i = ring.size () - n; i < ring.size (); i++) {
+    out.push_back (ring.at (metric, i));
+  }
+  return out.size ();
+}
+
+size_t TimeSeriesStore::memoryUsage () const {
+  size_t bytes = sizeof (*this) + EcoSim::Memory::heapBytes (_tiers)
+               - _tiers.size () * sizeof (SeriesRing);
+  for (const SeriesRing &ring : _tiers) {
+    bytes += ring.memoryUsage ();
+  }
+  return bytes;
+}
+
+//================================================================================
+//  TimeSeriesStore - Memory-mapped Stream
+//================================================================================
+bool TimeSeriesStore::openStream (const string &path) {
+  closeStream ();
+
+  int fd = ::open (path.c_str (), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return false;
+
+  _stream.fd = fd;
+  if (!growStream (STREAM_INITIAL_BYTES)) {
+    ::close (fd);
+    _stream = MappedStream ();
+    return false;
+  }
+
+  std::uint32_t metricCount = static_cast<std::uint32_t>(STAT_METRIC_COUNT);
+  std::memcpy (_stream.data, STREAM_MAGIC, sizeof (STREAM_MAGIC));
+  std::memcpy (_stream.data + 8, &metricCount, sizeof (metricCount));
+  std::memset (_stream.data + 12, 0, 4);
+  std::memcpy (_stream.data + 16, &_stream.rows, sizeof (_stream.rows));
+  return true;
+}
+
+bool TimeSeriesStore::growStream (size_t bytes) {
+  if (_stream.data) {
+    ::munmap (_stream.data, _stream.mapped);
+    _stream.data = nullptr;
+  }
+  if (::ftruncate (_stream.fd, static_cast<off_t>(bytes)) != 0) return false;
+
+  void *p = ::mmap (nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _stream.fd, 0);
+  if (p == MAP_FAILED) return false;
+
+  _stream.data   = static_cast<unsigned char*>(p);
+  _stream.mapped = bytes;
+  return true;
+}
+
+void TimeSeriesStore::writeStream (uint64_t tick, const MetricRow &row) {
+  size_t offset = STREAM_HEADER_BYTES + _stream.rows * STREAM_ROW_BYTES;
+  if (offset + STREAM_ROW_BYTES > _stream.mapped) {
+    if (!growStream (_stream.mapped * 2)) {
+      closeStream ();
+      return;
+    }
+  }
+
+  std::memcpy (_stream.data + offset, &tick, sizeof (tick));
+  std::memcpy (_stream.data + offset + sizeof (tick), row.data (),
+               STAT_METRIC_COUNT * sizeof (float));
+  _stream.rows++;
+  std::memcpy (_stream.data + 16, &_stream.rows, sizeof (_stream.rows));
+}
+
+void TimeSeriesStore::closeStream () {
+  if (_stream.fd < 0) return;
+
+  size_t used = STREAM_HEADER_BYTES + _stream.rows * STREAM_ROW_BYTES;
+  if (_stream.data) {
+    ::msync (_stream.data, _stream.mapped, MS_SYNC);
+    ::munmap (_stream.data, _stream.mapped);
+  }
+  // Trim the preallocated tail so the file holds exactly the written rows
+  if (::ftruncate (_stream.fd, static_cast<off_t>(used)) != 0) {
+    // Leave the padded file in place; the header row count is authoritative
+  }
+  ::close (_stream.fd);
+  _stream = MappedStream ();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file bench_genetics.cpp
+ * @brief Benchmarks for trait lookup, genome reproduction and plant updates.
+ */
+
+#include "bench_harness.hpp"
+
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/core/Genome.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "genetics/organisms/CreatureFactory.hpp"
+#include "genetics/organisms/PlantFactory.hpp"
+#include "genetics/organisms/PlantRecordStore.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+struct GeneticsFixture {
+    std::shared_ptr<G::GeneRegistry> registry = std::make_shared<G::GeneRegistry>();
+    std::vector<G::OrganismPtr> parents;
+
+    GeneticsFixture() {
+        G::CreatureFactory factory(registry);
+        factory.registerDefaultTemplates();
+        parents.push_back(factory.createFromTemplate("grazer", 0, 0));
+        parents.push_back(factory.createFromTemplate("hunter", 0, 0));
+    }
+};
+
+GeneticsFixture& fixture() {
+    static GeneticsFixture f;
+    return f;
+}
+
+/// The same oak population as Plant objects and as compact records
+struct PlantFixture {
+    static constexpr std::size_t POPULATION = 1024;
+
+    std::vector<G::Plant> plants;
+    G::PlantRecordStore records;
+    G::EnvironmentState env;
+
+    PlantFixture() {
+        G::PlantFactory factory(fixture().registry);
+        factory.registerTemplate(G::PlantFactory::createOakTreeTemplate());
+        plants.reserve(POPULATION);
+        for (std::size_t i = 0; i < POPULATION; ++i) {
+            plants.push_back(factory.createFromTemplate("oak_tree", static_cast<int>(i), 0));
+            records.add(plants.back());
+        }
+        env.temperature = 20.0f;
+        env.humidity = 0.6f;
+        env.time_of_day = 0.5f;
+    }
+};
+
+PlantFixture& plantFixture() {
+    static PlantFixture f;
+    return f;
+}
+
+} // namespace
+
+void registerGeneticsBenchmarks(EcoSim::Bench::Registry& registry) {
+    using EcoSim::Bench::State;
+    using EcoSim::Bench::doNotOptimize;
+
+    registry.add("phenotype/get_trait", [](State& state) {
+        const G::Phenotype& phenotype = fixture().parents[0]->getPhenotype();
+        const std::array<std::string, 4> traits = {
+            G::UniversalGenes::LOCOMOTION, G::UniversalGenes::SIGHT_RANGE,
+            G::UniversalGenes::MAX_SIZE, G::UniversalGenes::METABOLISM_RATE};
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            doNotOptimize(phenotype.getTrait(traits[i % traits.size()]));
+        }
+    });
+
+    registry.add("genome/crossover", [](State& state) {
+        const G::Genome& a = fixture().parents[0]->getGenome();
+        const G::Genome& b = fixture().parents[1]->getGenome();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            G::Genome child = G::Genome::crossover(a, b, 0.5f);
+            doNotOptimize(child);
+        }
+    });
+
+    registry.add("genome/mutate", [](State& state) {
+        G::Genome genome = fixture().parents[0]->getGenome();
+        const auto& definitions = fixture().registry->getAllDefinitions();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            genome.mutate(0.05f, definitions);
+        }
+        doNotOptimize(genome);
+    });
+
+    registry.add("genome/compare", [](State& state) {
+        const G::Genome& a = fixture().parents[0]->getGenome();
+        const G::Genome& b = fixture().parents[1]->getGenome();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            doNotOptimize(a.compare(b));
+        }
+    });
+
+    registry.add("plant/update", [](State& state) {
+        PlantFixture& f = plantFixture();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            G::Plant& plant = f.plants[i % PlantFixture::POPULATION];
+            plant.update(f.env);
+            doNotOptimize(plant.getCurrentSize());
+        }
+    });
+
+    registry.add("plant_records/update", [](State& state) {
+        PlantFixture& f = plantFixture();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            const std::size_t index = i % PlantFixture::POPULATION;
+            f.records.update(index, f.env);
+            doNotOptimize(f.records[index].currentSize);
+        }
+    });
+}
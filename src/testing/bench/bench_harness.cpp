@@ -0,0 +1,210 @@
+/**
+ * @file bench_harness.cpp
+ * @brief Sampling, statistics and baseline comparison for ecosim_bench.
+ */
+
+#include "bench_harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+namespace EcoSim {
+namespace Bench {
+
+namespace {
+
+// Calibration stops growing the iteration count past this, so a body that
+// is cheaper than the clock resolution still terminates
+constexpr std::size_t MAX_ITERATIONS = std::size_t(1) << 30;
+
+/**
+ * @brief Run one sample and return its duration in seconds
+ */
+double sample(const Benchmark& benchmark, std::size_t iterations, double& items) {
+    State state(iterations);
+    auto start = std::chrono::steady_clock::now();
+    benchmark.body(state);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    double seconds = state.hasManualTime() ? state.manualSeconds() : elapsed.count();
+    items = state.items();
+    return seconds;
+}
+
+std::string formatNs(double ns) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(ns < 10.0 ? 2 : 1);
+    if (ns >= 1e9) {
+        out << ns / 1e9 << " s";
+    } else if (ns >= 1e6) {
+        out << ns / 1e6 << " ms";
+    } else if (ns >= 1e3) {
+        out << ns / 1e3 << " us";
+    } else {
+        out << ns << " ns";
+    }
+    return out.str();
+}
+
+} // namespace
+
+// ============================================================================
+// Running
+// ============================================================================
+
+Result run(const Benchmark& benchmark, const Options& options) {
+    // The first call also builds any lazily created fixture, so it is not
+    // used for calibration
+    double items = 0.0;
+    sample(benchmark, 1, items);
+
+    // Grow the iteration count until a sample fills minTime
+    std::size_t iterations = 1;
+    while (iterations < MAX_ITERATIONS) {
+        double seconds = sample(benchmark, iterations, items);
+        if (seconds >= options.minTime) break;
+
+        double scale = seconds > 0.0 ? options.minTime / seconds * 1.4 : 10.0;
+        scale = std::clamp(scale, 2.0, 10.0);
+        iterations = static_cast<std::size_t>(static_cast<double>(iterations) * scale);
+    }
+    iterations = std::min(iterations, MAX_ITERATIONS);
+
+    for (int i = 0; i < options.warmup; ++i) {
+        sample(benchmark, iterations, items);
+    }
+
+    const int repetitions = std::max(1, options.repetitions);
+    std::vector<double> perOp;
+    double totalSeconds = 0.0;
+    double totalItems = 0.0;
+    perOp.reserve(static_cast<std::size_t>(repetitions));
+    for (int i = 0; i < repetitions; ++i) {
+        double seconds = sample(benchmark, iterations, items);
+        perOp.push_back(seconds * 1e9 / static_cast<double>(iterations));
+        totalSeconds += seconds;
+        totalItems += items;
+    }
+
+    Result result;
+    result.name = benchmark.name;
+    result.iterations = iterations;
+    result.repetitions = repetitions;
+
+    std::vector<double> sorted = perOp;
+    std::sort(sorted.begin(), sorted.end());
+    const std::size_t n = sorted.size();
+    result.medianNs = (n % 2 == 1) ? sorted[n / 2]
+                                   : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+    result.minNs = sorted.front();
+    result.maxNs = sorted.back();
+    result.meanNs = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(n);
+
+    double variance = 0.0;
+    for (double v : sorted) {
+        variance += (v - result.meanNs) * (v - result.meanNs);
+    }
+    result.stddevNs = n > 1 ? std::sqrt(variance / static_cast<double>(n - 1)) : 0.0;
+
+    if (totalItems > 0.0 && totalSeconds > 0.0) {
+        result.itemsPerSecond = totalItems / totalSeconds;
+    }
+    return result;
+}
+
+// ============================================================================
+// JSON and baselines
+// ============================================================================
+
+nlohmann::json toJson(const std::vector<Result>& results, const Options& options) {
+    nlohmann::json doc;
+    doc["context"] = {
+        {"warmup", options.warmup},
+        {"repetitions", options.repetitions},
+        {"min_time", options.minTime}
+    };
+
+    nlohmann::json list = nlohmann::json::array();
+    for (const Result& r : results) {
+        list.push_back({
+            {"name", r.name},
+            {"iterations", r.iterations},
+            {"repetitions", r.repetitions},
+            {"median_ns", r.medianNs},
+            {"mean_ns", r.meanNs},
+            {"stddev_ns", r.stddevNs},
+            {"min_ns", r.minNs},
+            {"max_ns", r.maxNs},
+            {"items_per_second", r.itemsPerSecond}
+        });
+    }
+    doc["benchmarks"] = list;
+    return doc;
+}
+
+std::vector<Comparison> compare(const std::vector<Result>& results,
+                                const nlohmann::json& baseline,
+                                double threshold) {
+    std::unordered_map<std::string, double> baselineMedians;
+    if (baseline.contains("benchmarks") && baseline["benchmarks"].is_array()) {
+        for (const auto& entry : baseline["benchmarks"]) {
+            if (entry.contains("name") && entry.contains("median_ns")) {
+                baselineMedians[entry["name"].get<std::string>()] =
+                    entry["median_ns"].get<double>();
+            }
+        }
+    }
+
+    std::vector<Comparison> comparisons;
+    for (const Result& r : results) {
+        auto it = baselineMedians.find(r.name);
+        if (it == baselineMedians.end() || it->second <= 0.0) continue;
+
+        Comparison c;
+        c.name = r.name;
+        c.baselineNs = it->second;
+        c.currentNs = r.medianNs;
+        c.change = (c.currentNs - c.baselineNs) / c.baselineNs;
+        c.regression = c.change > threshold;
+        comparisons.push_back(c);
+    }
+    return comparisons;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void printResult(const Result& r) {
+    std::cout << std::left << std::setw(44) << r.name << std::right
+              << std::setw(12) << formatNs(r.medianNs)
+              << std::setw(12) << formatNs(r.meanNs)
+              << std::setw(8) << std::fixed << std::setprecision(1)
+              << (r.meanNs > 0.0 ? r.stddevNs / r.meanNs * 100.0 : 0.0) << "%"
+              << std::setw(12) << formatNs(r.minNs)
+              << std::setw(12) << r.iterations;
+    if (r.itemsPerSecond > 0.0) {
+        std::cout << "  " << std::setprecision(0) << r.itemsPerSecond << " items/s";
+    }
+    std::cout << std::endl;
+}
+
+void printComparisons(const std::vector<Comparison>& comparisons) {
+    for (const Comparison& c : comparisons) {
+        std::cout << std::left << std::setw(44) << c.name << std::right
+                  << std::setw(12) << formatNs(c.baselineNs)
+                  << std::setw(12) << formatNs(c.currentNs)
+                  << std::setw(9) << std::showpos << std::fixed << std::setprecision(1)
+                  << c.change * 100.0 << "%" << std::noshowpos
+                  << (c.regression ? "  REGRESSION" : "") << std::endl;
+    }
+}
+
+} // namespace Bench
+} // namespace EcoSim
@@ -0,0 +1,156 @@
+/**
+ * @file bench_harness.hpp
+ * @brief Minimal microbenchmark harness for the ecosim_bench target.
+ *
+ * A benchmark is a named body that runs an operation state.iterations()
+ * times. The harness makes one priming call (which builds any lazily
+ * created fixture), grows the iteration count until one sample takes at
+ * least minTime, runs the warmup samples, then records the timed
+ * repetitions and reports per-operation statistics over them.
+ *
+ * Results can be written as JSON and compared against an earlier JSON
+ * file; a median slower than the baseline by more than the threshold is
+ * reported as a regression.
+ */
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace EcoSim {
+namespace Bench {
+
+/**
+ * @brief Keep a value (and the work producing it) from being optimised out
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Per-sample state handed to a benchmark body
+ */
+class State {
+public:
+    explicit State(std::size_t iterations) : iterations_(iterations) {}
+
+    /** @brief Number of operations the body must run */
+    std::size_t iterations() const { return iterations_; }
+
+    /**
+     * @brief Count processed items (creatures, tiles, ...) for items/s
+     */
+    void addItems(double items) { items_ += items; }
+
+    /**
+     * @brief Report time measured by the body itself
+     *
+     * When a body reports any manual time, the sample uses the sum of it
+     * instead of the wall time of the whole body; for operations that need
+     * untimed setup or are timed by the code under test.
+     */
+    void addManualTime(double seconds) { manualSeconds_ += seconds; manual_ = true; }
+
+    double items() const { return items_; }
+    bool hasManualTime() const { return manual_; }
+    double manualSeconds() const { return manualSeconds_; }
+
+private:
+    std::size_t iterations_;
+    double items_ = 0.0;
+    double manualSeconds_ = 0.0;
+    bool manual_ = false;
+};
+
+using BenchmarkBody = std::function<void(State&)>;
+
+struct Benchmark {
+    std::string name;
+    BenchmarkBody body;
+};
+
+/**
+ * @brief Benchmarks in registration order
+ */
+class Registry {
+public:
+    void add(const std::string& name, BenchmarkBody body) {
+        benchmarks_.push_back({name, std::move(body)});
+    }
+
+    const std::vector<Benchmark>& benchmarks() const { return benchmarks_; }
+
+private:
+    std::vector<Benchmark> benchmarks_;
+};
+
+struct Options {
+    std::string filter;             ///< Substring a name must contain
+    int warmup = 1;                 ///< Untimed samples after calibration
+    int repetitions = 10;           ///< Timed samples
+    double minTime = 0.05;          ///< Seconds per sample to calibrate to
+    std::string jsonPath;           ///< Write results here when set
+    std::string baselinePath;       ///< Compare against this JSON when set
+    double threshold = 0.10;        ///< Allowed median slowdown (fraction)
+};
+
+/**
+ * @brief Statistics of one benchmark, per operation
+ */
+struct Result {
+    std::string name;
+    std::size_t iterations = 0;     ///< Operations per sample
+    int repetitions = 0;
+    double medianNs = 0.0;
+    double meanNs = 0.0;
+    double stddevNs = 0.0;
+    double minNs = 0.0;
+    double maxNs = 0.0;
+    double itemsPerSecond = 0.0;    ///< 0 when the body counts no items
+};
+
+/**
+ * @brief Median change of one benchmark against the baseline
+ */
+struct Comparison {
+    std::string name;
+    double baselineNs = 0.0;
+    double currentNs = 0.0;
+    double change = 0.0;            ///< (current - baseline) / baseline
+    bool regression = false;
+};
+
+/**
+ * @brief Calibrate, warm up and time one benchmark
+ */
+Result run(const Benchmark& benchmark, const Options& options);
+
+nlohmann::json toJson(const std::vector<Result>& results, const Options& options);
+
+/**
+ * @brief Compare results with a JSON document written by toJson()
+ *
+ * Benchmarks missing from either side are skipped.
+ */
+std::vector<Comparison> compare(const std::vector<Result>& results,
+                                const nlohmann::json& baseline,
+                                double threshold);
+
+/** @brief One aligned line per result */
+void printResult(const Result& result);
+
+void printComparisons(const std::vector<Comparison>& comparisons);
+
+} // namespace Bench
+} // namespace EcoSim
@@ -0,0 +1,178 @@
+/**
+ * EcoSim Microbenchmarks
+ *
+ * Times the hot-path subsystems in isolation: spatial indexes, scent layer,
+ * trait lookup, genome reproduction, pathfinding, world generation stages
+ * and whole ticks at several population sizes.
+ *
+ * Usage:
+ *   ./ecosim_bench [options]
+ *
+ * Options:
+ *   --filter TEXT      Only run benchmarks whose name contains TEXT
+ *   --list             List benchmark names and exit
+ *   --reps N           Timed repetitions per benchmark (default: 10)
+ *   --warmup N         Untimed samples before timing (default: 1)
+ *   --min-time SEC     Minimum duration of one sample (default: 0.05)
+ *   --quick            3 repetitions, no warmup, short samples (smoke run)
+ *   --json PATH        Write results as JSON
+ *   --baseline PATH    Compare medians with an earlier --json file
+ *   --threshold PCT    Slowdown flagged as a regression (default: 10)
+ *
+ * Exits with 1 when a benchmark regressed past the threshold.
+ */
+
+#include "bench_harness.hpp"
+
+#include "objects/creature/creature.hpp"
+#include "logging/Logger.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+extern void registerSpatialBenchmarks(EcoSim::Bench::Registry& registry);
+extern void registerGeneticsBenchmarks(EcoSim::Bench::Registry& registry);
+extern void registerWorldBenchmarks(EcoSim::Bench::Registry& registry);
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --filter TEXT      Only run benchmarks whose name contains TEXT\n"
+              << "  --list             List benchmark names and exit\n"
+              << "  --reps N           Timed repetitions per benchmark (default: 10)\n"
+              << "  --warmup N         Untimed samples before timing (default: 1)\n"
+              << "  --min-time SEC     Minimum duration of one sample (default: 0.05)\n"
+              << "  --quick            3 repetitions, no warmup, short samples\n"
+              << "  --json PATH        Write results as JSON\n"
+              << "  --baseline PATH    Compare medians with an earlier --json file\n"
+              << "  --threshold PCT    Slowdown flagged as a regression (default: 10)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    EcoSim::Bench::Options options;
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--filter") {
+            options.filter = value();
+        } else if (arg == "--list") {
+            list = true;
+        } else if (arg == "--reps") {
+            options.repetitions = std::atoi(value().c_str());
+        } else if (arg == "--warmup") {
+            options.warmup = std::atoi(value().c_str());
+        } else if (arg == "--min-time") {
+            options.minTime = std::atof(value().c_str());
+        } else if (arg == "--quick") {
+            options.repetitions = 3;
+            options.warmup = 0;
+            options.minTime = 0.002;
+        } else if (arg == "--json") {
+            options.jsonPath = value();
+        } else if (arg == "--baseline") {
+            options.baselinePath = value();
+        } else if (arg == "--threshold") {
+            options.threshold = std::atof(value().c_str()) / 100.0;
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    // Organism events would otherwise be logged from inside timed loops
+    logging::LoggerConfig logConfig;
+    logConfig.minLevel = logging::LogLevel::ERROR;
+    logConfig.consoleOutput = false;
+    logConfig.fileOutput = false;
+    logging::Logger::getInstance().configure(logConfig);
+
+    Creature::initializeGeneRegistry();
+    Creature::initializeInteractionSystems();
+
+    EcoSim::Bench::Registry registry;
+    registerSpatialBenchmarks(registry);
+    registerGeneticsBenchmarks(registry);
+    registerWorldBenchmarks(registry);
+
+    std::vector<const EcoSim::Bench::Benchmark*> selected;
+    for (const auto& benchmark : registry.benchmarks()) {
+        if (benchmark.name.find(options.filter) != std::string::npos) {
+            selected.push_back(&benchmark);
+        }
+    }
+
+    if (list) {
+        for (const auto* benchmark : selected) {
+            std::cout << benchmark->name << "\n";
+        }
+        return 0;
+    }
+
+    // Load the baseline up front so a bad path fails before the long run
+    nlohmann::json baseline;
+    if (!options.baselinePath.empty()) {
+        std::ifstream in(options.baselinePath);
+        baseline = nlohmann::json::parse(in, nullptr, false);
+        if (!in || baseline.is_discarded()) {
+            std::cerr << "Could not read baseline " << options.baselinePath << "\n";
+            return 2;
+        }
+    }
+
+    std::cout << std::left << std::setw(44) << "benchmark" << std::right
+              << std::setw(12) << "median" << std::setw(12) << "mean"
+              << std::setw(9) << "cv" << std::setw(12) << "min"
+              << std::setw(12) << "iterations" << "\n";
+
+    std::vector<EcoSim::Bench::Result> results;
+    for (const auto* benchmark : selected) {
+        results.push_back(EcoSim::Bench::run(*benchmark, options));
+        EcoSim::Bench::printResult(results.back());
+    }
+
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        out << EcoSim::Bench::toJson(results, options).dump(2) << "\n";
+        if (!out) {
+            std::cerr << "Could not write " << options.jsonPath << "\n";
+            return 2;
+        }
+    }
+
+    if (options.baselinePath.empty()) return 0;
+
+    auto comparisons = EcoSim::Bench::compare(results, baseline, options.threshold);
+    std::cout << "\nAgainst " << options.baselinePath << " (threshold "
+              << options.threshold * 100.0 << "%):\n";
+    EcoSim::Bench::printComparisons(comparisons);
+
+    int regressions = 0;
+    for (const auto& c : comparisons) {
+        if (c.regression) ++regressions;
+    }
+    if (regressions > 0) {
+        std::cout << regressions << " benchmark(s) regressed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+/**
+ * @file bench_spatial.cpp
+ * @brief Benchmarks for the creature and plant spatial indexes and the
+ *        scent layer.
+ */
+
+#include "bench_harness.hpp"
+
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/core/RandomStream.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "genetics/organisms/CreatureFactory.hpp"
+#include "genetics/organisms/Plant.hpp"
+#include "world/PlantSpatialIndex.hpp"
+#include "world/ScentLayer.hpp"
+#include "world/SpatialIndex.hpp"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+constexpr int WORLD_SIZE = 500;
+constexpr std::uint64_t SEED = 2024;
+constexpr std::size_t QUERY_POINTS = 1024;
+
+struct Point {
+    float x;
+    float y;
+};
+
+std::vector<Point> queryPoints() {
+    G::RandomStream rng(SEED, G::RandomSystem::Engine, 1);
+    std::vector<Point> points(QUERY_POINTS);
+    for (auto& p : points) {
+        p.x = rng.uniform(0.0f, static_cast<float>(WORLD_SIZE));
+        p.y = rng.uniform(0.0f, static_cast<float>(WORLD_SIZE));
+    }
+    return points;
+}
+
+/**
+ * @brief Creatures scattered uniformly over the world, built on first use
+ */
+std::vector<G::OrganismPtr>& creatures(std::size_t count) {
+    static std::vector<std::unique_ptr<std::vector<G::OrganismPtr>>> cache;
+    for (auto& population : cache) {
+        if (population->size() == count) return *population;
+    }
+
+    G::CreatureFactory factory(std::make_shared<G::GeneRegistry>());
+    factory.registerDefaultTemplates();
+    const std::array<const char*, 4> templates = {"grazer", "browser", "hunter", "forager"};
+
+    G::RandomStream rng(SEED, G::RandomSystem::Spawning, count);
+    auto population = std::make_unique<std::vector<G::OrganismPtr>>();
+    for (std::size_t i = 0; i < count; ++i) {
+        population->push_back(factory.createFromTemplate(
+            templates[i % templates.size()],
+            rng.uniformInt(0, WORLD_SIZE - 1), rng.uniformInt(0, WORLD_SIZE - 1)));
+    }
+    cache.push_back(std::move(population));
+    return *cache.back();
+}
+
+struct PlantField {
+    G::GeneRegistry registry;
+    std::vector<std::unique_ptr<G::Plant>> plants;
+
+    explicit PlantField(std::size_t count) {
+        G::UniversalGenes::registerDefaults(registry);
+        G::RandomStream rng(SEED, G::RandomSystem::Plants);
+        for (std::size_t i = 0; i < count; ++i) {
+            plants.push_back(std::make_unique<G::Plant>(
+                rng.uniformInt(0, WORLD_SIZE - 1), rng.uniformInt(0, WORLD_SIZE - 1), registry));
+        }
+    }
+};
+
+PlantField& plantField() {
+    static PlantField field(20000);
+    return field;
+}
+
+EcoSim::ScentLayer filledScentLayer(std::size_t deposits) {
+    EcoSim::ScentLayer layer(WORLD_SIZE, WORLD_SIZE);
+    G::RandomStream rng(SEED, G::RandomSystem::Engine, 2);
+    std::array<float, 8> signature{};
+    for (std::size_t i = 0; i < deposits; ++i) {
+        signature[i % signature.size()] = rng.uniform();
+        layer.deposit(rng.uniformInt(0, WORLD_SIZE - 1), rng.uniformInt(0, WORLD_SIZE - 1),
+                      EcoSim::ScentDeposit(EcoSim::ScentType::MATE_SEEKING,
+                                           static_cast<int>(i), rng.uniform(0.2f, 1.0f),
+                                           signature, 0, 200));
+    }
+    return layer;
+}
+
+} // namespace
+
+void registerSpatialBenchmarks(EcoSim::Bench::Registry& registry) {
+    using EcoSim::Bench::State;
+    using EcoSim::Bench::doNotOptimize;
+
+    // ------------------------------------------------------------------------
+    // SpatialIndex
+    // ------------------------------------------------------------------------
+    for (std::size_t count : {500u, 2000u, 8000u}) {
+        registry.add("spatial_index/rebuild/" + std::to_string(count), [count](State& state) {
+            auto& population = creatures(count);
+            EcoSim::SpatialIndex index(WORLD_SIZE, WORLD_SIZE);
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                index.rebuild(population);
+                doNotOptimize(index.size());
+            }
+            state.addItems(static_cast<double>(count * state.iterations()));
+        });
+    }
+
+    for (float radius : {8.0f, 32.0f}) {
+        registry.add("spatial_index/query_radius/r" + std::to_string(static_cast<int>(radius)),
+                     [radius](State& state) {
+            EcoSim::SpatialIndex index(WORLD_SIZE, WORLD_SIZE);
+            index.rebuild(creatures(2000));
+            static const std::vector<Point> points = queryPoints();
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                const Point& p = points[i % points.size()];
+                auto found = index.queryRadius(p.x, p.y, radius);
+                doNotOptimize(found.size());
+            }
+        });
+    }
+
+    registry.add("spatial_index/find_nearest", [](State& state) {
+        EcoSim::SpatialIndex index(WORLD_SIZE, WORLD_SIZE);
+        index.rebuild(creatures(2000));
+        static const std::vector<Point> points = queryPoints();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            const Point& p = points[i % points.size()];
+            auto* nearest = index.findNearest(p.x, p.y, 32.0f,
+                [](const G::Organism* o) { return o->isAlive(); });
+            doNotOptimize(nearest);
+        }
+    });
+
+    // ------------------------------------------------------------------------
+    // PlantSpatialIndex
+    // ------------------------------------------------------------------------
+    registry.add("plant_spatial_index/insert_all", [](State& state) {
+        auto& field = plantField();
+        EcoSim::PlantSpatialIndex index(WORLD_SIZE, WORLD_SIZE);
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            index.clear();
+            for (auto& plant : field.plants) {
+                index.insert(plant.get(), plant->getX(), plant->getY());
+            }
+            doNotOptimize(index.size());
+        }
+        state.addItems(static_cast<double>(field.plants.size() * state.iterations()));
+    });
+
+    for (float radius : {5.0f, 15.0f}) {
+        registry.add("plant_spatial_index/query_radius/r" + std::to_string(static_cast<int>(radius)),
+                     [radius](State& state) {
+            auto& field = plantField();
+            EcoSim::PlantSpatialIndex index(WORLD_SIZE, WORLD_SIZE);
+            for (auto& plant : field.plants) {
+                index.insert(plant.get(), plant->getX(), plant->getY());
+            }
+            static const std::vector<Point> points = queryPoints();
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                const Point& p = points[i % points.size()];
+                auto found = index.queryRadius(p.x, p.y, radius);
+                doNotOptimize(found.size());
+            }
+        });
+    }
+
+    // ------------------------------------------------------------------------
+    // ScentLayer
+    // ------------------------------------------------------------------------
+    registry.add("scent_layer/deposit", [](State& state) {
+        EcoSim::ScentLayer layer(WORLD_SIZE, WORLD_SIZE);
+        G::RandomStream rng(SEED, G::RandomSystem::Engine, 3);
+        const std::array<float, 8> signature{0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f};
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            layer.deposit(rng.uniformInt(0, WORLD_SIZE - 1), rng.uniformInt(0, WORLD_SIZE - 1),
+                          EcoSim::ScentDeposit(EcoSim::ScentType::MATE_SEEKING,
+                                               static_cast<int>(i % 1000), 0.8f,
+                                               signature, 0, 200));
+        }
+        doNotOptimize(layer);
+    });
+
+    registry.add("scent_layer/query_radius", [](State& state) {
+        static const EcoSim::ScentLayer layer = filledScentLayer(20000);
+        static const std::vector<Point> points = queryPoints();
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            const Point& p = points[i % points.size()];
+            auto found = layer.getScentsInRadius(static_cast<int>(p.x), static_cast<int>(p.y),
+                                                 10, EcoSim::ScentType::MATE_SEEKING);
+            doNotOptimize(found.size());
+        }
+    });
+
+    // Decay only runs every decayInterval ticks and empties the layer over
+    // time, so each operation decays a fresh copy; the copy is not timed
+    registry.add("scent_layer/decay/20000", [](State& state) {
+        static const EcoSim::ScentLayer filled = filledScentLayer(20000);
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            EcoSim::ScentLayer layer = filled;
+            auto start = std::chrono::steady_clock::now();
+            layer.update(10);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            state.addManualTime(elapsed.count());
+            doNotOptimize(layer);
+        }
+        state.addItems(20000.0 * static_cast<double>(state.iterations()));
+    });
+}
@@ -0,0 +1,244 @@
+/**
+ * @file bench_world.cpp
+ * @brief Benchmarks for pathfinding, world generation and whole ticks.
+ */
+
+#include "bench_harness.hpp"
+
+#include "simulationTick.hpp"
+#include "world/world.hpp"
+#include "world/ClimateWorldGenerator.hpp"
+#include "objects/creature/navigator.hpp"
+#include "genetics/core/RandomEngine.hpp"
+#include "genetics/core/RandomStream.hpp"
+#include "genetics/organisms/CreatureFactory.hpp"
+#include "genetics/organisms/OrganismStore.hpp"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+constexpr unsigned MAP_SIZE = 200;
+constexpr std::uint64_t SEED = 42;
+
+// World is built in place: its subsystems point at each other, so it must
+// not be moved after construction
+std::unique_ptr<World> makeWorld() {
+    MapGen mg {
+        static_cast<double>(SEED),
+        0.0035,   // scale
+        4.0,      // frequency
+        0.8,      // exponent
+        64,       // terraces
+        MAP_SIZE,
+        MAP_SIZE,
+        false     // not wrapped
+    };
+    OctaveGen og { 2, 0.25, 0.5, 2 };
+    return std::make_unique<World>(mg, og);
+}
+
+bool passable(World& world, int x, int y) {
+    return world.getGrid()[static_cast<std::size_t>(x)][static_cast<std::size_t>(y)].isPassable();
+}
+
+// ============================================================================
+// Pathfinding
+// ============================================================================
+
+struct PathFixture {
+    std::unique_ptr<World> world = makeWorld();
+    G::OrganismPtr walker;
+
+    struct Route {
+        int startX, startY, endX, endY;
+    };
+
+    PathFixture() {
+        G::CreatureFactory factory(std::make_shared<G::GeneRegistry>());
+        factory.registerDefaultTemplates();
+        walker = factory.createFromTemplate("grazer", 0, 0);
+    }
+
+    /**
+     * @brief A reachable route whose ends are about distance tiles apart
+     */
+    Route findRoute(int distance) {
+        const int rows = static_cast<int>(world->getRows());
+        const int cols = static_cast<int>(world->getCols());
+        G::RandomStream rng(SEED, G::RandomSystem::Navigation, static_cast<std::uint64_t>(distance));
+
+        for (int attempt = 0; attempt < 10000; ++attempt) {
+            Route r;
+            r.startX = rng.uniformInt(0, cols - 1);
+            r.startY = rng.uniformInt(0, rows - 1);
+            r.endX = r.startX + distance;
+            r.endY = r.startY + rng.uniformInt(-distance / 2, distance / 2);
+            if (r.endX >= cols || r.endY < 0 || r.endY >= rows) continue;
+            if (!passable(*world, r.startX, r.startY) || !passable(*world, r.endX, r.endY)) continue;
+
+            if (search(r)) return r;
+        }
+        return Route{0, 0, 0, 0};
+    }
+
+    bool search(const Route& r) {
+        walker->setXY(r.startX, r.startY);
+        const int rows = static_cast<int>(world->getRows());
+        const int cols = static_cast<int>(world->getCols());
+        return Navigator::astarSearch(*walker, world->getGrid(), rows, cols, r.endX, r.endY);
+    }
+};
+
+PathFixture& pathFixture() {
+    static PathFixture f;
+    return f;
+}
+
+const PathFixture::Route& route(int distance) {
+    static std::map<int, PathFixture::Route> routes;
+    auto it = routes.find(distance);
+    if (it == routes.end()) {
+        it = routes.emplace(distance, pathFixture().findRoute(distance)).first;
+    }
+    return it->second;
+}
+
+// ============================================================================
+// Simulation ticks
+// ============================================================================
+
+/**
+ * @brief A populated world advanced one tick at a time by the game's
+ *        advanceSimulation()
+ */
+struct TickFixture {
+    std::unique_ptr<World> world;
+    G::OrganismStore creatures;
+
+    explicit TickFixture(std::size_t population) {
+        G::RandomEngine::seed(SEED);
+        world = makeWorld();
+        world->plants().initialize();
+        world->plants().addPlants(165, 200, 5, "grass");
+        world->plants().addPlants(170, 190, 3, "berry_bush");
+
+        G::CreatureFactory factory(std::make_shared<G::GeneRegistry>());
+        factory.registerDefaultTemplates();
+        const std::array<const char*, 4> templates = {"grazer", "browser", "hunter", "forager"};
+
+        G::RandomStream rng(SEED, G::RandomSystem::Spawning, population);
+        for (std::size_t i = 0; i < population; ++i) {
+            int x = 0;
+            int y = 0;
+            for (int attempt = 0; attempt < 10000; ++attempt) {
+                x = rng.uniformInt(0, static_cast<int>(MAP_SIZE) - 1);
+                y = rng.uniformInt(0, static_cast<int>(MAP_SIZE) - 1);
+                if (passable(*world, x, y)) break;
+            }
+            creatures.insert(factory.createFromTemplate(templates[i % templates.size()], x, y));
+        }
+    }
+
+    void step() {
+        GeneralStats stats{};
+        advanceSimulation(*world, creatures, stats);
+    }
+};
+
+TickFixture& tickFixture(std::size_t population) {
+    static std::map<std::size_t, std::unique_ptr<TickFixture>> fixtures;
+    auto& f = fixtures[population];
+    if (!f) f = std::make_unique<TickFixture>(population);
+    return *f;
+}
+
+// ============================================================================
+// World generation
+// ============================================================================
+
+EcoSim::ClimateGeneratorConfig generatorConfig() {
+    EcoSim::ClimateGeneratorConfig config;
+    config.width = MAP_SIZE;
+    config.height = MAP_SIZE;
+    config.seed = static_cast<unsigned int>(SEED);
+    return config;
+}
+
+const std::array<const char*, 12> GENERATOR_STAGES = {
+    "initialize", "plate_ridges", "continents", "elevation", "inland_seas",
+    "temperature", "water_distance", "rain_shadow", "moisture", "biomes",
+    "rivers", "apply"
+};
+
+} // namespace
+
+void registerWorldBenchmarks(EcoSim::Bench::Registry& registry) {
+    using EcoSim::Bench::State;
+    using EcoSim::Bench::doNotOptimize;
+
+    // ------------------------------------------------------------------------
+    // Navigator::astarSearch
+    // ------------------------------------------------------------------------
+    for (int distance : {10, 40, 120}) {
+        registry.add("navigator/astar/" + std::to_string(distance), [distance](State& state) {
+            auto& f = pathFixture();
+            const PathFixture::Route& r = route(distance);
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                doNotOptimize(f.search(r));
+            }
+        });
+    }
+
+    // ------------------------------------------------------------------------
+    // ClimateWorldGenerator
+    // ------------------------------------------------------------------------
+    registry.add("worldgen/total", [](State& state) {
+        EcoSim::ClimateWorldGenerator generator(generatorConfig());
+        EcoSim::WorldGrid grid;
+        for (std::size_t i = 0; i < state.iterations(); ++i) {
+            generator.generate(grid, static_cast<unsigned int>(SEED));
+            doNotOptimize(grid);
+        }
+        state.addItems(static_cast<double>(MAP_SIZE * MAP_SIZE * state.iterations()));
+    });
+
+    // Stages are private, so each runs as part of a full generation and is
+    // timed by the generator itself
+    for (const char* stage : GENERATOR_STAGES) {
+        const std::string name = stage;
+        registry.add("worldgen/" + name, [name](State& state) {
+            EcoSim::ClimateWorldGenerator generator(generatorConfig());
+            EcoSim::WorldGrid grid;
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                generator.generate(grid, static_cast<unsigned int>(SEED));
+                for (const auto& timing : generator.getStageTimings()) {
+                    if (name == timing.stage) {
+                        state.addManualTime(timing.milliseconds / 1000.0);
+                    }
+                }
+            }
+        });
+    }
+
+    // ------------------------------------------------------------------------
+    // Full simulation tick
+    // ------------------------------------------------------------------------
+    // The world keeps evolving between samples; items are creature turns,
+    // so creature turns/s stays comparable as the population drifts
+    for (std::size_t population : {100u, 500u, 2000u}) {
+        registry.add("tick/" + std::to_string(population), [population](State& state) {
+            TickFixture& f = tickFixture(population);
+            for (std::size_t i = 0; i < state.iterations(); ++i) {
+                state.addItems(static_cast<double>(f.creatures.size()));
+                f.step();
+            }
+        });
+    }
+}
@@ -757,7 +757,7 @@ int main(int argc, char* argv[]) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Run simulation
-    GeneralStats gs = { calendar, 0, 0, 0, 0 };
+    GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
     int snapshotInterval = 1;  // Record every tick for detailed diagnostics
     
     for (int tick = 0; tick < tickCount; tick++) {
@@ -765,7 +765,7 @@ int main(int argc, char* argv[]) {
         g_breedingTracker.resetTickAccumulators();
         
         // Reset per-tick stats
-        gs = { calendar, 0, 0, 0, 0 };
+        gs = { calendar, 0, 0, 0, 0, {} };
         
         // Advance simulation
         advanceSimulationWithBreedingDiagnostics(w, creatures, gs);
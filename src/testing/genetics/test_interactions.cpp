@@ -5,6 +5,7 @@
  * Tests FeedingInteraction, SeedDispersal, and CoevolutionTracker.
  */
 
+#include <cmath>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -20,10 +21,7 @@
 #include "genetics/interactions/FeedingInteraction.hpp"
 #include "genetics/interactions/SeedDispersal.hpp"
 
-// CoevolutionTracker depends on legacy Creature class - conditionally include
-#ifdef INCLUDE_COEVOLUTION_TRACKER
 #include "genetics/interactions/CoevolutionTracker.hpp"
-#endif
 
 namespace G = EcoSim::Genetics;
 
@@ -356,11 +354,9 @@ void testExpectedBurrDistance() {
 }
 
 // ============================================================================
-// CoevolutionTracker Tests (requires legacy Creature class)
+// CoevolutionTracker Tests
 // ============================================================================
 
-#ifdef INCLUDE_COEVOLUTION_TRACKER
-
 void testCoevolutionTrackerCreation() {
     G::CoevolutionTracker tracker;
     TEST_ASSERT_EQ(0, tracker.getCurrentGeneration());
@@ -482,7 +478,114 @@ void testGeneHistoryRetrieval() {
     TEST_ASSERT_EQ(0u, plantHistory.size());
 }
 
-#endif // INCLUDE_COEVOLUTION_TRACKER
+/// Pearson correlation computed directly, for checking the running sums
+float referenceCorrelation(const std::vector<double>& x, const std::vector<double>& y) {
+    double n = static_cast<double>(x.size());
+    double mx = 0.0, my = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) { mx += x[i]; my += y[i]; }
+    mx /= n;
+    my /= n;
+    double cov = 0.0, vx = 0.0, vy = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        cov += (x[i] - mx) * (y[i] - my);
+        vx += (x[i] - mx) * (x[i] - mx);
+        vy += (y[i] - my) * (y[i] - my);
+    }
+    return static_cast<float>(cov / std::sqrt(vx * vy));
+}
+
+void testStreamingGenerationsMatchReference() {
+    G::GeneRegistry registry;
+    G::UniversalGenes::registerDefaults(registry);
+    
+    G::ArmsRaceConfig config;
+    config.maxHistoryGenerations = 10;
+    config.minGenerationsForTrend = 5;
+    config.escalationThreshold = 0.001f;
+    config.trackedPairs.push_back({G::UniversalGenes::TOXIN_TOLERANCE,
+                                   G::UniversalGenes::TOXIN_PRODUCTION});
+    G::CoevolutionTracker tracker(config);
+    
+    std::vector<double> creatureMeans;
+    std::vector<double> plantMeans;
+    
+    for (int gen = 0; gen < 35; ++gen) {
+        tracker.beginCreatureGeneration();
+        tracker.beginPlantGeneration();
+        
+        double creatureSum = 0.0, plantSum = 0.0;
+        for (int i = 0; i < 4; ++i) {
+            G::Genome genome = G::UniversalGenes::createCreatureGenome(registry);
+            float wobble = static_cast<float>((gen * 7 + i * 3) % 5) * 0.01f;
+            genome.getGeneMutable(G::UniversalGenes::TOXIN_TOLERANCE)
+                .setAlleleValues(0.1f + 0.02f * static_cast<float>(gen) + wobble);
+            genome.getGeneMutable(G::UniversalGenes::TOXIN_PRODUCTION)
+                .setAlleleValues(0.05f + 0.015f * static_cast<float>(gen) - wobble);
+            
+            G::Phenotype phenotype(&genome, &registry);
+            tracker.addCreatureSample(phenotype);
+            tracker.addPlantSample(phenotype);
+            creatureSum += static_cast<double>(phenotype.getTrait(G::UniversalGenes::TOXIN_TOLERANCE));
+            plantSum += static_cast<double>(phenotype.getTrait(G::UniversalGenes::TOXIN_PRODUCTION));
+        }
+        creatureMeans.push_back(creatureSum / 4.0);
+        plantMeans.push_back(plantSum / 4.0);
+        tracker.advanceGeneration();
+    }
+    
+    // Only the last maxHistoryGenerations are in the window
+    std::vector<double> x(creatureMeans.end() - 10, creatureMeans.end());
+    std::vector<double> y(plantMeans.end() - 10, plantMeans.end());
+    
+    G::CoevolutionStats stats = tracker.getCoevolutionStats(
+        G::UniversalGenes::TOXIN_TOLERANCE, G::UniversalGenes::TOXIN_PRODUCTION);
+    TEST_ASSERT_EQ(10, stats.generationsTracked);
+    TEST_ASSERT_NEAR(referenceCorrelation(x, y), stats.correlationCoefficient, 1e-4f);
+    TEST_ASSERT_NEAR(static_cast<float>(x.back()), stats.creatureMeanValue, 1e-5f);
+    TEST_ASSERT(stats.trend == "escalating");
+    
+    auto history = tracker.getCreatureGeneHistory(G::UniversalGenes::TOXIN_TOLERANCE);
+    TEST_ASSERT_EQ(10u, history.size());
+    TEST_ASSERT_EQ(25, history.front().first);
+    TEST_ASSERT_GE(tracker.creatureGeneIndex(G::UniversalGenes::TOXIN_TOLERANCE), 0);
+    TEST_ASSERT_EQ(-1, tracker.plantGeneIndex("NOT_A_GENE"));
+}
+
+void testPairAddedLateUsesExistingHistory() {
+    G::GeneRegistry registry;
+    G::UniversalGenes::registerDefaults(registry);
+    
+    G::ArmsRaceConfig config;
+    config.trackedPairs.push_back({G::UniversalGenes::TOXIN_TOLERANCE,
+                                   G::UniversalGenes::TOXIN_PRODUCTION});
+    config.trackedPairs.push_back({G::UniversalGenes::HIDE_THICKNESS,
+                                   G::UniversalGenes::THORN_DENSITY});
+    G::CoevolutionTracker tracker(config);
+    
+    for (int gen = 0; gen < 6; ++gen) {
+        G::Genome genome = G::UniversalGenes::createCreatureGenome(registry);
+        G::Phenotype phenotype(&genome, &registry);
+        tracker.recordCreatureGeneration({});
+        tracker.addCreatureSample(phenotype);
+        tracker.beginPlantGeneration();
+        tracker.addPlantSample(phenotype);
+        tracker.advanceGeneration();
+    }
+    
+    // Both genes were already recorded, so the new pair starts with history
+    tracker.addTrackedPair(G::UniversalGenes::TOXIN_TOLERANCE,
+                           G::UniversalGenes::THORN_DENSITY);
+    TEST_ASSERT_EQ(3u, tracker.getConfig().trackedPairs.size());
+    TEST_ASSERT_EQ(6, tracker.getCoevolutionStats(
+        G::UniversalGenes::TOXIN_TOLERANCE, G::UniversalGenes::THORN_DENSITY).generationsTracked);
+    
+    tracker.removeTrackedPair(G::UniversalGenes::TOXIN_TOLERANCE,
+                              G::UniversalGenes::THORN_DENSITY);
+    TEST_ASSERT_EQ(0, tracker.getCoevolutionStats(
+        G::UniversalGenes::TOXIN_TOLERANCE, G::UniversalGenes::THORN_DENSITY).generationsTracked);
+    TEST_ASSERT_EQ(6, tracker.getCoevolutionStats(
+        G::UniversalGenes::HIDE_THICKNESS, G::UniversalGenes::THORN_DENSITY).generationsTracked);
+}
 
 // ============================================================================
 // Test Runner
@@ -515,7 +618,6 @@ void runInteractionTests() {
     RUN_TEST(testExpectedBurrDistance);
     END_TEST_GROUP();
     
-#ifdef INCLUDE_COEVOLUTION_TRACKER
     BEGIN_TEST_GROUP("CoevolutionTracker Tests");
     RUN_TEST(testCoevolutionTrackerCreation);
     RUN_TEST(testCoevolutionTrackerWithConfig);
@@ -529,10 +631,9 @@ void runInteractionTests() {
     RUN_TEST(testCoevolutionReset);
     RUN_TEST(testClearHistory);
     RUN_TEST(testGeneHistoryRetrieval);
+    RUN_TEST(testStreamingGenerationsMatchReference);
+    RUN_TEST(testPairAddedLateUsesExistingHistory);
     END_TEST_GROUP();
-#else
-    std::cout << "[INFO] CoevolutionTracker tests skipped (requires legacy Creature)" << std::endl;
-#endif
 }
 
 #ifdef TEST_INTERACTIONS_STANDALONE
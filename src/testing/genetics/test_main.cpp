@@ -11,12 +11,15 @@
 
 // Forward declarations for test runners
 extern void runCoreTests();
+extern void runRandomStreamTests();
 extern void runExpressionTests();
 extern void runUniversalGenesTests();
 extern void runEnergyBudgetTests();
 extern void runPlantTests();
 extern void runInteractionTests();
 extern void runOrganismFactoryTests();
+extern void runOrganismStoreTests();
+extern void runPlantRecordStoreTests();
 
 // Behavior integration test runners
 extern void runBehaviorPlantTests();
@@ -73,6 +76,19 @@ extern void runWorldGridTests();
 // WorldGenerator test runner (terrain generation component)
 extern void runWorldGeneratorTests();
 
+// ClimateWorldGenerator test runner (climate pipeline)
+extern void runClimateWorldGeneratorTests();
+
+// ChunkedWorld test runner (lazily generated chunks)
+extern void runChunkedWorldTests();
+
+// Terrain revision test runner (cached terrain invalidation)
+extern void runTerrainRevisionTests();
+extern void runSimulationThreadTests();
+
+// WorldOverview test runner (zoomed-out world summaries)
+extern void runWorldOverviewTests();
+
 // CorpseManager test runner (corpse lifecycle management)
 extern void runCorpseManagerTests();
 
@@ -85,6 +101,12 @@ extern void runEnvironmentSystemTests();
 // PlantManager test runner (plant lifecycle management)
 extern void runPlantManagerTests();
 
+// VegetationField test runner (aggregate ground cover)
+extern void runVegetationFieldTests();
+
+// TurnScheduler test runner (level-of-detail creature turns)
+extern void runTurnSchedulerTests();
+
 // IReproducible interface test runner
 extern void runReproducibleInterfaceTests();
 
@@ -100,6 +122,25 @@ extern void runBiomeVariantTests();
 // World-Organism Integration test runner (extended integration testing)
 extern void runWorldOrganismIntegrationTests();
 
+// TimeSeriesStore test runner (columnar statistics history)
+extern void runTimeSeriesTests();
+
+// GenomeStatsEngine test runner (parallel genome statistics)
+extern void runGenomeStatsTests();
+
+// Profiler test runner (scoped zones and trace export)
+extern void runProfilerTests();
+
+// MemoryBudget test runner (limit parsing and report checks)
+extern void runMemoryBudgetTests();
+
+// TickMetrics test runner (history ring and allocation counting)
+extern void runTickMetricsTests();
+
+// NCursesScreenBuffer test runner (diffing and dirty-cell flushes)
+extern void runScreenBufferTests();
+extern void runHUDPanelTests();
+
 int main() {
     auto start = std::chrono::high_resolution_clock::now();
     
@@ -112,6 +153,11 @@ int main() {
     std::cout << "=== Phase 1: Core Genetics ===" << std::endl;
     runCoreTests();
     std::cout << std::endl;
+
+    // Counter-based random streams
+    std::cout << "=== Phase 1: Random Streams ===" << std::endl;
+    runRandomStreamTests();
+    std::cout << std::endl;
     
     // Phase 1 continued: Expression
     std::cout << "=== Phase 1: Expression System ===" << std::endl;
@@ -137,6 +183,16 @@ int main() {
     std::cout << "=== OrganismFactory: gene → component attachment ===" << std::endl;
     runOrganismFactoryTests();
     std::cout << std::endl;
+
+    // Slot-mapped organism container
+    std::cout << "=== OrganismStore: handles and lifecycle ===" << std::endl;
+    runOrganismStoreTests();
+    std::cout << std::endl;
+
+    // Compact plant records
+    std::cout << "=== PlantRecordStore: compact plants ===" << std::endl;
+    runPlantRecordStoreTests();
+    std::cout << std::endl;
     
     // Phase 2.4: Creature-Plant Interactions
     std::cout << "=== Phase 2.4: Creature-Plant Interactions ===" << std::endl;
@@ -255,6 +311,31 @@ int main() {
     runWorldGeneratorTests();
     std::cout << std::endl;
     
+    // ClimateWorldGenerator Tests (climate pipeline)
+    std::cout << "=== ClimateWorldGenerator Tests (World) ===" << std::endl;
+    runClimateWorldGeneratorTests();
+    std::cout << std::endl;
+    
+    // ChunkedWorld Tests (lazily generated chunks)
+    std::cout << "=== ChunkedWorld Tests (World) ===" << std::endl;
+    runChunkedWorldTests();
+    std::cout << std::endl;
+    
+    // Terrain Revision Tests (cached terrain invalidation)
+    std::cout << "=== Terrain Revision Tests (World) ===" << std::endl;
+    runTerrainRevisionTests();
+    std::cout << std::endl;
+    
+    // Simulation Thread Tests (triple-buffered render snapshots)
+    std::cout << "=== Simulation Thread Tests (World) ===" << std::endl;
+    runSimulationThreadTests();
+    std::cout << std::endl;
+    
+    // WorldOverview Tests (zoomed-out world summaries)
+    std::cout << "=== WorldOverview Tests (World) ===" << std::endl;
+    runWorldOverviewTests();
+    std::cout << std::endl;
+    
     // CorpseManager Tests (corpse lifecycle management)
     std::cout << "=== CorpseManager Tests (World) ===" << std::endl;
     runCorpseManagerTests();
@@ -275,6 +356,16 @@ int main() {
     runPlantManagerTests();
     std::cout << std::endl;
     
+    // VegetationField Tests (aggregate ground cover)
+    std::cout << "=== VegetationField Tests (World) ===" << std::endl;
+    runVegetationFieldTests();
+    std::cout << std::endl;
+    
+    // TurnScheduler Tests (level-of-detail creature turns)
+    std::cout << "=== TurnScheduler Tests (World) ===" << std::endl;
+    runTurnSchedulerTests();
+    std::cout << std::endl;
+    
     // IReproducible Interface Tests
     std::cout << "=== IReproducible Interface Tests ===" << std::endl;
     runReproducibleInterfaceTests();
@@ -300,6 +391,41 @@ int main() {
     runWorldOrganismIntegrationTests();
     std::cout << std::endl;
     
+    // TimeSeriesStore Tests (columnar statistics history)
+    std::cout << "=== TimeSeriesStore Tests (Statistics) ===" << std::endl;
+    runTimeSeriesTests();
+    std::cout << std::endl;
+
+    // GenomeStatsEngine Tests (parallel genome statistics)
+    std::cout << "=== GenomeStatsEngine Tests (Statistics) ===" << std::endl;
+    runGenomeStatsTests();
+    std::cout << std::endl;
+
+    // Profiler Tests (scoped zones and trace export)
+    std::cout << "=== Profiler Tests (Logging) ===" << std::endl;
+    runProfilerTests();
+    std::cout << std::endl;
+
+    // MemoryBudget Tests (limit parsing and report checks)
+    std::cout << "=== MemoryBudget Tests (Logging) ===" << std::endl;
+    runMemoryBudgetTests();
+    std::cout << std::endl;
+
+    // TickMetrics Tests (history ring and allocation counting)
+    std::cout << "=== TickMetrics Tests (Logging) ===" << std::endl;
+    runTickMetricsTests();
+    std::cout << std::endl;
+
+    // NCursesScreenBuffer Tests (diffing and dirty-cell flushes)
+    std::cout << "=== NCursesScreenBuffer Tests (Rendering) ===" << std::endl;
+    runScreenBufferTests();
+    std::cout << std::endl;
+
+    // HUD panel Tests (snapshot copies for the ImGui panels)
+    std::cout << "=== HUD Panel Tests (Rendering) ===" << std::endl;
+    runHUDPanelTests();
+    std::cout << std::endl;
+    
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
     
@@ -59,6 +59,12 @@ void setGeneValue(G::Genome& genome, const std::string& id, float value) {
     }
 }
 
+// Archetype an organism's identity points at, or nullptr without one.
+const G::ArchetypeIdentity* archetypeOf(const G::Organism& organism) {
+    const G::IdentityComponent* identity = organism.identity();
+    return identity ? identity->archetype : nullptr;
+}
+
 } // namespace
 
 // ============================================================================
@@ -274,6 +280,58 @@ void testFactoryPureAutotrophHasNoSpeciesName() {
     TEST_ASSERT(!organism->getName().empty());
 }
 
+// ============================================================================
+// Moves — the archetype population is released exactly once
+// ============================================================================
+
+void testMoveConstructionReleasesArchetypeOnce() {
+    auto registry = buildFullRegistry();
+    auto organism = G::OrganismFactory::fromGenome(
+        G::UniversalGenes::createCreatureGenome(registry), 0, 0, registry);
+    const G::ArchetypeIdentity* archetype = archetypeOf(*organism);
+    TEST_ASSERT(archetype != nullptr);
+    const int start = archetype->getPopulation();
+
+    {
+        G::Organism moved(std::move(*organism));
+        TEST_ASSERT_EQ(start, archetype->getPopulation());
+        TEST_ASSERT(moved.identity() != nullptr);
+        TEST_ASSERT(organism->identity() == nullptr);
+
+        // The moved-from shell holds no identity, so it releases nothing
+        organism.reset();
+        TEST_ASSERT_EQ(start, archetype->getPopulation());
+    }
+    TEST_ASSERT_EQ(start - 1, archetype->getPopulation());
+}
+
+void testMoveAssignmentReleasesEachArchetypeOnce() {
+    auto registry = buildFullRegistry();
+    auto target = G::OrganismFactory::fromGenome(
+        G::UniversalGenes::createCreatureGenome(registry), 0, 0, registry);
+    auto source = G::OrganismFactory::fromGenome(
+        G::UniversalGenes::createCreatureGenome(registry), 1, 0, registry);
+    const G::ArchetypeIdentity* replaced = archetypeOf(*target);
+    const G::ArchetypeIdentity* kept = archetypeOf(*source);
+    TEST_ASSERT(replaced != nullptr && kept != nullptr);
+    const int shared = (replaced == kept) ? 1 : 0;
+    const int replacedStart = replaced->getPopulation();
+    const int keptStart = kept->getPopulation();
+
+    // The overwritten identity is released; the incoming one moves over
+    *target = std::move(*source);
+    TEST_ASSERT_EQ(replacedStart - 1, replaced->getPopulation());
+    TEST_ASSERT_EQ(keptStart - shared, kept->getPopulation());
+    TEST_ASSERT(source->identity() == nullptr);
+
+    source.reset();
+    TEST_ASSERT_EQ(replacedStart - 1, replaced->getPopulation());
+    TEST_ASSERT_EQ(keptStart - shared, kept->getPopulation());
+
+    target.reset();
+    TEST_ASSERT_EQ(keptStart - 1 - shared, kept->getPopulation());
+}
+
 // ============================================================================
 // Test runner
 // ============================================================================
@@ -310,4 +368,9 @@ void runOrganismFactoryTests() {
     RUN_TEST(testFactoryHeterotrophHasSpeciesName);
     RUN_TEST(testFactoryPureAutotrophHasNoSpeciesName);
     END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("OrganismFactory: moves");
+    RUN_TEST(testMoveConstructionReleasesArchetypeOnce);
+    RUN_TEST(testMoveAssignmentReleasesEachArchetypeOnce);
+    END_TEST_GROUP();
 }
@@ -0,0 +1,159 @@
+/**
+ * @file test_organism_store.cpp
+ * @brief Tests for OrganismStore handles, ID lookup and lifecycle passes.
+ *
+ * Pins the guarantees the simulation loop relies on: survivors keep their
+ * turn order and handles across removeDead(), a recycled slot never
+ * resolves a stale handle, offspring are appended as one batch, and
+ * reindex() picks up changes made through the vector adapter.
+ */
+
+#include "test_framework.hpp"
+
+#include "genetics/organisms/OrganismStore.hpp"
+#include "genetics/organisms/Plant.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+G::GeneRegistry& registry() {
+    static G::GeneRegistry reg = []() {
+        G::GeneRegistry r;
+        G::UniversalGenes::registerDefaults(r);
+        return r;
+    }();
+    return reg;
+}
+
+G::OrganismPtr makePlant(int x = 0) {
+    return std::make_unique<G::Plant>(x, 0, registry());
+}
+
+std::vector<int> ids(const G::OrganismStore& store) {
+    std::vector<int> result;
+    for (const auto& organism : store) {
+        result.push_back(organism->getId());
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// Insertion and lookup
+// ============================================================================
+
+void testStoreInsertAndLookup() {
+    G::OrganismStore store;
+    auto a = store.insert(makePlant(1));
+    auto b = store.insert(makePlant(2));
+
+    TEST_ASSERT_EQ(std::size_t(2), store.size());
+    TEST_ASSERT(a.valid() && b.valid());
+    TEST_ASSERT(a != b);
+    TEST_ASSERT_EQ(1, store.get(a)->getX());
+    TEST_ASSERT_EQ(2, store.get(b)->getX());
+
+    int idB = store.get(b)->getId();
+    TEST_ASSERT(store.find(idB) == store.get(b));
+    TEST_ASSERT(store.handleOf(idB) == b);
+    TEST_ASSERT(store.find(-12345) == nullptr);
+    TEST_ASSERT(!store.insert(nullptr).valid());
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void testStoreRemoveDeadKeepsOrderAndHandles() {
+    G::OrganismStore store;
+    std::vector<G::OrganismStore::Handle> handles;
+    for (int i = 0; i < 5; ++i) {
+        handles.push_back(store.insert(makePlant(i)));
+    }
+    std::vector<int> before = ids(store);
+
+    store.get(handles[1])->die();
+    store.get(handles[3])->die();
+    TEST_ASSERT_EQ(std::size_t(2), store.removeDead());
+
+    std::vector<int> expected = {before[0], before[2], before[4]};
+    TEST_ASSERT(ids(store) == expected);
+    TEST_ASSERT(store.get(handles[1]) == nullptr);
+    TEST_ASSERT(store.get(handles[3]) == nullptr);
+    TEST_ASSERT(store.find(before[1]) == nullptr);
+    TEST_ASSERT_EQ(4, store.get(handles[4])->getX());
+    TEST_ASSERT(store.find(before[4]) == store.get(handles[4]));
+}
+
+void testStoreRecycledSlotRejectsStaleHandle() {
+    G::OrganismStore store;
+    auto old = store.insert(makePlant(1));
+    store.get(old)->die();
+    store.removeDead();
+
+    auto fresh = store.insert(makePlant(2));
+    TEST_ASSERT_EQ(old.slot, fresh.slot);
+    TEST_ASSERT(old != fresh);
+    TEST_ASSERT(store.get(old) == nullptr);
+    TEST_ASSERT_EQ(2, store.get(fresh)->getX());
+}
+
+void testStoreCollectsOffspringAsBatch() {
+    G::OrganismStore store;
+    auto parent = store.insert(makePlant(1));
+    store.insert(makePlant(2));
+
+    // The offspring's own pending child is left for the next tick
+    auto child = makePlant(3);
+    child->setPendingOffspring(makePlant(4));
+    store.get(parent)->setPendingOffspring(std::move(child));
+
+    TEST_ASSERT_EQ(std::size_t(1), store.collectOffspring());
+    TEST_ASSERT_EQ(std::size_t(3), store.size());
+    TEST_ASSERT(!store.get(parent)->hasPendingOffspring());
+    TEST_ASSERT_EQ(3, store.organisms().back()->getX());
+    TEST_ASSERT(store.find(store.organisms().back()->getId()) != nullptr);
+
+    TEST_ASSERT_EQ(std::size_t(1), store.collectOffspring());
+    TEST_ASSERT_EQ(std::size_t(4), store.size());
+}
+
+void testStoreReindexAfterVectorChanges() {
+    G::OrganismStore store;
+    auto kept = store.insert(makePlant(1));
+    auto dropped = store.insert(makePlant(2));
+
+    auto& organisms = store.organisms();
+    organisms.erase(organisms.begin() + 1);
+    organisms.push_back(makePlant(3));
+    store.reindex();
+
+    TEST_ASSERT_EQ(1, store.get(kept)->getX());
+    TEST_ASSERT(store.get(dropped) == nullptr);
+    TEST_ASSERT(store.find(organisms.back()->getId()) == organisms.back().get());
+
+    store.clear();
+    TEST_ASSERT(store.empty());
+    TEST_ASSERT(store.get(kept) == nullptr);
+}
+
+// ============================================================================
+// Test Runner
+// ============================================================================
+
+void runOrganismStoreTests() {
+    BEGIN_TEST_GROUP("OrganismStore");
+    RUN_TEST(testStoreInsertAndLookup);
+    RUN_TEST(testStoreRemoveDeadKeepsOrderAndHandles);
+    RUN_TEST(testStoreRecycledSlotRejectsStaleHandle);
+    RUN_TEST(testStoreCollectsOffspringAsBatch);
+    RUN_TEST(testStoreReindexAfterVectorChanges);
+    END_TEST_GROUP();
+}
@@ -0,0 +1,254 @@
+/**
+ * @file test_plant_record_store.cpp
+ * @brief Tests for PlantRecordStore compaction, parity and materialization.
+ *
+ * Records must tick exactly like the Plant they came from, identical
+ * genomes must share one genotype, and a materialized plant must carry
+ * the same genes and lifecycle state as the record.
+ */
+
+#include "test_framework.hpp"
+
+#include "genetics/organisms/PlantRecordStore.hpp"
+#include "genetics/organisms/PlantFactory.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+
+#include <array>
+#include <memory>
+
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+struct PlantFixture {
+    std::shared_ptr<G::GeneRegistry> registry = std::make_shared<G::GeneRegistry>();
+    std::unique_ptr<G::PlantFactory> factory;
+
+    PlantFixture() {
+        G::UniversalGenes::registerDefaults(*registry);
+        factory = std::make_unique<G::PlantFactory>(registry);
+        factory->registerTemplate(G::PlantFactory::createOakTreeTemplate());
+        factory->registerTemplate(G::PlantFactory::createGrassTemplate());
+    }
+};
+
+PlantFixture& fixture() {
+    static PlantFixture f;
+    return f;
+}
+
+G::EnvironmentState mildEnvironment() {
+    G::EnvironmentState env;
+    env.temperature = 20.0f;
+    env.humidity = 0.6f;
+    env.time_of_day = 0.5f;
+    return env;
+}
+
+} // namespace
+
+// ============================================================================
+// Parity with Plant
+// ============================================================================
+
+void testRecordUpdateMatchesPlant() {
+    G::Plant plant = fixture().factory->createFromTemplate("grass", 3, 4);
+    G::PlantRecordStore store;
+    const std::size_t index = store.add(plant);
+
+    const G::EnvironmentState env = mildEnvironment();
+    for (int tick = 0; tick < 200; ++tick) {
+        plant.update(env);
+        store.update(index, env);
+    }
+
+    const G::PlantRecord& record = store[index];
+    TEST_ASSERT_NEAR(plant.getCurrentSize(), record.currentSize, 1e-5f);
+    TEST_ASSERT_NEAR(plant.getHealth(), record.health, 1e-5f);
+    TEST_ASSERT_EQ(plant.isMature(), record.mature);
+    TEST_ASSERT_EQ(plant.getAge(), record.age);
+    TEST_ASSERT_EQ(3, record.x);
+    TEST_ASSERT_EQ(4, record.y);
+}
+
+void testRecordStressDamageMatchesPlant() {
+    G::Plant plant = fixture().factory->createFromTemplate("oak_tree", 0, 0);
+    G::PlantRecordStore store;
+    const std::size_t index = store.add(plant);
+
+    // Far above tolerance: stress damage every tick
+    G::EnvironmentState env = mildEnvironment();
+    env.temperature = 70.0f;
+    env.humidity = 0.05f;
+    const float startHealth = plant.getHealth();
+    for (int tick = 0; tick < 500; ++tick) {
+        plant.update(env);
+        store.update(index, env);
+        TEST_ASSERT_NEAR(plant.getHealth(), store[index].health, 1e-5f);
+        TEST_ASSERT_EQ(plant.isAlive(), store[index].isAlive());
+    }
+    TEST_ASSERT_LT(store[index].health, startHealth);
+
+    G::Plant grazed = fixture().factory->createFromTemplate("grass", 0, 0);
+    const std::size_t second = store.add(grazed);
+    grazed.takeDamage(0.3f);
+    store.takeDamage(second, 0.3f);
+    TEST_ASSERT_NEAR(grazed.getHealth(), store[second].health, 1e-6f);
+}
+
+void testScentAndSpreadMatchPlant() {
+    G::Plant plant = fixture().factory->createFromTemplate("grass", 5, 5);
+    G::PlantRecordStore store;
+    const std::size_t index = store.add(plant);
+
+    const G::PlantTraits& traits = store.traits(index);
+    TEST_ASSERT_NEAR(plant.getScentProductionRate(), traits.scentProductionRate, 1e-6f);
+    TEST_ASSERT_NEAR(plant.getFruitProductionRate(), traits.fruitProductionRate, 1e-6f);
+    TEST_ASSERT_NEAR(plant.getRunnerProduction(), traits.runnerProduction, 1e-6f);
+
+    const std::array<float, 8> expected = plant.getScentSignature();
+    const std::array<float, 8> signature = store.scentSignature(index);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        TEST_ASSERT_NEAR(expected[i], signature[i], 1e-6f);
+    }
+
+    // Vegetative spread depends on age, size and the runner cooldown
+    const G::EnvironmentState env = mildEnvironment();
+    for (int tick = 0; tick < 400; ++tick) {
+        plant.update(env);
+        store.update(index, env);
+        TEST_ASSERT_EQ(plant.canSpreadVegetatively(), store.canSpreadVegetatively(index));
+    }
+}
+
+// ============================================================================
+// Shared genotypes
+// ============================================================================
+
+void testIdenticalGenomesShareGenotype() {
+    G::Plant oak = fixture().factory->createFromTemplate("oak_tree", 0, 0);
+    G::Plant clone(oak);
+    G::Plant grass = fixture().factory->createFromTemplate("grass", 1, 0);
+
+    G::PlantRecordStore store;
+    store.add(oak);
+    store.add(clone);
+    TEST_ASSERT_EQ(std::size_t(1), store.genotypeCount());
+
+    const std::size_t grassIndex = store.add(grass);
+    TEST_ASSERT_EQ(std::size_t(2), store.genotypeCount());
+    TEST_ASSERT_NEAR(grass.getMaxSize(), store.traits(grassIndex).maxSize, 1e-6f);
+    TEST_ASSERT_EQ(grass.getMaxLifespan(), store.traits(grassIndex).lifespan);
+
+    // The shared genotype stays until its last record is removed
+    store.takeDamage(0, 100.0f);
+    TEST_ASSERT_EQ(std::size_t(1), store.removeDead());
+    TEST_ASSERT_EQ(std::size_t(2), store.genotypeCount());
+    store.takeDamage(0, 100.0f);
+    TEST_ASSERT_EQ(std::size_t(1), store.removeDead());
+    TEST_ASSERT_EQ(std::size_t(1), store.genotypeCount());
+    TEST_ASSERT_EQ(1, store[0].x);
+
+    // Its slot is reused by the next new genotype
+    store.add(fixture().factory->createFromTemplate("oak_tree", 2, 0));
+    TEST_ASSERT_EQ(std::size_t(2), store.genotypeCount());
+}
+
+// ============================================================================
+// Materialization
+// ============================================================================
+
+void testMaterializeRestoresGenomeAndState() {
+    G::Plant plant = fixture().factory->createFromTemplate("oak_tree", 7, 9);
+    const G::EnvironmentState env = mildEnvironment();
+    for (int tick = 0; tick < 50; ++tick) {
+        plant.update(env);
+    }
+    plant.takeDamage(0.2f);
+
+    G::PlantRecordStore store;
+    const std::size_t index = store.add(plant);
+    G::Plant restored = store.materialize(index, *fixture().registry);
+
+    TEST_ASSERT_EQ(7, restored.getX());
+    TEST_ASSERT_EQ(9, restored.getY());
+    TEST_ASSERT_EQ(plant.getAge(), restored.getAge());
+    TEST_ASSERT_NEAR(plant.getCurrentSize(), restored.getCurrentSize(), 1e-6f);
+    TEST_ASSERT_NEAR(plant.getHealth(), restored.getHealth(), 1e-6f);
+    TEST_ASSERT_EQ(plant.isMature(), restored.isMature());
+
+    const G::Genome& original = plant.getGenome();
+    const G::Genome& rebuilt = restored.getGenome();
+    TEST_ASSERT_EQ(original.getTotalGeneCount(), rebuilt.getTotalGeneCount());
+    TEST_ASSERT_NEAR(1.0f, original.compare(rebuilt), 1e-6f);
+    for (const G::Gene& gene : original.getAllGenes()) {
+        const G::Gene& copy = rebuilt.getGene(gene.getId());
+        TEST_ASSERT_NEAR(gene.getNumericValue(G::DominanceType::Incomplete),
+                         copy.getNumericValue(G::DominanceType::Incomplete), 1e-6f);
+    }
+
+    // The materialized plant ticks on like the original
+    plant.update(env);
+    restored.update(env);
+    TEST_ASSERT_NEAR(plant.getCurrentSize(), restored.getCurrentSize(), 1e-6f);
+}
+
+void testSyncCopiesMaterializedChanges() {
+    G::Plant plant = fixture().factory->createFromTemplate("oak_tree", 2, 3);
+    G::PlantRecordStore store;
+    const std::size_t index = store.add(plant);
+
+    G::Plant view = store.materialize(index, *fixture().registry);
+    const G::EnvironmentState env = mildEnvironment();
+    for (int tick = 0; tick < 20; ++tick) {
+        view.update(env);
+    }
+    view.takeDamage(0.3f);
+    store.sync(index, view);
+
+    const G::PlantRecord& record = store[index];
+    TEST_ASSERT_EQ(view.getAge(), record.age);
+    TEST_ASSERT_NEAR(view.getCurrentSize(), record.currentSize, 1e-6f);
+    TEST_ASSERT_NEAR(view.getHealth(), record.health, 1e-6f);
+    TEST_ASSERT_EQ(view.isMature(), record.mature);
+
+    // A plant eaten to death leaves a dead record
+    view.takeDamage(100.0f);
+    store.sync(index, view);
+    TEST_ASSERT(!store[index].isAlive());
+    TEST_ASSERT_EQ(std::size_t(1), store.removeDead());
+}
+
+// ============================================================================
+// Footprint
+// ============================================================================
+
+void testRecordsAreSmallerThanPlants() {
+    G::PlantRecordStore store;
+    std::size_t plantBytes = 0;
+    for (int i = 0; i < 100; ++i) {
+        G::Plant plant = fixture().factory->createFromTemplate("oak_tree", i, 0);
+        plantBytes += plant.memoryUsage();
+        store.add(plant);
+    }
+
+    TEST_ASSERT_LE(sizeof(G::PlantRecord), std::size_t(40));
+    TEST_ASSERT_LT(store.memoryUsage() * 10, plantBytes);
+}
+
+// ============================================================================
+// Test Runner
+// ============================================================================
+
+void runPlantRecordStoreTests() {
+    BEGIN_TEST_GROUP("PlantRecordStore");
+    RUN_TEST(testRecordUpdateMatchesPlant);
+    RUN_TEST(testRecordStressDamageMatchesPlant);
+    RUN_TEST(testScentAndSpreadMatchPlant);
+    RUN_TEST(testIdenticalGenomesShareGenotype);
+    RUN_TEST(testMaterializeRestoresGenomeAndState);
+    RUN_TEST(testSyncCopiesMaterializedChanges);
+    RUN_TEST(testRecordsAreSmallerThanPlants);
+    END_TEST_GROUP();
+}
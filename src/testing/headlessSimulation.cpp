@@ -24,10 +24,26 @@
  *   -v, --verbose       Enable verbose debug output
  *   --nav-debug         Enable navigator debug logging
  *   --behavior-debug    Enable creature behavior debug logging
+ *   --series PATH       Stream per-tick statistics to a memory-mapped file
+ *   --batch PATH        Run every job in a manifest across all cores
+ *   --results PATH      Batch summary file (default: batch_results.jsonl)
+ *   --world-cache DIR   Climate cache shared by batch jobs
+ *
+ * Batch mode:
+ *   Each non-empty manifest line is one job, written as the options above
+ *   (e.g. "-s 42 -p 150 -t 2000 -w 300"); options not given on the line
+ *   come from the command line. '#' starts a comment. Jobs run on the
+ *   shared worker pool (ECOSIM_THREADS overrides the thread count), each
+ *   with its own World. The gene registry and creature factories are built
+ *   once and shared, and worlds go through the climate cache so a world
+ *   used by several jobs is generated once. Every finished run appends
+ *   one JSON summary line to the results file.
  */
 
 #include <csignal>
 #include <cstdlib>
+#include <cstdint>
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <iomanip>
@@ -36,6 +52,12 @@
 #include <chrono>
 #include <random>
 #include <map>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <tuple>
 
 // Platform-specific backtrace support
 #ifdef __APPLE__
@@ -57,12 +79,17 @@
 #include "../../include/calendar.hpp"
 #include "../../include/statistics/statistics.hpp"
 #include "../../include/logging/Logger.hpp"
+#include "../../include/logging/TickMetrics.hpp"
+#include "../../include/logging/MemoryReport.hpp"
+#include "../../include/parallel.hpp"
 
 // Genetics system
+#include "../../include/genetics/core/RandomEngine.hpp"
 #include "../../include/genetics/defaults/UniversalGenes.hpp"
 #include "../../include/genetics/organisms/PlantFactory.hpp"
 #include "../../include/genetics/organisms/CreatureFactory.hpp"
 #include "../../include/genetics/organisms/BiomeVariantExamples.hpp"
+#include "../../include/genetics/organisms/OrganismStore.hpp"
 
 using namespace std;
 using namespace logging;
@@ -81,14 +108,66 @@ struct SimulationConfig {
     unsigned mapWidth = 200;
     unsigned mapHeight = 200;
     int statusInterval = 100;
+    std::string seriesPath;
+    bool quiet = false;           // Batch jobs: no setup or status output
+    std::string batchPath;
+    std::string resultsPath = "batch_results.jsonl";
+    std::string worldCache;
+    std::string tracePath;        // Chrome trace of the whole run when set
+    std::vector<std::string> memoryBudgets;  // NAME=MB soft limits
+    bool lod = false;             // Level-of-detail turn scheduling
+    float lodDrift = 0.5f;        // Most a need may drift between LOD turns
+    bool groundCoverField = false;  // Grass and moss as a biomass field
+    bool chunked = false;         // Generate terrain in chunks around the creatures
+    bool compactPlants = false;   // Individual plants as PlantRecordStore records
+};
+
+//================================================================================
+// Run Summary
+//================================================================================
+struct RunSummary {
+    int ticksRun = 0;
+    size_t finalPopulation = 0;
+    bool extinct = false;
+    unsigned deathsOldAge = 0;
+    unsigned deathsStarved = 0;
+    unsigned deathsDehydrated = 0;
+    unsigned deathsDiscomfort = 0;
+    unsigned deathsPredator = 0;
+    unsigned births = 0;
+    float avgHunger = 0.0f;
+    float avgThirst = 0.0f;
+    float avgFatigue = 0.0f;
+    long long elapsedMs = 0;
+    std::uint64_t turnsTaken = 0;
+    std::uint64_t turnsSkipped = 0;
+};
+
+//================================================================================
+// Shared Factories
+//================================================================================
+// Gene registration and template setup are the same for every run, so they
+// are done once and the factories shared. Creating creatures only reads them.
+struct SpawnFactories {
+    std::shared_ptr<EcoSim::Genetics::GeneRegistry> registry;
+    std::unique_ptr<EcoSim::Genetics::CreatureFactory> standard;
+    std::unique_ptr<EcoSim::Genetics::BiomeVariantFactory> biome;
+    
+    SpawnFactories()
+        : registry(std::make_shared<EcoSim::Genetics::GeneRegistry>())
+        , standard(std::make_unique<EcoSim::Genetics::CreatureFactory>(registry))
+        , biome(std::make_unique<EcoSim::Genetics::BiomeVariantFactory>(registry)) {
+        standard->registerDefaultTemplates();
+    }
 };
 
 //================================================================================
 // Global state for signal handler
 //================================================================================
-static int g_currentTick = 0;
-static size_t g_creatureCount = 0;
-static std::string g_lastAction = "initializing";
+// Per thread, so a crash in a batch job reports that job's state
+static thread_local int g_currentTick = 0;
+static thread_local size_t g_creatureCount = 0;
+static thread_local std::string g_lastAction = "initializing";
 
 //================================================================================
 // Signal Handler
@@ -139,30 +218,49 @@ void printUsage(const char* programName) {
               << "  --nav-debug           Enable navigator debug logging\n"
               << "  --behavior-debug      Enable creature behavior debug logging\n"
               << "  --metrics             Output JSON metrics at milestone ticks\n"
+              << "  --series PATH         Stream per-tick statistics to a memory-mapped file\n"
+              << "  --batch PATH          Run the jobs in a manifest in parallel\n"
+              << "  --results PATH        Batch summary file (default: batch_results.jsonl)\n"
+              << "  --world-cache DIR     Climate cache shared by batch jobs\n"
+              << "                        (default: $ECOSIM_WORLD_CACHE or a temp directory)\n"
+              << "  --trace PATH          Record profiling zones and write a Chrome trace\n"
+              << "  --memory-budget N=MB  Warn when subsystem N (or 'total') exceeds MB\n"
+              << "                        megabytes; repeatable, adds to $ECOSIM_MEMORY_BUDGET\n"
+              << "  --lod                 Let resting and isolated creatures skip turns\n"
+              << "  --lod-drift D         Most a need may drift between skipped turns\n"
+              << "                        (default: 0.5, implies --lod)\n"
+              << "  --ground-cover-field  Model grass and moss as per-tile biomass\n"
+              << "  --chunked             Generate terrain in chunks, starting around the\n"
+              << "                        map centre; evicted chunks go to the world cache\n"
+              << "  --compact-plants      Keep plants as compact records, building a full\n"
+              << "                        plant only to disperse seeds or to be eaten\n"
               << "  --help                Show this help message\n";
 }
 
-SimulationConfig parseArgs(int argc, char* argv[]) {
-    SimulationConfig config;
+/**
+ * Apply options to a config. Options missing from args keep their value.
+ *
+ * @return The first unrecognised argument, or an empty string.
+ */
+std::string applyArgs(SimulationConfig& config, const std::vector<std::string>& args) {
+    std::string unknown;
     
-    for (int i = 1; i < argc; ++i) {
-        std::string arg = argv[i];
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string& arg = args[i];
+        const bool hasValue = i + 1 < args.size();
         
-        if (arg == "--help") {
-            printUsage(argv[0]);
-            exit(0);
-        } else if ((arg == "-t" || arg == "--ticks") && i + 1 < argc) {
-            config.maxTicks = std::atoi(argv[++i]);
-        } else if ((arg == "-p" || arg == "--population") && i + 1 < argc) {
-            config.population = static_cast<unsigned>(std::atoi(argv[++i]));
-        } else if ((arg == "-s" || arg == "--seed") && i + 1 < argc) {
-            config.seed = static_cast<unsigned>(std::atoi(argv[++i]));
-        } else if ((arg == "-w" || arg == "--width") && i + 1 < argc) {
-            config.mapWidth = static_cast<unsigned>(std::atoi(argv[++i]));
-        } else if ((arg == "-h" || arg == "--height") && i + 1 < argc) {
-            config.mapHeight = static_cast<unsigned>(std::atoi(argv[++i]));
-        } else if ((arg == "-i" || arg == "--interval") && i + 1 < argc) {
-            config.statusInterval = std::atoi(argv[++i]);
+        if ((arg == "-t" || arg == "--ticks") && hasValue) {
+            config.maxTicks = std::atoi(args[++i].c_str());
+        } else if ((arg == "-p" || arg == "--population") && hasValue) {
+            config.population = static_cast<unsigned>(std::atoi(args[++i].c_str()));
+        } else if ((arg == "-s" || arg == "--seed") && hasValue) {
+            config.seed = static_cast<unsigned>(std::atoi(args[++i].c_str()));
+        } else if ((arg == "-w" || arg == "--width") && hasValue) {
+            config.mapWidth = static_cast<unsigned>(std::atoi(args[++i].c_str()));
+        } else if ((arg == "-h" || arg == "--height") && hasValue) {
+            config.mapHeight = static_cast<unsigned>(std::atoi(args[++i].c_str()));
+        } else if ((arg == "-i" || arg == "--interval") && hasValue) {
+            config.statusInterval = std::atoi(args[++i].c_str());
         } else if (arg == "-v" || arg == "--verbose") {
             config.verbose = true;
         } else if (arg == "--nav-debug") {
@@ -171,13 +269,57 @@ SimulationConfig parseArgs(int argc, char* argv[]) {
             config.behaviorDebug = true;
         } else if (arg == "--metrics") {
             config.metrics = true;
+        } else if (arg == "--series" && hasValue) {
+            config.seriesPath = args[++i];
+        } else if (arg == "--batch" && hasValue) {
+            config.batchPath = args[++i];
+        } else if (arg == "--results" && hasValue) {
+            config.resultsPath = args[++i];
+        } else if (arg == "--world-cache" && hasValue) {
+            config.worldCache = args[++i];
+        } else if (arg == "--trace" && hasValue) {
+            config.tracePath = args[++i];
+        } else if (arg == "--memory-budget" && hasValue) {
+            config.memoryBudgets.push_back(args[++i]);
+        } else if (arg == "--lod") {
+            config.lod = true;
+        } else if (arg == "--ground-cover-field") {
+            config.groundCoverField = true;
+        } else if (arg == "--chunked") {
+            config.chunked = true;
+        } else if (arg == "--compact-plants") {
+            config.compactPlants = true;
+        } else if (arg == "--lod-drift" && hasValue) {
+            config.lod = true;
+            config.lodDrift = static_cast<float>(std::atof(args[++i].c_str()));
+        } else if (unknown.empty()) {
+            unknown = arg;
+        }
+    }
+    
+    return unknown;
+}
+
+unsigned randomSeed() {
+    std::random_device rd;
+    return rd();
+}
+
+SimulationConfig parseArgs(int argc, char* argv[]) {
+    SimulationConfig config;
+    std::vector<std::string> args(argv + 1, argv + argc);
+    
+    for (const std::string& arg : args) {
+        if (arg == "--help") {
+            printUsage(argv[0]);
+            exit(0);
         }
     }
+    applyArgs(config, args);
     
-    // Generate random seed if not specified
-    if (config.seed == 0) {
-        std::random_device rd;
-        config.seed = rd();
+    // Generate random seed if not specified (batch jobs pick their own)
+    if (config.seed == 0 && config.batchPath.empty()) {
+        config.seed = randomSeed();
     }
     
     return config;
@@ -201,29 +343,34 @@ World initializeWorld(const SimulationConfig& config) {
     
     OctaveGen og { 2, 0.25, 0.5, 2 };
     
-    // Create world with basic parameters
-    World world(mg, og);
-    
-    // Regenerate using ClimateWorldGenerator for realistic biomes
-    world.regenerateClimate(config.seed);
+    if (config.chunked) {
+        EcoSim::ChunkedWorldConfig chunks;
+        chunks.cacheDirectory = config.worldCache.empty()
+            ? EcoSim::ClimateWorldGenerator::defaultCacheDirectory()
+            : config.worldCache;
+        return World(mg, og, chunks);
+    }
     
-    return world;
+    // The constructor generates the climate-based biomes from the same
+    // seed (or loads them from the world cache)
+    return World(mg, og);
 }
 
 //================================================================================
 // Creature Population (biome-based)
 //================================================================================
-void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>& creatures, 
-                          unsigned amount, const SimulationConfig& config) {
+void populateWorldByBiome(World& w, EcoSim::Genetics::OrganismStore& creatures, 
+                          unsigned amount, const SimulationConfig& config,
+                          SpawnFactories& factories) {
     using namespace EcoSim;
     using namespace EcoSim::Genetics;
     
-    auto registry = std::make_shared<GeneRegistry>();
-    BiomeVariantFactory biomeFactory(registry);
-    CreatureFactory standardFactory(registry);
-    standardFactory.registerDefaultTemplates();
+    BiomeVariantFactory& biomeFactory = *factories.biome;
+    const CreatureFactory& standardFactory = *factories.standard;
     
-    std::cout << "[Headless] Populating by biome with " << amount << " creatures..." << std::endl;
+    if (!config.quiet) {
+        std::cout << "[Headless] Populating by biome with " << amount << " creatures..." << std::endl;
+    }
     
     // Collect valid spawn positions for each biome category
     std::vector<std::pair<int, int>> tundraPositions;
@@ -231,46 +378,49 @@ void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>&
     std::vector<std::pair<int, int>> tropicalPositions;
     std::vector<std::pair<int, int>> temperatePositions;
     
+    // A chunked world only spawns on the chunks already generated
     const auto& grid = w.grid();
-    for (unsigned x = 0; x < grid.width(); ++x) {
-        for (unsigned y = 0; y < grid.height(); ++y) {
-            if (!grid(x, y).isPassable()) continue;
-            
-            int biomeInt = w.environment().getBiome(static_cast<int>(x), static_cast<int>(y));
-            Biome biome = static_cast<Biome>(biomeInt);
-            
-            switch (biome) {
-                case Biome::OCEAN_DEEP:
-                case Biome::OCEAN_SHALLOW:
-                case Biome::OCEAN_COAST:
-                case Biome::FRESHWATER:
-                    continue;  // Skip water biomes
+    for (const WorldGrid::Region& region : grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; ++x) {
+            for (unsigned y = region.y; y < region.y + region.height; ++y) {
+                if (!grid(x, y).isPassable()) continue;
                 
-                case Biome::ICE_SHEET:
-                case Biome::TUNDRA:
-                case Biome::TAIGA:
-                case Biome::BOREAL_FOREST:
-                case Biome::ALPINE_TUNDRA:
-                case Biome::GLACIER:
-                    tundraPositions.push_back({x, y});
-                    break;
-                    
-                case Biome::DESERT_HOT:
-                case Biome::DESERT_COLD:
-                case Biome::STEPPE:
-                case Biome::SHRUBLAND:
-                    desertPositions.push_back({x, y});
-                    break;
-                    
-                case Biome::TROPICAL_RAINFOREST:
-                case Biome::TROPICAL_SEASONAL_FOREST:
-                case Biome::SAVANNA:
-                    tropicalPositions.push_back({x, y});
-                    break;
+                int biomeInt = w.environment().getBiome(static_cast<int>(x), static_cast<int>(y));
+                Biome biome = static_cast<Biome>(biomeInt);
+                
+                switch (biome) {
+                    case Biome::OCEAN_DEEP:
+                    case Biome::OCEAN_SHALLOW:
+                    case Biome::OCEAN_COAST:
+                    case Biome::FRESHWATER:
+                        continue;  // Skip water biomes
                     
-                default:
-                    temperatePositions.push_back({x, y});
-                    break;
+                    case Biome::ICE_SHEET:
+                    case Biome::TUNDRA:
+                    case Biome::TAIGA:
+                    case Biome::BOREAL_FOREST:
+                    case Biome::ALPINE_TUNDRA:
+                    case Biome::GLACIER:
+                        tundraPositions.push_back({x, y});
+                        break;
+                        
+                    case Biome::DESERT_HOT:
+                    case Biome::DESERT_COLD:
+                    case Biome::STEPPE:
+                    case Biome::SHRUBLAND:
+                        desertPositions.push_back({x, y});
+                        break;
+                        
+                    case Biome::TROPICAL_RAINFOREST:
+                    case Biome::TROPICAL_SEASONAL_FOREST:
+                    case Biome::SAVANNA:
+                        tropicalPositions.push_back({x, y});
+                        break;
+                        
+                    default:
+                        temperatePositions.push_back({x, y});
+                        break;
+                }
             }
         }
     }
@@ -296,7 +446,7 @@ void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>&
     unsigned tropicalCount = calculateBiomeCount(tropicalPositions.size());
     unsigned temperateCount = calculateBiomeCount(temperatePositions.size());
     
-    std::mt19937 rng(config.seed);
+    EcoSim::Genetics::RandomStream rng(config.seed, EcoSim::Genetics::RandomSystem::Spawning);
     
     // Helper lambda for spawning creatures in a biome
     auto spawnInBiome = [&](
@@ -329,7 +479,7 @@ void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>&
             creature->setXY(x, y);
             creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
             primeAdult(*creature);
-            creatures.push_back(std::move(creature));
+            creatures.insert(std::move(creature));
         }
 
         for (unsigned i = 0; i < carnivoreCount && !positions.empty(); ++i) {
@@ -339,7 +489,7 @@ void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>&
             creature->setXY(x, y);
             creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
             primeAdult(*creature);
-            creatures.push_back(std::move(creature));
+            creatures.insert(std::move(creature));
         }
     };
     
@@ -367,13 +517,15 @@ void populateWorldByBiome(World& w, std::vector<EcoSim::Genetics::OrganismPtr>&
             auto [x, y] = temperatePositions[idx];
             creature->setXY(x, y);
             creature->setWorldPosition(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
-            creatures.push_back(std::move(creature));
+            creatures.insert(std::move(creature));
         }
     }
     
-    std::cout << "[Headless] Spawned " << creatures.size() << " creatures" << std::endl;
-    std::cout << "  Tundra: " << tundraCount << ", Desert: " << desertCount
-              << ", Tropical: " << tropicalCount << ", Temperate: " << temperateCount << std::endl;
+    if (!config.quiet) {
+        std::cout << "[Headless] Spawned " << creatures.size() << " creatures" << std::endl;
+        std::cout << "  Tundra: " << tundraCount << ", Desert: " << desertCount
+                  << ", Tropical: " << tropicalCount << ", Temperate: " << temperateCount << std::endl;
+    }
 }
 
 //================================================================================
@@ -391,6 +543,10 @@ void addGeneticsPlants(World& w) {
 bool takeTurn(World& w, GeneralStats& gs, std::vector<EcoSim::Genetics::OrganismPtr>& c, 
               unsigned int cIndex, const SimulationConfig& config) {
     auto* activeC = c.at(cIndex).get();
+
+    // Level-of-detail scheduling: skipped ticks are integrated here
+    const unsigned elapsed = w.turnScheduler().beginTurn(*activeC, w.getCurrentTick());
+    if (elapsed == 0) return false;
     
     g_lastAction = "checking death for creature " + std::to_string(activeC->getId());
     
@@ -431,7 +587,10 @@ bool takeTurn(World& w, GeneralStats& gs, std::vector<EcoSim::Genetics::Organism
         g_lastAction = "executing BC for creature " + std::to_string(activeC->getId());
 
         auto ctx = activeC->buildBehaviorContext(w, w.getScentLayer(), w.getCurrentTick());
-        activeC->updateWithBehaviors(ctx);
+        ctx.deltaTime = static_cast<float>(elapsed);
+        auto result = activeC->updateWithBehaviors(ctx);
+        w.turnScheduler().endTurn(*activeC, result, w.getCurrentTick(),
+                                  w.getCreatureIndex(), w.getScentLayer());
 
         // Post-update death check: metabolism drain or environmental damage
         // during updateWithBehaviors may have pushed the creature below a
@@ -466,29 +625,50 @@ bool takeTurn(World& w, GeneralStats& gs, std::vector<EcoSim::Genetics::Organism
     }
 }
 
-void advanceSimulation(World& w, std::vector<EcoSim::Genetics::OrganismPtr>& c, GeneralStats& gs,
+void advanceSimulation(World& w, EcoSim::Genetics::OrganismStore& c, GeneralStats& gs,
                        const SimulationConfig& config) {
+    ECOSIM_PROFILE_ZONE("tick");
+
     g_lastAction = "updating environment tick cache";
     unsigned int currentTick = w.getCurrentTick();
-    w.environment().updateTickCache(static_cast<int>(currentTick));
+    {
+        ECOSIM_TICK_PHASE(EnvironmentCache);
+        w.environment().updateTickCache(static_cast<int>(currentTick));
+    }
     
     g_lastAction = "rebuilding creature spatial index";
-    w.rebuildCreatureIndex(c);
+    {
+        ECOSIM_TICK_PHASE(SpatialIndex);
+        w.rebuildCreatureIndex(c.organisms());
+        w.evictDistantChunks(c.organisms());
+    }
     
     g_lastAction = "updating world objects";
-    w.updateAllObjects();
+    {
+        ECOSIM_TICK_PHASE(WorldObjects);
+        w.updateAllObjects();
+    }
     
     g_lastAction = "updating scent layer";
-    w.updateScentLayer();
+    {
+        ECOSIM_TICK_PHASE(ScentLayer);
+        w.updateScentLayer();
+    }
     
     g_lastAction = "ticking corpses";
-    w.tickCorpses();
+    {
+        ECOSIM_TICK_PHASE(Corpses);
+        w.tickCorpses();
+    }
     
     // Pre-pass: deposit breeding scents
     g_lastAction = "depositing breeding scents";
-    for (auto& creature : c) {
-        if (creature->getMotivation() == Motivation::Amorous) {
-            creature->depositBreedingScent(w.getScentLayer(), currentTick);
+    {
+        ECOSIM_TICK_PHASE(BreedingScents);
+        for (auto& creature : c) {
+            if (creature->getMotivation() == Motivation::Amorous) {
+                creature->depositBreedingScent(w.getScentLayer(), currentTick);
+            }
         }
     }
     
@@ -496,29 +676,27 @@ void advanceSimulation(World& w, std::vector<EcoSim::Genetics::OrganismPtr>& c,
     // count deaths. Skipping dead creatures here causes silent death
     // removal without category counting.
     g_lastAction = "processing creature turns";
-    const size_t preTickCount = c.size();
-    for (size_t i = 0; i < preTickCount; ++i) {
-        takeTurn(w, gs, c, static_cast<unsigned int>(i), config);
+    {
+        ECOSIM_TICK_PHASE(CreatureTurns);
+        const size_t preTickCount = c.size();
+        for (size_t i = 0; i < preTickCount; ++i) {
+            takeTurn(w, gs, c.organisms(), static_cast<unsigned int>(i), config);
+        }
     }
 
     // Drain any pending offspring produced during this tick's mating.
     g_lastAction = "collecting offspring";
-    for (size_t i = 0; i < preTickCount; ++i) {
-        if (i >= c.size()) break;
-        if (!c[i]->hasPendingOffspring()) continue;
-        auto offspring = c[i]->takePendingOffspring();
-        if (!offspring) continue;
-        c.push_back(std::move(offspring));
-        gs.births++;
+    {
+        ECOSIM_TICK_PHASE(Offspring);
+        gs.births += static_cast<unsigned>(c.collectOffspring());
     }
 
     // Remove dead creatures
     g_lastAction = "removing dead creatures";
-    c.erase(
-        std::remove_if(c.begin(), c.end(),
-            [](const EcoSim::Genetics::OrganismPtr& creature) { return !creature->isAlive(); }),
-        c.end()
-    );
+    {
+        ECOSIM_TICK_PHASE(RemoveDead);
+        c.removeDead();
+    }
     
     gs.population = c.size();
     g_creatureCount = c.size();
@@ -559,117 +737,202 @@ void printStatus(int tick, const std::vector<EcoSim::Genetics::OrganismPtr>& cre
 }
 
 //================================================================================
-// Main
+// Memory Reporting
 //================================================================================
-int main(int argc, char* argv[]) {
-    // Install signal handlers
-    signal(SIGSEGV, signalHandler);
-    signal(SIGABRT, signalHandler);
-    signal(SIGFPE, signalHandler);
-    
-    // Parse arguments
-    SimulationConfig config = parseArgs(argc, argv);
-    
-    std::cout << "╔════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║         ECOSIM HEADLESS SIMULATION RUNNER                  ║\n";
-    std::cout << "╚════════════════════════════════════════════════════════════╝\n";
-    std::cout << "Configuration:\n";
-    std::cout << "  Max ticks:     " << config.maxTicks << "\n";
-    std::cout << "  Population:    " << config.population << "\n";
-    std::cout << "  Seed:          " << config.seed << "\n";
-    std::cout << "  Map size:      " << config.mapWidth << "x" << config.mapHeight << "\n";
-    std::cout << "  Verbose:       " << (config.verbose ? "yes" : "no") << "\n";
-    std::cout << "  Nav debug:     " << (config.navDebug ? "yes" : "no") << "\n";
-    std::cout << "  Behavior debug:" << (config.behaviorDebug ? "yes" : "no") << "\n";
-    std::cout << "────────────────────────────────────────────────────────────\n";
-    
-    // Configure logger
+/**
+ * Size of every subsystem of one run. Walks every organism.
+ */
+MemoryReport captureMemory(const World& world, const EcoSim::Genetics::OrganismStore& creatures,
+                           const TimeSeriesStore& series) {
+    MemoryReport report;
+    world.reportMemory(report);
+    report.add("creatures", creatures.memoryUsage(), creatures.size());
+    report.add("statistics", series.memoryUsage());
+    report.add("logger", Logger::getInstance().memoryUsage());
+    return report;
+}
+
+/**
+ * Check a report against the budget. The Logger only reaches the console
+ * with --verbose, so new overruns are also reported on stderr.
+ */
+void checkMemoryBudget(MemoryBudget& budget, const MemoryReport& report,
+                       const SimulationConfig& config, int tick) {
+    for (const MemoryBudget::Overrun& overrun : budget.check(report)) {
+        std::cerr << "[Headless] Warning: seed " << config.seed << " tick " << tick
+                  << ": " << overrun.name << " uses " << std::fixed << std::setprecision(1)
+                  << static_cast<double>(overrun.bytes) / (1024.0 * 1024.0) << " MB, over its "
+                  << static_cast<double>(overrun.limit) / (1024.0 * 1024.0) << " MB budget"
+                  << std::defaultfloat << std::endl;
+    }
+}
+
+void printMemoryJson(const MemoryReport& report, const MemoryBudget& budget) {
+    std::cout << "  \"memory\": {\n";
+    std::cout << "    \"total_bytes\": " << report.total() << ",\n";
+    std::cout << "    \"subsystems\": {\n";
+    const auto& entries = report.entries();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const MemoryReport::Entry& entry = entries[i];
+        std::cout << "      \"" << entry.name << "\": {\"bytes\": " << entry.bytes;
+        if (entry.objects > 0) {
+            std::cout << ", \"objects\": " << entry.objects
+                      << ", \"bytes_per_object\": " << entry.bytes / entry.objects;
+        }
+        if (size_t limit = budget.limitFor(entry.name)) {
+            std::cout << ", \"budget\": " << limit;
+        }
+        std::cout << "}" << (i + 1 < entries.size() ? "," : "") << "\n";
+    }
+    std::cout << "    },\n";
+    std::cout << "    \"over_budget\": [";
+    const std::vector<std::string> over = budget.exceeded();
+    for (size_t i = 0; i < over.size(); ++i) {
+        std::cout << (i ? ", " : "") << "\"" << over[i] << "\"";
+    }
+    std::cout << "]\n";
+    std::cout << "  }\n";
+}
+
+//================================================================================
+// Single Run
+//================================================================================
+/**
+ * Generate a world, populate it and simulate it for config.maxTicks ticks.
+ * Everything the run mutates is local to it, so runs may execute on
+ * several threads at once.
+ */
+RunSummary runSimulation(const SimulationConfig& config, SpawnFactories& factories) {
     Logger& logger = Logger::getInstance();
-    LoggerConfig logConfig;
-    logConfig.minLevel = config.verbose ? LogLevel::DEBUG : LogLevel::INFO;
-    logConfig.flushMode = FlushMode::PERIODIC;
-    logConfig.periodicFlushCount = 100;
-    logConfig.consoleOutput = config.verbose;
-    logConfig.fileOutput = false;
-    logger.configure(logConfig);
-    
-    // Initialize genetics system
-    std::cout << "[Headless] Initializing genetics system...\n";
-    g_lastAction = "initializing gene registry";
-    Creature::initializeGeneRegistry();
+
+    // Everything random in this run (plants, spawning, genetics, movement)
+    // derives from the run seed, so a seed reproduces the run
+    EcoSim::Genetics::RandomEngine::seed(config.seed);
     
     // Generate world
-    std::cout << "[Headless] Generating climate-based world (seed=" << config.seed << ")...\n";
+    if (!config.quiet) {
+        std::cout << "[Headless] Generating climate-based world (seed=" << config.seed << ")...\n";
+    }
     g_lastAction = "generating world";
     World world = initializeWorld(config);
+    if (config.lod) {
+        EcoSim::TurnSchedulerConfig lod;
+        lod.enabled = true;
+        lod.maxNeedDrift = config.lodDrift;
+        world.turnScheduler().setConfig(lod);
+    }
+    if (config.groundCoverField) {
+        world.plants().setGroundCoverField(true);
+    }
+    if (config.compactPlants) {
+        world.plants().setCompactPlants(true);
+    }
+    if (world.isChunked()) {
+        // Plants and creatures start on the chunks around the centre
+        world.prefetchChunks(static_cast<int>(config.mapWidth / 2), static_cast<int>(config.mapHeight / 2),
+                             world.chunks()->getConfig().evictionRadius);
+    }
     
     // Initialize plants
-    std::cout << "[Headless] Adding genetics-based plants...\n";
+    if (!config.quiet) {
+        std::cout << "[Headless] Adding genetics-based plants...\n";
+    }
     g_lastAction = "adding plants";
     addGeneticsPlants(world);
     
     // Plant warm-up period
     const int PLANT_WARMUP = 50;
-    std::cout << "[Headless] Running plant warm-up (" << PLANT_WARMUP << " ticks)...\n";
+    if (!config.quiet) {
+        std::cout << "[Headless] Running plant warm-up (" << PLANT_WARMUP << " ticks)...\n";
+    }
     for (int i = 0; i < PLANT_WARMUP; ++i) {
         g_lastAction = "plant warmup tick " + std::to_string(i);
         world.updateAllObjects();
     }
     
     // Spawn creatures
-    std::vector<EcoSim::Genetics::OrganismPtr> creatures;
+    EcoSim::Genetics::OrganismStore creatures;
     Calendar calendar;
-    std::cout << "[Headless] Populating world with " << config.population << " creatures...\n";
+    if (!config.quiet) {
+        std::cout << "[Headless] Populating world with " << config.population << " creatures...\n";
+    }
     g_lastAction = "populating world";
-    populateWorldByBiome(world, creatures, config.population, config);
+    populateWorldByBiome(world, creatures, config.population, config, factories);
     g_creatureCount = creatures.size();
     
-    std::cout << "────────────────────────────────────────────────────────────\n";
-    std::cout << "[Headless] Starting simulation...\n\n";
+    if (!config.quiet) {
+        std::cout << "────────────────────────────────────────────────────────────\n";
+        std::cout << "[Headless] Starting simulation...\n\n";
+    }
     
     // Start timing
     auto startTime = std::chrono::high_resolution_clock::now();
     
+    // Bounded multi-resolution history, optionally streamed to disk
+    TimeSeriesStore series;
+    if (!config.seriesPath.empty() && !series.openStream(config.seriesPath)) {
+        std::cerr << "[Headless] Warning: could not open series file '"
+                  << config.seriesPath << "'" << std::endl;
+    }
+    
+    // Soft memory limits, checked at every status interval
+    MemoryBudget memoryBudget = MemoryBudget::fromEnvironment();
+    for (const std::string& spec : config.memoryBudgets) {
+        if (!memoryBudget.parseLimit(spec)) {
+            std::cerr << "[Headless] Warning: ignoring memory budget '" << spec
+                      << "' (expected NAME=MB)" << std::endl;
+        }
+    }
+    
     // Main simulation loop
-    GeneralStats gs = { calendar, 0, 0, 0, 0 };
+    GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
     // Cumulative totals across all ticks (GeneralStats.deaths / .births
     // get reset each tick by advanceSimulation, so we accumulate here).
-    unsigned totalOldAge = 0, totalStarved = 0, totalDehydrated = 0;
-    unsigned totalDiscomfort = 0, totalPredator = 0, totalBirths = 0;
+    RunSummary summary;
 
     for (int tick = 0; tick < config.maxTicks; ++tick) {
         g_currentTick = tick;
-        logger.setCurrentTick(tick);
+        if (!config.quiet) {
+            logger.setCurrentTick(tick);
+        }
 
         // Reset per-tick stats
-        gs = { calendar, static_cast<unsigned>(creatures.size()), 0, 0, 0 };
+        gs = { calendar, static_cast<unsigned>(creatures.size()), 0, 0, 0, {} };
         
         // Advance simulation
         advanceSimulation(world, creatures, gs, config);
+        series.append(gs);
 
         // Accumulate into cumulative totals
-        totalOldAge     += gs.deaths.oldAge;
-        totalStarved    += gs.deaths.starved;
-        totalDehydrated += gs.deaths.dehydrated;
-        totalDiscomfort += gs.deaths.discomfort;
-        totalPredator   += gs.deaths.predator;
-        totalBirths     += gs.births;
+        summary.deathsOldAge     += gs.deaths.oldAge;
+        summary.deathsStarved    += gs.deaths.starved;
+        summary.deathsDehydrated += gs.deaths.dehydrated;
+        summary.deathsDiscomfort += gs.deaths.discomfort;
+        summary.deathsPredator   += gs.deaths.predator;
+        summary.births           += gs.births;
 
         // Status report — show cumulative totals
-        if (tick % config.statusInterval == 0) {
+        if (!config.quiet && tick % config.statusInterval == 0) {
             GeneralStats cumulative = gs;
-            cumulative.deaths.oldAge     = totalOldAge;
-            cumulative.deaths.starved    = totalStarved;
-            cumulative.deaths.dehydrated = totalDehydrated;
-            cumulative.deaths.discomfort = totalDiscomfort;
-            cumulative.deaths.predator   = totalPredator;
-            cumulative.births            = totalBirths;
-            printStatus(tick, creatures, cumulative, config);
+            cumulative.deaths.oldAge     = summary.deathsOldAge;
+            cumulative.deaths.starved    = summary.deathsStarved;
+            cumulative.deaths.dehydrated = summary.deathsDehydrated;
+            cumulative.deaths.discomfort = summary.deathsDiscomfort;
+            cumulative.deaths.predator   = summary.deathsPredator;
+            cumulative.births            = summary.births;
+            printStatus(tick, creatures.organisms(), cumulative, config);
+        }
+        
+        if (!memoryBudget.empty() && tick % config.statusInterval == 0) {
+            checkMemoryBudget(memoryBudget, captureMemory(world, creatures, series), config, tick);
         }
         
         // Check for extinction
         if (creatures.empty()) {
-            std::cout << "\n[Headless] EXTINCTION at tick " << tick << "!\n";
+            if (!config.quiet) {
+                std::cout << "\n[Headless] EXTINCTION at tick " << tick << "!\n";
+            }
+            summary.extinct = true;
             break;
         }
         
@@ -678,10 +941,27 @@ int main(int argc, char* argv[]) {
     
     // End timing
     auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    summary.elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+    summary.ticksRun = g_currentTick;
+    summary.finalPopulation = creatures.size();
+    summary.turnsTaken = world.turnScheduler().turnsTaken();
+    summary.turnsSkipped = world.turnScheduler().turnsSkipped();
+
+    // Average needs across surviving creatures
+    if (!creatures.empty()) {
+        for (const auto& c : creatures) {
+            summary.avgHunger += c->getHunger();
+            summary.avgThirst += c->getThirst();
+            summary.avgFatigue += c->getFatigue();
+        }
+        float n = static_cast<float>(creatures.size());
+        summary.avgHunger /= n;
+        summary.avgThirst /= n;
+        summary.avgFatigue /= n;
+    }
     
     // Metrics output (JSON format for regression comparison)
-    if (config.metrics) {
+    if (config.metrics && !config.quiet) {
         std::cout << "\n{\"metrics\": {\n";
         std::cout << "  \"seed\": " << config.seed << ",\n";
         std::cout << "  \"final_population\": " << creatures.size() << ",\n";
@@ -694,43 +974,344 @@ int main(int argc, char* argv[]) {
         std::cout << "    \"combat\": " << gs.deaths.predator << "\n";
         std::cout << "  },\n";
         std::cout << "  \"births\": " << gs.births << ",\n";
+        std::cout << "  \"avg_hunger\": " << summary.avgHunger << ",\n";
+        std::cout << "  \"avg_thirst\": " << summary.avgThirst << ",\n";
+        std::cout << "  \"avg_fatigue\": " << summary.avgFatigue << ",\n";
+        if (config.lod) {
+            std::cout << "  \"lod\": {\"turns_taken\": " << summary.turnsTaken
+                      << ", \"turns_skipped\": " << summary.turnsSkipped << "},\n";
+        }
+        const MemoryReport memory = captureMemory(world, creatures, series);
+        checkMemoryBudget(memoryBudget, memory, config, g_currentTick);
+        printMemoryJson(memory, memoryBudget);
+        std::cout << "}}\n";
+    }
+    
+    if (series.isStreaming() && !config.quiet) {
+        std::cout << "  Series rows:    " << series.streamedRows()
+                  << " -> " << config.seriesPath << "\n";
+    }
+
+    return summary;
+}
+
+//================================================================================
+// Batch Mode
+//================================================================================
+/**
+ * Read one job per non-empty line. Each line is applied on top of the
+ * command line options.
+ *
+ * @return false if the manifest cannot be read or has an unknown option.
+ */
+bool loadManifest(const std::string& path, const SimulationConfig& base,
+                  std::vector<SimulationConfig>& jobs) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "[Batch] Error: cannot open manifest '" << path << "'" << std::endl;
+        return false;
+    }
+    
+    std::string line;
+    for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        
+        std::istringstream tokens(line);
+        std::vector<std::string> args;
+        for (std::string token; tokens >> token;) {
+            args.push_back(token);
+        }
+        if (args.empty()) {
+            continue;
+        }
+        
+        SimulationConfig job = base;
+        std::string unknown = applyArgs(job, args);
+        if (!unknown.empty()) {
+            std::cerr << "[Batch] Error: " << path << ":" << lineNumber
+                      << ": unknown option '" << unknown << "'" << std::endl;
+            return false;
+        }
+        if (job.seed == 0) {
+            job.seed = randomSeed();
+        }
+        job.quiet = true;
+        jobs.push_back(job);
+    }
+    
+    return true;
+}
+
+/**
+ * One result line: the job's settings followed by its summary.
+ */
+std::string summaryJson(size_t index, const SimulationConfig& job, const RunSummary& summary) {
+    std::ostringstream out;
+    out << "{\"job\": " << index
+        << ", \"seed\": " << job.seed
+        << ", \"population\": " << job.population
+        << ", \"ticks\": " << job.maxTicks
+        << ", \"width\": " << job.mapWidth
+        << ", \"height\": " << job.mapHeight
+        << ", \"ticks_run\": " << summary.ticksRun
+        << ", \"final_population\": " << summary.finalPopulation
+        << ", \"extinct\": " << (summary.extinct ? "true" : "false")
+        << ", \"births\": " << summary.births
+        << ", \"deaths\": {\"old_age\": " << summary.deathsOldAge
+        << ", \"starvation\": " << summary.deathsStarved
+        << ", \"dehydration\": " << summary.deathsDehydrated
+        << ", \"discomfort\": " << summary.deathsDiscomfort
+        << ", \"combat\": " << summary.deathsPredator << "}"
+        << ", \"avg_hunger\": " << summary.avgHunger
+        << ", \"avg_thirst\": " << summary.avgThirst
+        << ", \"avg_fatigue\": " << summary.avgFatigue
+        << ", \"elapsed_ms\": " << summary.elapsedMs;
+    if (job.lod) {
+        out << ", \"lod\": {\"turns_taken\": " << summary.turnsTaken
+            << ", \"turns_skipped\": " << summary.turnsSkipped << "}";
+    }
+    out << "}";
+    return out.str();
+}
 
-        // Average needs across surviving creatures
-        float avgHunger = 0, avgThirst = 0, avgFatigue = 0;
-        if (!creatures.empty()) {
-            for (const auto& c : creatures) {
-                avgHunger += c->getHunger();
-                avgThirst += c->getThirst();
-                avgFatigue += c->getFatigue();
+/**
+ * Point the climate cache at a directory shared by all jobs. Must run
+ * before any worker starts, since the cache location is read from the
+ * environment.
+ */
+std::string setupWorldCache(const SimulationConfig& config) {
+    std::string directory = config.worldCache;
+    if (directory.empty()) {
+        directory = EcoSim::ClimateWorldGenerator::defaultCacheDirectory();
+    }
+    if (directory.empty()) {
+        directory = (std::filesystem::temp_directory_path() / "ecosim_world_cache").string();
+    }
+#ifdef _WIN32
+    _putenv_s("ECOSIM_WORLD_CACHE", directory.c_str());
+#else
+    setenv("ECOSIM_WORLD_CACHE", directory.c_str(), 1);
+#endif
+    return directory;
+}
+
+/**
+ * Run every job in the manifest on the shared worker pool.
+ *
+ * @return Process exit code.
+ */
+int runBatch(const SimulationConfig& base, SpawnFactories& factories) {
+    std::vector<SimulationConfig> jobs;
+    if (!loadManifest(base.batchPath, base, jobs)) {
+        return 1;
+    }
+    if (jobs.empty()) {
+        std::cerr << "[Batch] Error: manifest '" << base.batchPath << "' has no jobs" << std::endl;
+        return 1;
+    }
+    
+    std::ofstream results(base.resultsPath, std::ios::trunc);
+    if (!results) {
+        std::cerr << "[Batch] Error: cannot write results to '" << base.resultsPath << "'" << std::endl;
+        return 1;
+    }
+    
+    std::string cacheDirectory = setupWorldCache(base);
+    
+    std::cout << "[Batch] " << jobs.size() << " jobs from " << base.batchPath
+              << " on " << EcoSim::parallelConcurrency() << " threads\n";
+    std::cout << "[Batch] World cache: " << cacheDirectory << "\n";
+    std::cout << "[Batch] Results: " << base.resultsPath << "\n";
+    std::cout << "────────────────────────────────────────────────────────────\n";
+    
+    auto wallStart = std::chrono::steady_clock::now();
+    
+    // Worlds used by more than one job are generated once up front, so the
+    // jobs load them from the cache instead of all generating them at once
+    using WorldKey = std::tuple<unsigned, unsigned, unsigned>;
+    std::set<WorldKey> seen;
+    std::set<WorldKey> sharedKeys;
+    for (const SimulationConfig& job : jobs) {
+        WorldKey key(job.seed, job.mapWidth, job.mapHeight);
+        if (!seen.insert(key).second) {
+            sharedKeys.insert(key);
+        }
+    }
+    std::vector<SimulationConfig> sharedWorlds;
+    for (const SimulationConfig& job : jobs) {
+        WorldKey key(job.seed, job.mapWidth, job.mapHeight);
+        if (sharedKeys.erase(key) > 0) {
+            sharedWorlds.push_back(job);
+        }
+    }
+    if (!sharedWorlds.empty()) {
+        std::cout << "[Batch] Caching " << sharedWorlds.size() << " shared worlds...\n";
+        EcoSim::parallelFor(0, sharedWorlds.size(), 1, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                initializeWorld(sharedWorlds[i]);
+            }
+        });
+    }
+    
+    std::mutex outputMutex;
+    size_t finished = 0;
+    size_t failed = 0;
+    long long busyMs = 0;
+    
+    EcoSim::parallelFor(0, jobs.size(), 1, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            const SimulationConfig& job = jobs[i];
+            auto jobStart = std::chrono::steady_clock::now();
+            
+            std::string line;
+            std::string error;
+            try {
+                RunSummary summary = runSimulation(job, factories);
+                line = summaryJson(i, job, summary);
+            } catch (const std::exception& e) {
+                error = e.what();
+                std::replace(error.begin(), error.end(), '"', '\'');
+                line = "{\"job\": " + std::to_string(i) + ", \"seed\": " + std::to_string(job.seed) +
+                       ", \"error\": \"" + error + "\"}";
+            }
+            
+            long long jobMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - jobStart).count();
+            
+            std::lock_guard<std::mutex> lock(outputMutex);
+            results << line << '\n' << std::flush;
+            ++finished;
+            busyMs += jobMs;
+            std::cout << "[Batch] " << std::setw(4) << finished << "/" << jobs.size()
+                      << "  job " << i << " (seed " << job.seed << ") ";
+            if (error.empty()) {
+                std::cout << "done in " << jobMs << " ms\n";
+            } else {
+                ++failed;
+                std::cout << "FAILED: " << error << "\n";
             }
-            float n = static_cast<float>(creatures.size());
-            avgHunger /= n;
-            avgThirst /= n;
-            avgFatigue /= n;
         }
-        std::cout << "  \"avg_hunger\": " << avgHunger << ",\n";
-        std::cout << "  \"avg_thirst\": " << avgThirst << ",\n";
-        std::cout << "  \"avg_fatigue\": " << avgFatigue << "\n";
-        std::cout << "}}\n";
+    });
+    
+    long long wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - wallStart).count();
+    
+    std::cout << "────────────────────────────────────────────────────────────\n";
+    std::cout << "[Batch] " << (jobs.size() - failed) << " of " << jobs.size() << " jobs completed\n";
+    std::cout << "  Wall time:      " << wallMs << " ms\n";
+    std::cout << "  Job time:       " << busyMs << " ms\n";
+    std::cout << "  Parallelism:    " << std::fixed << std::setprecision(1)
+              << (wallMs > 0 ? static_cast<double>(busyMs) / static_cast<double>(wallMs) : 0.0) << "x\n";
+    
+    return failed == 0 ? 0 : 1;
+}
+
+//================================================================================
+// Profiling
+//================================================================================
+/**
+ * Stop the capture started for --trace and write it out.
+ */
+void writeTrace(const std::string& path) {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.stop();
+    if (!profiler.writeChromeTrace(path)) {
+        std::cerr << "[Headless] Could not write trace " << path << "\n";
+        return;
+    }
+    std::cout << "[Headless] Wrote " << profiler.eventCount() << " profiling zones to " << path;
+    if (profiler.droppedCount() > 0) {
+        std::cout << " (" << profiler.droppedCount() << " dropped)";
     }
+    std::cout << "\n";
+}
 
+//================================================================================
+// Main
+//================================================================================
+int main(int argc, char* argv[]) {
+    // Install signal handlers
+    signal(SIGSEGV, signalHandler);
+    signal(SIGABRT, signalHandler);
+    signal(SIGFPE, signalHandler);
+    
+    // Parse arguments
+    SimulationConfig config = parseArgs(argc, argv);
+    
+    std::cout << "╔════════════════════════════════════════════════════════════╗\n";
+    std::cout << "║         ECOSIM HEADLESS SIMULATION RUNNER                  ║\n";
+    std::cout << "╚════════════════════════════════════════════════════════════╝\n";
+    if (config.batchPath.empty()) {
+        std::cout << "Configuration:\n";
+        std::cout << "  Max ticks:     " << config.maxTicks << "\n";
+        std::cout << "  Population:    " << config.population << "\n";
+        std::cout << "  Seed:          " << config.seed << "\n";
+        std::cout << "  Map size:      " << config.mapWidth << "x" << config.mapHeight << "\n";
+        std::cout << "  Verbose:       " << (config.verbose ? "yes" : "no") << "\n";
+        std::cout << "  Nav debug:     " << (config.navDebug ? "yes" : "no") << "\n";
+        std::cout << "  Behavior debug:" << (config.behaviorDebug ? "yes" : "no") << "\n";
+        std::cout << "────────────────────────────────────────────────────────────\n";
+    }
+    
+    // Configure logger
+    Logger& logger = Logger::getInstance();
+    LoggerConfig logConfig;
+    logConfig.minLevel = config.verbose ? LogLevel::DEBUG : LogLevel::INFO;
+    logConfig.flushMode = FlushMode::PERIODIC;
+    logConfig.periodicFlushCount = 100;
+    logConfig.consoleOutput = config.verbose;
+    logConfig.fileOutput = false;
+    logger.configure(logConfig);
+    
+    // Initialize genetics system. Shared state is set up here, before any
+    // batch worker starts, and only read afterwards.
+    std::cout << "[Headless] Initializing genetics system...\n";
+    g_lastAction = "initializing gene registry";
+    Creature::initializeGeneRegistry();
+    Creature::initializeInteractionSystems();
+    SpawnFactories factories;
+    
+    if (!config.tracePath.empty()) {
+        Profiler::getInstance().setThreadName("main");
+        Profiler::getInstance().start();
+    }
+    
+    if (!config.batchPath.empty()) {
+        int status = runBatch(config, factories);
+        if (!config.tracePath.empty()) writeTrace(config.tracePath);
+        return status;
+    }
+    
+    RunSummary summary = runSimulation(config, factories);
+    if (!config.tracePath.empty()) writeTrace(config.tracePath);
+    
     // Final report
     std::cout << "\n────────────────────────────────────────────────────────────\n";
     std::cout << "[Headless] Simulation complete!\n";
-    std::cout << "  Duration:       " << duration.count() << " ms\n";
+    std::cout << "  Duration:       " << summary.elapsedMs << " ms\n";
     std::cout << "  Ticks/second:   " << std::fixed << std::setprecision(1)
-              << (g_currentTick * 1000.0 / duration.count()) << "\n";
-    std::cout << "  Final pop:      " << creatures.size() << "\n";
+              << (summary.ticksRun * 1000.0 / static_cast<double>(summary.elapsedMs)) << "\n";
+    std::cout << "  Final pop:      " << summary.finalPopulation << "\n";
     std::cout << "  Total deaths:\n";
-    std::cout << "    Old age:      " << totalOldAge << "\n";
-    std::cout << "    Starvation:   " << totalStarved << "\n";
-    std::cout << "    Dehydration:  " << totalDehydrated << "\n";
-    std::cout << "    Discomfort:   " << totalDiscomfort << "\n";
-    std::cout << "    Predator:     " << totalPredator << "\n";
-    std::cout << "  Total births:   " << totalBirths << "\n";
+    std::cout << "    Old age:      " << summary.deathsOldAge << "\n";
+    std::cout << "    Starvation:   " << summary.deathsStarved << "\n";
+    std::cout << "    Dehydration:  " << summary.deathsDehydrated << "\n";
+    std::cout << "    Discomfort:   " << summary.deathsDiscomfort << "\n";
+    std::cout << "    Predator:     " << summary.deathsPredator << "\n";
+    std::cout << "  Total births:   " << summary.births << "\n";
+    if (config.lod) {
+        const std::uint64_t turns = summary.turnsTaken + summary.turnsSkipped;
+        std::cout << "  LOD skipped:    " << summary.turnsSkipped << " of " << turns
+                  << " creature turns ("
+                  << (turns ? 100.0 * static_cast<double>(summary.turnsSkipped) / static_cast<double>(turns) : 0.0)
+                  << "%)\n";
+    }
     std::cout << "────────────────────────────────────────────────────────────\n";
     
-    if (!creatures.empty()) {
+    if (summary.finalPopulation > 0) {
         std::cout << "\n[Headless] SUCCESS - Simulation completed without crash!\n";
     }
     
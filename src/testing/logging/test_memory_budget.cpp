@@ -0,0 +1,151 @@
+/**
+ * @file test_memory_budget.cpp
+ * @brief Unit tests for MemoryBudget limit parsing and checks
+ */
+
+#include "logging/MemoryReport.hpp"
+#include "logging/Logger.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace EcoSim::Testing;
+using logging::Logger;
+using logging::MemoryBudget;
+using logging::MemoryReport;
+
+namespace {
+
+constexpr std::size_t MB = 1024 * 1024;
+
+/// Keeps the MEMORY_BUDGET warnings that check() logs out of the test output
+class QuietBudgetWarnings {
+public:
+    QuietBudgetWarnings() { Logger::getInstance().disableEventType("MEMORY_BUDGET"); }
+    ~QuietBudgetWarnings() { Logger::getInstance().enableEventType("MEMORY_BUDGET"); }
+};
+
+/// Budget read from ECOSIM_MEMORY_BUDGET set to the given value
+MemoryBudget budgetFromEnvironment(const char* value) {
+    setenv("ECOSIM_MEMORY_BUDGET", value, 1);
+    MemoryBudget budget = MemoryBudget::fromEnvironment();
+    unsetenv("ECOSIM_MEMORY_BUDGET");
+    return budget;
+}
+
+MemoryReport makeReport(std::size_t plants, std::size_t creatures) {
+    MemoryReport report;
+    report.add("plants", plants);
+    report.add("creatures", creatures);
+    return report;
+}
+
+//==============================================================================
+// Tests: Parsing
+//==============================================================================
+
+void test_parse_limit_accepts_megabytes() {
+    MemoryBudget budget;
+    TEST_ASSERT(budget.empty());
+
+    TEST_ASSERT(budget.parseLimit("plants=256"));
+    TEST_ASSERT(budget.parseLimit("total=0.5"));
+    TEST_ASSERT_EQ(256 * MB, budget.limitFor("plants"));
+    TEST_ASSERT_EQ(MB / 2, budget.limitFor(MemoryBudget::TOTAL));
+    TEST_ASSERT_EQ(std::size_t(0), budget.limitFor("creatures"));
+
+    // A repeated name replaces the earlier limit
+    TEST_ASSERT(budget.parseLimit("plants=64"));
+    TEST_ASSERT_EQ(64 * MB, budget.limitFor("plants"));
+}
+
+void test_parse_limit_rejects_malformed_specs() {
+    MemoryBudget budget;
+    const std::vector<std::string> malformed = {
+        "", "plants", "plants=", "=5", "plants=abc", "plants=12MB",
+        "plants=0", "plants=-3", "plants= "
+    };
+    for (const std::string& spec : malformed) {
+        TEST_ASSERT_MSG(!budget.parseLimit(spec), "accepted '" + spec + "'");
+    }
+    TEST_ASSERT(budget.empty());
+}
+
+void test_from_environment_skips_malformed_items() {
+    MemoryBudget budget = budgetFromEnvironment("plants=2,=5,creatures=,total=x,,total=8");
+    TEST_ASSERT_EQ(2 * MB, budget.limitFor("plants"));
+    TEST_ASSERT_EQ(8 * MB, budget.limitFor(MemoryBudget::TOTAL));
+    TEST_ASSERT_EQ(std::size_t(0), budget.limitFor("creatures"));
+    TEST_ASSERT_EQ(std::size_t(0), budget.limitFor(""));
+
+    unsetenv("ECOSIM_MEMORY_BUDGET");
+    TEST_ASSERT(MemoryBudget::fromEnvironment().empty());
+    TEST_ASSERT(budgetFromEnvironment("").empty());
+}
+
+//==============================================================================
+// Tests: Checking Reports
+//==============================================================================
+
+void test_check_reports_each_overrun_once() {
+    QuietBudgetWarnings quiet;
+    MemoryBudget budget;
+    budget.setLimit("plants", 100);
+    budget.setLimit("creatures", 1000);
+
+    std::vector<MemoryBudget::Overrun> overruns = budget.check(makeReport(150, 500));
+    TEST_ASSERT_EQ(std::size_t(1), overruns.size());
+    TEST_ASSERT_EQ(std::string("plants"), overruns[0].name);
+    TEST_ASSERT_EQ(std::size_t(150), overruns[0].bytes);
+    TEST_ASSERT_EQ(std::size_t(100), overruns[0].limit);
+
+    // Still over: no new warning, but the limit stays reported as exceeded
+    TEST_ASSERT(budget.check(makeReport(200, 500)).empty());
+    TEST_ASSERT_EQ(std::size_t(1), budget.exceeded().size());
+
+    // Back under, then over again: warns again
+    TEST_ASSERT(budget.check(makeReport(100, 500)).empty());
+    TEST_ASSERT(budget.exceeded().empty());
+    TEST_ASSERT_EQ(std::size_t(1), budget.check(makeReport(101, 500)).size());
+}
+
+void test_check_total_and_missing_entries() {
+    QuietBudgetWarnings quiet;
+    MemoryBudget budget;
+    budget.setLimit(MemoryBudget::TOTAL, 1000);
+    budget.setLimit("statistics", 10);
+
+    // Entries absent from the report count as zero bytes
+    TEST_ASSERT(budget.check(makeReport(400, 600)).empty());
+
+    std::vector<MemoryBudget::Overrun> overruns = budget.check(makeReport(400, 601));
+    TEST_ASSERT_EQ(std::size_t(1), overruns.size());
+    TEST_ASSERT_EQ(std::string(MemoryBudget::TOTAL), overruns[0].name);
+    TEST_ASSERT_EQ(std::size_t(1001), overruns[0].bytes);
+
+    // Replacing a limit clears its exceeded state
+    budget.setLimit(MemoryBudget::TOTAL, 2000);
+    TEST_ASSERT(budget.exceeded().empty());
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runMemoryBudgetTests() {
+    BEGIN_TEST_GROUP("MemoryBudget - Parsing");
+    RUN_TEST(test_parse_limit_accepts_megabytes);
+    RUN_TEST(test_parse_limit_rejects_malformed_specs);
+    RUN_TEST(test_from_environment_skips_malformed_items);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("MemoryBudget - Checking Reports");
+    RUN_TEST(test_check_reports_each_overrun_once);
+    RUN_TEST(test_check_total_and_missing_entries);
+    END_TEST_GROUP();
+}
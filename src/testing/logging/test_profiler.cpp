@@ -0,0 +1,160 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Unit tests for Profiler zones and the Chrome trace export
+ */
+
+#include "logging/Profiler.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace EcoSim::Testing;
+using logging::ProfileEvent;
+using logging::ProfileZone;
+using logging::Profiler;
+
+namespace {
+
+const char* const OUTER = "test::outer";
+const char* const INNER = "test::inner";
+
+/// Records an inner zone nested inside an outer one on the calling thread
+void recordNestedZones() {
+    ProfileZone outer(OUTER);
+    ProfileZone inner(INNER);
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
+
+/// Captures nested zones on this thread and on a named worker thread
+void captureTwoThreads() {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.start();
+    recordNestedZones();
+    std::thread worker([&profiler]() {
+        profiler.setThreadName("test worker");
+        recordNestedZones();
+    });
+    worker.join();
+    profiler.stop();
+}
+
+/// Events of this test, grouped by thread
+std::map<std::uint32_t, std::vector<ProfileEvent>> testEventsByThread() {
+    std::map<std::uint32_t, std::vector<ProfileEvent>> byThread;
+    for (const auto& entry : Profiler::getInstance().events()) {
+        if (entry.second.name == OUTER || entry.second.name == INNER) {
+            byThread[entry.first].push_back(entry.second);
+        }
+    }
+    return byThread;
+}
+
+//==============================================================================
+// Tests: Zones
+//==============================================================================
+
+void test_nested_zones_on_two_threads() {
+    captureTwoThreads();
+
+    const auto byThread = testEventsByThread();
+    TEST_ASSERT_EQ(static_cast<std::size_t>(2), byThread.size());
+
+    for (const auto& entry : byThread) {
+        const std::vector<ProfileEvent>& events = entry.second;
+        TEST_ASSERT_EQ(static_cast<std::size_t>(2), events.size());
+
+        // Zones are recorded as they close, so the inner one comes first
+        const ProfileEvent& inner = events[0];
+        const ProfileEvent& outer = events[1];
+        TEST_ASSERT(std::strcmp(INNER, inner.name) == 0);
+        TEST_ASSERT(std::strcmp(OUTER, outer.name) == 0);
+        TEST_ASSERT_GE(inner.startNs, outer.startNs);
+        TEST_ASSERT_LE(inner.startNs + inner.durationNs, outer.startNs + outer.durationNs);
+        TEST_ASSERT_GE(inner.durationNs, static_cast<std::int64_t>(100000));
+    }
+}
+
+void test_zones_outside_capture_are_ignored() {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.start();
+    profiler.stop();
+    const std::size_t before = profiler.eventCount();
+
+    recordNestedZones();
+
+    TEST_ASSERT(!Profiler::isRecording());
+    TEST_ASSERT_EQ(before, profiler.eventCount());
+}
+
+//==============================================================================
+// Tests: Chrome Trace Export
+//==============================================================================
+
+void test_chrome_trace_events() {
+    captureTwoThreads();
+
+    const char* path = "test_profiler_trace.json";
+    TEST_ASSERT(Profiler::getInstance().writeChromeTrace(path));
+
+    std::ifstream in(path);
+    const nlohmann::json trace = nlohmann::json::parse(in);
+    in.close();
+    std::remove(path);
+
+    TEST_ASSERT(trace.contains("traceEvents"));
+    int outerZones = 0;
+    int innerZones = 0;
+    bool namedWorker = false;
+    for (const nlohmann::json& event : trace["traceEvents"]) {
+        if (event["ph"] == "M") {
+            if (event["args"]["name"] == "test worker") namedWorker = true;
+            continue;
+        }
+        TEST_ASSERT(event["ph"] == "X");
+        TEST_ASSERT_GE(event["ts"].get<double>(), 0.0);
+        TEST_ASSERT_GE(event["dur"].get<double>(), 0.0);
+        if (event["name"] == OUTER) ++outerZones;
+        if (event["name"] == INNER) {
+            ++innerZones;
+            TEST_ASSERT_GE(event["dur"].get<double>(), 100.0);
+        }
+    }
+    TEST_ASSERT_EQ(2, outerZones);
+    TEST_ASSERT_EQ(2, innerZones);
+    TEST_ASSERT(namedWorker);
+}
+
+void test_trace_not_written_while_recording() {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.start();
+    TEST_ASSERT(!profiler.writeChromeTrace("test_profiler_recording.json"));
+    TEST_ASSERT(profiler.events().empty());
+    profiler.stop();
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runProfilerTests() {
+    BEGIN_TEST_GROUP("Profiler - Zones");
+    RUN_TEST(test_nested_zones_on_two_threads);
+    RUN_TEST(test_zones_outside_capture_are_ignored);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("Profiler - Chrome Trace Export");
+    RUN_TEST(test_chrome_trace_events);
+    RUN_TEST(test_trace_not_written_while_recording);
+    END_TEST_GROUP();
+}
@@ -0,0 +1,202 @@
+/**
+ * @file test_tick_metrics.cpp
+ * @brief Unit tests for the TickMetrics history ring and AllocationCounter
+ */
+
+#include "logging/TickMetrics.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace EcoSim::Testing;
+using logging::TickMetrics;
+using logging::TickPhase;
+
+namespace {
+
+constexpr std::size_t HISTORY = TickMetrics::HISTORY_SIZE;
+
+/// Enables a cleared TickMetrics for one test and clears it again afterwards
+class RecordingMetrics {
+public:
+    RecordingMetrics() : metrics_(TickMetrics::getInstance()) {
+        metrics_.clear();
+        metrics_.setEnabled(true);
+    }
+
+    ~RecordingMetrics() {
+        metrics_.setEnabled(false);
+        metrics_.clear();
+    }
+
+    TickMetrics& operator*() { return metrics_; }
+    TickMetrics* operator->() { return &metrics_; }
+
+private:
+    TickMetrics& metrics_;
+};
+
+/// Records one tick whose path search expands `tick` nodes
+void recordTick(TickMetrics& metrics, std::uint64_t tick) {
+    metrics.beginTick(tick);
+    metrics.recordPathSearch(static_cast<unsigned>(tick));
+    metrics.addPhaseTime(TickPhase::CreatureTurns, 2000000);
+    metrics.endTick();
+}
+
+/// Keeps the allocations alive so they can't be optimized away
+std::vector<std::unique_ptr<int>> allocateInts(int count) {
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        values.push_back(std::make_unique<int>(i));
+    }
+    return values;
+}
+
+//==============================================================================
+// Tests: History Ring
+//==============================================================================
+
+void test_ring_keeps_ticks_in_order_until_full() {
+    RecordingMetrics metrics;
+    TEST_ASSERT(metrics->empty());
+
+    for (std::uint64_t tick = 0; tick < 10; ++tick) {
+        recordTick(*metrics, tick);
+    }
+    TEST_ASSERT_EQ(std::size_t(10), metrics->size());
+    TEST_ASSERT_EQ(std::uint64_t(0), metrics->at(0).tick);
+    TEST_ASSERT_EQ(std::uint64_t(9), metrics->latest().tick);
+    TEST_ASSERT_EQ(std::uint32_t(1), metrics->latest().pathSearches);
+    TEST_ASSERT_EQ(std::uint32_t(9), metrics->latest().pathNodes);
+}
+
+void test_ring_wraps_at_history_size() {
+    RecordingMetrics metrics;
+    const std::uint64_t ticks = HISTORY + 60;
+    for (std::uint64_t tick = 0; tick < ticks; ++tick) {
+        recordTick(*metrics, tick);
+    }
+
+    // The oldest 60 ticks were overwritten
+    TEST_ASSERT_EQ(HISTORY, metrics->size());
+    for (std::size_t i = 0; i < HISTORY; ++i) {
+        TEST_ASSERT_EQ(60 + i, metrics->at(i).tick);
+    }
+    TEST_ASSERT_EQ(ticks - 1, metrics->latest().tick);
+}
+
+void test_means_cover_only_the_kept_window() {
+    RecordingMetrics metrics;
+    for (std::uint64_t tick = 0; tick < 2 * HISTORY; ++tick) {
+        recordTick(*metrics, tick);
+    }
+
+    // Per-tick means as the dashboard computes them: over at(0..size)
+    double nodes = 0.0;
+    double turnsMs = 0.0;
+    for (std::size_t i = 0; i < metrics->size(); ++i) {
+        nodes += metrics->at(i).pathNodes;
+        turnsMs += static_cast<double>(metrics->at(i).phaseMs[static_cast<std::size_t>(TickPhase::CreatureTurns)]);
+    }
+    const double samples = static_cast<double>(metrics->size());
+
+    // Ticks HISTORY .. 2*HISTORY-1 remain, so the mean node count is their midpoint
+    const double expectedNodes = static_cast<double>(HISTORY) + static_cast<double>(HISTORY - 1) / 2.0;
+    TEST_ASSERT_NEAR(expectedNodes, nodes / samples, 1e-9);
+    TEST_ASSERT_NEAR(2.0, turnsMs / samples, 1e-4);
+}
+
+void test_nothing_recorded_while_disabled() {
+    RecordingMetrics metrics;
+    recordTick(*metrics, 1);
+
+    metrics->setEnabled(false);
+    recordTick(*metrics, 2);
+    TEST_ASSERT_EQ(std::size_t(1), metrics->size());
+    TEST_ASSERT_EQ(std::uint64_t(1), metrics->latest().tick);
+
+    // Disabling keeps the history; clear() drops it
+    metrics->clear();
+    TEST_ASSERT(metrics->empty());
+}
+
+void test_behaviors_are_tracked_by_name() {
+    RecordingMetrics metrics;
+    metrics->beginTick(1);
+    metrics->recordBehavior("feeding", 1000000);
+    metrics->recordBehavior("movement", 500000);
+    metrics->recordBehavior("feeding", 1000000);
+    metrics->endTick();
+
+    TEST_ASSERT_EQ(std::size_t(2), metrics->behaviorCount());
+    TEST_ASSERT_EQ(std::string("feeding"), metrics->behaviorName(0));
+    TEST_ASSERT_EQ(std::uint32_t(2), metrics->latest().behaviorCalls[0]);
+    TEST_ASSERT_NEAR(2.0f, metrics->latest().behaviorMs[0], 1e-4f);
+    TEST_ASSERT_EQ(std::uint32_t(1), metrics->latest().behaviorCalls[1]);
+
+    // Outside a tick nothing is counted
+    metrics->recordBehavior("resting", 1000000);
+    TEST_ASSERT_EQ(std::size_t(2), metrics->behaviorCount());
+}
+
+//==============================================================================
+// Tests: AllocationCounter
+//==============================================================================
+
+void test_allocations_are_counted_per_thread() {
+    const std::uint64_t before = logging::threadAllocationCount();
+    auto values = allocateInts(100);
+    TEST_ASSERT_GE(logging::threadAllocationCount() - before, std::uint64_t(100));
+
+    // Another thread's allocations don't reach this thread's counter
+    std::uint64_t workerCount = 0;
+    const std::uint64_t beforeWorker = logging::threadAllocationCount();
+    std::thread worker([&workerCount]() {
+        const std::uint64_t start = logging::threadAllocationCount();
+        auto workerValues = allocateInts(1000);
+        workerCount = logging::threadAllocationCount() - start;
+    });
+    worker.join();
+    TEST_ASSERT_GE(workerCount, std::uint64_t(1000));
+    TEST_ASSERT_LT(logging::threadAllocationCount() - beforeWorker, std::uint64_t(100));
+}
+
+void test_tick_sample_counts_its_allocations() {
+    RecordingMetrics metrics;
+    metrics->beginTick(1);
+    auto values = allocateInts(50);
+    metrics->endTick();
+    TEST_ASSERT_GE(metrics->latest().allocations, std::uint32_t(50));
+
+    metrics->beginTick(2);
+    metrics->endTick();
+    TEST_ASSERT_EQ(std::uint32_t(0), metrics->latest().allocations);
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runTickMetricsTests() {
+    BEGIN_TEST_GROUP("TickMetrics - History Ring");
+    RUN_TEST(test_ring_keeps_ticks_in_order_until_full);
+    RUN_TEST(test_ring_wraps_at_history_size);
+    RUN_TEST(test_means_cover_only_the_kept_window);
+    RUN_TEST(test_nothing_recorded_while_disabled);
+    RUN_TEST(test_behaviors_are_tracked_by_name);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TickMetrics - AllocationCounter");
+    RUN_TEST(test_allocations_are_counted_per_thread);
+    RUN_TEST(test_tick_sample_counts_its_allocations);
+    END_TEST_GROUP();
+}
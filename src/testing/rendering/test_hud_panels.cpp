@@ -0,0 +1,147 @@
+/**
+ * @file test_hud_panels.cpp
+ * @brief Unit tests for copying HUD panel data into render snapshots
+ *
+ * Tests that captureHUDPanels() copies only what the panel request names,
+ * lists living creatures only, and gives the inspector everything it shows
+ * without a pointer back into the simulation.
+ */
+
+#include "rendering/RenderSnapshot.hpp"
+#include "world/world.hpp"
+#include "genetics/organisms/CreatureFactory.hpp"
+#include "genetics/expression/Phenotype.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace EcoSim::Testing;
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+/// A small world with three creatures, the middle one dead
+struct PanelFixture {
+    World world;
+    std::vector<G::OrganismPtr> creatures;
+    TimeSeriesStore series;
+    logging::TickMetrics::History metrics;
+
+    PanelFixture() : world(smallMap(), OctaveGen()) {
+        auto registry = std::make_shared<G::GeneRegistry>();
+        G::UniversalGenes::registerDefaults(*registry);
+        G::CreatureFactory factory(registry);
+        factory.registerDefaultTemplates();
+
+        creatures.push_back(factory.createApexPredator(5, 6));
+        creatures.push_back(factory.createTankHerbivore(7, 8));
+        creatures.push_back(factory.createPackHunter(9, 10));
+        creatures[1]->die();
+    }
+
+    static MapGen smallMap() {
+        MapGen mapGen;
+        mapGen.rows = 40;
+        mapGen.cols = 60;
+        mapGen.seed = 4242.0;
+        return mapGen;
+    }
+
+    HUDPanels capture(const PanelRequest& request) const {
+        HUDPanels panels;
+        captureHUDPanels(world, creatures, series, metrics, request, panels);
+        return panels;
+    }
+};
+
+//==============================================================================
+// Test: Requests
+//==============================================================================
+
+void test_empty_request_copies_no_creatures() {
+    PanelFixture fixture;
+    HUDPanels panels = fixture.capture(PanelRequest());
+    TEST_ASSERT(panels.request == PanelRequest());
+    TEST_ASSERT(panels.creatures.empty());
+    TEST_ASSERT(!panels.hasSelected);
+}
+
+void test_world_details_follow_the_world() {
+    PanelFixture fixture;
+    PanelRequest request;
+    request.world = true;
+    HUDPanels panels = fixture.capture(request);
+
+    TEST_ASSERT_EQ(std::size_t(0), panels.world.corpses);
+    TEST_ASSERT_EQ(60u, panels.world.mapGen.cols);
+    TEST_ASSERT(panels.world.overview == &fixture.world.overview());
+}
+
+//==============================================================================
+// Test: Creatures
+//==============================================================================
+
+void test_creature_list_skips_the_dead() {
+    PanelFixture fixture;
+    PanelRequest request;
+    request.creatureList = true;
+    HUDPanels panels = fixture.capture(request);
+
+    TEST_ASSERT_EQ(std::size_t(2), panels.creatures.size());
+    TEST_ASSERT_EQ(fixture.creatures[0]->getSequentialId(), panels.creatures[0].id);
+    TEST_ASSERT_EQ(fixture.creatures[2]->getSequentialId(), panels.creatures[1].id);
+    TEST_ASSERT_EQ(9, panels.creatures[1].tileX);
+    TEST_ASSERT_EQ(10, panels.creatures[1].tileY);
+    TEST_ASSERT(!panels.hasSelected);
+}
+
+void test_selected_creature_is_copied_in_full() {
+    PanelFixture fixture;
+    const G::Organism& creature = *fixture.creatures[2];
+    PanelRequest request;
+    request.selectedCreature = creature.getSequentialId();
+    HUDPanels panels = fixture.capture(request);
+
+    // Selecting alone doesn't fill the list
+    TEST_ASSERT(panels.creatures.empty());
+    TEST_ASSERT(panels.hasSelected);
+    TEST_ASSERT_EQ(creature.getSequentialId(), panels.selected.id);
+    TEST_ASSERT_EQ(creature.getLifespan(), panels.selected.lifespan);
+    TEST_ASSERT(panels.selected.diet == creature.getPhenotype().calculateDietType());
+    TEST_ASSERT(!panels.selected.traits.empty());
+    TEST_ASSERT_NEAR(creature.getPhenotype().getTrait(G::UniversalGenes::LIFESPAN),
+                     panels.selected.trait(G::UniversalGenes::LIFESPAN), 1e-6f);
+    TEST_ASSERT_NEAR(0.0f, panels.selected.trait("NOT_A_GENE"), 1e-6f);
+}
+
+void test_dead_selection_is_reported_missing() {
+    PanelFixture fixture;
+    PanelRequest request;
+    request.selectedCreature = fixture.creatures[1]->getSequentialId();
+    TEST_ASSERT(!fixture.capture(request).hasSelected);
+
+    request.selectedCreature = -1;
+    TEST_ASSERT(!fixture.capture(request).hasSelected);
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runHUDPanelTests() {
+    BEGIN_TEST_GROUP("HUD Panels - Requests");
+    RUN_TEST(test_empty_request_copies_no_creatures);
+    RUN_TEST(test_world_details_follow_the_world);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("HUD Panels - Creatures");
+    RUN_TEST(test_creature_list_skips_the_dead);
+    RUN_TEST(test_selected_creature_is_copied_in_full);
+    RUN_TEST(test_dead_selection_is_reported_missing);
+    END_TEST_GROUP();
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_screen_buffer.cpp
+ * @brief Unit tests for NCursesScreenBuffer diffing and dirty-cell flushes
+ *
+ * curses is never initialized here, so stdscr is null and the writes made
+ * by flush() are no-ops. The cell counts flush() reports are what the
+ * renderer relies on, and those come from the diff alone.
+ */
+
+#include "rendering/backends/ncurses/NCursesScreenBuffer.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstddef>
+#include <string>
+
+using namespace EcoSim::Testing;
+
+namespace {
+
+constexpr int ROWS = 4;
+constexpr int COLS = 10;
+constexpr std::size_t ALL_CELLS = static_cast<std::size_t>(ROWS * COLS);
+
+/// A buffer whose first full flush has already happened
+NCursesScreenBuffer flushedBuffer() {
+    NCursesScreenBuffer screen;
+    screen.resize(ROWS, COLS);
+    screen.flush();
+    return screen;
+}
+
+//==============================================================================
+// Tests: Diffing
+//==============================================================================
+
+void test_first_flush_writes_every_cell() {
+    NCursesScreenBuffer screen;
+    screen.resize(ROWS, COLS);
+    TEST_ASSERT_EQ(ROWS, screen.rows());
+    TEST_ASSERT_EQ(COLS, screen.cols());
+
+    // Nothing is known about stdscr yet, so even blank cells are written
+    TEST_ASSERT_EQ(ALL_CELLS, screen.flush());
+    TEST_ASSERT_EQ(ALL_CELLS, screen.lastFlushCells());
+}
+
+void test_unchanged_frame_writes_nothing() {
+    NCursesScreenBuffer screen = flushedBuffer();
+
+    screen.clear();
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+
+    screen.put(1, 1, '#', 2);
+    screen.flush();
+    screen.clear();
+    screen.put(1, 1, '#', 2);
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+    TEST_ASSERT_EQ(std::size_t(0), screen.lastFlushCells());
+}
+
+void test_only_changed_cells_are_written() {
+    NCursesScreenBuffer screen = flushedBuffer();
+
+    screen.put(0, 0, '@', 1);
+    screen.putText(2, 3, "abc", 4);
+    TEST_ASSERT_EQ(std::size_t(4), screen.flush());
+
+    // Same glyph in a different color pair is still a change
+    screen.clear();
+    screen.put(0, 0, '@', 5);
+    screen.putText(2, 3, "abc", 4);
+    TEST_ASSERT_EQ(std::size_t(1), screen.flush());
+
+    // Cells that go back to blank are written once
+    screen.clear();
+    TEST_ASSERT_EQ(std::size_t(4), screen.flush());
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+}
+
+//==============================================================================
+// Tests: Invalidation and Clipping
+//==============================================================================
+
+void test_invalidate_forces_full_rewrite() {
+    NCursesScreenBuffer screen = flushedBuffer();
+    screen.put(3, 9, 'x', 1);
+    screen.flush();
+
+    screen.invalidate();
+    TEST_ASSERT_EQ(ALL_CELLS, screen.flush());
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+}
+
+void test_resize_forces_full_rewrite() {
+    NCursesScreenBuffer screen = flushedBuffer();
+
+    screen.resize(ROWS + 1, COLS);
+    TEST_ASSERT_EQ(ALL_CELLS + COLS, screen.flush());
+
+    screen.resize(-3, COLS);
+    TEST_ASSERT_EQ(0, screen.rows());
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+}
+
+void test_cells_outside_screen_are_clipped() {
+    NCursesScreenBuffer screen = flushedBuffer();
+
+    screen.put(-1, 0, 'x');
+    screen.put(0, -1, 'x');
+    screen.put(ROWS, 0, 'x');
+    screen.put(0, COLS, 'x');
+    TEST_ASSERT_EQ(std::size_t(0), screen.flush());
+
+    // Text running off the right edge keeps only the visible part
+    screen.putText(1, COLS - 2, "hello");
+    TEST_ASSERT_EQ(std::size_t(2), screen.flush());
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runScreenBufferTests() {
+    BEGIN_TEST_GROUP("NCursesScreenBuffer - Diffing");
+    RUN_TEST(test_first_flush_writes_every_cell);
+    RUN_TEST(test_unchanged_frame_writes_nothing);
+    RUN_TEST(test_only_changed_cells_are_written);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("NCursesScreenBuffer - Invalidation and Clipping");
+    RUN_TEST(test_invalidate_forces_full_rewrite);
+    RUN_TEST(test_resize_forces_full_rewrite);
+    RUN_TEST(test_cells_outside_screen_are_clipped);
+    END_TEST_GROUP();
+}
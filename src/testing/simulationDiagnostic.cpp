@@ -376,7 +376,7 @@ int main(int argc, char* argv[]) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Run simulation
-    GeneralStats gs = { calendar, 0, 0, 0, 0 };
+    GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
     int snapshotInterval = tickCount / 20;  // 20 snapshots during run
     if (snapshotInterval < 1) snapshotInterval = 1;
     
@@ -384,7 +384,7 @@ int main(int argc, char* argv[]) {
         logger.setCurrentTick(tick);
         
         // Reset stats for this tick
-        gs = { calendar, 0, 0, 0, 0 };
+        gs = { calendar, 0, 0, 0, 0, {} };
         
         // Advance simulation
         advanceSimulationWithLogging(w, creatures, gs, logger);
@@ -0,0 +1,237 @@
+/**
+ * @file test_genome_stats.cpp
+ * @brief Unit tests for the Welford-based GenomeStatsEngine and GenomeStats
+ */
+
+#include "statistics/genomeStats.hpp"
+#include "statistics/genomeStatsEngine.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "parallel.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace EcoSim::Testing;
+using EcoSim::Genetics::Organism;
+using EcoSim::Genetics::OrganismPtr;
+
+namespace {
+
+/// Snapshot with one gene column per entry of `columns`, limits [0, 10].
+GenomeSnapshot makeSnapshot(const std::vector<std::vector<float>>& columns,
+                            const std::vector<uint32_t>& archetypeOf,
+                            std::size_t archetypes) {
+    GenomeSnapshot snap;
+    snap.time = 42;
+    const std::size_t genes = columns.size();
+    for (std::size_t g = 0; g < genes; ++g) {
+        snap.geneIds.push_back("gene_" + std::to_string(g));
+        snap.lowerLimits.push_back(0.0f);
+        snap.upperLimits.push_back(10.0f);
+    }
+    for (std::size_t a = 0; a < archetypes; ++a) {
+        snap.archetypes.push_back("type_" + std::to_string(a));
+    }
+    snap.archetypeOf = archetypeOf;
+    snap.values.resize(archetypeOf.size() * genes);
+    for (std::size_t i = 0; i < archetypeOf.size(); ++i) {
+        for (std::size_t g = 0; g < genes; ++g) {
+            snap.values[i * genes + g] = columns[g][i];
+        }
+    }
+    return snap;
+}
+
+//==============================================================================
+// Test: RunningStat
+//==============================================================================
+
+void test_running_stat_matches_two_pass() {
+    std::vector<float> values = {2.0f, 4.0f, 4.0f, 4.0f, 5.0f, 5.0f, 7.0f, 9.0f};
+    RunningStat stat;
+    for (float v : values) stat.add(v);
+
+    TEST_ASSERT_EQ(uint64_t(8), stat.count);
+    TEST_ASSERT_NEAR(5.0, stat.mean, 1e-9);
+    TEST_ASSERT_NEAR(4.0, stat.variance(), 1e-9);
+    TEST_ASSERT_NEAR(2.0, stat.stdDev(), 1e-9);
+    TEST_ASSERT_NEAR(2.0f, stat.min, 1e-6f);
+    TEST_ASSERT_NEAR(9.0f, stat.max, 1e-6f);
+}
+
+void test_running_stat_merge_equals_sequential() {
+    std::mt19937 rng(7);
+    std::normal_distribution<float> dist(100.0f, 15.0f);
+
+    RunningStat all, left, right, empty;
+    for (int i = 0; i < 1000; ++i) {
+        float v = dist(rng);
+        all.add(v);
+        (i < 300 ? left : right).add(v);
+    }
+    left.merge(right);
+    left.merge(empty);
+
+    TEST_ASSERT_EQ(all.count, left.count);
+    TEST_ASSERT_NEAR(all.mean, left.mean, 1e-9);
+    TEST_ASSERT_NEAR(all.variance(), left.variance(), 1e-6);
+    TEST_ASSERT_NEAR(all.min, left.min, 1e-6f);
+    TEST_ASSERT_NEAR(all.max, left.max, 1e-6f);
+}
+
+//==============================================================================
+// Test: Engine
+//==============================================================================
+
+void test_engine_chunking_does_not_change_results() {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(0.0f, 10.0f);
+    const std::size_t n = 10000;
+    std::vector<std::vector<float>> columns(3, std::vector<float>(n));
+    std::vector<uint32_t> archetypeOf(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (auto& col : columns) col[i] = dist(rng);
+        archetypeOf[i] = static_cast<uint32_t>(i % 3);
+    }
+    GenomeSnapshot snap = makeSnapshot(columns, archetypeOf, 3);
+
+    GenomeStatsOptions whole;
+    whole.grain = n;
+    GenomeStatsOptions chunked;
+    chunked.grain = 97;
+
+    GenomeStatsReport a = GenomeStatsEngine::compute(snap, whole);
+    GenomeStatsReport b = GenomeStatsEngine::compute(snap, chunked);
+
+    TEST_ASSERT_EQ(uint64_t(n), b.organisms);
+    for (std::size_t g = 0; g < 3; ++g) {
+        TEST_ASSERT_EQ(a.genes[g].stat.count, b.genes[g].stat.count);
+        TEST_ASSERT_NEAR(a.genes[g].stat.mean, b.genes[g].stat.mean, 1e-9);
+        TEST_ASSERT_NEAR(a.genes[g].stat.variance(), b.genes[g].stat.variance(), 1e-6);
+        TEST_ASSERT_NEAR(a.genes[g].stat.min, b.genes[g].stat.min, 0.0f);
+    }
+}
+
+void test_engine_histograms_and_archetypes() {
+    // gene_0: 0.5, 1.5, ..., 9.5 -> one value per bin; archetype = i % 2
+    std::vector<float> col;
+    std::vector<uint32_t> archetypeOf;
+    for (int i = 0; i < 10; ++i) {
+        col.push_back(static_cast<float>(i) + 0.5f);
+        archetypeOf.push_back(static_cast<uint32_t>(i % 2));
+    }
+    col[9] = 25.0f;  // Out of range values land in the edge bins
+    GenomeSnapshot snap = makeSnapshot({col}, archetypeOf, 2);
+
+    GenomeStatsOptions options;
+    options.histogramBins = 10;
+    options.perArchetype = true;
+    options.grain = 3;
+    GenomeStatsReport report = GenomeStatsEngine::compute(snap, options);
+
+    TEST_ASSERT_EQ(10u, report.genes[0].histogram.size());
+    for (std::size_t b = 0; b < 10; ++b) {
+        TEST_ASSERT_EQ(1u, report.genes[0].histogram[b]);
+    }
+
+    TEST_ASSERT_EQ(2u, report.archetypes.size());
+    TEST_ASSERT_EQ(uint64_t(5), report.archetypes[0].organisms);
+    // Even indices: 0.5, 2.5, 4.5, 6.5, 8.5
+    TEST_ASSERT_NEAR(4.5, report.archetypes[0].genes[0].mean, 1e-9);
+    TEST_ASSERT_NEAR(25.0f, report.archetypes[1].genes[0].max, 1e-6f);
+    TEST_ASSERT_EQ(0, report.findGene("gene_0"));
+    TEST_ASSERT_EQ(-1, report.findGene("missing"));
+}
+
+void test_engine_skips_missing_genes() {
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    GenomeSnapshot snap = makeSnapshot({{1.0f, nan, 3.0f}}, {0, 0, 0}, 1);
+
+    GenomeStatsReport report = GenomeStatsEngine::compute(snap);
+    TEST_ASSERT_EQ(uint64_t(2), report.genes[0].stat.count);
+    TEST_ASSERT_NEAR(2.0, report.genes[0].stat.mean, 1e-9);
+}
+
+void test_engine_async_matches_sync() {
+    std::vector<float> col;
+    for (int i = 0; i < 5000; ++i) col.push_back(static_cast<float>(i % 10));
+    GenomeSnapshot snap = makeSnapshot({col}, std::vector<uint32_t>(5000, 0), 1);
+
+    GenomeStatsReport sync = GenomeStatsEngine::compute(snap);
+    GenomeStatsReport async = GenomeStatsEngine::computeAsync(snap).get();
+    TEST_ASSERT_NEAR(sync.genes[0].stat.mean, async.genes[0].stat.mean, 1e-12);
+    TEST_ASSERT_EQ(sync.toString(true), async.toString(true));
+}
+
+//==============================================================================
+// Test: Population Snapshot
+//==============================================================================
+
+void test_snapshot_captures_registered_genes() {
+    Organism::initializeGeneRegistry();
+    auto& registry = Organism::getGeneRegistry();
+
+    std::vector<OrganismPtr> population;
+    for (int i = 0; i < 20; ++i) {
+        population.push_back(std::make_unique<Organism>(
+            i, i, EcoSim::Genetics::UniversalGenes::createCreatureGenome(registry), registry));
+    }
+
+    GenomeSnapshot snap = GenomeSnapshot::capture(population, registry, 7);
+    TEST_ASSERT_EQ(population.size(), snap.organismCount());
+    TEST_ASSERT_EQ(registry.getAllGeneIds().size(), snap.geneCount());
+
+    GenomeStatsReport report = GenomeStatsEngine::compute(snap);
+    int lifespan = report.findGene(EcoSim::Genetics::UniversalGenes::LIFESPAN);
+    TEST_ASSERT(lifespan >= 0);
+    TEST_ASSERT_EQ(uint64_t(20), report.genes[static_cast<std::size_t>(lifespan)].stat.count);
+
+    // The legacy fixed-trait summary still reports every trait
+    GenomeStats legacy(population, 7);
+    TEST_ASSERT(legacy.toString(true).find("7,ComfDec,") != std::string::npos);
+}
+
+//==============================================================================
+// Test: Thread Pool
+//==============================================================================
+
+void test_parallel_for_covers_range_once() {
+    std::vector<int> hits(10007, 0);
+    EcoSim::parallelFor(0, hits.size(), 64, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) hits[i]++;
+    });
+    for (int h : hits) {
+        TEST_ASSERT_EQ(1, h);
+    }
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runGenomeStatsTests() {
+    BEGIN_TEST_GROUP("GenomeStats - RunningStat");
+    RUN_TEST(test_running_stat_matches_two_pass);
+    RUN_TEST(test_running_stat_merge_equals_sequential);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("GenomeStats - Engine");
+    RUN_TEST(test_engine_chunking_does_not_change_results);
+    RUN_TEST(test_engine_histograms_and_archetypes);
+    RUN_TEST(test_engine_skips_missing_genes);
+    RUN_TEST(test_engine_async_matches_sync);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("GenomeStats - Population Snapshot");
+    RUN_TEST(test_snapshot_captures_registered_genes);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("GenomeStats - Thread Pool");
+    RUN_TEST(test_parallel_for_covers_range_once);
+    END_TEST_GROUP();
+}
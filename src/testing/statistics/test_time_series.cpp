@@ -0,0 +1,227 @@
+/**
+ * @file test_time_series.cpp
+ * @brief Unit tests for the columnar TimeSeriesStore used by Statistics
+ */
+
+#include "statistics/statistics.hpp"
+#include "statistics/timeSeries.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace EcoSim::Testing;
+
+namespace {
+
+GeneralStats makeRecord(const Calendar& cal, unsigned population, unsigned births) {
+    GeneralStats gs {};
+    gs.calendar = cal;
+    gs.population = population;
+    gs.births = births;
+    gs.foodAte = 0;
+    return gs;
+}
+
+/// Appends `ticks` one-minute records starting at midnight, Jan 1st.
+void appendMinutes(TimeSeriesStore& store, unsigned ticks) {
+    Calendar cal;
+    for (unsigned i = 0; i < ticks; ++i) {
+        store.append(makeRecord(cal, i, 1));
+        cal++;
+    }
+}
+
+//==============================================================================
+// Test: Tick Tier
+//==============================================================================
+
+void test_tick_tier_records_every_append() {
+    TimeSeriesStore store;
+    appendMinutes(store, 10);
+
+    const SeriesRing& ticks = store.tier(SeriesTier::Tick);
+    TEST_ASSERT_EQ(10u, ticks.size());
+    TEST_ASSERT_EQ(uint64_t(10), store.tickCount());
+    TEST_ASSERT_NEAR(7.0f, ticks.at(StatMetric::Population, 7), 0.001f);
+    TEST_ASSERT_EQ(uint64_t(7), ticks.stampAt(7));
+}
+
+void test_tick_tier_is_bounded() {
+    SeriesConfig config;
+    config.tickCapacity = 16;
+    TimeSeriesStore store(config);
+    appendMinutes(store, 100);
+
+    const SeriesRing& ticks = store.tier(SeriesTier::Tick);
+    TEST_ASSERT_EQ(16u, ticks.size());
+    // Oldest retained sample is tick 84, newest is 99
+    TEST_ASSERT_EQ(uint64_t(84), ticks.stampAt(0));
+    TEST_ASSERT_NEAR(99.0f, ticks.at(StatMetric::Population, 15), 0.001f);
+    // Ring offset points at the oldest sample in raw storage
+    TEST_ASSERT_NEAR(84.0f, ticks.column(StatMetric::Population)[ticks.offset()], 0.001f);
+}
+
+//==============================================================================
+// Test: Downsampling
+//==============================================================================
+
+void test_hour_tier_sums_counts_and_keeps_last_population() {
+    TimeSeriesStore store;
+    appendMinutes(store, 150);  // Two complete hours plus an open one
+
+    const SeriesRing& hours = store.tier(SeriesTier::Hour);
+    TEST_ASSERT_EQ(2u, hours.size());
+    TEST_ASSERT_NEAR(60.0f, hours.at(StatMetric::Births, 0), 0.001f);
+    TEST_ASSERT_NEAR(59.0f, hours.at(StatMetric::Population, 0), 0.001f);
+    TEST_ASSERT_NEAR(119.0f, hours.at(StatMetric::Population, 1), 0.001f);
+    TEST_ASSERT_EQ(uint64_t(60), hours.stampAt(1));
+}
+
+void test_day_and_season_tiers_close_on_boundaries() {
+    TimeSeriesStore store;
+    // 100 days covers the Jan-Mar season (90 days) and closes it
+    appendMinutes(store, 100 * 24 * 60);
+
+    TEST_ASSERT_EQ(99u, store.tier(SeriesTier::Day).size());
+    TEST_ASSERT_NEAR(1440.0f, store.tier(SeriesTier::Day).at(StatMetric::Births, 0), 0.001f);
+    TEST_ASSERT_EQ(1u, store.tier(SeriesTier::Season).size());
+    TEST_ASSERT_NEAR(90.0f * 1440.0f, store.tier(SeriesTier::Season).at(StatMetric::Births, 0), 0.5f);
+}
+
+//==============================================================================
+// Test: Queries
+//==============================================================================
+
+void test_range_query_by_tick() {
+    TimeSeriesStore store;
+    appendMinutes(store, 300);
+
+    std::vector<float> out;
+    // Hours starting in [60, 180) -> hours 1 and 2
+    size_t n = store.query(SeriesTier::Hour, StatMetric::Population, 60, 180, out);
+    TEST_ASSERT_EQ(size_t(2), n);
+    TEST_ASSERT_NEAR(119.0f, out[0], 0.001f);
+    TEST_ASSERT_NEAR(179.0f, out[1], 0.001f);
+
+    n = store.query(SeriesTier::Tick, StatMetric::Population, 10, 15, out);
+    TEST_ASSERT_EQ(size_t(5), n);
+    TEST_ASSERT_NEAR(14.0f, out[4], 0.001f);
+}
+
+void test_latest_samples() {
+    TimeSeriesStore store;
+    appendMinutes(store, 20);
+
+    std::vector<float> out;
+    TEST_ASSERT_EQ(size_t(3), store.latest(SeriesTier::Tick, StatMetric::Population, 3, out));
+    TEST_ASSERT_NEAR(17.0f, out[0], 0.001f);
+    TEST_ASSERT_NEAR(19.0f, out[2], 0.001f);
+}
+
+//==============================================================================
+// Test: Memory-mapped Stream
+//==============================================================================
+
+void test_stream_writes_every_tick() {
+    const char* path = "test_time_series_stream.bin";
+    {
+        TimeSeriesStore store;
+        TEST_ASSERT(store.openStream(path));
+        appendMinutes(store, 50000);  // Forces the mapping to grow
+        TEST_ASSERT_EQ(uint64_t(50000), store.streamedRows());
+    }
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    TEST_ASSERT(in.good());
+    auto bytes = static_cast<size_t>(in.tellg());
+    TEST_ASSERT_EQ(TimeSeriesStore::STREAM_HEADER_BYTES + 50000 * TimeSeriesStore::STREAM_ROW_BYTES, bytes);
+
+    char header[TimeSeriesStore::STREAM_HEADER_BYTES];
+    in.seekg(0);
+    in.read(header, sizeof(header));
+    TEST_ASSERT(std::memcmp(header, "ECOTS001", 8) == 0);
+    uint64_t rows = 0;
+    std::memcpy(&rows, header + 16, sizeof(rows));
+    TEST_ASSERT_EQ(uint64_t(50000), rows);
+
+    // Last row: tick 49999, population 49999
+    std::vector<char> row(TimeSeriesStore::STREAM_ROW_BYTES);
+    in.seekg(static_cast<std::streamoff>(bytes - row.size()));
+    in.read(row.data(), static_cast<std::streamsize>(row.size()));
+    uint64_t tick = 0;
+    float population = 0.0f;
+    std::memcpy(&tick, row.data(), sizeof(tick));
+    std::memcpy(&population, row.data() + sizeof(tick), sizeof(population));
+    TEST_ASSERT_EQ(uint64_t(49999), tick);
+    TEST_ASSERT_NEAR(49999.0f, population, 0.001f);
+
+    in.close();
+    std::remove(path);
+}
+
+//==============================================================================
+// Test: Statistics Integration
+//==============================================================================
+
+void test_statistics_series_survives_clear_and_accumulate() {
+    Statistics stats;
+    Calendar cal;
+    for (unsigned i = 0; i < 120; ++i) {
+        stats.addRecord(makeRecord(cal, 5, 1));
+        cal++;
+    }
+    stats.accumulate();
+    stats.clearRecords();
+
+    TEST_ASSERT(stats.getRecords().empty());
+    TEST_ASSERT_EQ(uint64_t(120), stats.series().tickCount());
+    TEST_ASSERT_EQ(1u, stats.series().tier(SeriesTier::Hour).size());
+}
+
+void test_accumulate_starts_from_zero() {
+    Statistics stats;
+    Calendar cal;
+    stats.addRecord(makeRecord(cal, 3, 2));
+    stats.addRecord(makeRecord(cal, 4, 5));
+    stats.accumulate();
+
+    TEST_ASSERT_EQ(1u, stats.getRecords().size());
+    TEST_ASSERT_EQ(7u, stats.getRecords()[0].births);
+    TEST_ASSERT_EQ(4u, stats.getRecords()[0].population);
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runTimeSeriesTests() {
+    BEGIN_TEST_GROUP("TimeSeriesStore - Tick Tier");
+    RUN_TEST(test_tick_tier_records_every_append);
+    RUN_TEST(test_tick_tier_is_bounded);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TimeSeriesStore - Downsampling");
+    RUN_TEST(test_hour_tier_sums_counts_and_keeps_last_population);
+    RUN_TEST(test_day_and_season_tiers_close_on_boundaries);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TimeSeriesStore - Queries");
+    RUN_TEST(test_range_query_by_tick);
+    RUN_TEST(test_latest_samples);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TimeSeriesStore - Memory-mapped Stream");
+    RUN_TEST(test_stream_writes_every_tick);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TimeSeriesStore - Statistics Integration");
+    RUN_TEST(test_statistics_series_survives_clear_and_accumulate);
+    RUN_TEST(test_accumulate_starts_from_zero);
+    END_TEST_GROUP();
+}
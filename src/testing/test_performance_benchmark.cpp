@@ -242,7 +242,7 @@ BenchmarkResult runBenchmark(unsigned creatureCount, int warmupTicks, int benchm
     
     // Create stats
     Calendar calendar;
-    GeneralStats gs = { calendar, 0, 0, 0, 0 };
+    GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
     
     // Warmup phase (not measured)
     for (int i = 0; i < warmupTicks; i++) {
@@ -555,7 +555,7 @@ int main(int argc, char* argv[]) {
     
     // Stats
     Calendar calendar;
-    GeneralStats gs = { calendar, 0, 0, 0, 0 };
+    GeneralStats gs = { calendar, 0, 0, 0, 0, {} };
     
     // Warmup phase
     std::cout << "Running warmup (10 ticks)..." << std::endl;
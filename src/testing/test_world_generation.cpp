@@ -47,8 +47,8 @@ void printBiomeStats(const ClimateWorldGenerator& generator) {
     const auto& climateMap = generator.getClimateMap();
     if (climateMap.empty()) return;
     
-    unsigned int width = static_cast<unsigned int>(climateMap.size());
-    unsigned int height = static_cast<unsigned int>(climateMap[0].size());
+    unsigned int width = climateMap.width();
+    unsigned int height = climateMap.height();
     
     // Count biomes
     int biomeCounts[static_cast<int>(Biome::COUNT)] = {0};
@@ -60,7 +60,7 @@ void printBiomeStats(const ClimateWorldGenerator& generator) {
     
     for (unsigned int y = 0; y < height; ++y) {
         for (unsigned int x = 0; x < width; ++x) {
-            const TileClimate& climate = climateMap[x][y];
+            TileClimate climate = climateMap.get(x, y);
             biomeCounts[static_cast<int>(climate.biome())]++;
             
             if (climate.feature == TerrainFeature::RIVER) riverCount++;
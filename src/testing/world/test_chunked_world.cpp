@@ -0,0 +1,403 @@
+/**
+ * @file test_chunked_world.cpp
+ * @brief Unit tests for lazily generated chunked worlds
+ *
+ * Tests that chunks do not depend on the order they are generated in, that
+ * they reproduce whole-world generation, that evicted chunks come back
+ * unchanged from the disk cache (also in later worlds) with their tile
+ * edits, that chunks holding plants stay resident, and that a chunked World
+ * reads its tiles and climate from the chunks.
+ */
+
+#include "world/ChunkedWorld.hpp"
+#include "world/WorldGrid.hpp"
+#include "world/world.hpp"
+#include "genetics/organisms/CreatureFactory.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace EcoSim;
+using namespace EcoSim::Testing;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+ChunkedWorldConfig smallConfig(unsigned int seed) {
+    ChunkedWorldConfig config;
+    config.climate.width = 200;
+    config.climate.height = 136;
+    config.climate.seed = seed;
+    return config;
+}
+
+bool sameClimate(const TileClimate& a, const TileClimate& b) {
+    return std::memcmp(&a, &b, sizeof(TileClimate)) == 0;
+}
+
+bool sameClimate(const PackedTileClimate& a, const PackedTileClimate& b) {
+    return std::memcmp(&a, &b, sizeof(PackedTileClimate)) == 0;
+}
+
+/// An empty cache directory, left over from nothing
+fs::path freshCacheDirectory(const char* name) {
+    fs::path dir = fs::temp_directory_path() / name;
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+/// MapGen for a World the size of smallConfig()
+MapGen smallMap(unsigned int seed) {
+    MapGen mapGen;
+    mapGen.cols = 200;
+    mapGen.rows = 136;
+    mapGen.seed = seed;
+    mapGen.isIsland = true;
+    return mapGen;
+}
+
+//==============================================================================
+// Test: Determinism
+//==============================================================================
+
+void test_chunk_independent_of_access_order() {
+    ChunkedWorld forward(smallConfig(5));
+    ChunkedWorld backward(smallConfig(5));
+    TEST_ASSERT_EQ(4u, forward.chunksX());
+    TEST_ASSERT_EQ(3u, forward.chunksY());
+
+    for (unsigned int cx = 0; cx < forward.chunksX(); ++cx) {
+        for (unsigned int cy = 0; cy < forward.chunksY(); ++cy) {
+            forward.chunk(cx, cy);
+        }
+    }
+
+    bool same = true;
+    for (unsigned int cx = backward.chunksX(); cx-- > 0;) {
+        for (unsigned int cy = backward.chunksY(); cy-- > 0;) {
+            const ChunkedWorld::Chunk& a = forward.chunk(cx, cy);
+            const ChunkedWorld::Chunk& b = backward.chunk(cx, cy);
+            same = same && a.width == b.width && a.height == b.height;
+            for (std::size_t i = 0; same && i < a.climate.size(); ++i) {
+                same = sameClimate(a.climate[i], b.climate[i]);
+            }
+        }
+    }
+    TEST_ASSERT(same);
+
+    // Edge chunks are clipped to the world
+    TEST_ASSERT_EQ(8u, forward.chunk(3, 2).width);
+    TEST_ASSERT_EQ(8u, forward.chunk(3, 2).height);
+}
+
+void test_chunks_match_whole_world_generation() {
+    // Without the overview-driven water features every stage is a function
+    // of world coordinates, so chunks must equal the dense generator
+    ChunkedWorldConfig config = smallConfig(21);
+    config.climate.removeInlandSeas = false;
+    config.climate.generateRivers = false;
+    ChunkedWorld chunked(config);
+
+    ClimateWorldGenerator whole(config.climate);
+    WorldGrid grid;
+    whole.generate(grid);
+
+    int mismatches = 0;
+    for (unsigned int x = 0; x < chunked.width(); ++x) {
+        for (unsigned int y = 0; y < chunked.height(); ++y) {
+            if (!sameClimate(chunked.climate(x, y), whole.getClimate(x, y)) ||
+                chunked.tile(x, y).getTerrainType() != grid(x, y).getTerrainType()) {
+                ++mismatches;
+            }
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+}
+
+//==============================================================================
+// Test: Residency
+//==============================================================================
+
+void test_evicted_chunks_reload_from_cache() {
+    fs::path dir = freshCacheDirectory("ecosim_chunk_cache_test");
+
+    ChunkedWorldConfig config = smallConfig(8);
+    config.maxResidentChunks = 2;
+    config.cacheDirectory = dir.string();
+    std::vector<PackedTileClimate> original;
+    TerrainType terrain;
+    {
+        ChunkedWorld world(config);
+        original = world.chunk(1, 1).climate;
+        terrain = world.tile(70, 70).getTerrainType();
+
+        world.chunk(0, 0);
+        world.chunk(2, 0);
+        TEST_ASSERT(!world.isResident(1, 1));
+        TEST_ASSERT_EQ(std::size_t(2), world.residentCount());
+        TEST_ASSERT_EQ(std::size_t(1), world.stats().spilled);
+
+        const ChunkedWorld::Chunk& reloaded = world.chunk(1, 1);
+        TEST_ASSERT_EQ(std::size_t(1), world.stats().loadedFromCache);
+        TEST_ASSERT_EQ(std::size_t(3), world.stats().generated);
+
+        bool same = reloaded.climate.size() == original.size();
+        for (std::size_t i = 0; same && i < original.size(); ++i) {
+            same = sameClimate(reloaded.climate[i], original[i]);
+        }
+        TEST_ASSERT(same);
+        TEST_ASSERT(world.tile(70, 70).getTerrainType() == terrain);
+    }
+
+    // The cache outlives the world, so a later one reads instead of generating
+    TEST_ASSERT(!fs::is_empty(dir));
+    ChunkedWorld later(config);
+    const ChunkedWorld::Chunk& cached = later.chunk(1, 1);
+    TEST_ASSERT_EQ(std::size_t(1), later.stats().loadedFromCache);
+    TEST_ASSERT_EQ(std::size_t(0), later.stats().generated);
+
+    bool same = cached.climate.size() == original.size();
+    for (std::size_t i = 0; same && i < original.size(); ++i) {
+        same = sameClimate(cached.climate[i], original[i]);
+    }
+    TEST_ASSERT(same);
+    TEST_ASSERT(later.tile(70, 70).getTerrainType() == terrain);
+
+    // Chunks already on disk are not written again
+    later.evictDistantChunks({}, 0);
+    TEST_ASSERT_EQ(std::size_t(0), later.stats().spilled);
+    fs::remove_all(dir);
+}
+
+void test_worlds_sharing_a_cache_keep_their_own_chunks() {
+    fs::path dir = freshCacheDirectory("ecosim_chunk_cache_shared_test");
+
+    // Same seed, different world size or generator parameters
+    ChunkedWorldConfig base = smallConfig(8);
+    base.maxResidentChunks = 1;
+    base.cacheDirectory = dir.string();
+    ChunkedWorldConfig wider = base;
+    wider.climate.width = 264;
+    ChunkedWorldConfig wetter = base;
+    wetter.climate.seaLevel = 0.45f;
+
+    ChunkedWorld a(base), b(wider), c(wetter);
+    std::vector<ChunkedWorld*> worlds = {&a, &b, &c};
+
+    std::vector<std::vector<PackedTileClimate>> originals;
+    for (ChunkedWorld* world : worlds) {
+        originals.push_back(world->chunk(0, 0).climate);
+        world->chunk(1, 0);
+        TEST_ASSERT_EQ(std::size_t(1), world->stats().spilled);
+    }
+    TEST_ASSERT_EQ(3, std::distance(fs::directory_iterator(dir), fs::directory_iterator()));
+
+    for (std::size_t w = 0; w < worlds.size(); ++w) {
+        const ChunkedWorld::Chunk& reloaded = worlds[w]->chunk(0, 0);
+        TEST_ASSERT_EQ(std::size_t(1), worlds[w]->stats().loadedFromCache);
+
+        bool same = reloaded.climate.size() == originals[w].size();
+        for (std::size_t i = 0; same && i < originals[w].size(); ++i) {
+            same = sameClimate(reloaded.climate[i], originals[w][i]);
+        }
+        TEST_ASSERT(same);
+    }
+    fs::remove_all(dir);
+}
+
+void test_evict_distant_chunks_keeps_nearby() {
+    ChunkedWorld world(smallConfig(3));
+    world.prefetch({{0, 0}, {1, 0}, {3, 0}, {3, 2}, {0, 2}});
+    TEST_ASSERT_EQ(std::size_t(5), world.residentCount());
+
+    // An organism in chunk (0, 0) keeps its neighbours only
+    std::size_t evicted = world.evictDistantChunks({{10, 10}}, 1);
+    TEST_ASSERT_EQ(std::size_t(3), evicted);
+    TEST_ASSERT(world.isResident(0, 0));
+    TEST_ASSERT(world.isResident(1, 0));
+    TEST_ASSERT(!world.isResident(3, 2));
+
+    TEST_ASSERT_EQ(std::size_t(2), world.evictDistantChunks({}, 1));
+    TEST_ASSERT_EQ(std::size_t(0), world.residentCount());
+}
+
+void test_chunks_with_plants_stay_resident() {
+    ChunkedWorldConfig config = smallConfig(3);
+    config.maxResidentChunks = 1;
+    ChunkedWorld world(config);
+
+    world.plantsChanged(10, 10, 2);
+    world.chunk(1, 0);
+    world.chunk(2, 0);
+    TEST_ASSERT(world.isResident(0, 0));
+    TEST_ASSERT(!world.isResident(1, 0));
+
+    TEST_ASSERT_EQ(std::size_t(1), world.evictDistantChunks({}, 0));
+    TEST_ASSERT(world.isResident(0, 0));
+
+    // Still one plant left
+    world.plantsChanged(10, 10, -1);
+    TEST_ASSERT_EQ(std::size_t(0), world.evictDistantChunks({}, 0));
+
+    world.plantsChanged(10, 10, -1);
+    TEST_ASSERT_EQ(std::size_t(1), world.evictDistantChunks({}, 0));
+    TEST_ASSERT_EQ(std::size_t(0), world.residentCount());
+}
+
+void test_tile_edits_survive_eviction() {
+    fs::path dir = freshCacheDirectory("ecosim_chunk_cache_edit_test");
+
+    // Once regenerating, once reading back from the cache
+    for (bool cached : {false, true}) {
+        ChunkedWorldConfig config = smallConfig(8);
+        if (cached) config.cacheDirectory = dir.string();
+        ChunkedWorld world(config);
+
+        // An untouched chunk keeps nothing back
+        world.chunk(1, 1);
+        world.evictDistantChunks({}, 0);
+        TEST_ASSERT_EQ(std::size_t(0), world.stats().editsKept);
+
+        Tile& edited = world.tile(70, 70);
+        const unsigned int elevation = edited.getElevation() + 7;
+        edited.setElevation(elevation);
+        edited.setWaterDepth(0.25f);
+        world.evictDistantChunks({}, 0);
+        TEST_ASSERT(!world.isResident(1, 1));
+        TEST_ASSERT_EQ(std::size_t(1), world.stats().editsKept);
+
+        const Tile& reloaded = world.tile(70, 70);
+        TEST_ASSERT_EQ(elevation, reloaded.getElevation());
+        TEST_ASSERT_NEAR(0.25f, reloaded.getWaterDepth(), 1e-6f);
+        TEST_ASSERT_EQ(cached ? std::size_t(2) : std::size_t(0), world.stats().loadedFromCache);
+    }
+    fs::remove_all(dir);
+}
+
+//==============================================================================
+// Test: Large Worlds
+//==============================================================================
+
+void test_overview_size_is_bounded() {
+    ChunkedWorldConfig config;
+    config.climate.width = 16384;
+    config.climate.height = 8192;
+    config.climate.seed = 77;
+    ChunkedWorld world(config);
+
+    const ClimateGeneratorConfig& overview = world.overview().getConfig();
+    TEST_ASSERT_EQ(512u, overview.width);
+    TEST_ASSERT_EQ(256u, overview.height);
+    TEST_ASSERT_EQ(32u, world.overview().getRegion().stride);
+    TEST_ASSERT_EQ(std::size_t(0), world.residentCount());
+
+    TileClimate far = world.climate(16000, 8000);
+    TEST_ASSERT(far.elevation >= 0.0f && far.elevation <= 1.0f);
+    TEST_ASSERT_EQ(std::size_t(1), world.residentCount());
+}
+
+//==============================================================================
+// Test: Chunked World
+//==============================================================================
+
+void test_chunked_world_reads_tiles_and_climate_from_chunks() {
+    ChunkedWorldConfig config;
+    World world(smallMap(8), OctaveGen(), config);
+    ChunkedWorld reference(smallConfig(8));
+
+    TEST_ASSERT(world.isChunked());
+    TEST_ASSERT_EQ(std::size_t(0), world.chunks()->residentCount());
+    TEST_ASSERT_EQ(200u, world.grid().width());
+    TEST_ASSERT(world.getGrid().empty());
+
+    int mismatches = 0;
+    for (unsigned int x = 60; x < 140; x += 3) {
+        for (unsigned int y = 30; y < 100; y += 3) {
+            const int ix = static_cast<int>(x);
+            const int iy = static_cast<int>(y);
+            if (world.grid()(x, y).getTerrainType() != reference.tile(x, y).getTerrainType() ||
+                world.environment().getBiome(ix, iy) != static_cast<int>(reference.climate(x, y).biome()) ||
+                world.environment().getTemperature(ix, iy) != reference.packedClimate(x, y).getTemperature()) {
+                ++mismatches;
+            }
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+    TEST_ASSERT_EQ(std::size_t(6), world.chunks()->residentCount());
+
+    // Only resident chunks are visited by whole-grid loops
+    TEST_ASSERT_EQ(std::size_t(6), world.grid().residentRegions().size());
+}
+
+void test_tick_evicts_chunks_no_creature_is_near() {
+    ChunkedWorldConfig config;
+    config.evictionRadius = 0;
+    World world(smallMap(8), OctaveGen(), config);
+    world.prefetchChunks(100, 68, 1);
+    TEST_ASSERT_EQ(std::size_t(9), world.chunks()->residentCount());
+
+    auto registry = std::make_shared<Genetics::GeneRegistry>();
+    Genetics::UniversalGenes::registerDefaults(*registry);
+    Genetics::CreatureFactory factory(registry);
+    factory.registerDefaultTemplates();
+    std::vector<Genetics::OrganismPtr> creatures;
+    creatures.push_back(factory.createApexPredator(100, 68));
+
+    // A plant keeps its chunk, a creature keeps the one it stands on
+    world.plants().initialize();
+    int plantX = -1;
+    for (int x = 64; x < 128 && plantX < 0; ++x) {
+        for (int y = 0; y < 64 && plantX < 0; ++y) {
+            if (world.plants().addPlant(x, y, "berry_bush")) plantX = x;
+        }
+    }
+    TEST_ASSERT_GE(plantX, 0);
+
+    TEST_ASSERT_EQ(std::size_t(7), world.evictDistantChunks(creatures));
+    TEST_ASSERT(world.chunks()->isResident(1, 1));
+    TEST_ASSERT(world.chunks()->isResident(1, 0));
+
+    // Dense worlds have nothing to evict
+    World dense(smallMap(8), OctaveGen());
+    TEST_ASSERT(!dense.isChunked());
+    TEST_ASSERT_EQ(std::size_t(0), dense.evictDistantChunks(creatures));
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runChunkedWorldTests() {
+    BEGIN_TEST_GROUP("ChunkedWorld - Determinism");
+    RUN_TEST(test_chunk_independent_of_access_order);
+    RUN_TEST(test_chunks_match_whole_world_generation);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("ChunkedWorld - Residency");
+    RUN_TEST(test_evicted_chunks_reload_from_cache);
+    RUN_TEST(test_worlds_sharing_a_cache_keep_their_own_chunks);
+    RUN_TEST(test_evict_distant_chunks_keeps_nearby);
+    RUN_TEST(test_chunks_with_plants_stay_resident);
+    RUN_TEST(test_tile_edits_survive_eviction);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("ChunkedWorld - Large Worlds");
+    RUN_TEST(test_overview_size_is_bounded);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("ChunkedWorld - Chunked World");
+    RUN_TEST(test_chunked_world_reads_tiles_and_climate_from_chunks);
+    RUN_TEST(test_tick_evicts_chunks_no_creature_is_near);
+    END_TEST_GROUP();
+}
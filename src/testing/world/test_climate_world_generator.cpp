@@ -0,0 +1,341 @@
+/**
+ * @file test_climate_world_generator.cpp
+ * @brief Unit tests for the ClimateWorldGenerator pipeline
+ *
+ * Tests that the parallel generation stages reproduce the serial output,
+ * that the linear-time rain shadow and ridge distance passes match the
+ * direct per-tile searches they replaced, that cached worlds load back
+ * exactly as generated, and that the packed climate store stays within its
+ * quantization error.
+ */
+
+#include "world/ClimateWorldGenerator.hpp"
+#include "world/WorldGrid.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+using namespace EcoSim;
+using namespace EcoSim::Testing;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+ClimateGeneratorConfig smallConfig(unsigned int seed) {
+    ClimateGeneratorConfig config;
+    config.width = 120;
+    config.height = 90;
+    config.seed = seed;
+    return config;
+}
+
+/// True when two maps hold exactly the same bits (NaN-safe, unlike ==).
+bool sameBits(const std::vector<std::vector<float>>& a,
+              const std::vector<std::vector<float>>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t x = 0; x < a.size(); ++x) {
+        if (a[x].size() != b[x].size()) return false;
+        if (std::memcmp(a[x].data(), b[x].data(), a[x].size() * sizeof(float)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==============================================================================
+// Test: Parallel Determinism
+//==============================================================================
+
+void test_parallel_matches_serial() {
+    for (unsigned int seed : {7u, 4242u}) {
+        ClimateGeneratorConfig serialConfig = smallConfig(seed);
+        serialConfig.parallel = false;
+        ClimateGeneratorConfig parallelConfig = smallConfig(seed);
+        parallelConfig.parallel = true;
+
+        ClimateWorldGenerator serial(serialConfig);
+        ClimateWorldGenerator parallel(parallelConfig);
+        WorldGrid serialGrid;
+        WorldGrid parallelGrid;
+        serial.generate(serialGrid);
+        parallel.generate(parallelGrid);
+
+        TEST_ASSERT(sameBits(serial.getElevationMap(), parallel.getElevationMap()));
+        TEST_ASSERT(sameBits(serial.getTemperatureMap(), parallel.getTemperatureMap()));
+        TEST_ASSERT(sameBits(serial.getMoistureMap(), parallel.getMoistureMap()));
+
+        bool tilesMatch = true;
+        for (unsigned int x = 0; x < serialConfig.width && tilesMatch; ++x) {
+            for (unsigned int y = 0; y < serialConfig.height && tilesMatch; ++y) {
+                const TileClimate& a = serial.getClimate(x, y);
+                const TileClimate& b = parallel.getClimate(x, y);
+                tilesMatch = a.biome() == b.biome() &&
+                             a.feature == b.feature &&
+                             std::memcmp(&a.waterLevel, &b.waterLevel, sizeof(float)) == 0 &&
+                             serialGrid(x, y).getTerrainType() == parallelGrid(x, y).getTerrainType() &&
+                             serialGrid(x, y).getElevation() == parallelGrid(x, y).getElevation();
+            }
+        }
+        TEST_ASSERT(tilesMatch);
+    }
+}
+
+void test_regenerate_is_repeatable() {
+    ClimateWorldGenerator generator(smallConfig(99));
+    WorldGrid grid;
+    generator.generate(grid);
+    std::vector<std::vector<float>> first = generator.getMoistureMap();
+
+    generator.generate(grid);
+    TEST_ASSERT(sameBits(first, generator.getMoistureMap()));
+}
+
+//==============================================================================
+// Test: Linear-time Passes
+//==============================================================================
+
+/// Rain shadow by scanning every upwind tile, as generation used to.
+float referenceRainShadow(const ClimateGeneratorConfig& config,
+                          const std::vector<std::vector<float>>& elevation,
+                          std::size_t x, std::size_t y) {
+    float maxUpwindElevation = 0.0f;
+    for (std::size_t dx = 1; static_cast<int>(dx) < config.rainShadowDistance && dx <= x; ++dx) {
+        maxUpwindElevation = std::max(maxUpwindElevation, elevation[x - dx][y]);
+    }
+    float currentElev = elevation[x][y];
+    if (maxUpwindElevation > currentElev + 0.1f) {
+        float shadowStrength = std::min((maxUpwindElevation - currentElev) / 0.3f, 1.0f);
+        return 1.0f - shadowStrength * config.rainShadowStrength;
+    }
+    return 1.0f;
+}
+
+/// Ridge distance by measuring every sample of every ridge, as generation used to.
+float referenceRidgeDistance(const ClimateWorldGenerator& generator,
+                             const ClimateGeneratorConfig& config,
+                             unsigned int x, unsigned int y) {
+    float px = static_cast<float>(x) / static_cast<float>(config.width);
+    float py = static_cast<float>(y) / static_cast<float>(config.height);
+    float minDist = std::numeric_limits<float>::max();
+    for (const auto& ridge : generator.getPlateRidges()) {
+        float ridgeDist = std::numeric_limits<float>::max();
+        for (int i = 0; i <= ClimateWorldGenerator::RIDGE_SAMPLES; ++i) {
+            float t = static_cast<float>(i) / static_cast<float>(ClimateWorldGenerator::RIDGE_SAMPLES);
+            float dx = px - ClimateWorldGenerator::bezierPoint(t, ridge.startX, ridge.controlX, ridge.endX);
+            float dy = py - ClimateWorldGenerator::bezierPoint(t, ridge.startY, ridge.controlY, ridge.endY);
+            ridgeDist = std::min(ridgeDist, std::sqrt(dx * dx + dy * dy));
+        }
+        minDist = std::min(minDist, ridgeDist / ridge.strength);
+    }
+    return minDist * static_cast<float>(std::max(config.width, config.height));
+}
+
+void test_rain_shadow_matches_upwind_scan() {
+    for (int distance : {100, 7, 1}) {
+        ClimateGeneratorConfig config = smallConfig(31);
+        config.rainShadowDistance = distance;
+        ClimateWorldGenerator generator(config);
+        WorldGrid grid;
+        generator.generate(grid);
+
+        const auto& elevation = generator.getElevationMap();
+        const auto& shadow = generator.getRainShadowMap();
+        int mismatches = 0;
+        for (std::size_t x = 0; x < config.width; ++x) {
+            for (std::size_t y = 0; y < config.height; ++y) {
+                if (shadow[x][y] != referenceRainShadow(config, elevation, x, y)) {
+                    ++mismatches;
+                }
+            }
+        }
+        TEST_ASSERT_EQ(0, mismatches);
+    }
+}
+
+void test_ridge_distance_matches_sampled_search() {
+    for (unsigned int seed : {9u, 777u}) {
+        // Non-square so the two axes are scaled differently
+        ClimateGeneratorConfig config = smallConfig(seed);
+        config.width = 160;
+        config.height = 80;
+        ClimateWorldGenerator generator(config);
+        WorldGrid grid;
+        generator.generate(grid);
+
+        const auto& ridgeDistance = generator.getRidgeDistanceMap();
+        float maxError = 0.0f;
+        unsigned int exact = 0;
+        for (unsigned int x = 0; x < config.width; ++x) {
+            for (unsigned int y = 0; y < config.height; ++y) {
+                float expected = referenceRidgeDistance(generator, config, x, y);
+                float error = std::abs(ridgeDistance[x][y] - expected);
+                maxError = std::max(maxError, error);
+                if (error == 0.0f) ++exact;
+            }
+        }
+
+        // Only tiles nearly equidistant from many samples may pick a
+        // neighbouring one, and then by less than a tile
+        TEST_ASSERT(maxError < 1.0f);
+        TEST_ASSERT(exact * 100 >= config.width * config.height * 99);
+    }
+}
+
+//==============================================================================
+// Test: Generation Cache
+//==============================================================================
+
+void test_generation_key_tracks_config() {
+    ClimateGeneratorConfig config = smallConfig(12);
+    std::uint64_t base = ClimateWorldGenerator(config).generationKey();
+
+    config.parallel = !config.parallel;
+    TEST_ASSERT(ClimateWorldGenerator(config).generationKey() == base);
+
+    ClimateGeneratorConfig reseeded = smallConfig(13);
+    TEST_ASSERT(ClimateWorldGenerator(reseeded).generationKey() != base);
+
+    ClimateGeneratorConfig wetter = smallConfig(12);
+    wetter.moistureScale = 1.1f;
+    TEST_ASSERT(ClimateWorldGenerator(wetter).generationKey() != base);
+}
+
+void test_cached_world_matches_generated() {
+    fs::path dir = fs::temp_directory_path() / "ecosim_worldgen_cache_test";
+    fs::remove_all(dir);
+
+    ClimateWorldGenerator first(smallConfig(64));
+    WorldGrid firstGrid;
+    TEST_ASSERT(!first.generateCached(firstGrid, dir.string()));
+
+    ClimateWorldGenerator second(smallConfig(64));
+    WorldGrid secondGrid;
+    TEST_ASSERT(second.generateCached(secondGrid, dir.string()));
+
+    TEST_ASSERT(sameBits(first.getElevationMap(), second.getElevationMap()));
+    TEST_ASSERT(sameBits(first.getMoistureMap(), second.getMoistureMap()));
+    TEST_ASSERT(sameBits(first.getRainShadowMap(), second.getRainShadowMap()));
+    TEST_ASSERT_EQ(first.getPlateRidges().size(), second.getPlateRidges().size());
+
+    bool tilesMatch = true;
+    for (unsigned int x = 0; x < firstGrid.width() && tilesMatch; ++x) {
+        for (unsigned int y = 0; y < firstGrid.height() && tilesMatch; ++y) {
+            const TileClimate& a = first.getClimate(x, y);
+            const TileClimate& b = second.getClimate(x, y);
+            tilesMatch = std::memcmp(&a, &b, sizeof(TileClimate)) == 0 &&
+                         firstGrid(x, y).getTerrainType() == secondGrid(x, y).getTerrainType() &&
+                         firstGrid(x, y).getWaterDepth() == secondGrid(x, y).getWaterDepth();
+        }
+    }
+    TEST_ASSERT(tilesMatch);
+
+    // A different seed misses the cache
+    ClimateWorldGenerator other(smallConfig(65));
+    WorldGrid otherGrid;
+    TEST_ASSERT(!other.generateCached(otherGrid, dir.string()));
+
+    fs::remove_all(dir);
+}
+
+void test_truncated_cache_is_regenerated() {
+    fs::path dir = fs::temp_directory_path() / "ecosim_worldgen_truncated_test";
+    fs::remove_all(dir);
+
+    ClimateWorldGenerator generator(smallConfig(5));
+    WorldGrid grid;
+    generator.generateCached(grid, dir.string());
+    std::vector<std::vector<float>> expected = generator.getElevationMap();
+
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        fs::resize_file(entry.path(), fs::file_size(entry.path()) / 2);
+    }
+
+    ClimateWorldGenerator reloaded(smallConfig(5));
+    WorldGrid reloadedGrid;
+    TEST_ASSERT(!reloaded.generateCached(reloadedGrid, dir.string()));
+    TEST_ASSERT(sameBits(expected, reloaded.getElevationMap()));
+
+    fs::remove_all(dir);
+}
+
+//==============================================================================
+// Test: Climate Store
+//==============================================================================
+
+void test_packed_climate_round_trip() {
+    TileClimate climate;
+    climate.elevation = 0.61803f;
+    climate.temperature = -41.37f;
+    climate.moisture = 0.25f;
+    climate.waterLevel = 0.5f;
+    climate.feature = TerrainFeature::RIVER;
+    climate.biomeBlend.count = 2;
+    climate.biomeBlend.contributions[0] = {Biome::TEMPERATE_FOREST, 0.7f};
+    climate.biomeBlend.contributions[1] = {Biome::TEMPERATE_GRASSLAND, 0.3f};
+
+    TileClimate back = PackedTileClimate::pack(climate).unpack();
+    TEST_ASSERT(std::fabs(back.elevation - climate.elevation) <= 1.0f / 65535.0f);
+    TEST_ASSERT(std::fabs(back.temperature - climate.temperature) <= 1.0f / 256.0f);
+    TEST_ASSERT(std::fabs(back.moisture - climate.moisture) <= 1.0f / 65535.0f);
+    TEST_ASSERT(back.feature == TerrainFeature::RIVER);
+    TEST_ASSERT_EQ(2, back.biomeBlend.count);
+    TEST_ASSERT(back.biomeBlend.contributions[1].biome == Biome::TEMPERATE_GRASSLAND);
+    TEST_ASSERT(std::fabs(back.biomeBlend.contributions[0].weight - 0.7f) <= 1.0f / 255.0f);
+
+    // Packing a dequantized tile is lossless
+    PackedTileClimate once = PackedTileClimate::pack(climate);
+    PackedTileClimate twice = PackedTileClimate::pack(once.unpack());
+    TEST_ASSERT(std::memcmp(&once, &twice, sizeof(PackedTileClimate)) == 0);
+}
+
+void test_climate_store_outlives_intermediate_maps() {
+    ClimateWorldGenerator generator(smallConfig(31));
+    WorldGrid grid;
+    generator.generate(grid);
+    float elevation = generator.getElevationMap()[40][30];
+
+    generator.releaseIntermediateMaps();
+    TEST_ASSERT(generator.getElevationMap().empty());
+
+    const ClimateStore& store = generator.getClimateMap();
+    TEST_ASSERT_EQ(120u, store.width());
+    TEST_ASSERT_EQ(90u, store.height());
+    TEST_ASSERT_EQ(std::size_t(120 * 90 * 16), store.memoryBytes());
+    TEST_ASSERT(std::fabs(generator.getClimate(40, 30).elevation - elevation) <= 1.0f / 65535.0f);
+    TEST_ASSERT(store.biome(40, 30) == generator.getClimate(40, 30).biome());
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runClimateWorldGeneratorTests() {
+    BEGIN_TEST_GROUP("ClimateWorldGenerator - Parallel Determinism");
+    RUN_TEST(test_parallel_matches_serial);
+    RUN_TEST(test_regenerate_is_repeatable);
+    END_TEST_GROUP();
+    
+    BEGIN_TEST_GROUP("ClimateWorldGenerator - Linear-time Passes");
+    RUN_TEST(test_rain_shadow_matches_upwind_scan);
+    RUN_TEST(test_ridge_distance_matches_sampled_search);
+    END_TEST_GROUP();
+    
+    BEGIN_TEST_GROUP("ClimateWorldGenerator - Generation Cache");
+    RUN_TEST(test_generation_key_tracks_config);
+    RUN_TEST(test_cached_world_matches_generated);
+    RUN_TEST(test_truncated_cache_is_regenerated);
+    END_TEST_GROUP();
+    
+    BEGIN_TEST_GROUP("ClimateWorldGenerator - Climate Store");
+    RUN_TEST(test_packed_climate_round_trip);
+    RUN_TEST(test_climate_store_outlives_intermediate_maps);
+    END_TEST_GROUP();
+}
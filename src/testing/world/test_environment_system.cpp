@@ -310,7 +310,8 @@ void test_climate_map_connection() {
     climateMap[50][50].moisture = 0.2f;
     
     // Connect climate data
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     TEST_ASSERT(envSystem.hasClimateData());
     
     // Verify queries return climate values
@@ -344,7 +345,8 @@ void test_out_of_bounds_with_climate_returns_defaults() {
     
     // Connect climate data
     auto climateMap = createClimateMap(100, 100);
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     // Out of bounds should return defaults
     TEST_ASSERT(std::abs(envSystem.getTemperature(-1, 0) - EnvironmentSystem::DEFAULT_TEMPERATURE) < 0.001f);
@@ -388,7 +390,8 @@ void test_organism_receives_per_tile_environment() {
     auto climateMap = createClimateMap(100, 100);
     climateMap[25][25].temperature = 40.0f;  // Hot tile
     climateMap[75][75].temperature = 5.0f;   // Cold tile
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     // Get environment for each location
     auto hotEnv = envSystem.getEnvironmentStateAt(25, 25);
@@ -490,7 +493,8 @@ void test_environment_system_returns_blended_values() {
     climateMap[50][50].biomeBlend.addContribution(Biome::TEMPERATE_GRASSLAND, 0.5f);
     climateMap[50][50].biomeBlend.normalize();
     
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     auto env = envSystem.getEnvironmentStateAt(50, 50);
     
@@ -543,7 +547,8 @@ void test_getMoisture_query() {
     
     auto climateMap = createClimateMap(100, 100);
     climateMap[50][50].moisture = 0.75f;
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     float moisture = envSystem.getMoisture(50, 50);
     TEST_ASSERT(std::abs(moisture - 0.75f) < 0.001f);
@@ -556,7 +561,8 @@ void test_getElevation_query() {
     
     auto climateMap = createClimateMap(100, 100);
     climateMap[50][50].elevation = 0.9f;
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     float elevation = envSystem.getElevation(50, 50);
     TEST_ASSERT(std::abs(elevation - 0.9f) < 0.001f);
@@ -569,7 +575,8 @@ void test_getBiome_query() {
     
     auto climateMap = createClimateMap(100, 100);
     climateMap[50][50].biomeBlend = BiomeBlend(Biome::TUNDRA);
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     int biome = envSystem.getBiome(50, 50);
     TEST_ASSERT(biome == static_cast<int>(Biome::TUNDRA));
@@ -586,7 +593,8 @@ void test_getClimateAt_raw_access() {
     climateMap[50][50].biomeBlend = BiomeBlend(Biome::TEMPERATE_FOREST);
     climateMap[50][50].biomeBlend.addContribution(Biome::TEMPERATE_GRASSLAND, 0.3f);
     climateMap[50][50].biomeBlend.normalize();
-    envSystem.setClimateMap(&climateMap);
+    ClimateStore store(climateMap);
+    envSystem.setClimateMap(&store);
     
     const TileClimate& climate = envSystem.getClimateAt(50, 50);
     
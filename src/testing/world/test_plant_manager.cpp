@@ -394,6 +394,113 @@ void test_index_query_after_deaths_does_not_return_stale_pointers() {
     }
 }
 
+//=============================================================================
+// Tests: Compact Plants
+//=============================================================================
+
+void test_compact_plants_are_records() {
+    Tile passableTile(100, '.', 1, true, false, 180, TerrainType::PLAINS);
+    WorldGrid grid(32, 32, passableTile);
+    ScentLayer scents(32, 32);
+
+    PlantManager manager(grid, scents);
+    manager.initialize();
+    manager.setCompactPlants(true);
+
+    TEST_ASSERT(manager.addPlant(10, 10, "grass"));
+    TEST_ASSERT(grid(10, 10).getPlants().empty());
+    TEST_ASSERT_EQ(size_t{1}, manager.records().size());
+    TEST_ASSERT_EQ(size_t{1}, manager.plantCount());
+
+    // One living plant per tile, as on the tiles
+    TEST_ASSERT(!manager.addPlant(10, 10, "oak_tree"));
+    TEST_ASSERT_EQ(size_t{1}, manager.records().size());
+
+    manager.setCompactPlants(false);
+    TEST_ASSERT(manager.records().empty());
+}
+
+void test_compact_nearest_plant_matches_tiles() {
+    Tile passableTile(100, '.', 1, true, false, 180, TerrainType::PLAINS);
+    WorldGrid tileGrid(32, 32, passableTile);
+    WorldGrid recordGrid(32, 32, passableTile);
+    ScentLayer tileScents(32, 32);
+    ScentLayer recordScents(32, 32);
+
+    PlantManager tiles(tileGrid, tileScents);
+    PlantManager records(recordGrid, recordScents);
+    tiles.initialize();
+    records.initialize();
+    records.setCompactPlants(true);
+    for (PlantManager* manager : {&tiles, &records}) {
+        manager->addPlant(10, 10, "grass");
+        manager->addPlant(14, 12, "oak_tree");
+        manager->addPlant(25, 25, "grass");
+    }
+
+    for (PlantManager* manager : {&tiles, &records}) {
+        G::Plant* nearest = manager->nearestPlant(13, 13, 8.0f);
+        TEST_ASSERT(nearest != nullptr);
+        TEST_ASSERT_EQ(14, nearest->getX());
+        TEST_ASSERT_EQ(12, nearest->getY());
+        TEST_ASSERT(manager->nearestPlant(0, 31, 5.0f) == nullptr);
+        TEST_ASSERT_EQ(size_t{2}, manager->queryPlantsInRadius(12, 11, 5.0f).size());
+    }
+
+    // Asking again hands out the same plant
+    TEST_ASSERT(records.nearestPlant(13, 13, 8.0f) == records.nearestPlant(14, 11, 3.0f));
+}
+
+void test_compact_plant_eaten_through_nearest_plant_dies() {
+    Tile passableTile(100, '.', 1, true, false, 180, TerrainType::PLAINS);
+    WorldGrid grid(32, 32, passableTile);
+    ScentLayer scents(32, 32);
+
+    PlantManager manager(grid, scents);
+    manager.initialize();
+    manager.setCompactPlants(true);
+    manager.addPlant(5, 5, "grass");
+    manager.addPlant(20, 20, "grass");
+
+    G::Plant* plant = manager.nearestPlant(6, 6, 4.0f);
+    TEST_ASSERT(plant != nullptr);
+    plant->takeDamage(1e6f);
+
+    // The dead plant is no longer offered, and the next tick drops its record
+    TEST_ASSERT(manager.nearestPlant(6, 6, 4.0f) == nullptr);
+    manager.tick(1);
+    TEST_ASSERT_EQ(size_t{1}, manager.records().size());
+    TEST_ASSERT_EQ(20, manager.records()[0].x);
+
+    // The tile is free again
+    TEST_ASSERT(manager.addPlant(5, 5, "grass"));
+}
+
+void test_compact_plants_disperse_into_records() {
+    Tile passableTile(100, '.', 1, true, false, 180, TerrainType::PLAINS);
+    WorldGrid grid(64, 64, passableTile);
+    ScentLayer scents(64, 64);
+
+    PlantManager manager(grid, scents);
+    manager.initialize();
+    manager.setCompactPlants(true);
+    for (int x = 28; x < 36; x += 2) {
+        for (int y = 28; y < 36; y += 2) {
+            manager.addPlant(x, y, "grass");
+        }
+    }
+    const size_t planted = manager.records().size();
+
+    for (unsigned tick = 0; tick < 300; ++tick) {
+        manager.tick(tick);
+    }
+
+    TEST_ASSERT_GT(manager.records().size(), planted);
+    for (const G::PlantRecord& record : manager.records().records()) {
+        TEST_ASSERT(grid(static_cast<unsigned>(record.x), static_cast<unsigned>(record.y)).getPlants().empty());
+    }
+}
+
 } // anonymous namespace
 
 //=============================================================================
@@ -432,4 +539,11 @@ void runPlantManagerTests() {
     RUN_TEST(test_dispersal_into_full_tile_does_not_leak_stale_pointer);
     RUN_TEST(test_index_query_after_deaths_does_not_return_stale_pointers);
     END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("PlantManager - Compact Plants");
+    RUN_TEST(test_compact_plants_are_records);
+    RUN_TEST(test_compact_nearest_plant_matches_tiles);
+    RUN_TEST(test_compact_plant_eaten_through_nearest_plant_dies);
+    RUN_TEST(test_compact_plants_disperse_into_records);
+    END_TEST_GROUP();
 }
@@ -0,0 +1,241 @@
+/**
+ * @file test_simulation_thread.cpp
+ * @brief Unit tests for TripleBuffer and SimulationThread
+ *
+ * Tests that the triple buffer always hands the reader the newest complete
+ * value, and that the simulation thread ticks, pauses, publishes snapshots
+ * on request and never runs a tick inside withWorld().
+ */
+
+#include "tripleBuffer.hpp"
+#include "simulationThread.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace EcoSim::Testing;
+
+namespace {
+
+constexpr double FAST_TICK_MS = 1.0;
+
+template<typename Pred>
+bool waitFor(Pred pred, int timeoutMs = 2000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+//==============================================================================
+// Test: TripleBuffer
+//==============================================================================
+
+void test_nothing_to_read_before_publish() {
+    EcoSim::TripleBuffer<int> buffer;
+    TEST_ASSERT(!buffer.update());
+    TEST_ASSERT_EQ(0, buffer.front());
+}
+
+void test_reader_gets_newest_value() {
+    EcoSim::TripleBuffer<int> buffer;
+    buffer.back() = 1;
+    buffer.publish();
+    buffer.back() = 2;
+    buffer.publish();
+
+    TEST_ASSERT(buffer.update());
+    TEST_ASSERT_EQ(2, buffer.front());
+    TEST_ASSERT(!buffer.update());
+    TEST_ASSERT_EQ(2, buffer.front());
+}
+
+void test_slots_keep_their_contents() {
+    EcoSim::TripleBuffer<std::vector<int>> buffer;
+    for (int i = 0; i < 3; ++i) {
+        buffer.back().assign(100, i);
+        buffer.publish();
+        buffer.update();
+    }
+    // Every slot has been filled once; the writer's next slot is reused
+    TEST_ASSERT(buffer.back().capacity() >= 100);
+}
+
+void test_concurrent_reader_sees_whole_values_in_order() {
+    struct Frame {
+        int sequence = 0;
+        std::array<int, 16> copies{};
+    };
+    EcoSim::TripleBuffer<Frame> buffer;
+    const int LAST = 20000;
+
+    std::thread writer([&]() {
+        for (int i = 1; i <= LAST; ++i) {
+            Frame& frame = buffer.back();
+            frame.sequence = i;
+            frame.copies.fill(i);
+            buffer.publish();
+        }
+    });
+
+    int previous = 0;
+    bool ordered = true;
+    bool whole = true;
+    while (previous < LAST) {
+        if (!buffer.update()) {
+            std::this_thread::yield();
+            continue;
+        }
+        const Frame& frame = buffer.front();
+        ordered = ordered && frame.sequence > previous;
+        for (int copy : frame.copies) {
+            whole = whole && copy == frame.sequence;
+        }
+        previous = frame.sequence;
+    }
+    writer.join();
+
+    TEST_ASSERT(ordered);
+    TEST_ASSERT(whole);
+}
+
+//==============================================================================
+// Test: SimulationThread
+//==============================================================================
+
+void test_ticks_publish_snapshots() {
+    std::atomic<unsigned int> ticks{0};
+    EcoSim::SimulationThread sim(FAST_TICK_MS,
+        [&]() { ++ticks; },
+        [&](RenderSnapshot& snapshot, const Viewport&, const PanelRequest&) {
+            snapshot.tick = ticks;
+        });
+
+    sim.start();
+    TEST_ASSERT(waitFor([&]() { return sim.ticksRun() >= 5; }));
+    sim.stop();
+
+    TEST_ASSERT(!sim.isRunning());
+    TEST_ASSERT(sim.updateSnapshot());
+    TEST_ASSERT_EQ(static_cast<unsigned int>(sim.ticksRun()), sim.snapshot().tick);
+    TEST_ASSERT(sim.snapshot().sequence >= sim.ticksRun());
+}
+
+void test_paused_thread_publishes_on_request() {
+    std::atomic<int> captures{0};
+    EcoSim::SimulationThread sim(FAST_TICK_MS,
+        []() {},
+        [&](RenderSnapshot& snapshot, const Viewport& region, const PanelRequest&) {
+            snapshot.region = region;
+            ++captures;
+        });
+
+    sim.setPaused(true);
+    sim.start();
+
+    // The first snapshot is published on start, even while paused
+    TEST_ASSERT(waitFor([&]() { return sim.updateSnapshot(); }));
+
+    sim.setViewRegion(Viewport(10, 20, 30, 40, 0, 0));
+    TEST_ASSERT(waitFor([&]() { return sim.updateSnapshot(); }));
+    TEST_ASSERT_EQ(10, sim.snapshot().region.originX);
+    TEST_ASSERT_EQ(40u, sim.snapshot().region.height);
+
+    // An unchanged region does not publish again
+    int before = captures;
+    sim.setViewRegion(Viewport(10, 20, 30, 40, 0, 0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    TEST_ASSERT_EQ(before, captures.load());
+
+    sim.stop();
+    TEST_ASSERT_EQ(std::uint64_t(0), sim.ticksRun());
+}
+
+void test_paused_thread_publishes_panel_requests() {
+    std::atomic<int> captures{0};
+    EcoSim::SimulationThread sim(FAST_TICK_MS,
+        []() {},
+        [&](RenderSnapshot& snapshot, const Viewport&, const PanelRequest& panels) {
+            snapshot.panels.request = panels;
+            ++captures;
+        });
+
+    sim.setPaused(true);
+    sim.start();
+    TEST_ASSERT(waitFor([&]() { return sim.updateSnapshot(); }));
+    TEST_ASSERT_EQ(-1, sim.snapshot().panels.request.selectedCreature);
+
+    // Selecting a creature while paused still reaches the capture
+    PanelRequest panels;
+    panels.selectedCreature = 7;
+    sim.setPanelRequest(panels);
+    TEST_ASSERT(waitFor([&]() { return sim.updateSnapshot(); }));
+    TEST_ASSERT_EQ(7, sim.snapshot().panels.request.selectedCreature);
+
+    int before = captures;
+    sim.setPanelRequest(panels);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    TEST_ASSERT_EQ(before, captures.load());
+
+    sim.stop();
+}
+
+void test_with_world_runs_between_ticks() {
+    std::atomic<bool> inTick{false};
+    std::atomic<bool> overlapped{false};
+    EcoSim::SimulationThread sim(FAST_TICK_MS,
+        [&]() {
+            inTick = true;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            inTick = false;
+        },
+        [](RenderSnapshot&, const Viewport&, const PanelRequest&) {});
+
+    sim.start();
+    bool ticksHeld = true;
+    for (int i = 0; i < 20; ++i) {
+        sim.withWorld([&]() {
+            std::uint64_t ticks = sim.ticksRun();
+            if (inTick) {
+                overlapped = true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            ticksHeld = ticksHeld && sim.ticksRun() == ticks;
+        });
+    }
+    TEST_ASSERT(waitFor([&]() { return sim.ticksRun() > 0; }));
+    sim.stop();
+
+    TEST_ASSERT(!overlapped);
+    TEST_ASSERT(ticksHeld);
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runSimulationThreadTests() {
+    BEGIN_TEST_GROUP("Simulation Thread - Triple Buffer");
+    RUN_TEST(test_nothing_to_read_before_publish);
+    RUN_TEST(test_reader_gets_newest_value);
+    RUN_TEST(test_slots_keep_their_contents);
+    RUN_TEST(test_concurrent_reader_sees_whole_values_in_order);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("Simulation Thread - Ticking and Snapshots");
+    RUN_TEST(test_ticks_publish_snapshots);
+    RUN_TEST(test_paused_thread_publishes_on_request);
+    RUN_TEST(test_paused_thread_publishes_panel_requests);
+    RUN_TEST(test_with_world_runs_between_ticks);
+    END_TEST_GROUP();
+}
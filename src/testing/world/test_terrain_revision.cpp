@@ -0,0 +1,70 @@
+/**
+ * @file test_terrain_revision.cpp
+ * @brief Unit tests for World terrain revisions
+ *
+ * Tests that every world and every regeneration gets a revision of its own,
+ * so renderers caching terrain know when to redraw it.
+ */
+
+#include "world/world.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <cstdint>
+
+using namespace EcoSim::Testing;
+
+namespace {
+
+MapGen smallMap() {
+    MapGen mapGen;
+    mapGen.rows = 40;
+    mapGen.cols = 60;
+    mapGen.seed = 4242.0;
+    return mapGen;
+}
+
+//==============================================================================
+// Test: Whole-world Changes
+//==============================================================================
+
+void test_worlds_never_share_a_revision() {
+    World first(smallMap(), OctaveGen());
+    World second(smallMap(), OctaveGen());
+    TEST_ASSERT(first.getTerrainRevision() != second.getTerrainRevision());
+}
+
+void test_regeneration_moves_to_a_new_revision() {
+    World world(smallMap(), OctaveGen());
+    std::uint64_t before = world.getTerrainRevision();
+
+    world.regenerateClimate(7);
+    std::uint64_t climate = world.getTerrainRevision();
+    TEST_ASSERT(climate > before);
+
+    world.regenerateClimate(7);
+    TEST_ASSERT(world.getTerrainRevision() > climate);
+}
+
+void test_simulation_leaves_revision_alone() {
+    World world(smallMap(), OctaveGen());
+    std::uint64_t before = world.getTerrainRevision();
+
+    for (int tick = 0; tick < 5; ++tick) {
+        world.updateAllObjects();
+    }
+    TEST_ASSERT_EQ(before, world.getTerrainRevision());
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runTerrainRevisionTests() {
+    BEGIN_TEST_GROUP("Terrain Revisions - Whole-world Changes");
+    RUN_TEST(test_worlds_never_share_a_revision);
+    RUN_TEST(test_regeneration_moves_to_a_new_revision);
+    RUN_TEST(test_simulation_leaves_revision_alone);
+    END_TEST_GROUP();
+}
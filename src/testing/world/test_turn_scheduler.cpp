@@ -0,0 +1,285 @@
+/**
+ * @file test_turn_scheduler.cpp
+ * @brief Unit tests for TurnScheduler level-of-detail creature turns
+ */
+
+#include "world/TurnScheduler.hpp"
+#include "world/SpatialIndex.hpp"
+#include "world/ScentLayer.hpp"
+#include "objects/creature/creature.hpp"
+#include "genetics/behaviors/BehaviorController.hpp"
+#include "genetics/behaviors/BehaviorContext.hpp"
+#include "genetics/behaviors/MovementBehavior.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+using namespace EcoSim;
+using namespace EcoSim::Testing;
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+/// Always applicable, does nothing; stands in for the behavior a creature holds
+class HeldBehavior : public G::IBehavior {
+public:
+    explicit HeldBehavior(std::string id) : _id(std::move(id)) {}
+
+    std::string getId() const override { return _id; }
+    bool isApplicable(const G::Organism&, const G::BehaviorContext&) const override { return true; }
+    float getPriority(const G::Organism&) const override { return 0.0f; }
+    G::BehaviorResult execute(G::Organism&, G::BehaviorContext&) override {
+        return G::BehaviorResult{true, false, 0.0f, ""};
+    }
+    float getEnergyCost(const G::Organism&) const override { return 0.0f; }
+
+private:
+    std::string _id;
+};
+
+Creature makeCreature(int x, int y) {
+    Creature::initializeGeneRegistry();
+    auto genome = std::make_unique<G::Genome>(
+        G::UniversalGenes::createCreatureGenome(Creature::getGeneRegistry()));
+    Creature creature(x, y, std::move(genome));
+    creature.setHunger(8.0f);
+    creature.setThirst(8.0f);
+    creature.setFatigue(2.0f);
+    return creature;
+}
+
+/// Runs one turn of the creature holding the given behavior
+G::BehaviorResult holdBehavior(G::Organism& organism, const std::string& behaviorId) {
+    auto controller = std::make_unique<G::BehaviorController>();
+    controller->addBehavior(std::make_unique<HeldBehavior>(behaviorId));
+    organism.setOrganismBehaviorController(std::move(controller));
+    G::BehaviorContext ctx;
+    return organism.getOrganismBehaviorController()->update(organism, ctx);
+}
+
+/// Tick of the organism's next full turn, or 0 if it is not scheduled
+unsigned nextTurn(const G::Organism& organism) {
+    const G::ScheduleComponent* schedule = organism.schedule();
+    return schedule ? schedule->nextTurnTick : 0u;
+}
+
+TurnSchedulerConfig enabledConfig() {
+    TurnSchedulerConfig config;
+    config.enabled = true;
+    return config;
+}
+
+//=============================================================================
+// Tests: Deferral
+//=============================================================================
+
+void test_resting_creature_is_deferred() {
+    TurnScheduler scheduler;
+    scheduler.setConfig(enabledConfig());
+    ScentLayer scents(40, 40);
+    Creature creature = makeCreature(10, 10);
+
+    // Unscheduled organisms take their turn
+    TEST_ASSERT_EQ(1u, scheduler.beginTurn(creature, 100));
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 100, nullptr, scents);
+
+    TEST_ASSERT(creature.schedule() != nullptr);
+    const unsigned next = nextTurn(creature);
+    TEST_ASSERT_GT(next, 101u);
+    TEST_ASSERT_LE(next, 100u + scheduler.getConfig().restingInterval);
+
+    for (unsigned tick = 101; tick < next; ++tick) {
+        TEST_ASSERT_EQ(0u, scheduler.beginTurn(creature, tick));
+    }
+    TEST_ASSERT_EQ(next - 100u, scheduler.beginTurn(creature, next));
+    TEST_ASSERT_EQ(static_cast<std::uint64_t>(next - 101u), scheduler.turnsSkipped());
+    TEST_ASSERT_EQ(static_cast<std::uint64_t>(2), scheduler.turnsTaken());
+}
+
+void test_isolated_wanderer_is_deferred() {
+    TurnScheduler scheduler;
+    scheduler.setConfig(enabledConfig());
+    ScentLayer scents(40, 40);
+    SpatialIndex index(40, 40);
+    Creature creature = makeCreature(10, 10);
+    index.insert(&creature);
+
+    scheduler.endTurn(creature, holdBehavior(creature, "movement"), 100, &index, scents);
+    TEST_ASSERT_GT(nextTurn(creature), 101u);
+
+    // A neighbour within sight keeps it at full rate
+    Creature neighbour = makeCreature(12, 10);
+    index.insert(&neighbour);
+    scheduler.endTurn(creature, holdBehavior(creature, "movement"), 101, &index, scents);
+    TEST_ASSERT_EQ(102u, nextTurn(creature));
+}
+
+void test_disabled_scheduler_runs_every_turn() {
+    TurnScheduler scheduler;
+    ScentLayer scents(40, 40);
+    Creature creature = makeCreature(10, 10);
+
+    for (unsigned tick = 100; tick < 110; ++tick) {
+        TEST_ASSERT_EQ(1u, scheduler.beginTurn(creature, tick));
+        scheduler.endTurn(creature, holdBehavior(creature, "rest"), tick, nullptr, scents);
+    }
+    TEST_ASSERT(creature.schedule() == nullptr);
+}
+
+//=============================================================================
+// Tests: Waking
+//=============================================================================
+
+void test_damage_wakes_on_next_tick() {
+    TurnScheduler scheduler;
+    scheduler.setConfig(enabledConfig());
+    ScentLayer scents(40, 40);
+    Creature creature = makeCreature(10, 10);
+
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 100, nullptr, scents);
+    TEST_ASSERT_GT(nextTurn(creature), 101u);
+
+    creature.takeDamage(1.0f);
+    TEST_ASSERT_EQ(1u, scheduler.beginTurn(creature, 101));
+
+    // Woken during its turn: the next one is at full rate too
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 101, nullptr, scents);
+    TEST_ASSERT_EQ(102u, nextTurn(creature));
+    TEST_ASSERT(creature.schedule() && !creature.schedule()->woken);
+}
+
+void test_threat_wakes_on_next_tick() {
+    TurnScheduler scheduler;
+    scheduler.setConfig(enabledConfig());
+    ScentLayer scents(40, 40);
+    Creature creature = makeCreature(10, 10);
+
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 100, nullptr, scents);
+    creature.setFleeing(true);
+    TEST_ASSERT_EQ(1u, scheduler.beginTurn(creature, 101));
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 101, nullptr, scents);
+    TEST_ASSERT_EQ(102u, nextTurn(creature));
+    creature.setFleeing(false);
+
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 102, nullptr, scents);
+    creature.setInCombat(true);
+    TEST_ASSERT_EQ(1u, scheduler.beginTurn(creature, 103));
+}
+
+//=============================================================================
+// Tests: Integration of skipped ticks
+//=============================================================================
+
+void test_skipped_ticks_stay_within_need_drift() {
+    TurnScheduler scheduler;
+    TurnSchedulerConfig config = enabledConfig();
+    config.restingInterval = 200;
+    config.maxNeedDrift = 0.2f;
+    scheduler.setConfig(config);
+    ScentLayer scents(40, 40);
+    Creature creature = makeCreature(10, 10);
+
+    scheduler.endTurn(creature, holdBehavior(creature, "rest"), 100, nullptr, scents);
+    const unsigned next = nextTurn(creature);
+    TEST_ASSERT_GT(next, 101u);
+    TEST_ASSERT_LT(next, 100u + config.restingInterval);
+
+    const float hunger = creature.getHunger();
+    const float thirst = creature.getThirst();
+    const float fatigue = creature.getFatigue();
+    const float mate = creature.getMate();
+    const unsigned age = creature.getAge();
+
+    TEST_ASSERT_EQ(next - 100u, scheduler.beginTurn(creature, next));
+
+    const float slack = 1e-4f;
+    TEST_ASSERT_LE(std::abs(creature.getHunger() - hunger), config.maxNeedDrift + slack);
+    TEST_ASSERT_LE(std::abs(creature.getThirst() - thirst), config.maxNeedDrift + slack);
+    TEST_ASSERT_LE(std::abs(creature.getFatigue() - fatigue), config.maxNeedDrift + slack);
+    TEST_ASSERT_LE(std::abs(creature.getMate() - mate), config.maxNeedDrift + slack);
+    TEST_ASSERT_EQ(age + (next - 101u), creature.getAge());
+    TEST_ASSERT_LT(creature.getHunger(), hunger);
+}
+
+void test_integrated_ticks_match_single_ticks() {
+    Creature batched = makeCreature(10, 10);
+    Creature stepped = makeCreature(10, 10);
+
+    batched.integrateSkippedTicks(6, 0.01f);
+    for (int i = 0; i < 6; ++i) {
+        stepped.integrateSkippedTicks(1, 0.01f);
+    }
+
+    TEST_ASSERT_NEAR(stepped.getHunger(), batched.getHunger(), 1e-5f);
+    TEST_ASSERT_NEAR(stepped.getThirst(), batched.getThirst(), 1e-5f);
+    TEST_ASSERT_NEAR(stepped.getFatigue(), batched.getFatigue(), 1e-5f);
+    TEST_ASSERT_NEAR(stepped.getMate(), batched.getMate(), 1e-5f);
+    TEST_ASSERT_EQ(stepped.getAge(), batched.getAge());
+}
+
+//=============================================================================
+// Tests: Movement over skipped ticks
+//=============================================================================
+
+void test_target_move_over_skipped_ticks() {
+    const int ticks = 4;
+    Creature batched = makeCreature(2, 2);
+    Creature stepped = makeCreature(2, 2);
+
+    G::MovementBehavior batchedMove;
+    G::MovementBehavior steppedMove;
+    batchedMove.setTarget(30, 20);
+    steppedMove.setTarget(30, 20);
+
+    const float startX = batched.getWorldX();
+    G::BehaviorContext ctx;
+    ctx.worldRows = 40;
+    ctx.worldCols = 40;
+    for (int i = 0; i < ticks; ++i) {
+        steppedMove.execute(stepped, ctx);
+    }
+    ctx.deltaTime = static_cast<float>(ticks);
+    batchedMove.execute(batched, ctx);
+
+    TEST_ASSERT_GT(batched.getWorldX(), startX);
+    TEST_ASSERT_NEAR(stepped.getWorldX(), batched.getWorldX(), 1e-4f);
+    TEST_ASSERT_NEAR(stepped.getWorldY(), batched.getWorldY(), 1e-4f);
+
+    // Steps that would overshoot stop at the target
+    G::MovementBehavior nearMove;
+    Creature near = makeCreature(2, 2);
+    nearMove.setTarget(3, 2);
+    ctx.deltaTime = 50.0f;
+    nearMove.execute(near, ctx);
+    TEST_ASSERT_NEAR(3.5f, near.getWorldX(), 1e-4f);
+    TEST_ASSERT_NEAR(2.5f, near.getWorldY(), 1e-4f);
+}
+
+} // anonymous namespace
+
+//=============================================================================
+// Test Runner
+//=============================================================================
+
+void runTurnSchedulerTests() {
+    BEGIN_TEST_GROUP("TurnScheduler - Deferral");
+    RUN_TEST(test_resting_creature_is_deferred);
+    RUN_TEST(test_isolated_wanderer_is_deferred);
+    RUN_TEST(test_disabled_scheduler_runs_every_turn);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TurnScheduler - Waking");
+    RUN_TEST(test_damage_wakes_on_next_tick);
+    RUN_TEST(test_threat_wakes_on_next_tick);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("TurnScheduler - Skipped Ticks");
+    RUN_TEST(test_skipped_ticks_stay_within_need_drift);
+    RUN_TEST(test_integrated_ticks_match_single_ticks);
+    RUN_TEST(test_target_move_over_skipped_ticks);
+    END_TEST_GROUP();
+}
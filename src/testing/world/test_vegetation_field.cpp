@@ -0,0 +1,227 @@
+/**
+ * @file test_vegetation_field.cpp
+ * @brief Unit tests for VegetationField and PlantManager's ground cover mode
+ */
+
+#include "world/VegetationField.hpp"
+#include "world/PlantManager.hpp"
+#include "world/WorldGrid.hpp"
+#include "world/ScentLayer.hpp"
+#include "genetics/core/GeneRegistry.hpp"
+#include "genetics/defaults/UniversalGenes.hpp"
+#include "genetics/organisms/PlantFactory.hpp"
+#include "../genetics/test_framework.hpp"
+
+#include <memory>
+
+using namespace EcoSim;
+using namespace EcoSim::Testing;
+namespace G = EcoSim::Genetics;
+
+namespace {
+
+G::Plant makeGrass() {
+    auto registry = std::make_shared<G::GeneRegistry>();
+    G::UniversalGenes::registerDefaults(*registry);
+    G::PlantFactory factory(registry);
+    factory.registerTemplate(G::PlantFactory::createGrassTemplate());
+    return factory.createFromTemplate("grass", 0, 0);
+}
+
+/// Field of grass on every tile at a mild, moist climate
+VegetationField makeGrassField(unsigned width, unsigned height) {
+    VegetationField field;
+    field.resize(width, height);
+    const int grass = field.addSpecies("grass", makeGrass());
+    for (int y = 0; y < static_cast<int>(height); ++y) {
+        for (int x = 0; x < static_cast<int>(width); ++x) {
+            field.setHabitat(x, y, grass, 20.0f, 1.0f);
+        }
+    }
+    return field;
+}
+
+//=============================================================================
+// Tests: VegetationField
+//=============================================================================
+
+void test_habitat_and_capacity() {
+    VegetationField field = makeGrassField(4, 3);
+
+    TEST_ASSERT_EQ(static_cast<std::size_t>(12), field.habitatTiles());
+    TEST_ASSERT(!field.empty());
+    TEST_ASSERT_EQ(0, field.speciesAt(2, 1));
+    TEST_ASSERT_EQ(VegetationField::NONE, field.speciesAt(5, 1));
+    TEST_ASSERT_NEAR(field.prototype(0).getMaxSize(), field.capacityAt(1, 1), 1e-6f);
+
+    // Biomass is clamped to capacity
+    field.setBiomass(1, 1, 1000.0f);
+    TEST_ASSERT_NEAR(field.capacityAt(1, 1), field.biomassAt(1, 1), 1e-6f);
+}
+
+void test_growth_approaches_capacity() {
+    VegetationField field = makeGrassField(3, 3);
+    const float capacity = field.capacityAt(0, 0);
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            field.setBiomass(x, y, 0.1f * capacity);
+        }
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        field.step(0.5f, 0.0f);
+    }
+
+    TEST_ASSERT_GT(field.biomassAt(1, 1), 0.9f * capacity);
+    TEST_ASSERT_LE(field.biomassAt(1, 1), capacity);
+}
+
+void test_dies_back_outside_tolerance() {
+    VegetationField field = makeGrassField(3, 3);
+    const float capacity = field.capacityAt(0, 0);
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            field.setBiomass(x, y, capacity);
+        }
+    }
+
+    // A deep winter puts every tile far below grass' tolerance
+    for (int i = 0; i < 50; ++i) {
+        field.step(0.5f, -60.0f);
+    }
+
+    TEST_ASSERT_LT(field.biomassAt(1, 1), 0.5f * capacity);
+}
+
+void test_spread_colonises_neighbours() {
+    VegetationField field = makeGrassField(5, 1);
+    field.setBiomass(0, 0, field.capacityAt(0, 0));
+
+    for (int i = 0; i < 200; ++i) {
+        field.step(0.5f, 0.0f);
+    }
+
+    TEST_ASSERT_GT(field.biomassAt(1, 0), 0.0f);
+    TEST_ASSERT_GT(field.biomassAt(4, 0), 0.0f);
+}
+
+void test_graze_removes_biomass() {
+    VegetationField field = makeGrassField(2, 2);
+    const float capacity = field.capacityAt(0, 0);
+    field.setBiomass(0, 0, capacity);
+
+    TEST_ASSERT_NEAR(0.25f * capacity, field.graze(0, 0, 0.25f * capacity), 1e-6f);
+    TEST_ASSERT_NEAR(0.75f * capacity, field.biomassAt(0, 0), 1e-6f);
+
+    // Only what is there can be eaten
+    TEST_ASSERT_NEAR(0.75f * capacity, field.graze(0, 0, 10.0f), 1e-6f);
+    TEST_ASSERT_NEAR(0.0f, field.biomassAt(0, 0), 1e-6f);
+    TEST_ASSERT(!field.isGrazeable(0, 0));
+
+    TEST_ASSERT_NEAR(0.0f, field.graze(-1, 0, 1.0f), 1e-6f);
+}
+
+void test_find_nearest_grazeable() {
+    VegetationField field = makeGrassField(20, 20);
+    field.setBiomass(15, 15, field.capacityAt(15, 15));
+    field.setBiomass(3, 14, field.capacityAt(3, 14));
+    field.step(0.5f, 0.0f);
+
+    int x = -1;
+    int y = -1;
+    TEST_ASSERT(!field.findNearestGrazeable(2, 2, 5.0f, x, y));
+
+    TEST_ASSERT(field.findNearestGrazeable(12, 12, 10.0f, x, y));
+    TEST_ASSERT_EQ(15, x);
+    TEST_ASSERT_EQ(15, y);
+
+    TEST_ASSERT(field.findNearestGrazeable(2, 10, 10.0f, x, y));
+    TEST_ASSERT_EQ(3, x);
+    TEST_ASSERT_EQ(14, y);
+
+    // A creature standing on grazeable cover eats where it is
+    TEST_ASSERT(field.findNearestGrazeable(15, 15, 0.0f, x, y));
+    TEST_ASSERT_EQ(15, x);
+    TEST_ASSERT_EQ(15, y);
+}
+
+//=============================================================================
+// Tests: PlantManager ground cover mode
+//=============================================================================
+
+void test_manager_field_off_by_default() {
+    WorldGrid grid(20, 20);
+    ScentLayer scents(20, 20);
+    PlantManager manager(grid, scents);
+    manager.initialize();
+
+    TEST_ASSERT(!manager.hasGroundCoverField());
+    TEST_ASSERT(manager.groundCover().empty());
+}
+
+void test_manager_seeds_grass_into_field() {
+    WorldGrid grid;
+    grid.resize(20, 20, Tile(100, '.', 2, true, false, 180));
+    ScentLayer scents(20, 20);
+
+    PlantManager manager(grid, scents);
+    manager.setGroundCoverField(true);
+    manager.initialize();
+
+    int added = 0;
+    for (int x = 0; x < 20; ++x) {
+        for (int y = 0; y < 20; ++y) {
+            if (manager.addBiomePlant(x, y)) ++added;
+        }
+    }
+
+    // Without climate data every tile is temperate grassland: grass goes
+    // into the field, the other species stay individual plants
+    const VegetationField& field = manager.groundCover();
+    int fieldTiles = 0;
+    int plantTiles = 0;
+    for (int x = 0; x < 20; ++x) {
+        for (int y = 0; y < 20; ++y) {
+            const bool seeded = field.biomassAt(x, y) > 0.0f;
+            const bool planted = !grid(static_cast<unsigned>(x), static_cast<unsigned>(y)).getPlants().empty();
+            TEST_ASSERT(!(seeded && planted));
+            if (seeded) ++fieldTiles;
+            if (planted) ++plantTiles;
+        }
+    }
+    TEST_ASSERT_EQ(added, fieldTiles + plantTiles);
+    TEST_ASSERT_GT(fieldTiles, 0);
+    TEST_ASSERT_GT(plantTiles, 0);
+    TEST_ASSERT_EQ(static_cast<std::size_t>(400), field.habitatTiles());
+
+    for (unsigned i = 0; i < 5; ++i) {
+        manager.tick(i);
+    }
+    TEST_ASSERT_GT(field.totalBiomass(), 0.0);
+    TEST_ASSERT_GE(manager.memoryUsage(), field.memoryUsage());
+}
+
+} // anonymous namespace
+
+//=============================================================================
+// Test Runner
+//=============================================================================
+
+void runVegetationFieldTests() {
+    BEGIN_TEST_GROUP("VegetationField - Dynamics");
+    RUN_TEST(test_habitat_and_capacity);
+    RUN_TEST(test_growth_approaches_capacity);
+    RUN_TEST(test_dies_back_outside_tolerance);
+    RUN_TEST(test_spread_colonises_neighbours);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("VegetationField - Grazing");
+    RUN_TEST(test_graze_removes_biomass);
+    RUN_TEST(test_find_nearest_grazeable);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("VegetationField - PlantManager Ground Cover");
+    RUN_TEST(test_manager_field_off_by_default);
+    RUN_TEST(test_manager_seeds_grass_into_field);
+    END_TEST_GROUP();
+}
@@ -11,6 +11,9 @@
 
 #include <set>
 #include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
 
 using namespace EcoSim;
 using namespace EcoSim::Testing;
@@ -448,6 +451,59 @@ void test_serialize_config() {
     TEST_ASSERT(serialized.length() > 0);
 }
 
+//==============================================================================
+// Test: Batched Noise
+//==============================================================================
+
+/// Number of out[i] whose bits differ from expected[i] (NaN-safe, unlike ==).
+int bitMismatches(const std::vector<float>& expected, const std::vector<float>& out) {
+    int mismatches = 0;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        if (std::memcmp(&expected[i], &out[i], sizeof(float)) != 0) ++mismatches;
+    }
+    return mismatches;
+}
+
+void test_noise_batch_matches_scalar() {
+    // Small, large, negative and integer coordinates; 1001 leaves a tail
+    // after every kernel's full steps
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> dist(-5000.0f, 5000.0f);
+    const std::size_t count = 1001;
+    std::vector<float> xs(count), ys(count), expected(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        float scale = (i % 3 == 0) ? 0.001f : 1.0f;
+        xs[i] = (i % 7 == 0) ? std::floor(dist(rng)) : dist(rng) * scale;
+        ys[i] = dist(rng) * scale;
+        expected[i] = SimplexNoise::noise(xs[i], ys[i]);
+    }
+    
+    for (SimplexNoise::Kernel kernel : {SimplexNoise::Kernel::Scalar,
+                                        SimplexNoise::Kernel::SSE2,
+                                        SimplexNoise::Kernel::AVX2}) {
+        std::vector<float> out(count);
+        SimplexNoise::noiseBatch(xs.data(), ys.data(), count, out.data(), kernel);
+        TEST_ASSERT_EQ(0, bitMismatches(expected, out));
+    }
+}
+
+void test_noise_row_matches_scalar() {
+    const std::size_t count = 300;
+    std::vector<float> expected(count), out(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        expected[i] = SimplexNoise::noise(-12.5f + static_cast<float>(i) * 0.37f, 3.25f);
+    }
+    SimplexNoise::noiseRow(-12.5f, 0.37f, 3.25f, count, out.data());
+    TEST_ASSERT_EQ(0, bitMismatches(expected, out));
+    
+    SimplexNoise fractal(0.02f, 1.0f, 2.0f, 0.5f);
+    for (std::size_t i = 0; i < count; ++i) {
+        expected[i] = fractal.fractal(5, -12.5f + static_cast<float>(i) * 0.37f, 3.25f);
+    }
+    fractal.fractalRow(5, -12.5f, 0.37f, 3.25f, count, out.data());
+    TEST_ASSERT_EQ(0, bitMismatches(expected, out));
+}
+
 } // anonymous namespace
 
 //==============================================================================
@@ -487,4 +543,9 @@ void runWorldGeneratorTests() {
     BEGIN_TEST_GROUP("WorldGenerator - Serialization");
     RUN_TEST(test_serialize_config);
     END_TEST_GROUP();
+    
+    BEGIN_TEST_GROUP("WorldGenerator - Batched Noise");
+    RUN_TEST(test_noise_batch_matches_scalar);
+    RUN_TEST(test_noise_row_matches_scalar);
+    END_TEST_GROUP();
 }
@@ -0,0 +1,177 @@
+/**
+ * @file test_world_overview.cpp
+ * @brief Unit tests for WorldOverview
+ *
+ * Tests the pyramid layout, dominant terrain summaries and their
+ * incremental update, and that population layers sum upwards.
+ */
+
+#include "world/WorldOverview.hpp"
+#include "world/WorldGrid.hpp"
+#include "world/tile.hpp"
+#include "../genetics/test_framework.hpp"
+
+using namespace EcoSim::Testing;
+using EcoSim::WorldOverview;
+using EcoSim::WorldGrid;
+
+namespace {
+
+Tile tileOf(TerrainType terrain) {
+    return Tile(10, '.', 0, true, false, terrain);
+}
+
+//==============================================================================
+// Test: Levels
+//==============================================================================
+
+void test_levels_halve_down_to_one_cell() {
+    WorldGrid grid(100, 40, tileOf(TerrainType::PLAINS));
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    // 100x40 tiles -> 13x5 blocks of 8, then 7x3, 4x2, 2x1, 1x1
+    TEST_ASSERT_EQ(5u, overview.levelCount());
+    TEST_ASSERT_EQ(13u, overview.levelWidth(0));
+    TEST_ASSERT_EQ(5u, overview.levelHeight(0));
+    TEST_ASSERT_EQ(7u, overview.levelWidth(1));
+    TEST_ASSERT_EQ(3u, overview.levelHeight(1));
+    TEST_ASSERT_EQ(1u, overview.levelWidth(4));
+    TEST_ASSERT_EQ(1u, overview.levelHeight(4));
+    TEST_ASSERT_EQ(32u, WorldOverview::blockSize(2));
+}
+
+void test_level_fitting_picks_coarsest_large_enough() {
+    WorldGrid grid(100, 40, tileOf(TerrainType::PLAINS));
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    TEST_ASSERT_EQ(1u, overview.levelFitting(6));
+    TEST_ASSERT_EQ(0u, overview.levelFitting(13));
+    TEST_ASSERT_EQ(4u, overview.levelFitting(1));
+    // Nothing is that detailed; the finest level is the best there is
+    TEST_ASSERT_EQ(0u, overview.levelFitting(1000));
+}
+
+//==============================================================================
+// Test: Terrain
+//==============================================================================
+
+void test_blocks_keep_dominant_terrain() {
+    WorldGrid grid(16, 8, tileOf(TerrainType::PLAINS));
+    for (unsigned int y = 0; y < 8; ++y) {
+        for (unsigned int x = 8; x < 13; ++x) {
+            grid(x, y) = tileOf(TerrainType::WATER);
+        }
+    }
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    TEST_ASSERT(overview.cell(0, 0, 0).terrain == TerrainType::PLAINS);
+    TEST_ASSERT_EQ(64u, overview.cell(0, 0, 0).terrainTiles);
+    TEST_ASSERT(overview.cell(0, 1, 0).terrain == TerrainType::WATER);
+    TEST_ASSERT_EQ(40u, overview.cell(0, 1, 0).terrainTiles);
+    // 64 plains tiles outweigh 40 water tiles one level up
+    TEST_ASSERT(overview.cell(1, 0, 0).terrain == TerrainType::PLAINS);
+}
+
+void test_tile_edit_updates_every_level() {
+    WorldGrid grid(32, 32, tileOf(TerrainType::PLAINS));
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    // Flood most of the top-left 16x16 quarter one tile at a time
+    for (unsigned int y = 0; y < 16; ++y) {
+        for (unsigned int x = 0; x < 16; ++x) {
+            grid(x, y) = tileOf(TerrainType::FOREST);
+            overview.updateTerrain(grid, x, y);
+        }
+    }
+    TEST_ASSERT(overview.cell(0, 1, 1).terrain == TerrainType::FOREST);
+    TEST_ASSERT(overview.cell(1, 0, 0).terrain == TerrainType::FOREST);
+    TEST_ASSERT(overview.cell(1, 1, 1).terrain == TerrainType::PLAINS);
+    // Still 3/4 plains overall
+    TEST_ASSERT(overview.cell(2, 0, 0).terrain == TerrainType::PLAINS);
+    TEST_ASSERT_EQ(768u, overview.cell(2, 0, 0).terrainTiles);
+
+    // Edits outside the world are ignored
+    overview.updateTerrain(grid, 100, 100);
+}
+
+//==============================================================================
+// Test: Population
+//==============================================================================
+
+void test_population_sums_upwards() {
+    WorldGrid grid(32, 32, tileOf(TerrainType::PLAINS));
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    overview.clear(WorldOverview::Layer::Plants);
+    overview.addPlant(1, 1, 2.0f);
+    overview.addPlant(2, 2, 3.0f);
+    overview.addPlant(20, 30, 1.0f);
+    overview.addPlant(-1, 5, 1.0f);     // Outside the world, ignored
+    overview.propagate(WorldOverview::Layer::Plants);
+
+    overview.clear(WorldOverview::Layer::Creatures);
+    overview.addCreature(9, 0, true, false);
+    overview.addCreature(10, 1, false, true);
+    overview.addCreature(31, 31, false, false);
+    overview.propagate(WorldOverview::Layer::Creatures);
+
+    TEST_ASSERT_EQ(2u, overview.cell(0, 0, 0).plants);
+    TEST_ASSERT_EQ(5.0f, overview.cell(0, 0, 0).plantBiomass);
+    TEST_ASSERT_EQ(2u, overview.cell(0, 1, 0).creatures);
+
+    const WorldOverview::Cell& top = overview.cell(2, 0, 0);
+    TEST_ASSERT_EQ(3u, top.plants);
+    TEST_ASSERT_EQ(6.0f, top.plantBiomass);
+    TEST_ASSERT_EQ(3u, top.creatures);
+    TEST_ASSERT_EQ(1u, top.herbivores);
+    TEST_ASSERT_EQ(1u, top.carnivores);
+    TEST_ASSERT_EQ(0u, top.corpses);
+}
+
+void test_clear_resets_only_its_layer() {
+    WorldGrid grid(16, 16, tileOf(TerrainType::PLAINS));
+    WorldOverview overview;
+    overview.rebuildTerrain(grid);
+
+    overview.addPlant(0, 0, 1.0f);
+    overview.addCorpse(0, 0);
+    overview.propagate(WorldOverview::Layer::Plants);
+    overview.propagate(WorldOverview::Layer::Corpses);
+
+    // Refilling the corpses each tick must not accumulate
+    overview.clear(WorldOverview::Layer::Corpses);
+    overview.addCorpse(0, 0);
+    overview.propagate(WorldOverview::Layer::Corpses);
+
+    const WorldOverview::Cell& top = overview.cell(overview.levelCount() - 1, 0, 0);
+    TEST_ASSERT_EQ(1u, top.plants);
+    TEST_ASSERT_EQ(1u, top.corpses);
+}
+
+} // anonymous namespace
+
+//==============================================================================
+// Test Runner
+//==============================================================================
+
+void runWorldOverviewTests() {
+    BEGIN_TEST_GROUP("WorldOverview - Levels");
+    RUN_TEST(test_levels_halve_down_to_one_cell);
+    RUN_TEST(test_level_fitting_picks_coarsest_large_enough);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("WorldOverview - Terrain");
+    RUN_TEST(test_blocks_keep_dominant_terrain);
+    RUN_TEST(test_tile_edit_updates_every_level);
+    END_TEST_GROUP();
+
+    BEGIN_TEST_GROUP("WorldOverview - Population");
+    RUN_TEST(test_population_sums_upwards);
+    RUN_TEST(test_clear_resets_only_its_layer);
+    END_TEST_GROUP();
+}
@@ -0,0 +1,439 @@
+/**
+ * @file ChunkedWorld.cpp
+ * @brief Implementation of lazily generated, chunked worlds
+ */
+
+#include "../../include/world/ChunkedWorld.hpp"
+#include "../../include/world/WorldGrid.hpp"
+#include "../../include/parallel.hpp"
+#include "../../include/memoryUsage.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+namespace EcoSim {
+
+namespace {
+
+static_assert(std::is_trivially_copyable<PackedTileClimate>::value,
+              "chunk cache files store PackedTileClimate as raw bytes");
+
+// Header of a chunk cache file
+struct CacheHeader {
+    char magic[4];
+    std::uint32_t cx, cy;
+    std::uint32_t width, height;
+    std::uint32_t worldWidth, worldHeight;
+    std::uint32_t chunkSize;
+    std::uint64_t key;
+};
+
+/// Generator parameters (which include the world size) plus the chunk size
+std::uint64_t chunkCacheKey(const ClimateWorldGenerator& overview, unsigned int chunkSize) {
+    return overview.generationKey() ^ (static_cast<std::uint64_t>(chunkSize) * 0x9e3779b97f4a7c15ULL);
+}
+
+constexpr char CACHE_MAGIC[4] = {'E', 'C', 'H', 'K'};
+
+/// Everything about a tile except its plants
+bool sameTerrain(const Tile& a, const Tile& b) {
+    return a.getChar() == b.getChar() && a.getColPair() == b.getColPair() &&
+           a.getTerrainType() == b.getTerrainType() && a.isPassable() == b.isPassable() &&
+           a.isSource() == b.isSource() && a.getElevation() == b.getElevation() &&
+           a.getWaterDepth() == b.getWaterDepth();
+}
+
+} // anonymous namespace
+
+//=============================================================================
+// Construction
+//=============================================================================
+
+ChunkedWorld::ChunkedWorld(const ChunkedWorldConfig& config)
+    : _config(config) {
+    _config.chunkSize = std::max(1u, _config.chunkSize);
+    _config.overviewResolution = std::max(1u, _config.overviewResolution);
+    _config.maxResidentChunks = std::max<std::size_t>(1, _config.maxResidentChunks);
+
+    const unsigned int w = _config.climate.width;
+    const unsigned int h = _config.climate.height;
+    _chunksX = (w + _config.chunkSize - 1) / _config.chunkSize;
+    _chunksY = (h + _config.chunkSize - 1) / _config.chunkSize;
+
+    // Sample the world coarsely enough that the overview has a fixed cost
+    unsigned int longest = std::max(w, h);
+    unsigned int stride = std::max(1u, (longest + _config.overviewResolution - 1) /
+                                       _config.overviewResolution);
+
+    ClimateGeneratorConfig overviewConfig = _config.climate;
+    overviewConfig.width = (w + stride - 1) / stride;
+    overviewConfig.height = (h + stride - 1) / stride;
+
+    GenerationRegion region;
+    region.worldWidth = w;
+    region.worldHeight = h;
+    region.stride = stride;
+
+    _overview = std::make_unique<ClimateWorldGenerator>(overviewConfig);
+    WorldGrid overviewGrid;
+    _overview->generateRegion(overviewGrid, region);
+    _cacheKey = chunkCacheKey(*_overview, _config.chunkSize);
+
+    if (!_config.cacheDirectory.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(_config.cacheDirectory, ec);
+    }
+}
+
+//=============================================================================
+// Access
+//=============================================================================
+
+Tile& ChunkedWorld::tile(unsigned int x, unsigned int y) {
+    Chunk& c = locate(x, y);
+    return c.tile(x - c.cx * _config.chunkSize, y - c.cy * _config.chunkSize);
+}
+
+TileClimate ChunkedWorld::climate(unsigned int x, unsigned int y) {
+    Chunk& c = locate(x, y);
+    return c.climateAt(x - c.cx * _config.chunkSize, y - c.cy * _config.chunkSize);
+}
+
+PackedTileClimate ChunkedWorld::packedClimate(unsigned int x, unsigned int y) {
+    Chunk& c = locate(x, y);
+    return c.climate[(x - c.cx * _config.chunkSize) * c.height + (y - c.cy * _config.chunkSize)];
+}
+
+ChunkedWorld::Chunk& ChunkedWorld::locate(unsigned int x, unsigned int y) {
+    unsigned int cx = x / _config.chunkSize;
+    unsigned int cy = y / _config.chunkSize;
+    if (_lastChunk && _lastChunk->cx == cx && _lastChunk->cy == cy) {
+        _lastChunk->lastUse = ++_clock;
+        return *_lastChunk;
+    }
+    return chunk(cx, cy);
+}
+
+ChunkedWorld::Chunk& ChunkedWorld::chunk(unsigned int cx, unsigned int cy) {
+    auto found = _chunks.find(key(cx, cy));
+    if (found != _chunks.end()) {
+        found->second->lastUse = ++_clock;
+        _lastChunk = found->second.get();
+        return *found->second;
+    }
+
+    std::unique_ptr<Chunk> loaded = readFromCache(cx, cy);
+    if (loaded) {
+        _cached.insert(key(cx, cy));
+        _stats.loadedFromCache++;
+    } else {
+        loaded = generateChunk(cx, cy);
+        _stats.generated++;
+    }
+    return insert(std::move(loaded));
+}
+
+void ChunkedWorld::prefetch(const std::vector<std::pair<unsigned int, unsigned int>>& chunks) {
+    std::vector<std::pair<unsigned int, unsigned int>> missing;
+    std::unordered_set<std::uint64_t> seen;
+    for (const auto& c : chunks) {
+        if (c.first >= _chunksX || c.second >= _chunksY) continue;
+        std::uint64_t k = key(c.first, c.second);
+        if (_chunks.count(k) || !seen.insert(k).second) continue;
+
+        // Cached chunks are cheap to read back, no need to fan out
+        std::unique_ptr<Chunk> cached = readFromCache(c.first, c.second);
+        if (cached) {
+            _cached.insert(k);
+            _stats.loadedFromCache++;
+            insert(std::move(cached));
+        } else {
+            missing.push_back(c);
+        }
+    }
+
+    // Chunks are independent, so they are generated on the pool and
+    // inserted afterwards in request order
+    std::vector<std::unique_ptr<Chunk>> generated(missing.size());
+    parallelFor(0, missing.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            generated[i] = generateChunk(missing[i].first, missing[i].second);
+        }
+    });
+    for (auto& c : generated) {
+        _stats.generated++;
+        insert(std::move(c));
+    }
+}
+
+bool ChunkedWorld::isResident(unsigned int cx, unsigned int cy) const {
+    return _chunks.count(key(cx, cy)) > 0;
+}
+
+std::vector<std::pair<unsigned int, unsigned int>> ChunkedWorld::residentChunks() const {
+    std::vector<std::pair<unsigned int, unsigned int>> resident;
+    resident.reserve(_chunks.size());
+    for (const auto& entry : _chunks) {
+        resident.emplace_back(entry.second->cx, entry.second->cy);
+    }
+    std::sort(resident.begin(), resident.end());
+    return resident;
+}
+
+void ChunkedWorld::plantsChanged(unsigned int x, unsigned int y, int delta) {
+    Chunk& c = locate(x, y);
+    if (delta >= 0) {
+        c.plants += static_cast<std::size_t>(delta);
+    } else {
+        c.plants -= std::min(c.plants, static_cast<std::size_t>(-delta));
+    }
+}
+
+std::size_t ChunkedWorld::memoryUsage() const {
+    std::size_t bytes = sizeof(*this) + Memory::heapBytes(_chunks) +
+                        Memory::heapBytes(_cached) + Memory::heapBytes(_edits);
+    if (_overview) bytes += _overview->memoryUsage();
+    for (const auto& entry : _chunks) {
+        const Chunk& c = *entry.second;
+        bytes += sizeof(Chunk) + Memory::heapBytes(c.tiles) + Memory::heapBytes(c.climate);
+        for (const Tile& t : c.tiles) {
+            bytes += Memory::heapBytes(t.getPlants());
+        }
+    }
+    for (const auto& entry : _edits) {
+        bytes += Memory::heapBytes(entry.second);
+    }
+    return bytes;
+}
+
+//=============================================================================
+// Generation
+//=============================================================================
+
+std::unique_ptr<ChunkedWorld::Chunk> ChunkedWorld::generateChunk(unsigned int cx,
+                                                                 unsigned int cy) const {
+    const unsigned int worldW = _config.climate.width;
+    const unsigned int worldH = _config.climate.height;
+    const unsigned int x0 = cx * _config.chunkSize;
+    const unsigned int y0 = cy * _config.chunkSize;
+
+    auto c = std::make_unique<Chunk>();
+    c->cx = cx;
+    c->cy = cy;
+    c->width = std::min(_config.chunkSize, worldW - x0);
+    c->height = std::min(_config.chunkSize, worldH - y0);
+
+    // Pad the chunk so water near its edges is found exactly, and on the
+    // upwind (west) side far enough for the full rain shadow window
+    unsigned int apron = _config.waterApron;
+    unsigned int shadow = _config.climate.rainShadowDistance > 1
+        ? static_cast<unsigned int>(_config.climate.rainShadowDistance - 1) : 0u;
+    unsigned int left = std::min(x0, std::max(apron, shadow));
+    unsigned int top = std::min(y0, apron);
+    unsigned int right = std::min(worldW - x0 - c->width, apron);
+    unsigned int bottom = std::min(worldH - y0 - c->height, apron);
+
+    ClimateGeneratorConfig regionConfig = _config.climate;
+    regionConfig.width = left + c->width + right;
+    regionConfig.height = top + c->height + bottom;
+    regionConfig.parallel = false;   // Chunks themselves are the unit of parallelism
+
+    GenerationRegion region;
+    region.worldWidth = worldW;
+    region.worldHeight = worldH;
+    region.originX = x0 - left;
+    region.originY = y0 - top;
+    region.apron = apron;
+
+    ClimateWorldGenerator generator(regionConfig);
+    WorldGrid grid;
+    generator.generateRegion(grid, region, _overview.get());
+
+    c->tiles.reserve(static_cast<std::size_t>(c->width) * c->height);
+    c->climate.reserve(c->tiles.capacity());
+    for (unsigned int lx = 0; lx < c->width; ++lx) {
+        for (unsigned int ly = 0; ly < c->height; ++ly) {
+            c->tiles.push_back(grid(left + lx, top + ly));
+            c->climate.push_back(generator.getClimateMap().packed(left + lx, top + ly));
+        }
+    }
+    return c;
+}
+
+//=============================================================================
+// Residency
+//=============================================================================
+
+ChunkedWorld::Chunk& ChunkedWorld::insert(std::unique_ptr<Chunk> chunk) {
+    // Put back the tiles that were edited before the chunk was evicted
+    auto edits = _edits.find(key(chunk->cx, chunk->cy));
+    if (edits != _edits.end()) {
+        for (const auto& edit : edits->second) {
+            chunk->tiles[edit.first] = edit.second;
+        }
+        _edits.erase(edits);
+    }
+
+    chunk->lastUse = ++_clock;
+    Chunk* raw = chunk.get();
+    _chunks[key(raw->cx, raw->cy)] = std::move(chunk);
+    _lastChunk = raw;
+
+    if (_chunks.size() > _config.maxResidentChunks) {
+        evictLeastRecentlyUsed();
+    }
+    return *raw;
+}
+
+void ChunkedWorld::evictLeastRecentlyUsed() {
+    while (_chunks.size() > _config.maxResidentChunks) {
+        std::uint64_t victim = 0;
+        std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+        for (const auto& entry : _chunks) {
+            const Chunk& c = *entry.second;
+            if (&c == _lastChunk || c.lastUse >= oldest || c.plants > 0) continue;
+            oldest = c.lastUse;
+            victim = entry.first;
+        }
+        // Everything left is in use or holds plants
+        if (oldest == std::numeric_limits<std::uint64_t>::max()) return;
+        evict(victim);
+    }
+}
+
+std::size_t ChunkedWorld::evictDistantChunks(const std::vector<std::pair<int, int>>& positions,
+                                             unsigned int radius) {
+    std::unordered_set<std::uint64_t> keep;
+    std::unordered_set<std::uint64_t> centres;
+    for (const auto& p : positions) {
+        if (p.first < 0 || p.second < 0 ||
+            static_cast<unsigned int>(p.first) >= width() ||
+            static_cast<unsigned int>(p.second) >= height()) {
+            continue;
+        }
+        unsigned int pcx = static_cast<unsigned int>(p.first) / _config.chunkSize;
+        unsigned int pcy = static_cast<unsigned int>(p.second) / _config.chunkSize;
+        if (!centres.insert(key(pcx, pcy)).second) continue;
+
+        unsigned int lastX = std::min(_chunksX - 1, pcx + radius);
+        unsigned int lastY = std::min(_chunksY - 1, pcy + radius);
+        for (unsigned int cx = pcx - std::min(pcx, radius); cx <= lastX; ++cx) {
+            for (unsigned int cy = pcy - std::min(pcy, radius); cy <= lastY; ++cy) {
+                keep.insert(key(cx, cy));
+            }
+        }
+    }
+
+    std::vector<std::uint64_t> victims;
+    for (const auto& entry : _chunks) {
+        if (!keep.count(entry.first) && entry.second->plants == 0) {
+            victims.push_back(entry.first);
+        }
+    }
+    for (std::uint64_t k : victims) {
+        evict(k);
+    }
+    return victims.size();
+}
+
+void ChunkedWorld::evict(std::uint64_t chunkKey) {
+    auto found = _chunks.find(chunkKey);
+    if (found == _chunks.end()) return;
+
+    const Chunk& c = *found->second;
+    if (!_config.cacheDirectory.empty() && !_cached.count(chunkKey) && writeToCache(c)) {
+        _cached.insert(chunkKey);
+        _stats.spilled++;
+    }
+
+    // Loading rebuilds tiles from the climate, so keep the ones that differ
+    std::vector<std::pair<std::uint32_t, Tile>> edits;
+    for (std::size_t i = 0; i < c.tiles.size(); ++i) {
+        Tile generated = _overview->makeTile(c.climate[i].unpack());
+        if (!sameTerrain(c.tiles[i], generated)) {
+            edits.emplace_back(static_cast<std::uint32_t>(i), c.tiles[i]);
+        }
+    }
+    if (!edits.empty()) {
+        _stats.editsKept += edits.size();
+        _edits[chunkKey] = std::move(edits);
+    }
+
+    if (_lastChunk == found->second.get()) _lastChunk = nullptr;
+    _chunks.erase(found);
+    _stats.evicted++;
+}
+
+//=============================================================================
+// Disk Cache
+//=============================================================================
+
+std::string ChunkedWorld::cachePath(unsigned int cx, unsigned int cy) const {
+    char key[17];
+    std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(_cacheKey));
+    return _config.cacheDirectory + "/chunk_" + key + "_" +
+           std::to_string(_config.climate.width) + "x" + std::to_string(_config.climate.height) +
+           "_" + std::to_string(cx) + "_" + std::to_string(cy) + ".bin";
+}
+
+bool ChunkedWorld::writeToCache(const Chunk& chunk) const {
+    std::ofstream out(cachePath(chunk.cx, chunk.cy), std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.cx = chunk.cx;
+    header.cy = chunk.cy;
+    header.width = chunk.width;
+    header.height = chunk.height;
+    header.worldWidth = _config.climate.width;
+    header.worldHeight = _config.climate.height;
+    header.chunkSize = _config.chunkSize;
+    header.key = _cacheKey;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(chunk.climate.data()),
+              static_cast<std::streamsize>(chunk.climate.size() * sizeof(PackedTileClimate)));
+    return static_cast<bool>(out);
+}
+
+std::unique_ptr<ChunkedWorld::Chunk> ChunkedWorld::readFromCache(unsigned int cx,
+                                                                 unsigned int cy) const {
+    if (_config.cacheDirectory.empty()) return nullptr;
+
+    std::ifstream in(cachePath(cx, cy), std::ios::binary);
+    CacheHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) return nullptr;
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.key != _cacheKey || header.chunkSize != _config.chunkSize ||
+        header.worldWidth != _config.climate.width ||
+        header.worldHeight != _config.climate.height ||
+        header.cx != cx || header.cy != cy ||
+        header.width > _config.chunkSize || header.height > _config.chunkSize) {
+        return nullptr;
+    }
+
+    auto c = std::make_unique<Chunk>();
+    c->cx = cx;
+    c->cy = cy;
+    c->width = header.width;
+    c->height = header.height;
+    c->climate.resize(static_cast<std::size_t>(c->width) * c->height);
+    if (!in.read(reinterpret_cast<char*>(c->climate.data()),
+                 static_cast<std::streamsize>(c->climate.size() * sizeof(PackedTileClimate)))) {
+        return nullptr;
+    }
+
+    // Tiles are a function of the climate, so only the climate is stored
+    c->tiles.reserve(c->climate.size());
+    for (const PackedTileClimate& climate : c->climate) {
+        c->tiles.push_back(_overview->makeTile(climate.unpack()));
+    }
+    return c;
+}
+
+} // namespace EcoSim
@@ -0,0 +1,101 @@
+/**
+ * @file ClimateStore.cpp
+ * @brief Quantization of TileClimate into PackedTileClimate
+ */
+
+#include "../../include/world/ClimateStore.hpp"
+#include "../../include/world/ClimateWorldGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace EcoSim {
+
+static_assert(sizeof(PackedTileClimate) == 16, "PackedTileClimate should stay 16 bytes");
+static_assert(static_cast<int>(Biome::COUNT) <= 32, "biomes are packed into 5 bits");
+static_assert(static_cast<int>(TerrainFeature::REEF) < 16, "features are packed into 4 bits");
+static_assert(MAX_BIOME_BLEND == 4, "the packed blend holds four contributions");
+
+namespace {
+
+template<typename T>
+T quantize(float value, float scale, float lo, float hi) {
+    return static_cast<T>(std::lround(std::min(std::max(value, lo), hi) * scale));
+}
+
+} // anonymous namespace
+
+//=============================================================================
+// PackedTileClimate
+//=============================================================================
+
+PackedTileClimate PackedTileClimate::pack(const TileClimate& climate) {
+    PackedTileClimate p;
+    p.elevation = quantize<std::uint16_t>(climate.elevation, FRACTION_SCALE, 0.0f, 1.0f);
+    p.temperature = quantize<std::int16_t>(climate.temperature, TEMPERATURE_SCALE,
+                                           -32768.0f / TEMPERATURE_SCALE,
+                                           32767.0f / TEMPERATURE_SCALE);
+    p.moisture = quantize<std::uint16_t>(climate.moisture, FRACTION_SCALE, 0.0f, 1.0f);
+    p.waterLevel = quantize<std::uint16_t>(climate.waterLevel, FRACTION_SCALE, 0.0f, 1.0f);
+
+    const BiomeBlend& blend = climate.biomeBlend;
+    int count = std::min(std::max(blend.count, 1), MAX_BIOME_BLEND);
+    for (int i = 0; i < count; ++i) {
+        p.classes |= (static_cast<std::uint32_t>(blend.contributions[i].biome) & 0x1Fu) << (5 * i);
+        p.weights[i] = quantize<std::uint8_t>(blend.contributions[i].weight, WEIGHT_SCALE, 0.0f, 1.0f);
+    }
+    p.classes |= static_cast<std::uint32_t>(count) << 20;
+    p.classes |= (static_cast<std::uint32_t>(climate.feature) & 0xFu) << 23;
+    return p;
+}
+
+TileClimate PackedTileClimate::unpack() const {
+    TileClimate climate;
+    climate.elevation = getElevation();
+    climate.temperature = getTemperature();
+    climate.moisture = getMoisture();
+    climate.waterLevel = getWaterLevel();
+    climate.feature = feature();
+
+    // Unused contributions are left default so equal tiles compare equal
+    BiomeBlend& blend = climate.biomeBlend;
+    blend.count = blendCount();
+    for (int i = 0; i < MAX_BIOME_BLEND; ++i) {
+        blend.contributions[i] = BiomeWeight{};
+    }
+    for (int i = 0; i < blend.count; ++i) {
+        blend.contributions[i].biome = static_cast<Biome>((classes >> (5 * i)) & 0x1Fu);
+        blend.contributions[i].weight = weights[i] / WEIGHT_SCALE;
+    }
+    return climate;
+}
+
+//=============================================================================
+// ClimateStore
+//=============================================================================
+
+ClimateStore::ClimateStore(unsigned int width, unsigned int height)
+    : _width(width), _height(height),
+      _tiles(static_cast<std::size_t>(width) * height, PackedTileClimate::pack(TileClimate{})) {
+}
+
+ClimateStore::ClimateStore(const std::vector<std::vector<TileClimate>>& map)
+    : _width(static_cast<unsigned int>(map.size())),
+      _height(map.empty() ? 0u : static_cast<unsigned int>(map[0].size())) {
+    _tiles.reserve(static_cast<std::size_t>(_width) * _height);
+    for (const auto& column : map) {
+        for (const TileClimate& climate : column) {
+            _tiles.push_back(PackedTileClimate::pack(climate));
+        }
+    }
+}
+
+TileClimate ClimateStore::get(unsigned int x, unsigned int y) const {
+    return packed(x, y).unpack();
+}
+
+void ClimateStore::set(unsigned int x, unsigned int y, const TileClimate& climate) {
+    _tiles[static_cast<std::size_t>(x) * _height + y] = PackedTileClimate::pack(climate);
+}
+
+} // namespace EcoSim
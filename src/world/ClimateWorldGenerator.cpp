@@ -5,13 +5,151 @@
 
 #include "../../include/world/ClimateWorldGenerator.hpp"
 #include "../../include/colorPairs.hpp"
+#include "../../include/parallel.hpp"
+#include "../../include/logging/Profiler.hpp"
+#include "../../include/memoryUsage.hpp"
 
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <limits>
+#include <type_traits>
 
 namespace EcoSim {
 
+//=============================================================================
+// Parallel Tile Passes
+//=============================================================================
+
+namespace {
+
+// Columns or rows claimed by one pool task
+constexpr std::size_t COLUMN_GRAIN = 8;
+constexpr std::size_t ROW_GRAIN = 16;
+
+// Samples either side of the rasterized nearest one checked exactly
+constexpr int RIDGE_SEARCH_RADIUS = 3;
+
+/**
+ * @brief Run fn(first, last) over ranges of [0, count) on the pool
+ *
+ * Falls back to a single serial call when the config disables threading.
+ */
+template<typename Fn>
+void forRanges(const ClimateGeneratorConfig& config, std::size_t count,
+               std::size_t grain, Fn&& fn) {
+    if (config.parallel) {
+        parallelFor(0, count, grain, fn);
+    } else {
+        fn(0, count);
+    }
+}
+
+/**
+ * @brief Run fn(x, y) for every tile, handing column ranges to the pool
+ *
+ * Generation maps are stored [x][y], so each task writes only to the column
+ * vectors it owns. A pass may read any map filled by an earlier pass but
+ * only writes its own tile, which keeps the output identical to a serial
+ * run for any thread count.
+ */
+template<typename Fn>
+void forEachTile(const ClimateGeneratorConfig& config, Fn&& fn) {
+    forRanges(config, config.width, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+        for (std::size_t x = first; x < last; ++x) {
+            for (unsigned int y = 0; y < config.height; ++y) {
+                fn(static_cast<unsigned int>(x), y);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Batched SimplexNoise::noise at count points
+ *
+ * coords(k, x, y) writes the coordinates of point k. Callers build them with
+ * the same float expressions as the per-tile code, so out[k] is identical to
+ * SimplexNoise::noise(x, y) while the batch runs on the SIMD kernels.
+ */
+template<typename Coords>
+void sampleNoise(std::size_t count, Coords&& coords, std::vector<float>& out) {
+    thread_local std::vector<float> xs;
+    thread_local std::vector<float> ys;
+    xs.resize(count);
+    ys.resize(count);
+    out.resize(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        coords(k, xs[k], ys[k]);
+    }
+    SimplexNoise::noiseBatch(xs.data(), ys.data(), count, out.data());
+}
+
+/**
+ * @brief Lower envelope of the parabolas f[q] + scale * (p - q)^2
+ *
+ * One dimension of the Felzenszwalb-Huttenlocher distance transform. Only
+ * entries with id[q] >= 0 take part; for every p, nearest[p] and dist[p]
+ * receive the id and value of the lowest parabola (-1 and infinity when
+ * there are none). Runs in O(n).
+ */
+class Envelope {
+public:
+    void transform(const std::vector<double>& f, const std::vector<int>& id, double scale,
+                   std::vector<double>& dist, std::vector<int>& nearest) {
+        const std::size_t n = f.size();
+        const double inf = std::numeric_limits<double>::infinity();
+        _v.resize(n);
+        _z.resize(n + 1);
+        
+        // Number of parabolas in the envelope so far
+        std::size_t count = 0;
+        for (std::size_t q = 0; q < n; ++q) {
+            if (id[q] < 0) continue;
+            const double qd = static_cast<double>(q);
+            const double fq = f[q] + scale * qd * qd;
+            double s = -inf;
+            while (count > 0) {
+                const double vd = static_cast<double>(_v[count - 1]);
+                s = (fq - (f[_v[count - 1]] + scale * vd * vd)) / (2.0 * scale * (qd - vd));
+                if (s > _z[count - 1]) break;
+                --count;
+            }
+            _v[count] = q;
+            _z[count] = count == 0 ? -inf : s;
+            _z[count + 1] = inf;
+            ++count;
+        }
+        
+        dist.resize(n);
+        nearest.resize(n);
+        if (count == 0) {
+            std::fill(dist.begin(), dist.end(), inf);
+            std::fill(nearest.begin(), nearest.end(), -1);
+            return;
+        }
+        
+        std::size_t k = 0;
+        for (std::size_t p = 0; p < n; ++p) {
+            const double pd = static_cast<double>(p);
+            while (_z[k + 1] < pd) ++k;
+            const double offset = pd - static_cast<double>(_v[k]);
+            dist[p] = scale * offset * offset + f[_v[k]];
+            nearest[p] = id[_v[k]];
+        }
+    }
+    
+private:
+    std::vector<std::size_t> _v;  // Parabola vertices in the envelope
+    std::vector<double> _z;       // Boundaries between consecutive parabolas
+};
+
+} // anonymous namespace
+
 //=============================================================================
 // Static Biome Properties
 //=============================================================================
@@ -250,33 +388,79 @@ void ClimateWorldGenerator::generate(WorldGrid& grid) {
 
 void ClimateWorldGenerator::generate(WorldGrid& grid, unsigned int seed) {
     _config.seed = seed;
-    _rng.seed(seed);
+    
+    GenerationRegion whole;
+    whole.worldWidth = _config.width;
+    whole.worldHeight = _config.height;
+    generateRegion(grid, whole);
+}
+
+void ClimateWorldGenerator::generateRegion(WorldGrid& grid, const GenerationRegion& region,
+                                           const ClimateWorldGenerator* overview) {
+    ECOSIM_PROFILE_ZONE("ClimateWorldGenerator::generate");
+    _region = region;
+    _region.stride = std::max(1u, region.stride);
+    _rng.seed(_config.seed);
+    _riverCells.clear();
+    _lakeCells.clear();
     
     // Resize grid if needed
     grid.resize(_config.width, _config.height);
     
-    // Run generation pipeline
-    initializeMaps();
-    generatePlateRidges();          // Generate tectonic plate boundaries first
-    calculateRidgeDistanceMap();    // Precompute distance to ridges
-    generateContinentMap();
-    generateElevationMap();
+    // Run generation pipeline. Per-tile stages run in parallel over
+    // columns; the plate ridges (RNG), flood fills, water distance BFS and
+    // river tracing depend on visit order and stay serial. Against an
+    // overview, the globally coupled steps read its results instead.
+    _stageTimings.clear();
+    auto stage = [this](const char* name, auto&& run) {
+        ECOSIM_PROFILE_ZONE(name);
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        _stageTimings.push_back({name, elapsed.count()});
+    };
+    
+    stage("initialize", [&] { initializeMaps(); });
+    stage("plate_ridges", [&] {
+        generatePlateRidges();          // Generate tectonic plate boundaries first
+        calculateRidgeDistanceMap();    // Precompute distance to ridges
+    });
+    stage("continents", [&] { generateContinentMap(); });
+    stage("elevation", [&] { generateElevationMap(); });
     
     // Remove unrealistic inland seas before climate simulation
     if (_config.removeInlandSeas) {
-        removeInlandSeas();
+        stage("inland_seas", [&] {
+            if (overview) {
+                fillInlandSeasFrom(*overview);
+            } else {
+                removeInlandSeas();
+            }
+        });
     }
     
-    calculateTemperature();
-    calculateWaterDistance();
-    calculateMoisture();
-    determineBiomes();
+    stage("temperature", [&] { calculateTemperature(); });
+    stage("water_distance", [&] { calculateWaterDistance(overview); });
+    stage("rain_shadow", [&] { calculateRainShadow(); });
+    stage("moisture", [&] { calculateMoisture(); });
+    stage("biomes", [&] { determineBiomes(); });
     
     if (_config.generateRivers) {
-        generateRivers();
+        stage("rivers", [&] {
+            if (overview) {
+                applyWaterFrom(*overview);
+            } else {
+                generateRivers();
+            }
+        });
     }
     
-    applyToGrid(grid);
+    stage("apply", [&] {
+        _climate = ClimateStore(_climateMap);
+        std::vector<std::vector<TileClimate>>().swap(_climateMap);
+        applyToGrid(grid);
+    });
 }
 
 void ClimateWorldGenerator::initializeMaps() {
@@ -287,6 +471,7 @@ void ClimateWorldGenerator::initializeMaps() {
     _elevationMap.assign(w, std::vector<float>(h, 0.0f));
     _temperatureMap.assign(w, std::vector<float>(h, 0.0f));
     _moistureMap.assign(w, std::vector<float>(h, 0.0f));
+    _rainShadowMap.assign(w, std::vector<float>(h, 1.0f));
     _waterDistanceMap.assign(w, std::vector<float>(h, 0.0f));
     _climateMap.assign(w, std::vector<TileClimate>(h));
 }
@@ -296,78 +481,100 @@ void ClimateWorldGenerator::initializeMaps() {
 //=============================================================================
 
 void ClimateWorldGenerator::generateContinentMap() {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            float noise = continentNoise(x, y);
+    // Noise is sampled a column at a time so it can be batched
+    forRanges(_config, _config.width, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned int> rows(_config.height);
+        for (unsigned int y = 0; y < _config.height; ++y) rows[y] = y;
+        std::vector<float> continent;
+        std::vector<float> coastline;
+        
+        for (std::size_t col = first; col < last; ++col) {
+            unsigned int x = static_cast<unsigned int>(col);
+            continentNoise(x, rows, continent);
+            coastlineDetailNoise(x, rows, coastline);
             
-            // Apply island mode falloff
-            if (_config.isIsland) {
-                float edgeDist = distanceToEdge(x, y);
-                // Center boost ramps up with edgeDist (0 at boundary, full
-                // inside islandFalloff). Edge sink does the inverse: full
-                // at the boundary, fading to 0 by half-falloff. Prior
-                // versions had edgeSink polarity inverted, which left the
-                // outer band with no sink and produced land in the corners.
-                float centerBoost = smoothstep(0.0f, _config.islandFalloff, edgeDist);
-                float edgeSink    = 1.0f - smoothstep(0.0f, _config.islandFalloff * 0.5f, edgeDist);
-
-                // Center has noise boosted, edges sink below sea level
-                noise = noise * 0.7f + centerBoost * 0.5f - edgeSink * 0.3f;
+            for (unsigned int y = 0; y < _config.height; ++y) {
+                float noise = continent[y];
+                
+                // Apply island mode falloff
+                if (_config.isIsland) {
+                    float edgeDist = distanceToEdge(x, y);
+                    // Center boost ramps up with edgeDist (0 at boundary, full
+                    // inside islandFalloff). Edge sink does the inverse: full
+                    // at the boundary, fading to 0 by half-falloff. Prior
+                    // versions had edgeSink polarity inverted, which left the
+                    // outer band with no sink and produced land in the corners.
+                    float centerBoost = smoothstep(0.0f, _config.islandFalloff, edgeDist);
+                    float edgeSink    = 1.0f - smoothstep(0.0f, _config.islandFalloff * 0.5f, edgeDist);
+                    
+                    // Center has noise boosted, edges sink below sea level
+                    noise = noise * 0.7f + centerBoost * 0.5f - edgeSink * 0.3f;
+                }
+                
+                // Add fractal coastline detail
+                // This creates bays, peninsulas, and jagged edges
+                float coastlineNoise = coastline[y];
+                
+                // Apply coastline detail more strongly near the land/sea boundary
+                float distFromSeaLevel = std::abs(noise - _config.seaLevel);
+                float coastlineInfluence = 1.0f - clampValue(distFromSeaLevel * 5.0f, 0.0f, 1.0f);
+                
+                // Perturb the elevation near coastlines
+                noise += coastlineNoise * 0.15f * coastlineInfluence;
+                
+                _continentMap[x][y] = clampValue(noise, 0.0f, 1.0f);
             }
-            
-            // Add fractal coastline detail
-            // This creates bays, peninsulas, and jagged edges
-            float coastlineNoise = coastlineDetailNoise(x, y);
-            
-            // Apply coastline detail more strongly near the land/sea boundary
-            float distFromSeaLevel = std::abs(noise - _config.seaLevel);
-            float coastlineInfluence = 1.0f - clampValue(distFromSeaLevel * 5.0f, 0.0f, 1.0f);
-            
-            // Perturb the elevation near coastlines
-            noise += coastlineNoise * 0.15f * coastlineInfluence;
-            
-            _continentMap[x][y] = clampValue(noise, 0.0f, 1.0f);
         }
-    }
+    });
 }
 
-float ClimateWorldGenerator::continentNoise(int x, int y) const {
+void ClimateWorldGenerator::continentNoise(unsigned int x, const std::vector<unsigned int>& rows,
+                                           std::vector<float>& out) const {
+    const std::size_t count = rows.size();
     float freq = _config.continentFrequency;
     float seed = static_cast<float>(_config.seed);
+    const float fx = worldX(x);
+    auto octave = [&](std::size_t k, float& sx, float& sy) {
+        sx = fx * freq + seed;
+        sy = worldY(rows[k]) * freq + seed;
+    };
     
     // Base continent noise
-    float noise = SimplexNoise::noise(
-        x * freq + seed,
-        y * freq + seed
-    );
+    sampleNoise(count, octave, out);
     
     // Add octaves for coastline detail
     float amplitude = 0.5f;
     float totalAmp = 1.0f;
+    std::vector<float> noise;
     
     for (int i = 1; i < _config.continentOctaves; ++i) {
         freq *= 2.0f;
-        noise += amplitude * SimplexNoise::noise(
-            x * freq + seed,
-            y * freq + seed
-        );
+        sampleNoise(count, octave, noise);
+        for (std::size_t k = 0; k < count; ++k) {
+            out[k] += amplitude * noise[k];
+        }
         totalAmp += amplitude;
         amplitude *= 0.5f;
     }
     
     // Normalize to 0-1 range
-    noise = (noise / totalAmp + 1.0f) * 0.5f;
-    return noise;
+    for (std::size_t k = 0; k < count; ++k) {
+        out[k] = (out[k] / totalAmp + 1.0f) * 0.5f;
+    }
 }
 
-float ClimateWorldGenerator::coastlineDetailNoise(int x, int y) const {
+void ClimateWorldGenerator::coastlineDetailNoise(unsigned int x, const std::vector<unsigned int>& rows,
+                                                 std::vector<float>& out) const {
     // High-frequency fractal noise for coastline detail
     // Creates bays, peninsulas, capes, and irregular shorelines
     
+    const std::size_t count = rows.size();
+    const float fx = worldX(x);
     float seed = static_cast<float>(_config.seed) * 5.0f;
-    float noise = 0.0f;
     float amplitude = 1.0f;
     float totalAmp = 0.0f;
+    out.assign(count, 0.0f);
+    std::vector<float> noise;
     
     // Use higher frequencies than continent noise for fine coastal detail
     float freq = _config.continentFrequency * 8.0f;
@@ -375,29 +582,44 @@ float ClimateWorldGenerator::coastlineDetailNoise(int x, int y) const {
     // Multiple octaves of noise for multi-scale coastline features
     // Large bays/peninsulas + medium irregularities + fine jagged edges
     for (int octave = 0; octave < 4; ++octave) {
-        noise += amplitude * SimplexNoise::noise(
-            x * freq + seed,
-            y * freq + seed + octave * 100.0f
-        );
+        sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+            sx = fx * freq + seed;
+            sy = worldY(rows[k]) * freq + seed + octave * 100.0f;
+        }, noise);
+        for (std::size_t k = 0; k < count; ++k) {
+            out[k] += amplitude * noise[k];
+        }
         totalAmp += amplitude;
         freq *= 2.2f;        // Slightly more than 2 for irregular patterns
         amplitude *= 0.45f;  // Slower falloff keeps high-freq detail visible
     }
     
     // Normalize to roughly -1 to 1
-    noise = noise / totalAmp;
+    for (std::size_t k = 0; k < count; ++k) {
+        out[k] = out[k] / totalAmp;
+    }
     
     // Add some warping for more organic coastlines
-    float warpX = SimplexNoise::noise(x * 0.008f + seed * 2.0f, y * 0.008f) * 8.0f;
-    float warpY = SimplexNoise::noise(x * 0.008f, y * 0.008f + seed * 2.0f) * 8.0f;
-    
-    float warpedNoise = SimplexNoise::noise(
-        (x + warpX) * _config.continentFrequency * 6.0f + seed,
-        (y + warpY) * _config.continentFrequency * 6.0f + seed
-    );
+    std::vector<float> warpX;
+    std::vector<float> warpY;
+    sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+        sx = fx * 0.008f + seed * 2.0f;
+        sy = worldY(rows[k]) * 0.008f;
+    }, warpX);
+    sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+        sx = fx * 0.008f;
+        sy = worldY(rows[k]) * 0.008f + seed * 2.0f;
+    }, warpY);
+    
+    sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+        sx = (fx + warpX[k] * 8.0f) * _config.continentFrequency * 6.0f + seed;
+        sy = (worldY(rows[k]) + warpY[k] * 8.0f) * _config.continentFrequency * 6.0f + seed;
+    }, noise);
     
     // Combine regular and warped noise
-    return noise * 0.7f + warpedNoise * 0.3f;
+    for (std::size_t k = 0; k < count; ++k) {
+        out[k] = out[k] * 0.7f + noise[k] * 0.3f;
+    }
 }
 
 //=============================================================================
@@ -455,54 +677,137 @@ void ClimateWorldGenerator::generatePlateRidges() {
 }
 
 void ClimateWorldGenerator::calculateRidgeDistanceMap() {
-    _ridgeDistanceMap.assign(_config.width, std::vector<float>(_config.height,
+    const unsigned int w = _config.width;
+    const unsigned int h = _config.height;
+    const unsigned int worldW = _region.worldWidth;
+    const unsigned int worldH = _region.worldHeight;
+    const float stride = static_cast<float>(_region.stride);
+    _ridgeDistanceMap.assign(w, std::vector<float>(h,
         std::numeric_limits<float>::max()));
-    
-    // For each tile, find minimum distance to any ridge
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            float px = static_cast<float>(x) / _config.width;
-            float py = static_cast<float>(y) / _config.height;
-            
+    if (w == 0 || h == 0) return;
+    
+    // A region that does not span the world may lie far from every sample,
+    // so each of its tiles measures all samples directly instead
+    const bool spansWorld = _region.originX == 0 && _region.originY == 0 &&
+                            w * _region.stride >= worldW && h * _region.stride >= worldH;
+    if (!spansWorld) {
+        forEachTile(_config, [&](unsigned int x, unsigned int y) {
+            float px = worldX(x) / worldW;
+            float py = worldY(y) / worldH;
             float minDist = std::numeric_limits<float>::max();
-            
             for (const auto& ridge : _plateRidges) {
-                float dist = distanceToRidge(px, py, ridge);
-                // Weight by ridge strength
-                dist = dist / ridge.strength;
-                minDist = std::min(minDist, dist);
+                float ridgeDist = std::numeric_limits<float>::max();
+                for (int i = 0; i <= RIDGE_SAMPLES; ++i) {
+                    float t = static_cast<float>(i) / RIDGE_SAMPLES;
+                    float dx = px - bezierPoint(t, ridge.startX, ridge.controlX, ridge.endX);
+                    float dy = py - bezierPoint(t, ridge.startY, ridge.controlY, ridge.endY);
+                    ridgeDist = std::min(ridgeDist, std::sqrt(dx * dx + dy * dy));
+                }
+                minDist = std::min(minDist, ridgeDist / ridge.strength);
             }
+            _ridgeDistanceMap[x][y] = minDist * std::max(worldW, worldH);
+        });
+        return;
+    }
+    
+    // Each ridge is measured by its RIDGE_SAMPLES + 1 sample points. Rather
+    // than testing every sample from every tile, the samples are rasterized
+    // and a two-pass exact distance transform finds the nearest one to each
+    // tile. Distances are in normalized coordinates, (dx / W)^2 + (dy / H)^2
+    // for a world W x H, scaled by (W * H)^2 so both axes stay integral.
+    const double scaleX = static_cast<double>(worldH) * worldH;
+    const double scaleY = static_cast<double>(worldW) * worldW;
+    const std::size_t tiles = static_cast<std::size_t>(w) * h;
+    
+    std::vector<int> nearest(tiles);        // Sample index, [x * h + y]
+    std::vector<double> columnDist(tiles);
+    std::vector<float> sampleX(RIDGE_SAMPLES + 1);
+    std::vector<float> sampleY(RIDGE_SAMPLES + 1);
+    
+    for (const auto& ridge : _plateRidges) {
+        std::fill(nearest.begin(), nearest.end(), -1);
+        for (int i = 0; i <= RIDGE_SAMPLES; ++i) {
+            float t = static_cast<float>(i) / RIDGE_SAMPLES;
             
-            // Convert back to pixel units for easier threshold comparison
-            _ridgeDistanceMap[x][y] = minDist * std::max(_config.width, _config.height);
+            // Quadratic Bezier: B(t) = (1-t)²P0 + 2(1-t)tP1 + t²P2
+            float bx = bezierPoint(t, ridge.startX, ridge.controlX, ridge.endX);
+            float by = bezierPoint(t, ridge.startY, ridge.controlY, ridge.endY);
+            sampleX[i] = bx;
+            sampleY[i] = by;
+            
+            long sx = clampValue(std::lround(bx * worldW / stride), 0L, static_cast<long>(w) - 1);
+            long sy = clampValue(std::lround(by * worldH / stride), 0L, static_cast<long>(h) - 1);
+            int& seed = nearest[static_cast<std::size_t>(sx) * h + static_cast<std::size_t>(sy)];
+            if (seed < 0) seed = i;
         }
-    }
-}
-
-float ClimateWorldGenerator::distanceToRidge(float px, float py, const PlateRidge& ridge) const {
-    // Find closest point on quadratic Bezier curve
-    // Sample the curve at multiple points and find minimum distance
-    float minDist = std::numeric_limits<float>::max();
-    
-    const int samples = 50;
-    for (int i = 0; i <= samples; ++i) {
-        float t = static_cast<float>(i) / samples;
         
-        // Quadratic Bezier: B(t) = (1-t)²P0 + 2(1-t)tP1 + t²P2
-        float bx = bezierPoint(t, ridge.startX, ridge.controlX, ridge.endX);
-        float by = bezierPoint(t, ridge.startY, ridge.controlY, ridge.endY);
+        // Pass 1: nearest sample within each column
+        forRanges(_config, w, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+            Envelope envelope;
+            std::vector<double> f(h, 0.0);
+            std::vector<double> dist;
+            std::vector<int> ids(h);
+            std::vector<int> found;
+            for (std::size_t x = first; x < last; ++x) {
+                std::copy_n(&nearest[x * h], h, ids.begin());
+                envelope.transform(f, ids, scaleY, dist, found);
+                std::copy_n(dist.begin(), h, &columnDist[x * h]);
+                std::copy_n(found.begin(), h, &nearest[x * h]);
+            }
+        });
         
-        float dx = px - bx;
-        float dy = py - by;
-        float dist = std::sqrt(dx * dx + dy * dy);
+        // Pass 2: nearest column result along each row. Rows only read and
+        // write their own entries, so they can be updated in place.
+        forRanges(_config, h, ROW_GRAIN, [&](std::size_t first, std::size_t last) {
+            Envelope envelope;
+            std::vector<double> f(w);
+            std::vector<double> dist;
+            std::vector<int> ids(w);
+            std::vector<int> found;
+            for (std::size_t y = first; y < last; ++y) {
+                for (std::size_t x = 0; x < w; ++x) {
+                    f[x] = columnDist[x * h + y];
+                    ids[x] = nearest[x * h + y];
+                }
+                envelope.transform(f, ids, scaleX, dist, found);
+                for (std::size_t x = 0; x < w; ++x) {
+                    nearest[x * h + y] = found[x];
+                }
+            }
+        });
         
-        minDist = std::min(minDist, dist);
+        // Rasterizing moves samples by up to half a tile, so the transform
+        // can pick a neighbour of the truly nearest sample along the curve.
+        // Measuring the exact distance to it and its neighbours recovers the
+        // brute-force result.
+        forEachTile(_config, [&](unsigned int x, unsigned int y) {
+            int sample = nearest[static_cast<std::size_t>(x) * h + y];
+            if (sample < 0) return;
+            
+            float px = worldX(x) / worldW;
+            float py = worldY(y) / worldH;
+            float minDist = std::numeric_limits<float>::max();
+            int lo = std::max(0, sample - RIDGE_SEARCH_RADIUS);
+            int hi = std::min(RIDGE_SAMPLES, sample + RIDGE_SEARCH_RADIUS);
+            for (int i = lo; i <= hi; ++i) {
+                float dx = px - sampleX[i];
+                float dy = py - sampleY[i];
+                minDist = std::min(minDist, std::sqrt(dx * dx + dy * dy));
+            }
+            
+            // Weight by ridge strength
+            float dist = minDist / ridge.strength;
+            _ridgeDistanceMap[x][y] = std::min(_ridgeDistanceMap[x][y], dist);
+        });
     }
     
-    return minDist;
+    // Convert back to pixel units for easier threshold comparison
+    forEachTile(_config, [&](unsigned int x, unsigned int y) {
+        _ridgeDistanceMap[x][y] = _ridgeDistanceMap[x][y] * std::max(worldW, worldH);
+    });
 }
 
-float ClimateWorldGenerator::bezierPoint(float t, float p0, float p1, float p2) const {
+float ClimateWorldGenerator::bezierPoint(float t, float p0, float p1, float p2) {
     float oneMinusT = 1.0f - t;
     return oneMinusT * oneMinusT * p0 + 2.0f * oneMinusT * t * p1 + t * t * p2;
 }
@@ -527,38 +832,47 @@ float ClimateWorldGenerator::ridgeInfluence(int x, int y) const {
     return 0.0f;
 }
 
-float ClimateWorldGenerator::ridgedMultifractal(float x, float y, int octaves,
-                                                  float lacunarity, float gain) const {
+void ClimateWorldGenerator::ridgedMultifractal(const std::vector<float>& x, const std::vector<float>& y,
+                                               int octaves, float lacunarity, float gain,
+                                               std::vector<float>& out) const {
+    const std::size_t count = x.size();
     float seed = static_cast<float>(_config.seed) * 3.0f;
     float frequency = 1.0f;
     float amplitude = 1.0f;
     float totalAmplitude = 0.0f;
-    float result = 0.0f;
+    out.assign(count, 0.0f);
+    std::vector<float> noise;
     
     // Previous octave's value for weighting (heterogeneous terrain)
-    float weight = 1.0f;
+    std::vector<float> weight(count, 1.0f);
     
     for (int i = 0; i < octaves; ++i) {
         // Sample noise and create ridge effect
-        float noise = SimplexNoise::noise(x * frequency + seed + i * 13.7f,
-                                          y * frequency + seed + i * 7.3f);
-        
-        // Ridge formula: 1 - abs(noise), squared for sharper ridges
-        float ridge = 1.0f - std::abs(noise);
-        ridge = ridge * ridge;
+        sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+            sx = x[k] * frequency + seed + i * 13.7f;
+            sy = y[k] * frequency + seed + i * 7.3f;
+        }, noise);
         
-        // Weight by previous octave for terrain variation
-        ridge *= weight;
-        weight = clampValue(ridge * 2.0f, 0.0f, 1.0f);
-        
-        result += ridge * amplitude;
+        for (std::size_t k = 0; k < count; ++k) {
+            // Ridge formula: 1 - abs(noise), squared for sharper ridges
+            float ridge = 1.0f - std::abs(noise[k]);
+            ridge = ridge * ridge;
+            
+            // Weight by previous octave for terrain variation
+            ridge *= weight[k];
+            weight[k] = clampValue(ridge * 2.0f, 0.0f, 1.0f);
+            
+            out[k] += ridge * amplitude;
+        }
         totalAmplitude += amplitude;
         
         frequency *= lacunarity;
         amplitude *= gain;
     }
     
-    return result / totalAmplitude;
+    for (std::size_t k = 0; k < count; ++k) {
+        out[k] = out[k] / totalAmplitude;
+    }
 }
 
 //=============================================================================
@@ -566,34 +880,72 @@ float ClimateWorldGenerator::ridgedMultifractal(float x, float y, int octaves,
 //=============================================================================
 
 void ClimateWorldGenerator::generateElevationMap() {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            float continent = _continentMap[x][y];
+    forRanges(_config, _config.width, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned int> land;
+        std::vector<float> ridgeX, ridgeY, ridgeNoise, clusterNoise, detail, rugged;
+        std::vector<float> elevation, mountainFactor;
+        std::vector<std::size_t> ruggedTiles;
+        
+        for (std::size_t col = first; col < last; ++col) {
+            unsigned int x = static_cast<unsigned int>(col);
+            const float fx = worldX(x);
+            
+            // Ocean floor is set directly; land tiles are gathered so their
+            // noise can be sampled in batches
+            land.clear();
+            for (unsigned int y = 0; y < _config.height; ++y) {
+                float continent = _continentMap[x][y];
+                if (continent < _config.seaLevel) {
+                    // Ocean floor - gentle variation with oceanic ridges
+                    float oceanFloor = continent * 0.3f;
+                    
+                    // Oceanic ridges (mid-ocean spreading centers)
+                    float oceanRidge = ridgeInfluence(x, y) * 0.15f;
+                    _elevationMap[x][y] = oceanFloor + oceanRidge;
+                } else {
+                    land.push_back(y);
+                }
+            }
+            
+            const std::size_t count = land.size();
+            if (count == 0) continue;
+            
+            // Multi-octave ridged noise for mountain detail
+            ridgeX.resize(count);
+            ridgeY.resize(count);
+            for (std::size_t k = 0; k < count; ++k) {
+                ridgeX[k] = fx * _config.ridgeFrequency;
+                ridgeY[k] = worldY(land[k]) * _config.ridgeFrequency;
+            }
+            ridgedMultifractal(ridgeX, ridgeY, _config.ridgeOctaves,
+                               _config.ridgeLacunarity, _config.ridgeGain, ridgeNoise);
+            
+            // Mountain clustering noise - creates distinct peaks within ranges
+            sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+                sx = fx * _config.mountainClusterFreq + _config.seed * 4.0f;
+                sy = worldY(land[k]) * _config.mountainClusterFreq + _config.seed * 4.0f;
+            }, clusterNoise);
             
-            if (continent < _config.seaLevel) {
-                // Ocean floor - gentle variation with oceanic ridges
-                float oceanFloor = continent * 0.3f;
+            // Local terrain variation (small hills and valleys)
+            sampleNoise(count, [&](std::size_t k, float& sx, float& sy) {
+                sx = fx * _config.elevationFrequency + _config.seed * 2.0f;
+                sy = worldY(land[k]) * _config.elevationFrequency + _config.seed * 2.0f;
+            }, detail);
+            
+            elevation.resize(count);
+            mountainFactor.resize(count);
+            ruggedTiles.clear();
+            for (std::size_t k = 0; k < count; ++k) {
+                unsigned int y = land[k];
+                float continent = _continentMap[x][y];
                 
-                // Oceanic ridges (mid-ocean spreading centers)
-                float oceanRidge = ridgeInfluence(x, y) * 0.15f;
-                _elevationMap[x][y] = oceanFloor + oceanRidge;
-            } else {
                 // Land elevation with detail
-                float elevation = continent;
+                float height = continent;
                 
                 // === Tectonic Mountain Ranges ===
                 // Mountains concentrate along plate boundaries
                 float tectonicInfluence = ridgeInfluence(x, y);
                 
-                // Multi-octave ridged noise for mountain detail
-                float ridgeNoise = ridgedMultifractal(
-                    x * _config.ridgeFrequency,
-                    y * _config.ridgeFrequency,
-                    _config.ridgeOctaves,
-                    _config.ridgeLacunarity,
-                    _config.ridgeGain
-                );
-                
                 // Combine tectonic influence with ridge noise
                 // Near plate boundaries: strong mountains
                 // Far from boundaries: gentler terrain
@@ -602,42 +954,40 @@ void ClimateWorldGenerator::generateElevationMap() {
                 // Scale mountain formation by how far above sea level (coastal mountains)
                 float landHeight = (continent - _config.seaLevel) / (1.0f - _config.seaLevel);
                 
-                // Mountain clustering noise - creates distinct peaks within ranges
-                float clusterNoise = SimplexNoise::noise(
-                    x * _config.mountainClusterFreq + _config.seed * 4.0f,
-                    y * _config.mountainClusterFreq + _config.seed * 4.0f
-                );
-                clusterNoise = clusterNoise * 0.5f + 0.5f;  // 0 to 1
+                float cluster = clusterNoise[k] * 0.5f + 0.5f;  // 0 to 1
                 
                 // Combine: tectonic position + ridge shape + clustering
-                float mountainFactor = mountainBoost * (0.5f + 0.5f * ridgeNoise) * (0.7f + 0.3f * clusterNoise);
-                elevation += mountainFactor * landHeight;
+                float factor = mountainBoost * (0.5f + 0.5f * ridgeNoise[k]) * (0.7f + 0.3f * cluster);
+                height += factor * landHeight;
                 
                 // Add random ridged noise for mountains outside tectonic zones
                 // (volcanic mountains, erosion remnants, etc.)
-                float randomRidges = ridgeNoise * 0.25f * landHeight * (1.0f - tectonicInfluence * 0.7f);
-                elevation += randomRidges;
-                
-                // Local terrain variation (small hills and valleys)
-                float detail = SimplexNoise::noise(
-                    x * _config.elevationFrequency + _config.seed * 2.0f,
-                    y * _config.elevationFrequency + _config.seed * 2.0f
-                );
-                elevation += detail * 0.08f;
+                float randomRidges = ridgeNoise[k] * 0.25f * landHeight * (1.0f - tectonicInfluence * 0.7f);
+                height += randomRidges;
                 
-                // Higher-frequency detail for rugged terrain near mountains
-                if (mountainFactor > 0.1f) {
-                    float rugged = SimplexNoise::noise(
-                        x * _config.elevationFrequency * 3.0f + _config.seed * 5.0f,
-                        y * _config.elevationFrequency * 3.0f + _config.seed * 5.0f
-                    );
-                    elevation += rugged * 0.05f * mountainFactor;
-                }
+                height += detail[k] * 0.08f;
                 
-                _elevationMap[x][y] = clampValue(elevation, 0.0f, 1.0f);
+                elevation[k] = height;
+                mountainFactor[k] = factor;
+                if (factor > 0.1f) ruggedTiles.push_back(k);
+            }
+            
+            // Higher-frequency detail for rugged terrain near mountains
+            sampleNoise(ruggedTiles.size(), [&](std::size_t r, float& sx, float& sy) {
+                float fy = worldY(land[ruggedTiles[r]]);
+                sx = fx * _config.elevationFrequency * 3.0f + _config.seed * 5.0f;
+                sy = fy * _config.elevationFrequency * 3.0f + _config.seed * 5.0f;
+            }, rugged);
+            for (std::size_t r = 0; r < ruggedTiles.size(); ++r) {
+                std::size_t k = ruggedTiles[r];
+                elevation[k] += rugged[r] * 0.05f * mountainFactor[k];
+            }
+            
+            for (std::size_t k = 0; k < count; ++k) {
+                _elevationMap[x][land[k]] = clampValue(elevation[k], 0.0f, 1.0f);
             }
         }
-    }
+    });
 }
 
 //=============================================================================
@@ -699,30 +1049,34 @@ void ClimateWorldGenerator::removeInlandSeas() {
     
     // Step 3: Fill in inland seas that are too small to be realistic
     // Large ones become lakes, small ones become land
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            int comp = componentMap[x][y];
-            if (comp >= 0) {
-                int size = componentSizes[comp];
+    forEachTile(_config, [&](unsigned int x, unsigned int y) {
+        int comp = componentMap[x][y];
+        if (comp >= 0) {
+            int size = componentSizes[comp];
+            
+            // Each map tile stands for stride x stride world tiles
+            long area = static_cast<long>(size) * _region.stride * _region.stride;
+            if (area < _config.minInlandSeaSize) {
+                // Small inland sea - fill with land
+                float fill = inlandSeaFillElevation(x, y);
+                _elevationMap[x][y] = fill;
                 
-                if (size < _config.minInlandSeaSize) {
-                    // Small inland sea - fill with land
-                    // Use noise to create natural-looking fill elevation
-                    float baseElev = _config.inlandSeaFillElevation;
-                    float noise = SimplexNoise::noise(
-                        x * 0.02f + _config.seed * 8.0f,
-                        y * 0.02f + _config.seed * 8.0f
-                    ) * 0.05f;
-                    
-                    _elevationMap[x][y] = baseElev + noise;
-                    
-                    // Also update continent map for consistency
-                    _continentMap[x][y] = baseElev + noise;
-                }
-                // Larger inland seas are kept as lakes (freshwater bodies)
+                // Also update continent map for consistency
+                _continentMap[x][y] = fill;
             }
+            // Larger inland seas are kept as lakes (freshwater bodies)
         }
-    }
+    });
+}
+
+float ClimateWorldGenerator::inlandSeaFillElevation(unsigned int x, unsigned int y) const {
+    // Use noise to create natural-looking fill elevation
+    float baseElev = _config.inlandSeaFillElevation;
+    float noise = SimplexNoise::noise(
+        worldX(x) * 0.02f + _config.seed * 8.0f,
+        worldY(y) * 0.02f + _config.seed * 8.0f
+    ) * 0.05f;
+    return baseElev + noise;
 }
 
 void ClimateWorldGenerator::floodFillOcean(std::vector<std::vector<bool>>& oceanMask) {
@@ -814,17 +1168,25 @@ float ClimateWorldGenerator::ridgedNoise(float x, float y) const {
 //=============================================================================
 
 void ClimateWorldGenerator::calculateTemperature() {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            _temperatureMap[x][y] = calculateTileTemperature(x, y);
+    forRanges(_config, _config.width, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+        std::vector<float> noise;
+        for (std::size_t col = first; col < last; ++col) {
+            unsigned int x = static_cast<unsigned int>(col);
+            sampleNoise(_config.height, [&](std::size_t y, float& sx, float& sy) {
+                sx = worldX(x) * _config.temperatureNoiseScale + _config.seed * 2.0f;
+                sy = worldY(static_cast<unsigned int>(y)) * _config.temperatureNoiseScale + _config.seed * 2.0f;
+            }, noise);
+            for (unsigned int y = 0; y < _config.height; ++y) {
+                _temperatureMap[x][y] = calculateTileTemperature(x, y, noise[y]);
+            }
         }
-    }
+    });
 }
 
-float ClimateWorldGenerator::calculateTileTemperature(int x, int y) const {
+float ClimateWorldGenerator::calculateTileTemperature(int x, int y, float noise) const {
     // 1. Base temperature from latitude
     // y=0 is one pole, y=height is the other
-    float latitude = static_cast<float>(y) / _config.height;
+    float latitude = worldY(static_cast<unsigned int>(y)) / _region.worldHeight;
     
     // Distance from equator (0 at equator, 1 at poles)
     float distFromEquator = std::abs(latitude - _config.equatorPosition) * 2.0f;
@@ -843,10 +1205,7 @@ float ClimateWorldGenerator::calculateTileTemperature(int x, int y) const {
     float elevationCooling = -(_config.lapseRate / 1000.0f) * elevationMeters;
     
     // 3. Local climate variation noise
-    float tempNoise = SimplexNoise::noise(
-        x * _config.temperatureNoiseScale + _config.seed * 2.0f,
-        y * _config.temperatureNoiseScale + _config.seed * 2.0f
-    ) * 5.0f;  // ±5°C variation
+    float tempNoise = noise * 5.0f;  // ±5°C variation
     
     return baseTemp + elevationCooling + tempNoise;
 }
@@ -855,9 +1214,10 @@ float ClimateWorldGenerator::calculateTileTemperature(int x, int y) const {
 // Phase 4: Water Distance Calculation
 //=============================================================================
 
-void ClimateWorldGenerator::calculateWaterDistance() {
-    // BFS from all water tiles to calculate distance
+void ClimateWorldGenerator::calculateWaterDistance(const ClimateWorldGenerator* overview) {
+    // BFS from all water tiles to calculate distance, in world tiles
     std::queue<std::pair<int, int>> frontier;
+    const float step = static_cast<float>(_region.stride);
     
     // Initialize: water tiles have distance 0, land starts at max
     for (unsigned int y = 0; y < _config.height; ++y) {
@@ -885,7 +1245,7 @@ void ClimateWorldGenerator::calculateWaterDistance() {
             if (!inBounds(nx, ny)) continue;
             
             // Distance to diagonal neighbors is sqrt(2), orthogonal is 1
-            float neighborDist = (dx != 0 && dy != 0) ? 1.414f : 1.0f;
+            float neighborDist = ((dx != 0 && dy != 0) ? 1.414f : 1.0f) * step;
             float newDist = currentDist + neighborDist;
             
             if (newDist < _waterDistanceMap[nx][ny]) {
@@ -894,6 +1254,19 @@ void ClimateWorldGenerator::calculateWaterDistance() {
             }
         }
     }
+    
+    // Water further away than the apron may lie outside the region, so
+    // those distances come from the overview. Within the apron the search
+    // above is exact for every tile the caller keeps.
+    if (overview) {
+        const float apron = static_cast<float>(_region.apron);
+        forEachTile(_config, [&](unsigned int x, unsigned int y) {
+            if (_waterDistanceMap[x][y] > apron) {
+                _waterDistanceMap[x][y] = std::max(apron,
+                    overview->overviewWaterDistance(worldX(x), worldY(y)));
+            }
+        });
+    }
 }
 
 //=============================================================================
@@ -901,14 +1274,33 @@ void ClimateWorldGenerator::calculateWaterDistance() {
 //=============================================================================
 
 void ClimateWorldGenerator::calculateMoisture() {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            _moistureMap[x][y] = calculateTileMoisture(x, y);
+    forRanges(_config, _config.width, COLUMN_GRAIN, [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned int> land;
+        std::vector<float> noise;
+        for (std::size_t col = first; col < last; ++col) {
+            unsigned int x = static_cast<unsigned int>(col);
+            
+            // Water tiles never use the noise, so only land is sampled
+            land.clear();
+            for (unsigned int y = 0; y < _config.height; ++y) {
+                if (_elevationMap[x][y] < _config.seaLevel) {
+                    _moistureMap[x][y] = 1.0f;
+                } else {
+                    land.push_back(y);
+                }
+            }
+            sampleNoise(land.size(), [&](std::size_t k, float& sx, float& sy) {
+                sx = worldX(x) * _config.moistureNoiseScale + _config.seed * 3.0f;
+                sy = worldY(land[k]) * _config.moistureNoiseScale + _config.seed * 3.0f;
+            }, noise);
+            for (std::size_t k = 0; k < land.size(); ++k) {
+                _moistureMap[x][land[k]] = calculateTileMoisture(x, land[k], noise[k]);
+            }
         }
-    }
+    });
 }
 
-float ClimateWorldGenerator::calculateTileMoisture(int x, int y) const {
+float ClimateWorldGenerator::calculateTileMoisture(int x, int y, float noise) const {
     // Water tiles have maximum moisture
     if (_elevationMap[x][y] < _config.seaLevel) {
         return 1.0f;
@@ -923,7 +1315,7 @@ float ClimateWorldGenerator::calculateTileMoisture(int x, int y) const {
     float windMoisture = calculateWindMoisture(x, y);
     
     // 3. Rain shadow effect
-    float rainShadow = calculateRainShadow(x, y);
+    float rainShadow = _rainShadowMap[x][y];
     
     // 4. Temperature effect - hot air can hold more moisture, but also loses more
     float temp = _temperatureMap[x][y];
@@ -935,10 +1327,7 @@ float ClimateWorldGenerator::calculateTileMoisture(int x, int y) const {
     }
     
     // 5. Local moisture variation noise
-    float moistNoise = SimplexNoise::noise(
-        x * _config.moistureNoiseScale + _config.seed * 3.0f,
-        y * _config.moistureNoiseScale + _config.seed * 3.0f
-    ) * 0.15f;  // ±0.15 variation
+    float moistNoise = noise * 0.15f;  // ±0.15 variation
     
     float moisture = baseMoisture * windMoisture * rainShadow * tempFactor * _config.moistureScale + moistNoise;
     return clampValue(moisture, 0.0f, 1.0f);
@@ -946,7 +1335,7 @@ float ClimateWorldGenerator::calculateTileMoisture(int x, int y) const {
 
 float ClimateWorldGenerator::calculateWindMoisture(int x, int y) const {
     // Calculate latitude-based wind patterns
-    float latitude = static_cast<float>(y) / _config.height;
+    float latitude = worldY(static_cast<unsigned int>(y)) / _region.worldHeight;
     float distFromEquator = std::abs(latitude - _config.equatorPosition);
     
     // Wind direction varies by latitude:
@@ -954,7 +1343,7 @@ float ClimateWorldGenerator::calculateWindMoisture(int x, int y) const {
     // 30-60° from equator: Westerlies (from west, so western coasts wetter)
     // 60-90° from equator: Polar easterlies (from east)
     
-    float xNorm = static_cast<float>(x) / _config.width;
+    float xNorm = worldX(static_cast<unsigned int>(x)) / _region.worldWidth;
     float windFactor = 1.0f;
     
     if (distFromEquator < 0.3f) {
@@ -971,24 +1360,43 @@ float ClimateWorldGenerator::calculateWindMoisture(int x, int y) const {
     return windFactor;
 }
 
-float ClimateWorldGenerator::calculateRainShadow(int x, int y) const {
-    // Look upwind (west) for mountains that block moisture
-    float maxUpwindElevation = 0.0f;
-    float currentElev = _elevationMap[x][y];
-    
-    for (int dx = 1; dx < _config.rainShadowDistance && x - dx >= 0; ++dx) {
-        float upwindElev = _elevationMap[x - dx][y];
-        maxUpwindElevation = std::max(maxUpwindElevation, upwindElev);
-    }
-    
-    // If there's a significant mountain upwind, reduce moisture
-    if (maxUpwindElevation > currentElev + 0.1f) {
-        float shadowStrength = (maxUpwindElevation - currentElev) / 0.3f;
-        shadowStrength = std::min(shadowStrength, 1.0f);
-        return 1.0f - shadowStrength * _config.rainShadowStrength;
-    }
-    
-    return 1.0f;
+void ClimateWorldGenerator::calculateRainShadow() {
+    // Wind blows from the west, so a tile is shadowed by the highest tile up
+    // to rainShadowDistance - 1 tiles west of it. Each row keeps that
+    // sliding-window maximum in a queue of candidate columns with strictly
+    // decreasing elevation, which costs O(width) per row regardless of the
+    // shadow distance.
+    const int width = static_cast<int>(_config.width);
+    const int window = (_config.rainShadowDistance - 1) / static_cast<int>(_region.stride);
+    
+    forRanges(_config, _config.height, ROW_GRAIN, [&](std::size_t first, std::size_t last) {
+        std::vector<int> queue(_config.width);
+        for (std::size_t y = first; y < last; ++y) {
+            int head = 0;
+            int tail = 0;
+            for (int x = 0; x < width; ++x) {
+                while (head < tail && queue[head] < x - window) ++head;
+                
+                float currentElev = _elevationMap[x][y];
+                float maxUpwindElevation = 0.0f;
+                if (head < tail) {
+                    maxUpwindElevation = std::max(maxUpwindElevation, _elevationMap[queue[head]][y]);
+                }
+                
+                // If there's a significant mountain upwind, reduce moisture
+                float shadow = 1.0f;
+                if (maxUpwindElevation > currentElev + 0.1f) {
+                    float shadowStrength = (maxUpwindElevation - currentElev) / 0.3f;
+                    shadowStrength = std::min(shadowStrength, 1.0f);
+                    shadow = 1.0f - shadowStrength * _config.rainShadowStrength;
+                }
+                _rainShadowMap[x][y] = shadow;
+                
+                while (head < tail && _elevationMap[queue[tail - 1]][y] <= currentElev) --tail;
+                queue[tail++] = x;
+            }
+        }
+    });
 }
 
 //=============================================================================
@@ -996,19 +1404,17 @@ float ClimateWorldGenerator::calculateRainShadow(int x, int y) const {
 //=============================================================================
 
 void ClimateWorldGenerator::determineBiomes() {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            TileClimate& climate = _climateMap[x][y];
-            
-            climate.elevation = _elevationMap[x][y];
-            climate.temperature = _temperatureMap[x][y];
-            climate.moisture = _moistureMap[x][y];
-            climate.biomeBlend = lookupBiomeBlend(climate.temperature, climate.moisture, climate.elevation);
-            
-            // Assign terrain features based on local terrain analysis
-            climate.feature = determineTerrainFeature(x, y, climate);
-        }
-    }
+    forEachTile(_config, [&](unsigned int x, unsigned int y) {
+        TileClimate& climate = _climateMap[x][y];
+        
+        climate.elevation = _elevationMap[x][y];
+        climate.temperature = _temperatureMap[x][y];
+        climate.moisture = _moistureMap[x][y];
+        climate.biomeBlend = lookupBiomeBlend(climate.temperature, climate.moisture, climate.elevation);
+        
+        // Assign terrain features based on local terrain analysis
+        climate.feature = determineTerrainFeature(x, y, climate);
+    });
 }
 
 TerrainFeature ClimateWorldGenerator::determineTerrainFeature(
@@ -1307,8 +1713,8 @@ void ClimateWorldGenerator::generateRivers() {
             if (options.size() > 1 && steepestGradient < 0.05f) {
                 // On gentle terrain, use noise to bias toward meandering
                 float meander = SimplexNoise::noise(
-                    x * 0.05f + _config.seed * 7.0f,
-                    y * 0.05f + _config.seed * 7.0f
+                    worldX(x) * 0.05f + _config.seed * 7.0f,
+                    worldY(y) * 0.05f + _config.seed * 7.0f
                 );
                 
                 // Find options within 50% of steepest gradient
@@ -1384,6 +1790,9 @@ void ClimateWorldGenerator::generateRivers() {
                 // Mark this cell as river
                 _climateMap[x][y].feature = TerrainFeature::RIVER;
                 _climateMap[x][y].waterLevel = std::min(flow / maxFlow, 1.0f);
+                _riverCells.push_back({static_cast<int>(x), static_cast<int>(y),
+                                       flowDir[x][y].first, flowDir[x][y].second,
+                                       _climateMap[x][y].waterLevel, flow > majorRiverThreshold});
                 
                 // For major rivers, also mark adjacent cells
                 if (flow > majorRiverThreshold) {
@@ -1482,6 +1891,7 @@ void ClimateWorldGenerator::formLake(int centerX, int centerY, float inflow, flo
         _climateMap[x][y].feature = TerrainFeature::LAKE;
         _climateMap[x][y].biomeBlend = BiomeBlend(Biome::FRESHWATER);
         _climateMap[x][y].waterLevel = depth;  // Actual depth for rendering
+        _lakeCells.push_back({x, y, lakeWaterSurface});
     }
 }
 
@@ -1501,71 +1911,195 @@ void ClimateWorldGenerator::floodFillLake(int startX, int startY, float inflow)
 }
 
 //=============================================================================
-// Apply to WorldGrid
+// Overview Lookups
 //=============================================================================
 
-void ClimateWorldGenerator::applyToGrid(WorldGrid& grid) {
-    for (unsigned int y = 0; y < _config.height; ++y) {
-        for (unsigned int x = 0; x < _config.width; ++x) {
-            const TileClimate& climate = _climateMap[x][y];
-            const BiomeProperties& props = getBiomeProperties(climate.biome());
-            
-            // Determine passability and terrain type
-            bool passable = true;
-            bool isWater = false;
-            TerrainType terrainType = props.terrainType;
-            char displayChar = props.displayChar;
-            float waterDepth = 0.0f;  // Water depth for gradient rendering
+void ClimateWorldGenerator::fillInlandSeasFrom(const ClimateWorldGenerator& overview) {
+    // Water the overview resolved is kept, whether ocean or a lake large
+    // enough to survive its own inland sea removal. Anything smaller than
+    // one overview tile with no overview water around it is a puddle well
+    // under minInlandSeaSize and is filled as removeInlandSeas() would.
+    forEachTile(_config, [&](unsigned int x, unsigned int y) {
+        if (_elevationMap[x][y] >= _config.seaLevel) return;
+        unsigned int wx = _region.originX + x;
+        unsigned int wy = _region.originY + y;
+        if (!overview.overviewHasWaterNear(wx, wy)) {
+            float fill = inlandSeaFillElevation(x, y);
+            _elevationMap[x][y] = fill;
+            _continentMap[x][y] = fill;
+        }
+    });
+}
+
+void ClimateWorldGenerator::applyWaterFrom(const ClimateWorldGenerator& overview) {
+    const int stride = static_cast<int>(overview._region.stride);
+    const int originX = static_cast<int>(_region.originX);
+    const int originY = static_cast<int>(_region.originY);
+    
+    auto markRiver = [&](int wx, int wy, float level) {
+        int x = wx - originX;
+        int y = wy - originY;
+        if (!inBounds(x, y) || _elevationMap[x][y] < _config.seaLevel) return;
+        TileClimate& climate = _climateMap[x][y];
+        if (climate.feature != TerrainFeature::RIVER || climate.waterLevel < level) {
+            climate.feature = TerrainFeature::RIVER;
+            climate.waterLevel = level;
+        }
+    };
+    
+    // Each overview river tile flows straight or diagonally into the next,
+    // so its course is redrawn as the run of tiles between the two
+    for (const RiverCell& cell : overview._riverCells) {
+        int wx = cell.x * stride;
+        int wy = cell.y * stride;
+        int lastX = wx + cell.dx * stride;
+        int lastY = wy + cell.dy * stride;
+        if (std::max(wx, lastX) + 1 < originX || std::min(wx, lastX) - 1 >= originX + static_cast<int>(_config.width) ||
+            std::max(wy, lastY) + 1 < originY || std::min(wy, lastY) - 1 >= originY + static_cast<int>(_config.height)) {
+            continue;
+        }
+        
+        int steps = (cell.dx == 0 && cell.dy == 0) ? 0 : stride;
+        for (int i = 0; i <= steps; ++i) {
+            int px = wx + cell.dx * i;
+            int py = wy + cell.dy * i;
+            markRiver(px, py, cell.waterLevel);
             
-            if (climate.biome() == Biome::OCEAN_DEEP ||
-                climate.biome() == Biome::OCEAN_SHALLOW ||
-                climate.biome() == Biome::OCEAN_COAST) {
-                passable = false;
-                isWater = true;
-                // Calculate ocean depth from elevation (deeper = lower elevation)
-                // seaLevel is the surface, so depth = seaLevel - elevation
-                float oceanDepth = _config.seaLevel - climate.elevation;
-                // Normalize to 0-1 range (max depth at elevation 0)
-                waterDepth = clampValue(oceanDepth / _config.seaLevel, 0.0f, 1.0f);
-            } else if (climate.biome() == Biome::FRESHWATER) {
-                passable = true;  // Shallow enough to wade
-                isWater = true;
-                // Use stored water level for freshwater
-                waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
-            } else if (climate.feature == TerrainFeature::RIVER) {
-                // Rivers are passable water with distinct terrain type
-                isWater = true;
-                passable = true;
-                terrainType = TerrainType::SHALLOW_WATER;
-                displayChar = '~';
-                // Rivers use waterLevel which represents flow (larger rivers = higher value)
-                waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
-            } else if (climate.feature == TerrainFeature::LAKE) {
-                // Lakes are passable water bodies
-                isWater = true;
-                passable = true;
-                terrainType = TerrainType::WATER;
-                displayChar = '~';
-                // Lakes store actual depth in waterLevel (set during formLake())
-                waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
-            } else if (climate.biome() == Biome::GLACIER ||
-                       climate.biome() == Biome::MOUNTAIN_BARE) {
-                passable = false;
+            // Major rivers are widened across their flow, as generateRivers() does
+            if (cell.major) {
+                if (cell.dx == 0) {
+                    markRiver(px - 1, py, cell.waterLevel * 0.8f);
+                    markRiver(px + 1, py, cell.waterLevel * 0.8f);
+                } else if (cell.dy == 0) {
+                    markRiver(px, py - 1, cell.waterLevel * 0.8f);
+                    markRiver(px, py + 1, cell.waterLevel * 0.8f);
+                } else {
+                    markRiver(px - cell.dx, py + cell.dy, cell.waterLevel * 0.8f);
+                    markRiver(px + cell.dx, py - cell.dy, cell.waterLevel * 0.8f);
+                }
+            }
+        }
+    }
+    
+    // Lakes cover the land below their water surface around each overview
+    // lake tile
+    const int half = stride / 2;
+    for (const LakeCell& cell : overview._lakeCells) {
+        int cx = cell.x * stride - originX;
+        int cy = cell.y * stride - originY;
+        for (int x = std::max(0, cx - half); x <= std::min(static_cast<int>(_config.width) - 1, cx + half); ++x) {
+            for (int y = std::max(0, cy - half); y <= std::min(static_cast<int>(_config.height) - 1, cy + half); ++y) {
+                float elev = _elevationMap[x][y];
+                if (elev < _config.seaLevel || elev >= cell.surface) continue;
+                TileClimate& climate = _climateMap[x][y];
+                climate.feature = TerrainFeature::LAKE;
+                climate.biomeBlend = BiomeBlend(Biome::FRESHWATER);
+                climate.waterLevel = cell.surface - elev;
             }
-            
-            // Get color pair based on biome
-            int colorPair = getColorPairForBiome(climate.biome(), climate.feature);
-            
-            // Create tile with appropriate terrain type
-            Tile tile(100, displayChar, colorPair, passable, isWater, terrainType);
-            tile.setElevation(static_cast<unsigned int>(climate.elevation * 255));
-            tile.setWaterDepth(waterDepth);  // Set water depth for gradient rendering
-            
-            grid(x, y) = tile;
         }
     }
 }
 
+bool ClimateWorldGenerator::overviewHasWaterNear(unsigned int worldX, unsigned int worldY) const {
+    unsigned int x0 = std::min(worldX / _region.stride, _config.width - 1);
+    unsigned int y0 = std::min(worldY / _region.stride, _config.height - 1);
+    unsigned int x1 = std::min(x0 + 1, _config.width - 1);
+    unsigned int y1 = std::min(y0 + 1, _config.height - 1);
+    return _elevationMap[x0][y0] < _config.seaLevel || _elevationMap[x1][y0] < _config.seaLevel ||
+           _elevationMap[x0][y1] < _config.seaLevel || _elevationMap[x1][y1] < _config.seaLevel;
+}
+
+float ClimateWorldGenerator::overviewWaterDistance(float worldX, float worldY) const {
+    // Bilinear interpolation between the four surrounding overview tiles
+    float fx = clampValue(worldX / _region.stride, 0.0f, static_cast<float>(_config.width - 1));
+    float fy = clampValue(worldY / _region.stride, 0.0f, static_cast<float>(_config.height - 1));
+    unsigned int x0 = static_cast<unsigned int>(fx);
+    unsigned int y0 = static_cast<unsigned int>(fy);
+    unsigned int x1 = std::min(x0 + 1, _config.width - 1);
+    unsigned int y1 = std::min(y0 + 1, _config.height - 1);
+    float tx = fx - static_cast<float>(x0);
+    float ty = fy - static_cast<float>(y0);
+    
+    float d00 = _waterDistanceMap[x0][y0];
+    float d10 = _waterDistanceMap[x1][y0];
+    float d01 = _waterDistanceMap[x0][y1];
+    float d11 = _waterDistanceMap[x1][y1];
+    const float none = std::numeric_limits<float>::max();
+    if (d00 == none || d10 == none || d01 == none || d11 == none) {
+        return std::min(std::min(d00, d10), std::min(d01, d11));
+    }
+    float top = d00 + (d10 - d00) * tx;
+    float bottom = d01 + (d11 - d01) * tx;
+    return top + (bottom - top) * ty;
+}
+
+//=============================================================================
+// Apply to WorldGrid
+//=============================================================================
+
+void ClimateWorldGenerator::applyToGrid(WorldGrid& grid) {
+    forEachTile(_config, [&](unsigned int x, unsigned int y) {
+        grid(x, y) = makeTile(_climate.get(x, y));
+    });
+}
+
+Tile ClimateWorldGenerator::makeTile(const TileClimate& climate) const {
+    const BiomeProperties& props = getBiomeProperties(climate.biome());
+    
+    // Determine passability and terrain type
+    bool passable = true;
+    bool isWater = false;
+    TerrainType terrainType = props.terrainType;
+    char displayChar = props.displayChar;
+    float waterDepth = 0.0f;  // Water depth for gradient rendering
+    
+    if (climate.biome() == Biome::OCEAN_DEEP ||
+        climate.biome() == Biome::OCEAN_SHALLOW ||
+        climate.biome() == Biome::OCEAN_COAST) {
+        passable = false;
+        isWater = true;
+        // Calculate ocean depth from elevation (deeper = lower elevation)
+        // seaLevel is the surface, so depth = seaLevel - elevation
+        float oceanDepth = _config.seaLevel - climate.elevation;
+        // Normalize to 0-1 range (max depth at elevation 0)
+        waterDepth = clampValue(oceanDepth / _config.seaLevel, 0.0f, 1.0f);
+    } else if (climate.biome() == Biome::FRESHWATER) {
+        passable = true;  // Shallow enough to wade
+        isWater = true;
+        // Use stored water level for freshwater
+        waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
+    } else if (climate.feature == TerrainFeature::RIVER) {
+        // Rivers are passable water with distinct terrain type
+        isWater = true;
+        passable = true;
+        terrainType = TerrainType::SHALLOW_WATER;
+        displayChar = '~';
+        // Rivers use waterLevel which represents flow (larger rivers = higher value)
+        waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
+    } else if (climate.feature == TerrainFeature::LAKE) {
+        // Lakes are passable water bodies
+        isWater = true;
+        passable = true;
+        terrainType = TerrainType::WATER;
+        displayChar = '~';
+        // Lakes store actual depth in waterLevel (set during formLake())
+        waterDepth = clampValue(climate.waterLevel, 0.0f, 1.0f);
+    } else if (climate.biome() == Biome::GLACIER ||
+               climate.biome() == Biome::MOUNTAIN_BARE) {
+        passable = false;
+    }
+    
+    // Get color pair based on biome
+    int colorPair = getColorPairForBiome(climate.biome(), climate.feature);
+    
+    // Create tile with appropriate terrain type
+    Tile tile(100, displayChar, colorPair, passable, isWater, terrainType);
+    tile.setElevation(static_cast<unsigned int>(climate.elevation * 255));
+    tile.setWaterDepth(waterDepth);  // Set water depth for gradient rendering
+    
+    return tile;
+}
+
 int ClimateWorldGenerator::getColorPairForBiome(Biome biome, TerrainFeature feature) const {
     // Handle water features first
     if (feature == TerrainFeature::RIVER || feature == TerrainFeature::LAKE) {
@@ -1625,8 +2159,267 @@ int ClimateWorldGenerator::getColorPairForBiome(Biome biome, TerrainFeature feat
 // Data Access
 //=============================================================================
 
-const TileClimate& ClimateWorldGenerator::getClimate(unsigned int x, unsigned int y) const {
-    return _climateMap[x][y];
+TileClimate ClimateWorldGenerator::getClimate(unsigned int x, unsigned int y) const {
+    return _climate.get(x, y);
+}
+
+void ClimateWorldGenerator::releaseIntermediateMaps() {
+    using Map = std::vector<std::vector<float>>;
+    Map().swap(_continentMap);
+    Map().swap(_elevationMap);
+    Map().swap(_temperatureMap);
+    Map().swap(_moistureMap);
+    Map().swap(_rainShadowMap);
+    Map().swap(_waterDistanceMap);
+    Map().swap(_ridgeDistanceMap);
+}
+
+size_t ClimateWorldGenerator::memoryUsage() const {
+    return sizeof(*this)
+         + _climate.memoryBytes()
+         + Memory::nestedHeapBytes(_continentMap)
+         + Memory::nestedHeapBytes(_elevationMap)
+         + Memory::nestedHeapBytes(_temperatureMap)
+         + Memory::nestedHeapBytes(_moistureMap)
+         + Memory::nestedHeapBytes(_rainShadowMap)
+         + Memory::nestedHeapBytes(_climateMap)
+         + Memory::nestedHeapBytes(_waterDistanceMap)
+         + Memory::nestedHeapBytes(_ridgeDistanceMap)
+         + Memory::heapBytes(_stageTimings)
+         + Memory::heapBytes(_plateRidges)
+         + Memory::heapBytes(_riverCells)
+         + Memory::heapBytes(_lakeCells);
+}
+
+//=============================================================================
+// Generation Cache
+//=============================================================================
+
+namespace {
+
+// Bump whenever generation output or the cache layout changes, so stale
+// cache files stop matching
+constexpr std::uint32_t CACHE_FORMAT_VERSION = 2;
+constexpr char CACHE_MAGIC[4] = {'E', 'C', 'W', 'G'};
+
+/// FNV-1a over the exact bytes of each value fed in.
+class KeyHasher {
+public:
+    template<typename T>
+    KeyHasher& add(const T& value) {
+        static_assert(std::is_arithmetic<T>::value, "hash fields one at a time");
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (unsigned char b : bytes) {
+            _hash ^= b;
+            _hash *= 0x100000001b3ULL;
+        }
+        return *this;
+    }
+    std::uint64_t value() const { return _hash; }
+
+private:
+    std::uint64_t _hash = 0xcbf29ce484222325ULL;
+};
+
+template<typename T>
+void writeRaw(std::ostream& out, const T* data, std::size_t count) {
+    out.write(reinterpret_cast<const char*>(data),
+              static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+template<typename T>
+bool readRaw(std::istream& in, T* data, std::size_t count) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(data),
+                                     static_cast<std::streamsize>(count * sizeof(T))));
+}
+
+template<typename T>
+void writeMap(std::ostream& out, const std::vector<std::vector<T>>& map) {
+    for (const auto& column : map) writeRaw(out, column.data(), column.size());
+}
+
+template<typename T>
+bool readMap(std::istream& in, std::vector<std::vector<T>>& map,
+             unsigned int width, unsigned int height) {
+    map.assign(width, std::vector<T>(height));
+    for (auto& column : map) {
+        if (!readRaw(in, column.data(), column.size())) return false;
+    }
+    return true;
+}
+
+template<typename T>
+void writeList(std::ostream& out, const std::vector<T>& list) {
+    std::uint64_t count = list.size();
+    writeRaw(out, &count, 1);
+    writeRaw(out, list.data(), list.size());
+}
+
+template<typename T>
+bool readList(std::istream& in, std::vector<T>& list) {
+    std::uint64_t count = 0;
+    if (!readRaw(in, &count, 1) || count > (std::uint64_t(1) << 32)) return false;
+    list.resize(count);
+    return readRaw(in, list.data(), list.size());
+}
+
+struct CacheHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint32_t width;
+    std::uint32_t height;
+};
+
+} // anonymous namespace
+
+std::uint64_t ClimateWorldGenerator::generationKey() const {
+    const ClimateGeneratorConfig& c = _config;
+    KeyHasher h;
+    h.add(CACHE_FORMAT_VERSION);
+    h.add(c.width).add(c.height);
+    h.add(c.seaLevel).add(c.isIsland).add(c.islandFalloff);
+    h.add(c.equatorPosition).add(c.temperatureRange).add(c.baseTemperature);
+    h.add(c.lapseRate).add(c.maxElevationMeters);
+    h.add(c.moistureScale).add(c.coastalMoistureDecay);
+    h.add(c.rainShadowDistance).add(c.rainShadowStrength);
+    h.add(c.generateRivers).add(c.maxRivers).add(c.riverSourceElevation);
+    h.add(c.riverSourceMoisture).add(c.riverSpawnChance).add(c.generateLakes);
+    h.add(c.continentFrequency).add(c.continentOctaves);
+    h.add(c.elevationFrequency).add(c.elevationOctaves).add(c.ridgeFrequency);
+    h.add(c.temperatureNoiseScale).add(c.moistureNoiseScale);
+    h.add(c.numPlateRidges).add(c.ridgeStrength).add(c.ridgeWidth);
+    h.add(c.foothillsWidth).add(c.ridgeOctaves).add(c.ridgeLacunarity);
+    h.add(c.ridgeGain).add(c.mountainClusterFreq);
+    h.add(c.removeInlandSeas).add(c.minInlandSeaSize).add(c.inlandSeaFillElevation);
+    h.add(c.seed);
+    h.add(_region.worldWidth).add(_region.worldHeight);
+    h.add(_region.originX).add(_region.originY);
+    h.add(_region.stride).add(_region.apron);
+    return h.value();
+}
+
+bool ClimateWorldGenerator::generateCached(WorldGrid& grid, const std::string& directory) {
+    if (directory.empty()) {
+        generate(grid);
+        return false;
+    }
+    
+    // The key covers the region, which generate() always sets to the whole world
+    _region = GenerationRegion();
+    _region.worldWidth = _config.width;
+    _region.worldHeight = _config.height;
+    
+    char name[32];
+    std::snprintf(name, sizeof(name), "climate_%016llx.bin",
+                  static_cast<unsigned long long>(generationKey()));
+    std::string path = directory + "/" + name;
+    if (loadGenerated(path, grid)) {
+        return true;
+    }
+    
+    generate(grid);
+    
+    // Concurrent runs may race to fill the same entry, so each writes a
+    // private file and renames it into place
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    std::string temp = path + ".tmp" + std::to_string(std::random_device{}());
+    if (saveGenerated(temp)) {
+        std::filesystem::rename(temp, path, ec);
+    }
+    if (ec || std::filesystem::exists(temp)) {
+        std::filesystem::remove(temp, ec);
+    }
+    return false;
+}
+
+bool ClimateWorldGenerator::saveGenerated(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    
+    CacheHeader header;
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_FORMAT_VERSION;
+    header.key = generationKey();
+    header.width = _config.width;
+    header.height = _config.height;
+    writeRaw(out, &header, 1);
+    writeRaw(out, &_region, 1);
+    
+    writeMap(out, _continentMap);
+    writeMap(out, _elevationMap);
+    writeMap(out, _temperatureMap);
+    writeMap(out, _moistureMap);
+    writeMap(out, _rainShadowMap);
+    writeMap(out, _waterDistanceMap);
+    writeMap(out, _ridgeDistanceMap);
+    writeRaw(out, _climate.tiles().data(), _climate.tiles().size());
+    writeList(out, _plateRidges);
+    writeList(out, _riverCells);
+    writeList(out, _lakeCells);
+    
+    // Trailer, so a truncated file is rejected
+    writeRaw(out, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    return static_cast<bool>(out);
+}
+
+bool ClimateWorldGenerator::loadGenerated(const std::string& path, WorldGrid& grid) {
+    static_assert(std::is_trivially_copyable<PackedTileClimate>::value &&
+                  std::is_trivially_copyable<PlateRidge>::value &&
+                  std::is_trivially_copyable<RiverCell>::value &&
+                  std::is_trivially_copyable<LakeCell>::value &&
+                  std::is_trivially_copyable<GenerationRegion>::value,
+                  "cache files store these as raw bytes");
+    
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    
+    CacheHeader header;
+    if (!readRaw(in, &header, 1) ||
+        std::memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != CACHE_FORMAT_VERSION ||
+        header.width != _config.width || header.height != _config.height) {
+        return false;
+    }
+    
+    // Everything is read into a scratch generator first so a bad file
+    // leaves this one untouched. The key is checked against the current
+    // config together with the region stored in the file.
+    ClimateWorldGenerator loaded(_config);
+    const unsigned int w = _config.width;
+    const unsigned int h = _config.height;
+    loaded._climate = ClimateStore(w, h);
+    char trailer[sizeof(CACHE_MAGIC)];
+    bool ok = readRaw(in, &loaded._region, 1) &&
+              readMap(in, loaded._continentMap, w, h) &&
+              readMap(in, loaded._elevationMap, w, h) &&
+              readMap(in, loaded._temperatureMap, w, h) &&
+              readMap(in, loaded._moistureMap, w, h) &&
+              readMap(in, loaded._rainShadowMap, w, h) &&
+              readMap(in, loaded._waterDistanceMap, w, h) &&
+              readMap(in, loaded._ridgeDistanceMap, w, h) &&
+              readRaw(in, loaded._climate.tiles().data(), loaded._climate.tiles().size()) &&
+              readList(in, loaded._plateRidges) &&
+              readList(in, loaded._riverCells) &&
+              readList(in, loaded._lakeCells) &&
+              readRaw(in, trailer, sizeof(trailer)) &&
+              std::memcmp(trailer, CACHE_MAGIC, sizeof(trailer)) == 0;
+    if (!ok || loaded.generationKey() != header.key) {
+        return false;
+    }
+    
+    *this = std::move(loaded);
+    _rng.seed(_config.seed);
+    grid.resize(_config.width, _config.height);
+    applyToGrid(grid);
+    return true;
+}
+
+std::string ClimateWorldGenerator::defaultCacheDirectory() {
+    const char* env = std::getenv("ECOSIM_WORLD_CACHE");
+    return env ? std::string(env) : std::string();
 }
 
 //=============================================================================
@@ -1639,8 +2432,8 @@ bool ClimateWorldGenerator::inBounds(int x, int y) const {
 }
 
 float ClimateWorldGenerator::distanceToEdge(int x, int y) const {
-    float dx = static_cast<float>(x) / _config.width - 0.5f;
-    float dy = static_cast<float>(y) / _config.height - 0.5f;
+    float dx = worldX(static_cast<unsigned int>(x)) / _region.worldWidth - 0.5f;
+    float dy = worldY(static_cast<unsigned int>(y)) / _region.worldHeight - 0.5f;
 
     // Radial falloff: positive at the inscribed-circle interior, negative
     // outside it. The smoothstep clamp downstream collapses the negative
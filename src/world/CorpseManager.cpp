@@ -4,6 +4,7 @@
  */
 
 #include "../../include/world/CorpseManager.hpp"
+#include "../../include/memoryUsage.hpp"
 #include <algorithm>
 
 namespace EcoSim {
@@ -192,6 +193,14 @@ float CorpseManager::getTotalNutritionAt(int x, int y) const {
     return total;
 }
 
+size_t CorpseManager::memoryUsage() const {
+    size_t bytes = sizeof(*this) + Memory::heapBytes(_corpses);
+    for (const auto& corpse : _corpses) {
+        bytes += sizeof(world::Corpse) + Memory::heapBytes(corpse->getSpeciesName());
+    }
+    return bytes;
+}
+
 //==============================================================================
 // Private Helpers
 //==============================================================================
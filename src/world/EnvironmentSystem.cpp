@@ -1,12 +1,10 @@
 #include "world/EnvironmentSystem.hpp"
 #include "world/ClimateWorldGenerator.hpp"
+#include "world/ChunkedWorld.hpp"
 #include <cmath>
 
 namespace EcoSim {
 
-// Static default climate instance
-TileClimate EnvironmentSystem::_defaultClimate = TileClimate{};
-
 EnvironmentSystem::EnvironmentSystem(const SeasonManager& seasonManager, const WorldGrid& grid)
     : _seasonManager(seasonManager)
     , _grid(grid)
@@ -17,10 +15,14 @@ EnvironmentSystem::EnvironmentSystem(const SeasonManager& seasonManager, const W
 {
 }
 
-void EnvironmentSystem::setClimateMap(const std::vector<std::vector<TileClimate>>* climateMap) {
+void EnvironmentSystem::setClimateMap(const ClimateStore* climateMap) {
     _climateMap = climateMap;
 }
 
+void EnvironmentSystem::setChunkedClimate(ChunkedWorld* chunks) {
+    _chunks = chunks;
+}
+
 //==============================================================================
 // Per-Tick Cache Management
 //==============================================================================
@@ -45,17 +47,23 @@ bool EnvironmentSystem::isValidPosition(int x, int y) const {
     return _grid.inBounds(x, y);
 }
 
+PackedTileClimate EnvironmentSystem::packedClimate(int x, int y) const {
+    const unsigned int ux = static_cast<unsigned int>(x);
+    const unsigned int uy = static_cast<unsigned int>(y);
+    return _chunks ? _chunks->packedClimate(ux, uy) : _climateMap->packed(ux, uy);
+}
+
 //==============================================================================
 // Raw Climate Access
 //==============================================================================
 
-const TileClimate& EnvironmentSystem::getClimateAt(int x, int y) const {
-    if (!isValidPosition(x, y) || !_climateMap) {
-        return _defaultClimate;
+TileClimate EnvironmentSystem::getClimateAt(int x, int y) const {
+    if (!isValidPosition(x, y) || !hasClimateData()) {
+        return TileClimate{};
     }
     
-    // Climate map uses same indexing as grid [x][y]
-    return (*_climateMap)[static_cast<size_t>(x)][static_cast<size_t>(y)];
+    // Climate uses same indexing as grid [x][y]
+    return packedClimate(x, y).unpack();
 }
 
 //==============================================================================
@@ -68,9 +76,9 @@ Genetics::EnvironmentState EnvironmentSystem::getEnvironmentStateAt(int x, int y
         return Genetics::EnvironmentState{};
     }
     
-    if (_climateMap) {
+    if (hasClimateData()) {
         // Use climate-based environment with biome blending
-        const TileClimate& climate = getClimateAt(x, y);
+        TileClimate climate = getClimateAt(x, y);
         
         // Use cached day progress if available, fall back to live query
         float timeOfDay = _cachedDayProgress;
@@ -101,29 +109,29 @@ Genetics::EnvironmentState EnvironmentSystem::getEnvironmentStateAt(int x, int y
 //==============================================================================
 
 float EnvironmentSystem::getTemperature(int x, int y) const {
-    if (_climateMap && isValidPosition(x, y)) {
-        return getClimateAt(x, y).temperature;
+    if (hasClimateData() && isValidPosition(x, y)) {
+        return packedClimate(x, y).getTemperature();
     }
     return DEFAULT_TEMPERATURE;
 }
 
 float EnvironmentSystem::getMoisture(int x, int y) const {
-    if (_climateMap && isValidPosition(x, y)) {
-        return getClimateAt(x, y).moisture;
+    if (hasClimateData() && isValidPosition(x, y)) {
+        return packedClimate(x, y).getMoisture();
     }
     return DEFAULT_MOISTURE;
 }
 
 float EnvironmentSystem::getElevation(int x, int y) const {
-    if (_climateMap && isValidPosition(x, y)) {
-        return getClimateAt(x, y).elevation;
+    if (hasClimateData() && isValidPosition(x, y)) {
+        return packedClimate(x, y).getElevation();
     }
     return DEFAULT_ELEVATION;
 }
 
 int EnvironmentSystem::getBiome(int x, int y) const {
-    if (_climateMap && isValidPosition(x, y)) {
-        return static_cast<int>(getClimateAt(x, y).biome());
+    if (hasClimateData() && isValidPosition(x, y)) {
+        return static_cast<int>(packedClimate(x, y).biome());
     }
     return static_cast<int>(Biome::TEMPERATE_GRASSLAND);
 }
@@ -143,7 +151,7 @@ float EnvironmentSystem::getLightLevel(int x, int y) const {
     float lightLevel = _cachedBaseLightLevel;
     
     // Reduce light in dense vegetation (canopy effect) - per-tile modifier
-    if (_climateMap) {
+    if (hasClimateData()) {
         float canopyReduction = getClimateAt(x, y).getVegetationDensity() * 0.3f;
         lightLevel *= (1.0f - canopyReduction);
     }
@@ -5,7 +5,15 @@
 
 #include "../../include/world/PlantManager.hpp"
 #include "../../include/world/EnvironmentSystem.hpp"
+#include "../../include/world/WorldOverview.hpp"
 #include "../../include/genetics/organisms/BiomeVariantExamples.hpp"
+#include "../../include/logging/Profiler.hpp"
+#include "../../include/memoryUsage.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
 
 namespace EcoSim {
 
@@ -19,7 +27,7 @@ PlantManager::PlantManager(WorldGrid& grid, ScentLayer& scents)
     : _grid(grid)
     , _scents(scents)
     , _environmentSystem(nullptr)
-    , _rng(std::random_device{}())
+    , _rng(Genetics::RandomEngine::stream(Genetics::RandomSystem::Plants))
     , _spatialIndexDirty(true) {
     // Initialize spatial index with grid dimensions
     _plantSpatialIndex = std::make_unique<PlantSpatialIndex>(
@@ -39,6 +47,10 @@ void PlantManager::setEnvironmentSystem(const EnvironmentSystem* envSystem) {
     }
 }
 
+void PlantManager::setOverview(WorldOverview* overview) {
+    _overview = overview;
+}
+
 //==============================================================================
 // Initialization
 //==============================================================================
@@ -72,6 +84,10 @@ void PlantManager::initialize() {
     _biomeFactory = std::make_unique<BiomeVariantFactory>(
         _plantRegistry, nullptr, _plantFactory.get());
     
+    if (_groundCoverField) {
+        registerGroundCoverSpecies();
+    }
+    
     std::cout << "[PlantManager] Initialized with "
               << _plantFactory->getTemplateNames().size() << " species templates" << std::endl;
 }
@@ -100,26 +116,25 @@ void PlantManager::addPlants(unsigned lowElev, unsigned highElev,
     std::uniform_int_distribution<unsigned short> dis(1, 100);
     unsigned int plantsAdded = 0;
     
-    unsigned cols = _grid.width();
-    unsigned rows = _grid.height();
-    
-    for (unsigned x = 0; x < cols; x++) {
-        for (unsigned y = 0; y < rows; y++) {
-            Tile& tile = _grid(x, y);
+    for (const WorldGrid::Region& region : _grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                Tile& tile = _grid(x, y);
             
-            // Check elevation is in range and tile is passable
-            if (tile.getElevation() > lowElev &&
-                tile.getElevation() < highElev &&
-                tile.isPassable()) {
+                // Check elevation is in range and tile is passable
+                if (tile.getElevation() > lowElev &&
+                    tile.getElevation() < highElev &&
+                    tile.isPassable()) {
                 
-                // Random chance of placing plant
-                if (dis(_rng) <= rate) {
-                    Plant plant = _plantFactory->createFromTemplate(species,
-                                                                    static_cast<int>(x),
-                                                                    static_cast<int>(y));
-                    auto plantPtr = std::make_shared<Plant>(std::move(plant));
-                    tile.addPlant(plantPtr);
-                    ++plantsAdded;
+                    // Random chance of placing plant
+                    if (dis(_rng) <= rate) {
+                        Plant plant = _plantFactory->createFromTemplate(species,
+                                                                        static_cast<int>(x),
+                                                                        static_cast<int>(y));
+                        placePlant(tile, static_cast<int>(x), static_cast<int>(y),
+                                   std::make_shared<Plant>(std::move(plant)));
+                        ++plantsAdded;
+                    }
                 }
             }
         }
@@ -152,17 +167,17 @@ bool PlantManager::addPlant(int x, int y, const std::string& species) {
     }
     
     Plant plant = _plantFactory->createFromTemplate(species, x, y);
-    return tile.addPlant(std::make_shared<Plant>(std::move(plant)));
+    return placePlant(tile, x, y, std::make_shared<Plant>(std::move(plant)));
 }
 
-std::function<Plant(int, int)> PlantManager::selectPlantForBiome(Biome biome) {
+std::string PlantManager::selectSpeciesForBiome(Biome biome) {
     // Water biomes cannot support plants
     switch (biome) {
         case Biome::OCEAN_DEEP:
         case Biome::OCEAN_SHALLOW:
         case Biome::OCEAN_COAST:
         case Biome::FRESHWATER:
-            return nullptr;
+            return "";
         default:
             break;
     }
@@ -175,7 +190,7 @@ std::function<Plant(int, int)> PlantManager::selectPlantForBiome(Biome biome) {
         case Biome::BOREAL_FOREST:
         case Biome::ALPINE_TUNDRA:
         case Biome::GLACIER:
-            return [this](int x, int y) { return _biomeFactory->createTundraMoss(x, y); };
+            return "tundra_moss";
         default:
             break;
     }
@@ -186,7 +201,7 @@ std::function<Plant(int, int)> PlantManager::selectPlantForBiome(Biome biome) {
         case Biome::DESERT_COLD:
         case Biome::STEPPE:
         case Biome::SHRUBLAND:
-            return [this](int x, int y) { return _biomeFactory->createDesertCactus(x, y); };
+            return "desert_cactus";
         default:
             break;
     }
@@ -196,7 +211,7 @@ std::function<Plant(int, int)> PlantManager::selectPlantForBiome(Biome biome) {
         case Biome::TROPICAL_RAINFOREST:
         case Biome::TROPICAL_SEASONAL_FOREST:
         case Biome::SAVANNA:
-            return [this](int x, int y) { return _biomeFactory->createRainforestVine(x, y); };
+            return "rainforest_vine";
         default:
             break;
     }
@@ -207,17 +222,20 @@ std::function<Plant(int, int)> PlantManager::selectPlantForBiome(Biome biome) {
     int speciesChoice = speciesDist(_rng);
     
     switch (speciesChoice) {
-        case 0:
-            return [this](int x, int y) { return _plantFactory->createFromTemplate("berry_bush", x, y); };
-        case 1:
-            return [this](int x, int y) { return _plantFactory->createFromTemplate("oak_tree", x, y); };
-        case 2:
-            return [this](int x, int y) { return _plantFactory->createFromTemplate("grass", x, y); };
-        default:
-            return [this](int x, int y) { return _plantFactory->createFromTemplate("thorn_bush", x, y); };
+        case 0:  return "berry_bush";
+        case 1:  return "oak_tree";
+        case 2:  return "grass";
+        default: return "thorn_bush";
     }
 }
 
+Plant PlantManager::createBiomePlant(const std::string& species, int x, int y) {
+    if (species == "tundra_moss") return _biomeFactory->createTundraMoss(x, y);
+    if (species == "desert_cactus") return _biomeFactory->createDesertCactus(x, y);
+    if (species == "rainforest_vine") return _biomeFactory->createRainforestVine(x, y);
+    return _plantFactory->createFromTemplate(species, x, y);
+}
+
 void PlantManager::addPlantsByBiome(unsigned rate) {
     if (!isInitialized()) {
         std::cerr << "[PlantManager] Error: Plant system not initialized. "
@@ -233,71 +251,85 @@ void PlantManager::addPlantsByBiome(unsigned rate) {
     
     std::uniform_int_distribution<unsigned short> chanceDist(1, 100);
     
-    unsigned cols = _grid.width();
-    unsigned rows = _grid.height();
-    
     // Track counts by biome category for logging
     unsigned tundraPlants = 0;
     unsigned desertPlants = 0;
     unsigned tropicalPlants = 0;
     unsigned temperatePlants = 0;
     unsigned skippedWater = 0;
+    unsigned fieldTiles = 0;
+    
+    if (_groundCoverField) {
+        registerGroundCoverSpecies();
+    }
     
-    for (unsigned x = 0; x < cols; x++) {
-        for (unsigned y = 0; y < rows; y++) {
-            Tile& tile = _grid(x, y);
+    for (const WorldGrid::Region& region : _grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                Tile& tile = _grid(x, y);
             
-            // Skip impassable tiles (mountains, cliffs, etc.)
-            if (!tile.isPassable()) {
-                continue;
-            }
+                // Skip impassable tiles (mountains, cliffs, etc.)
+                if (!tile.isPassable()) {
+                    continue;
+                }
             
-            // Random chance of placing plant
-            if (chanceDist(_rng) > rate) {
-                continue;
-            }
+                // Ground cover can spread onto every tile of its biomes
+                if (_groundCoverField) {
+                    addGroundCoverHabitat(static_cast<int>(x), static_cast<int>(y));
+                }
+            
+                // Random chance of placing plant
+                if (chanceDist(_rng) > rate) {
+                    continue;
+                }
             
-            // Get biome at this location
-            int biomeInt = _environmentSystem->getBiome(static_cast<int>(x), static_cast<int>(y));
-            Biome biome = static_cast<Biome>(biomeInt);
+                // Get biome at this location
+                int biomeInt = _environmentSystem->getBiome(static_cast<int>(x), static_cast<int>(y));
+                Biome biome = static_cast<Biome>(biomeInt);
             
-            // Select appropriate plant creator for this biome
-            auto plantCreator = selectPlantForBiome(biome);
+                // Select appropriate plant species for this biome
+                const std::string species = selectSpeciesForBiome(biome);
             
-            // Skip water biomes
-            if (!plantCreator) {
-                ++skippedWater;
-                continue;
-            }
+                // Skip water biomes
+                if (species.empty()) {
+                    ++skippedWater;
+                    continue;
+                }
             
-            // Create and add the plant
-            Plant plant = plantCreator(static_cast<int>(x), static_cast<int>(y));
-            tile.addPlant(std::make_shared<Plant>(std::move(plant)));
+                // Create and add the plant, or fill the tile's ground cover
+                if (seedGroundCover(static_cast<int>(x), static_cast<int>(y), species)) {
+                    ++fieldTiles;
+                } else {
+                    Plant plant = createBiomePlant(species, static_cast<int>(x), static_cast<int>(y));
+                    placePlant(tile, static_cast<int>(x), static_cast<int>(y),
+                               std::make_shared<Plant>(std::move(plant)));
+                }
             
-            // Track for logging
-            switch (biome) {
-                case Biome::ICE_SHEET:
-                case Biome::TUNDRA:
-                case Biome::TAIGA:
-                case Biome::BOREAL_FOREST:
-                case Biome::ALPINE_TUNDRA:
-                case Biome::GLACIER:
-                    ++tundraPlants;
-                    break;
-                case Biome::DESERT_HOT:
-                case Biome::DESERT_COLD:
-                case Biome::STEPPE:
-                case Biome::SHRUBLAND:
-                    ++desertPlants;
-                    break;
-                case Biome::TROPICAL_RAINFOREST:
-                case Biome::TROPICAL_SEASONAL_FOREST:
-                case Biome::SAVANNA:
-                    ++tropicalPlants;
-                    break;
-                default:
-                    ++temperatePlants;
-                    break;
+                // Track for logging
+                switch (biome) {
+                    case Biome::ICE_SHEET:
+                    case Biome::TUNDRA:
+                    case Biome::TAIGA:
+                    case Biome::BOREAL_FOREST:
+                    case Biome::ALPINE_TUNDRA:
+                    case Biome::GLACIER:
+                        ++tundraPlants;
+                        break;
+                    case Biome::DESERT_HOT:
+                    case Biome::DESERT_COLD:
+                    case Biome::STEPPE:
+                    case Biome::SHRUBLAND:
+                        ++desertPlants;
+                        break;
+                    case Biome::TROPICAL_RAINFOREST:
+                    case Biome::TROPICAL_SEASONAL_FOREST:
+                    case Biome::SAVANNA:
+                        ++tropicalPlants;
+                        break;
+                    default:
+                        ++temperatePlants;
+                        break;
+                }
             }
         }
     }
@@ -312,6 +344,10 @@ void PlantManager::addPlantsByBiome(unsigned rate) {
     std::cout << "  Tropical (vine): " << tropicalPlants << std::endl;
     std::cout << "  Temperate (mixed): " << temperatePlants << std::endl;
     std::cout << "  Skipped water tiles: " << skippedWater << std::endl;
+    if (_groundCoverField) {
+        std::cout << "  Ground cover field: " << fieldTiles << " of "
+                  << _groundCover.habitatTiles() << " habitat tiles seeded" << std::endl;
+    }
 }
 
 bool PlantManager::addBiomePlant(int x, int y) {
@@ -337,17 +373,116 @@ bool PlantManager::addBiomePlant(int x, int y) {
         biome = static_cast<Biome>(biomeInt);
     }
     
-    // Select appropriate plant creator for this biome
-    auto plantCreator = selectPlantForBiome(biome);
+    // Select appropriate plant species for this biome
+    const std::string species = selectSpeciesForBiome(biome);
     
     // Water biomes cannot support plants
-    if (!plantCreator) {
+    if (species.empty()) {
         return false;
     }
     
+    if (_groundCoverField) {
+        registerGroundCoverSpecies();
+        addGroundCoverHabitat(x, y);
+        if (seedGroundCover(x, y, species)) {
+            return true;
+        }
+    }
+    
     // Create and add the plant
-    Plant plant = plantCreator(x, y);
-    return tile.addPlant(std::make_shared<Plant>(std::move(plant)));
+    Plant plant = createBiomePlant(species, x, y);
+    return placePlant(tile, x, y, std::make_shared<Plant>(std::move(plant)));
+}
+
+//==============================================================================
+// Ground Cover
+//==============================================================================
+
+void PlantManager::setGroundCoverField(bool enabled) {
+    _groundCoverField = enabled;
+    if (enabled) {
+        _groundCover.resize(_grid.width(), _grid.height());
+    } else {
+        _groundCover = VegetationField();
+    }
+}
+
+const char* PlantManager::groundCoverForBiome(Biome biome) {
+    switch (biome) {
+        // Water, plus the biomes whose plants are all shrubs or vines
+        case Biome::OCEAN_DEEP:
+        case Biome::OCEAN_SHALLOW:
+        case Biome::OCEAN_COAST:
+        case Biome::FRESHWATER:
+        case Biome::DESERT_HOT:
+        case Biome::DESERT_COLD:
+        case Biome::STEPPE:
+        case Biome::SHRUBLAND:
+        case Biome::TROPICAL_RAINFOREST:
+        case Biome::TROPICAL_SEASONAL_FOREST:
+        case Biome::SAVANNA:
+            return nullptr;
+        
+        case Biome::ICE_SHEET:
+        case Biome::TUNDRA:
+        case Biome::TAIGA:
+        case Biome::BOREAL_FOREST:
+        case Biome::ALPINE_TUNDRA:
+        case Biome::GLACIER:
+            return "tundra_moss";
+        
+        default:
+            return "grass";
+    }
+}
+
+void PlantManager::registerGroundCoverSpecies() {
+    if (!isInitialized() || _groundCover.speciesCount() > 0) {
+        return;
+    }
+    _groundCover.addSpecies("grass", _plantFactory->createFromTemplate("grass", 0, 0));
+    _groundCover.addSpecies("tundra_moss", _biomeFactory->createTundraMoss(0, 0));
+}
+
+void PlantManager::addGroundCoverHabitat(int x, int y) {
+    Biome biome = Biome::TEMPERATE_GRASSLAND;
+    if (_environmentSystem && _environmentSystem->hasClimateData()) {
+        biome = static_cast<Biome>(_environmentSystem->getBiome(x, y));
+    }
+    const char* species = groundCoverForBiome(biome);
+    if (!species) {
+        return;
+    }
+    
+    const EnvironmentState env = _environmentSystem
+        ? _environmentSystem->getEnvironmentStateAt(x, y)
+        : _currentEnvironment;
+    _groundCover.setHabitat(x, y, _groundCover.findSpecies(species), env.temperature, env.humidity);
+}
+
+bool PlantManager::seedGroundCover(int x, int y, const std::string& species) {
+    if (!_groundCoverField) {
+        return false;
+    }
+    const int index = _groundCover.findSpecies(species);
+    if (index == VegetationField::NONE || _groundCover.speciesAt(x, y) != index) {
+        return false;
+    }
+    _groundCover.setBiomass(x, y, _groundCover.capacityAt(x, y));
+    return true;
+}
+
+//==============================================================================
+// Compact Plants
+//==============================================================================
+
+void PlantManager::setCompactPlants(bool enabled) {
+    _compactPlants = enabled;
+    if (!enabled) {
+        _records.clear();
+        _recordAt.clear();
+        _views.clear();
+    }
 }
 
 //==============================================================================
@@ -355,6 +490,7 @@ bool PlantManager::addBiomePlant(int x, int y) {
 //==============================================================================
 
 void PlantManager::tick(unsigned currentTick) {
+    ECOSIM_PROFILE_ZONE("PlantManager::tick");
     if (!isInitialized()) {
         return;
     }
@@ -363,92 +499,139 @@ void PlantManager::tick(unsigned currentTick) {
     unsigned rows = _grid.height();
     
     // Collect seed dispersal events during iteration
-    std::vector<std::pair<DispersalEvent, std::shared_ptr<Plant>>> dispersalEvents;
+    DispersalEvents dispersalEvents;
+    
+    // The overview's plant layer is recounted while every tile is visited
+    if (_overview) {
+        _overview->clear(WorldOverview::Layer::Plants);
+    }
+    
+    // Ground cover advances as one field before the individual plants
+    if (_groundCoverField) {
+        if (_environmentSystem) {
+            _groundCover.step(_environmentSystem->getDayProgress(),
+                              _environmentSystem->getSeasonalTemperatureOffset());
+        } else {
+            _groundCover.step(_currentEnvironment.time_of_day, 0.0f);
+        }
+    }
     
     // Update all plants on all tiles
-    for (unsigned x = 0; x < cols; x++) {
-        for (unsigned y = 0; y < rows; y++) {
-            Tile& tile = _grid(x, y);
+    for (const WorldGrid::Region& region : _grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                Tile& tile = _grid(x, y);
             
-            // Get per-tile environment if available, otherwise use global fallback
-            EnvironmentState tileEnv;
-            if (_environmentSystem) {
-                tileEnv = _environmentSystem->getEnvironmentStateAt(
-                    static_cast<int>(x), static_cast<int>(y));
-            } else {
-                tileEnv = _currentEnvironment;
-            }
+                if (_overview && _groundCoverField &&
+                    _groundCover.isGrazeable(static_cast<int>(x), static_cast<int>(y))) {
+                    _overview->addPlant(static_cast<int>(x), static_cast<int>(y),
+                                        _groundCover.biomassAt(static_cast<int>(x), static_cast<int>(y)));
+                }
             
-            // Update plants with location-specific environment
-            tile.updatePlants(tileEnv);
+                // Nothing below applies to a tile without plants, so skip its
+                // environment lookup
+                if (tile.getPlants().empty()) {
+                    continue;
+                }
             
-            // Remove dead plants with incremental spatial index update
-            // Instead of tile.removeDeadPlants(), we handle removal here to update the index
-            auto& plants = tile.getPlants();
-            auto it = plants.begin();
-            while (it != plants.end()) {
-                if (!(*it) || !(*it)->isAlive()) {
-                    // Remove from spatial index before erasing from tile
-                    if (*it && _plantSpatialIndex && !_spatialIndexDirty) {
-                        _plantSpatialIndex->remove(
-                            (*it).get(),
-                            static_cast<int>(x),
-                            static_cast<int>(y)
-                        );
-                    }
-                    it = plants.erase(it);
+                // Get per-tile environment if available, otherwise use global fallback
+                EnvironmentState tileEnv;
+                if (_environmentSystem) {
+                    tileEnv = _environmentSystem->getEnvironmentStateAt(
+                        static_cast<int>(x), static_cast<int>(y));
                 } else {
-                    ++it;
+                    tileEnv = _currentEnvironment;
                 }
-            }
             
-            // Handle scent emission and seed dispersal for living plants
-            for (auto& plant : tile.getPlants()) {
-                if (!plant || !plant->isAlive()) continue;
-
-                // Emit plant scent if plant has scent production capability
-                float scentRate = plant->getScentProductionRate();
-                if (scentRate > 0.01f) {
-                    std::array<float, 8> signature = plant->getScentSignature();
-                    float intensity = scentRate * plant->getCurrentSize() / plant->getMaxSize();
-
-                    ScentDeposit plantScent(
-                        ScentType::FOOD_TRAIL,
-                        -1,
-                        intensity,
-                        signature,
-                        currentTick,
-                        50
-                    );
-
-                    _scents.deposit(
-                        static_cast<int>(x),
-                        static_cast<int>(y),
-                        plantScent
-                    );
+                // Update plants with location-specific environment
+                tile.updatePlants(tileEnv);
+            
+                // Remove dead plants with incremental spatial index update
+                // Instead of tile.removeDeadPlants(), we handle removal here to update the index
+                auto& plants = tile.getPlants();
+                const size_t plantsBefore = plants.size();
+                auto it = plants.begin();
+                while (it != plants.end()) {
+                    if (!(*it) || !(*it)->isAlive()) {
+                        // Remove from spatial index before erasing from tile
+                        if (*it && _plantSpatialIndex && !_spatialIndexDirty) {
+                            _plantSpatialIndex->remove(
+                                (*it).get(),
+                                static_cast<int>(x),
+                                static_cast<int>(y)
+                            );
+                        }
+                        it = plants.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
+                if (plants.size() < plantsBefore) {
+                    _grid.plantsChanged(x, y, -static_cast<int>(plantsBefore - plants.size()));
+                }
+            
+                // Handle scent emission and seed dispersal for living plants
+                for (auto& plant : tile.getPlants()) {
+                    if (!plant || !plant->isAlive()) continue;
+
+                    if (_overview) {
+                        _overview->addPlant(static_cast<int>(x), static_cast<int>(y),
+                                            plant->getCurrentSize());
+                    }
 
-                // Seed dispersal — only mature plants with sufficient energy
-                if (plant->isMature()) {
-                    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+                    // Emit plant scent if plant has scent production capability
+                    float scentRate = plant->getScentProductionRate();
+                    if (scentRate > 0.01f) {
+                        std::array<float, 8> signature = plant->getScentSignature();
+                        float intensity = scentRate * plant->getCurrentSize() / plant->getMaxSize();
+
+                        ScentDeposit plantScent(
+                            ScentType::FOOD_TRAIL,
+                            -1,
+                            intensity,
+                            signature,
+                            currentTick,
+                            50
+                        );
 
-                    float dispersalChance;
-                    if (plant->canSpreadVegetatively()) {
-                        float sizeRatio = plant->getCurrentSize() / plant->getMaxSize();
-                        dispersalChance = plant->getRunnerProduction() * 0.15f * sizeRatio;
-                    } else {
-                        dispersalChance = plant->getFruitProductionRate() * 0.1f;
+                        _scents.deposit(
+                            static_cast<int>(x),
+                            static_cast<int>(y),
+                            plantScent
+                        );
                     }
 
-                    if (dist(_rng) < dispersalChance) {
-                        DispersalEvent event = _seedDispersal.disperse(*plant, &tileEnv);
-                        dispersalEvents.push_back({event, plant});
+                    // Seed dispersal — only mature plants with sufficient energy
+                    if (plant->isMature()) {
+                        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+                        float dispersalChance;
+                        if (plant->canSpreadVegetatively()) {
+                            float sizeRatio = plant->getCurrentSize() / plant->getMaxSize();
+                            dispersalChance = plant->getRunnerProduction() * 0.15f * sizeRatio;
+                        } else {
+                            dispersalChance = plant->getFruitProductionRate() * 0.1f;
+                        }
+
+                        if (dist(_rng) < dispersalChance) {
+                            DispersalEvent event = _seedDispersal.disperse(*plant, &tileEnv);
+                            dispersalEvents.push_back({event, plant});
+                        }
                     }
                 }
             }
         }
     }
     
+    if (_compactPlants) {
+        tickRecords(currentTick, dispersalEvents);
+    }
+    
+    // Seedlings spawned below are counted from the next tick
+    if (_overview) {
+        _overview->propagate(WorldOverview::Layer::Plants);
+    }
+    
     // Process dispersal events - spawn new plants at target locations
     for (const auto& [event, parentPlant] : dispersalEvents) {
         if (event.targetX < 0 || event.targetX >= static_cast<int>(cols) ||
@@ -482,11 +665,12 @@ void PlantManager::tick(unsigned currentTick) {
         // local shared_ptr would drop and destroy the plant — leaving the
         // raw Plant* in the index as a dangling pointer that later crashes
         // queryRadius.
-        if (!targetTile.addPlant(offspringPtr)) {
+        if (!placePlant(targetTile, event.targetX, event.targetY, offspringPtr)) {
             continue;
         }
 
-        if (_plantSpatialIndex && !_spatialIndexDirty) {
+        // A compact seedling is a record; offspringPtr goes with this loop
+        if (!_compactPlants && _plantSpatialIndex && !_spatialIndexDirty) {
             _plantSpatialIndex->insert(
                 offspringPtr.get(),
                 event.targetX,
@@ -498,6 +682,73 @@ void PlantManager::tick(unsigned currentTick) {
     // No need to mark dirty - we updated incrementally
 }
 
+void PlantManager::tickRecords(unsigned currentTick, DispersalEvents& dispersalEvents) {
+    // Creatures may have eaten the plants they were handed since last tick
+    for (const auto& [index, view] : _views) {
+        _records.sync(index, *view);
+    }
+    _views.clear();
+    
+    for (size_t i = 0; i < _records.size(); ++i) {
+        const PlantRecord& record = _records[i];
+        const int x = record.x;
+        const int y = record.y;
+        
+        EnvironmentState env;
+        if (record.isAlive()) {
+            env = _environmentSystem ? _environmentSystem->getEnvironmentStateAt(x, y)
+                                     : _currentEnvironment;
+            _records.update(i, env);
+        }
+        if (!record.isAlive()) {
+            _grid.plantsChanged(static_cast<unsigned int>(x), static_cast<unsigned int>(y), -1);
+            continue;
+        }
+        
+        if (_overview) {
+            _overview->addPlant(x, y, record.currentSize);
+        }
+        
+        // Scent and dispersal as for a tile's plants, from the shared traits
+        const PlantTraits& traits = _records.traits(i);
+        if (traits.scentProductionRate > 0.01f) {
+            float intensity = traits.scentProductionRate * record.currentSize / traits.maxSize;
+            ScentDeposit plantScent(
+                ScentType::FOOD_TRAIL,
+                -1,
+                intensity,
+                _records.scentSignature(i),
+                currentTick,
+                50
+            );
+            _scents.deposit(x, y, plantScent);
+        }
+        
+        if (record.mature) {
+            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+            
+            float dispersalChance;
+            if (_records.canSpreadVegetatively(i)) {
+                float sizeRatio = record.currentSize / traits.maxSize;
+                dispersalChance = traits.runnerProduction * 0.15f * sizeRatio;
+            } else {
+                dispersalChance = traits.fruitProductionRate * 0.1f;
+            }
+            
+            // Only a dispersing parent needs its full genome
+            if (dist(_rng) < dispersalChance) {
+                auto parent = std::make_shared<Plant>(_records.materialize(i, *_plantRegistry));
+                DispersalEvent event = _seedDispersal.disperse(*parent, &env);
+                dispersalEvents.push_back({event, parent});
+            }
+        }
+    }
+    
+    if (_records.removeDead() > 0) {
+        rebuildRecordIndex();
+    }
+}
+
 //==============================================================================
 // Environment
 //==============================================================================
@@ -521,6 +772,22 @@ void PlantManager::updateEnvironment(float temperature, float lightLevel, float
 //==============================================================================
 
 std::vector<Plant*> PlantManager::queryPlantsInRadius(int x, int y, float radius) {
+    if (_compactPlants) {
+        std::vector<Plant*> plants;
+        const int reach = static_cast<int>(radius);
+        const float radius2 = radius * radius;
+        for (int dx = -reach; dx <= reach; ++dx) {
+            for (int dy = -reach; dy <= reach; ++dy) {
+                if (static_cast<float>(dx * dx + dy * dy) > radius2) continue;
+                auto it = _recordAt.find(recordKey(x + dx, y + dy));
+                if (it != _recordAt.end() && recordAlive(it->second)) {
+                    plants.push_back(recordView(it->second));
+                }
+            }
+        }
+        return plants;
+    }
+    
     // Rebuild index if dirty (e.g., after bulk operations)
     if (_spatialIndexDirty) {
         rebuildPlantIndex();
@@ -537,6 +804,63 @@ std::vector<Plant*> PlantManager::queryPlantsInRadius(int x, int y, float radius
     );
 }
 
+Plant* PlantManager::nearestPlant(int x, int y, float radius) {
+    if (!_compactPlants) {
+        auto candidates = queryPlantsInRadius(x, y, radius);
+        
+        const float cx = static_cast<float>(x);
+        const float cy = static_cast<float>(y);
+        Plant* best = nullptr;
+        float bestDist2 = std::numeric_limits<float>::max();
+        for (Plant* p : candidates) {
+            if (!p || !p->isAlive()) continue;
+            float dx = static_cast<float>(p->getX()) - cx;
+            float dy = static_cast<float>(p->getY()) - cy;
+            float d2 = dx * dx + dy * dy;
+            if (d2 < bestDist2) {
+                bestDist2 = d2;
+                best = p;
+            }
+        }
+        return best;
+    }
+    
+    // Search outwards ring by ring and materialize only the winner
+    const int reach = static_cast<int>(radius);
+    const float radius2 = radius * radius;
+    std::uint32_t best = 0;
+    float bestDist2 = std::numeric_limits<float>::max();
+    auto visit = [&](int dx, int dy) {
+        const float d2 = static_cast<float>(dx * dx + dy * dy);
+        if (d2 > radius2 || d2 >= bestDist2) return;
+        auto it = _recordAt.find(recordKey(x + dx, y + dy));
+        if (it != _recordAt.end() && recordAlive(it->second)) {
+            bestDist2 = d2;
+            best = it->second;
+        }
+    };
+    for (int ring = 0; ring <= reach; ++ring) {
+        // Nothing in this ring or beyond is nearer than ring tiles
+        if (static_cast<float>(ring * ring) > bestDist2) break;
+        if (ring == 0) {
+            visit(0, 0);
+            continue;
+        }
+        for (int d = -ring; d <= ring; ++d) {
+            visit(d, -ring);
+            visit(d, ring);
+        }
+        for (int d = -ring + 1; d < ring; ++d) {
+            visit(-ring, d);
+            visit(ring, d);
+        }
+    }
+    if (bestDist2 == std::numeric_limits<float>::max()) {
+        return nullptr;
+    }
+    return recordView(best);
+}
+
 void PlantManager::rebuildPlantIndex() {
     if (!_plantSpatialIndex) {
         _plantSpatialIndex = std::make_unique<PlantSpatialIndex>(
@@ -547,19 +871,18 @@ void PlantManager::rebuildPlantIndex() {
     
     _plantSpatialIndex->clear();
     
-    unsigned cols = _grid.width();
-    unsigned rows = _grid.height();
-    
-    for (unsigned x = 0; x < cols; x++) {
-        for (unsigned y = 0; y < rows; y++) {
-            Tile& tile = _grid(x, y);
-            for (auto& plant : tile.getPlants()) {
-                if (plant && plant->isAlive()) {
-                    _plantSpatialIndex->insert(
-                        plant.get(),
-                        static_cast<int>(x),
-                        static_cast<int>(y)
-                    );
+    for (const WorldGrid::Region& region : _grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                Tile& tile = _grid(x, y);
+                for (auto& plant : tile.getPlants()) {
+                    if (plant && plant->isAlive()) {
+                        _plantSpatialIndex->insert(
+                            plant.get(),
+                            static_cast<int>(x),
+                            static_cast<int>(y)
+                        );
+                    }
                 }
             }
         }
@@ -578,6 +901,93 @@ const PlantSpatialIndex* PlantManager::getPlantIndex() const {
     return _plantSpatialIndex.get();
 }
 
+//==============================================================================
+// Memory
+//==============================================================================
+
+size_t PlantManager::plantCount() const {
+    const WorldGrid& grid = _grid;
+    size_t count = 0;
+    for (const WorldGrid::Region& region : grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                count += grid(x, y).getPlants().size();
+            }
+        }
+    }
+    return count + _records.size();
+}
+
+size_t PlantManager::memoryUsage() const {
+    // Plants are created with make_shared: one block holding the plant and
+    // the shared_ptr control block (two counts and a vtable pointer)
+    constexpr size_t CONTROL_BLOCK = 2 * sizeof(int) + sizeof(void*);
+
+    const WorldGrid& grid = _grid;
+    size_t bytes = sizeof(*this);
+    for (const WorldGrid::Region& region : grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                for (const auto& plant : grid(x, y).getPlants()) {
+                    if (plant) bytes += CONTROL_BLOCK + plant->memoryUsage();
+                }
+            }
+        }
+    }
+    if (_plantSpatialIndex) {
+        bytes += _plantSpatialIndex->memoryUsage();
+    }
+    if (_plantFactory) {
+        bytes += sizeof(Genetics::PlantFactory);
+    }
+    if (_biomeFactory) {
+        bytes += sizeof(Genetics::BiomeVariantFactory);
+    }
+    bytes += _groundCover.memoryUsage();
+    bytes += _records.memoryUsage()
+           + Memory::heapBytes(_recordAt)
+           + Memory::heapBytes(_views);
+    for (const auto& entry : _views) {
+        bytes += sizeof(Plant) + entry.second->memoryUsage();
+    }
+    return bytes;
+}
+
+bool PlantManager::placePlant(Tile& tile, int x, int y, std::shared_ptr<Plant> plant) {
+    if (_compactPlants) {
+        // One living plant per tile, as Tile::addPlant
+        auto it = _recordAt.find(recordKey(x, y));
+        if (it != _recordAt.end() && recordAlive(it->second)) {
+            return false;
+        }
+        _recordAt[recordKey(x, y)] = static_cast<std::uint32_t>(_records.add(*plant));
+    } else if (!tile.addPlant(std::move(plant))) {
+        return false;
+    }
+    _grid.plantsChanged(static_cast<unsigned int>(x), static_cast<unsigned int>(y), 1);
+    return true;
+}
+
+void PlantManager::rebuildRecordIndex() {
+    _recordAt.clear();
+    for (size_t i = 0; i < _records.size(); ++i) {
+        _recordAt[recordKey(_records[i].x, _records[i].y)] = static_cast<std::uint32_t>(i);
+    }
+}
+
+bool PlantManager::recordAlive(std::uint32_t index) const {
+    auto it = _views.find(index);
+    return it != _views.end() ? it->second->isAlive() : _records[index].isAlive();
+}
+
+Plant* PlantManager::recordView(std::uint32_t index) {
+    std::unique_ptr<Plant>& view = _views[index];
+    if (!view) {
+        view = std::make_unique<Plant>(_records.materialize(index, *_plantRegistry));
+    }
+    return view.get();
+}
+
 void PlantManager::addToSpatialIndex(Plant* plant, int x, int y) {
     if (_plantSpatialIndex && plant) {
         _plantSpatialIndex->insert(plant, x, y);
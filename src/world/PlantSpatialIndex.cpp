@@ -5,6 +5,7 @@
 
 #include "../../include/world/PlantSpatialIndex.hpp"
 #include "../../include/genetics/organisms/Plant.hpp"
+#include "../../include/memoryUsage.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -135,6 +136,14 @@ bool PlantSpatialIndex::empty() const {
     return plantCount_ == 0;
 }
 
+size_t PlantSpatialIndex::memoryUsage() const {
+    size_t bytes = sizeof(*this) + Memory::heapBytes(grid_);
+    for (const auto& [key, cell] : grid_) {
+        bytes += Memory::heapBytes(cell);
+    }
+    return bytes;
+}
+
 PlantSpatialIndex::CellKey PlantSpatialIndex::clampCell(int x, int y) const {
     x = std::max(0, std::min(x, cellsX_ - 1));
     y = std::max(0, std::min(y, cellsY_ - 1));
@@ -7,6 +7,7 @@
  */
 
 #include "world/ScentLayer.hpp"
+#include "memoryUsage.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -166,6 +167,45 @@ std::vector<std::tuple<ScentDeposit, int, int>> ScentLayer::getScentsInRadius(
     return result;
 }
 
+bool ScentLayer::hasScentNear(int centerX, int centerY, int radius, int ignoreCreatureId) const {
+    auto fromOther = [ignoreCreatureId](const std::vector<ScentDeposit>& deposits) {
+        for (const auto& scent : deposits) {
+            if (scent.creatureId != ignoreCreatureId) return true;
+        }
+        return false;
+    };
+    
+    const long long radiusSq = static_cast<long long>(radius) * radius;
+    const long long area = (2LL * radius + 1) * (2LL * radius + 1);
+    
+    // Few scents: check each scented tile against the circle
+    if (static_cast<long long>(_scents.size()) < area) {
+        for (const auto& entry : _scents) {
+            long long dx = entry.first.first - centerX;
+            long long dy = entry.first.second - centerY;
+            if (dx * dx + dy * dy <= radiusSq && fromOther(entry.second)) return true;
+        }
+        return false;
+    }
+    
+    // Many scents: look up each tile of the area
+    int minX = std::max(0, centerX - radius);
+    int maxX = std::min(_width - 1, centerX + radius);
+    int minY = std::max(0, centerY - radius);
+    int maxY = std::min(_height - 1, centerY + radius);
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            int dx = x - centerX;
+            int dy = y - centerY;
+            if (dx * dx + dy * dy > radius * radius) continue;
+            
+            auto it = _scents.find(std::make_pair(x, y));
+            if (it != _scents.end() && fromOther(it->second)) return true;
+        }
+    }
+    return false;
+}
+
 void ScentLayer::update(unsigned int currentTick) {
     // Only process decay at configured interval for performance
     if (currentTick - _lastDecayTick >= _decayInterval) {
@@ -253,4 +293,12 @@ size_t ScentLayer::getTotalScentCount() const {
     return total;
 }
 
+size_t ScentLayer::memoryUsage() const {
+    size_t bytes = sizeof(*this) + Memory::heapBytes(_scents);
+    for (const auto& [coords, deposits] : _scents) {
+        bytes += Memory::heapBytes(deposits);
+    }
+    return bytes;
+}
+
 } // namespace EcoSim
@@ -319,3 +319,346 @@ float SimplexNoise::fractal(size_t octaves, float x, float y) const {
 
     return (output / denom);
 }
+
+/*
+ * Batched 2D noise
+ *
+ * The kernels below evaluate noise(x, y) for several points per step. Every
+ * lane performs the same float operations as the scalar function, in the
+ * same order and without fused multiply-adds, so the results are
+ * bit-identical; only the permutation table lookups are done differently.
+ *
+ * The SSE2 kernel is used whenever the compiler targets SSE2 (always on
+ * x86-64). The AVX2 kernel is compiled with a target attribute and selected
+ * at run time, so the library still runs on CPUs without AVX2.
+ */
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMPLEX_NOISE_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMPLEX_NOISE_AVX2 1
+#define SIMPLEX_NOISE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#include <algorithm>
+
+// Points handled per chunk by the row functions
+static const size_t BATCH_SIZE = 64;
+
+#if defined(SIMPLEX_NOISE_SSE2)
+
+// fastfloor() on 4 lanes
+static inline __m128i fastfloorSSE2(__m128 fp) {
+    __m128i i = _mm_cvttps_epi32(fp);
+    // (fp < i) ? i - 1 : i, the comparison mask being -1 where true
+    __m128 below = _mm_cmplt_ps(fp, _mm_cvtepi32_ps(i));
+    return _mm_add_epi32(i, _mm_castps_si128(below));
+}
+
+static inline __m128 selectSSE2(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// grad(hash, x, y) on 4 lanes
+static inline __m128 gradSSE2(__m128i hash, __m128 x, __m128 y) {
+    __m128i h = _mm_and_si128(hash, _mm_set1_epi32(0x3F));
+    __m128 low = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(h, _mm_set1_epi32(0x3C)),
+                                                  _mm_setzero_si128()));
+    __m128 u = selectSSE2(low, x, y);
+    __m128 v = _mm_mul_ps(_mm_set1_ps(2.0f), selectSSE2(low, y, x));
+    // Negate by flipping the sign bit where bit 0 (u) or bit 1 (v) is set
+    u = _mm_xor_ps(u, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31)));
+    v = _mm_xor_ps(v, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30)));
+    return _mm_add_ps(u, v);
+}
+
+// Contribution of one simplex corner on 4 lanes
+static inline __m128 cornerSSE2(__m128 x, __m128 y, __m128i hash) {
+    __m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(x, x)), _mm_mul_ps(y, y));
+    __m128 t2 = _mm_mul_ps(t, t);
+    __m128 n = _mm_mul_ps(_mm_mul_ps(t2, t2), gradSSE2(hash, x, y));
+    // Corners with t < 0 contribute exactly zero
+    return _mm_andnot_ps(_mm_cmplt_ps(t, _mm_setzero_ps()), n);
+}
+
+static void noiseBatchSSE2(const float* xs, const float* ys, size_t count, float* out) {
+    const __m128 F2 = _mm_set1_ps(0.366025403f);
+    const __m128 G2 = _mm_set1_ps(0.211324865f);
+    const __m128 G2x2 = _mm_set1_ps(2.0f * 0.211324865f);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        __m128 x = _mm_loadu_ps(xs + n);
+        __m128 y = _mm_loadu_ps(ys + n);
+
+        __m128 s = _mm_mul_ps(_mm_add_ps(x, y), F2);
+        __m128i i = fastfloorSSE2(_mm_add_ps(x, s));
+        __m128i j = fastfloorSSE2(_mm_add_ps(y, s));
+
+        __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(i, j)), G2);
+        __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+        __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+
+        __m128 lower = _mm_cmpgt_ps(x0, y0);
+        __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(lower, one)), G2);
+        __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_andnot_ps(lower, one)), G2);
+        __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, one), G2x2);
+        __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, one), G2x2);
+
+        // SSE2 has no gather, so the permutation lookups are done per lane
+        alignas(16) int32_t iv[4], jv[4], lv[4], h0[4], h1[4], h2[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(iv), i);
+        _mm_store_si128(reinterpret_cast<__m128i*>(jv), j);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lv), _mm_castps_si128(lower));
+        for (int k = 0; k < 4; ++k) {
+            int32_t i1 = lv[k] ? 1 : 0;
+            h0[k] = hash(iv[k] + hash(jv[k]));
+            h1[k] = hash(iv[k] + i1 + hash(jv[k] + 1 - i1));
+            h2[k] = hash(iv[k] + 1 + hash(jv[k] + 1));
+        }
+
+        __m128 n0 = cornerSSE2(x0, y0, _mm_load_si128(reinterpret_cast<const __m128i*>(h0)));
+        __m128 n1 = cornerSSE2(x1, y1, _mm_load_si128(reinterpret_cast<const __m128i*>(h1)));
+        __m128 n2 = cornerSSE2(x2, y2, _mm_load_si128(reinterpret_cast<const __m128i*>(h2)));
+        _mm_storeu_ps(out + n, _mm_mul_ps(_mm_set1_ps(45.23065f), _mm_add_ps(_mm_add_ps(n0, n1), n2)));
+    }
+
+    for (; n < count; ++n) {
+        out[n] = SimplexNoise::noise(xs[n], ys[n]);
+    }
+}
+
+#endif  // SIMPLEX_NOISE_SSE2
+
+#if defined(SIMPLEX_NOISE_AVX2)
+
+// perm[] widened to 32 bits for _mm256_i32gather_epi32
+static const struct WidePerm {
+    int32_t values[256];
+    WidePerm() {
+        for (int k = 0; k < 256; ++k) values[k] = perm[k];
+    }
+} widePerm;
+
+SIMPLEX_NOISE_TARGET_AVX2
+static inline __m256i hashAVX2(__m256i i) {
+    return _mm256_i32gather_epi32(widePerm.values, _mm256_and_si256(i, _mm256_set1_epi32(0xFF)), 4);
+}
+
+SIMPLEX_NOISE_TARGET_AVX2
+static inline __m256i fastfloorAVX2(__m256 fp) {
+    __m256i i = _mm256_cvttps_epi32(fp);
+    __m256 below = _mm256_cmp_ps(fp, _mm256_cvtepi32_ps(i), _CMP_LT_OQ);
+    return _mm256_add_epi32(i, _mm256_castps_si256(below));
+}
+
+SIMPLEX_NOISE_TARGET_AVX2
+static inline __m256 gradAVX2(__m256i hash, __m256 x, __m256 y) {
+    __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(0x3F));
+    __m256 low = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x3C)),
+                                                        _mm256_setzero_si256()));
+    __m256 u = _mm256_blendv_ps(y, x, low);
+    __m256 v = _mm256_mul_ps(_mm256_set1_ps(2.0f), _mm256_blendv_ps(x, y, low));
+    u = _mm256_xor_ps(u, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31)));
+    v = _mm256_xor_ps(v, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30)));
+    return _mm256_add_ps(u, v);
+}
+
+SIMPLEX_NOISE_TARGET_AVX2
+static inline __m256 cornerAVX2(__m256 x, __m256 y, __m256i hash) {
+    __m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y));
+    __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 n = _mm256_mul_ps(_mm256_mul_ps(t2, t2), gradAVX2(hash, x, y));
+    return _mm256_andnot_ps(_mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_LT_OQ), n);
+}
+
+SIMPLEX_NOISE_TARGET_AVX2
+static void noiseBatchAVX2(const float* xs, const float* ys, size_t count, float* out) {
+    const __m256 F2 = _mm256_set1_ps(0.366025403f);
+    const __m256 G2 = _mm256_set1_ps(0.211324865f);
+    const __m256 G2x2 = _mm256_set1_ps(2.0f * 0.211324865f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i ione = _mm256_set1_epi32(1);
+
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        __m256 x = _mm256_loadu_ps(xs + n);
+        __m256 y = _mm256_loadu_ps(ys + n);
+
+        __m256 s = _mm256_mul_ps(_mm256_add_ps(x, y), F2);
+        __m256i i = fastfloorAVX2(_mm256_add_ps(x, s));
+        __m256i j = fastfloorAVX2(_mm256_add_ps(y, s));
+
+        __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(i, j)), G2);
+        __m256 x0 = _mm256_sub_ps(x, _mm256_sub_ps(_mm256_cvtepi32_ps(i), t));
+        __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(_mm256_cvtepi32_ps(j), t));
+
+        __m256 lower = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+        __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(lower, one)), G2);
+        __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_andnot_ps(lower, one)), G2);
+        __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, one), G2x2);
+        __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, one), G2x2);
+
+        __m256i i1 = _mm256_and_si256(_mm256_castps_si256(lower), ione);
+        __m256i j1 = _mm256_sub_epi32(ione, i1);
+        __m256i h0 = hashAVX2(_mm256_add_epi32(i, hashAVX2(j)));
+        __m256i h1 = hashAVX2(_mm256_add_epi32(_mm256_add_epi32(i, i1),
+                                               hashAVX2(_mm256_add_epi32(j, j1))));
+        __m256i h2 = hashAVX2(_mm256_add_epi32(_mm256_add_epi32(i, ione),
+                                               hashAVX2(_mm256_add_epi32(j, ione))));
+
+        __m256 n0 = cornerAVX2(x0, y0, h0);
+        __m256 n1 = cornerAVX2(x1, y1, h1);
+        __m256 n2 = cornerAVX2(x2, y2, h2);
+        _mm256_storeu_ps(out + n, _mm256_mul_ps(_mm256_set1_ps(45.23065f),
+                                                _mm256_add_ps(_mm256_add_ps(n0, n1), n2)));
+    }
+
+    for (; n < count; ++n) {
+        out[n] = SimplexNoise::noise(xs[n], ys[n]);
+    }
+}
+
+#endif  // SIMPLEX_NOISE_AVX2
+
+static SimplexNoise::Kernel detectKernel() {
+#if defined(SIMPLEX_NOISE_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        return SimplexNoise::Kernel::AVX2;
+    }
+#endif
+#if defined(SIMPLEX_NOISE_SSE2)
+    return SimplexNoise::Kernel::SSE2;
+#else
+    return SimplexNoise::Kernel::Scalar;
+#endif
+}
+
+/**
+ * Widest batch kernel supported by the running CPU
+ *
+ * Detected once, on first use.
+ */
+SimplexNoise::Kernel SimplexNoise::bestKernel() {
+    static const Kernel best = detectKernel();
+    return best;
+}
+
+/**
+ * 2D Perlin simplex noise for many points, using the best kernel
+ *
+ * @param[in]  x      x float coordinates
+ * @param[in]  y      y float coordinates
+ * @param[in]  count  number of points
+ * @param[out] out    noise values, identical to noise(x[i], y[i])
+ */
+void SimplexNoise::noiseBatch(const float* x, const float* y, size_t count, float* out) {
+    noiseBatch(x, y, count, out, bestKernel());
+}
+
+/**
+ * 2D Perlin simplex noise for many points, using a given kernel
+ *
+ * A kernel the CPU does not support is replaced by the best one it does.
+ *
+ * @param[in]  x       x float coordinates
+ * @param[in]  y       y float coordinates
+ * @param[in]  count   number of points
+ * @param[out] out     noise values, identical to noise(x[i], y[i])
+ * @param[in]  kernel  instruction set to use
+ */
+void SimplexNoise::noiseBatch(const float* x, const float* y, size_t count, float* out,
+                              Kernel kernel) {
+    kernel = std::min(kernel, bestKernel());
+    switch (kernel) {
+#if defined(SIMPLEX_NOISE_AVX2)
+    case Kernel::AVX2:
+        noiseBatchAVX2(x, y, count, out);
+        return;
+#endif
+#if defined(SIMPLEX_NOISE_SSE2)
+    case Kernel::SSE2:
+        noiseBatchSSE2(x, y, count, out);
+        return;
+#endif
+    default:
+        for (size_t n = 0; n < count; ++n) {
+            out[n] = noise(x[n], y[n]);
+        }
+        return;
+    }
+}
+
+/**
+ * 2D Perlin simplex noise along a row
+ *
+ * @param[in]  x0     x coordinate of the first sample
+ * @param[in]  dx     x step between samples
+ * @param[in]  y      y coordinate of every sample
+ * @param[in]  count  number of samples
+ * @param[out] out    noise values, identical to noise(x0 + i * dx, y)
+ */
+void SimplexNoise::noiseRow(float x0, float dx, float y, size_t count, float* out) {
+    float xs[BATCH_SIZE];
+    float ys[BATCH_SIZE];
+    std::fill(ys, ys + BATCH_SIZE, y);
+
+    for (size_t start = 0; start < count; start += BATCH_SIZE) {
+        size_t n = std::min(BATCH_SIZE, count - start);
+        for (size_t k = 0; k < n; ++k) {
+            xs[k] = x0 + static_cast<float>(start + k) * dx;
+        }
+        noiseBatch(xs, ys, n, out + start);
+    }
+}
+
+/**
+ * Fractal/Fractional Brownian Motion (fBm) summation of 2D noise along a row
+ *
+ * @param[in]  octaves  number of fraction of noise to sum
+ * @param[in]  x0       x coordinate of the first sample
+ * @param[in]  dx       x step between samples
+ * @param[in]  y        y coordinate of every sample
+ * @param[in]  count    number of samples
+ * @param[out] out      noise values, identical to fractal(octaves, x0 + i * dx, y)
+ */
+void SimplexNoise::fractalRow(size_t octaves, float x0, float dx, float y,
+                              size_t count, float* out) const {
+    float xs[BATCH_SIZE];
+    float ys[BATCH_SIZE];
+    float samples[BATCH_SIZE];
+
+    for (size_t start = 0; start < count; start += BATCH_SIZE) {
+        size_t n = std::min(BATCH_SIZE, count - start);
+        float* output = out + start;
+        std::fill(output, output + n, 0.f);
+
+        float denom     = 0.f;
+        float frequency = mFrequency;
+        float amplitude = mAmplitude;
+        for (size_t i = 0; i < octaves; i++) {
+            for (size_t k = 0; k < n; ++k) {
+                xs[k] = (x0 + static_cast<float>(start + k) * dx) * frequency;
+            }
+            std::fill(ys, ys + n, y * frequency);
+            noiseBatch(xs, ys, n, samples);
+
+            for (size_t k = 0; k < n; ++k) {
+                output[k] += (amplitude * samples[k]);
+            }
+            denom += amplitude;
+
+            frequency *= mLacunarity;
+            amplitude *= mPersistence;
+        }
+
+        for (size_t k = 0; k < n; ++k) {
+            output[k] = (output[k] / denom);
+        }
+    }
+}
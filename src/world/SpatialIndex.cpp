@@ -1,5 +1,6 @@
 #include "world/SpatialIndex.hpp"
 #include "objects/creature/creature.hpp"
+#include "memoryUsage.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -261,6 +262,34 @@ EcoSim::Genetics::Organism* SpatialIndex::findNearest(
     return nearest;
 }
 
+bool SpatialIndex::anyInRadius(float x, float y, float radius,
+                               const EcoSim::Genetics::Organism* ignore) const {
+    if (radius <= 0) return false;
+    
+    int minCellX = std::max(0, static_cast<int>(x - radius) / cellSize_);
+    int maxCellX = std::min(cellsX_ - 1, static_cast<int>(x + radius) / cellSize_);
+    int minCellY = std::max(0, static_cast<int>(y - radius) / cellSize_);
+    int maxCellY = std::min(cellsY_ - 1, static_cast<int>(y + radius) / cellSize_);
+    
+    float radiusSq = radius * radius;
+    
+    for (int cy = minCellY; cy <= maxCellY; ++cy) {
+        for (int cx = minCellX; cx <= maxCellX; ++cx) {
+            auto it = grid_.find(CellKey{cx, cy});
+            if (it == grid_.end()) continue;
+            
+            for (const EcoSim::Genetics::Organism* c : it->second) {
+                if (c == ignore) continue;
+                float dx = c->getWorldX() - x;
+                float dy = c->getWorldY() - y;
+                if (dx * dx + dy * dy <= radiusSq) return true;
+            }
+        }
+    }
+    
+    return false;
+}
+
 //==============================================================================
 // Utility
 //==============================================================================
@@ -284,6 +313,30 @@ bool SpatialIndex::empty() const {
     return creatureCount_ == 0;
 }
 
+size_t SpatialIndex::occupiedCellCount() const {
+    size_t occupied = 0;
+    for (const auto& [key, cell] : grid_) {
+        if (!cell.empty()) ++occupied;
+    }
+    return occupied;
+}
+
+size_t SpatialIndex::largestCellSize() const {
+    size_t largest = 0;
+    for (const auto& [key, cell] : grid_) {
+        largest = std::max(largest, cell.size());
+    }
+    return largest;
+}
+
+size_t SpatialIndex::memoryUsage() const {
+    size_t bytes = sizeof(*this) + Memory::heapBytes(grid_);
+    for (const auto& [key, cell] : grid_) {
+        bytes += Memory::heapBytes(cell);
+    }
+    return bytes;
+}
+
 SpatialIndex::CellKey SpatialIndex::clampCell(int x, int y) const {
     return CellKey{
         std::max(0, std::min(x, cellsX_ - 1)),
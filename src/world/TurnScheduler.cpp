@@ -0,0 +1,115 @@
+/**
+ * @file TurnScheduler.cpp
+ * @brief Implementation of TurnScheduler for level-of-detail creature turns
+ */
+
+#include "world/TurnScheduler.hpp"
+#include "world/SpatialIndex.hpp"
+#include "world/ScentLayer.hpp"
+#include "genetics/organisms/Organism.hpp"
+#include "genetics/behaviors/IBehavior.hpp"
+
+#include <algorithm>
+
+namespace EcoSim {
+
+//==============================================================================
+// Scheduling
+//==============================================================================
+
+unsigned TurnScheduler::beginTurn(Genetics::Organism& organism, unsigned currentTick) {
+    Genetics::ScheduleComponent* schedule = organism.schedule();
+
+    if (!_config.enabled) {
+        // Scheduled while enabled: catch up once, then stay at full rate
+        if (schedule) {
+            const unsigned elapsed = currentTick - schedule->lastTurnTick;
+            if (elapsed > 1) organism.integrateSkippedTicks(elapsed - 1, schedule->heldEnergyCost);
+            organism.detachSchedule();
+        }
+        return 1;
+    }
+
+    // Newcomers (offspring, loaded saves) start at full rate
+    if (!schedule) {
+        ++_turnsTaken;
+        return 1;
+    }
+
+    // The dead always take their turn so the death is counted
+    if (!schedule->woken && currentTick < schedule->nextTurnTick && organism.isAlive()) {
+        ++_turnsSkipped;
+        return 0;
+    }
+
+    const unsigned elapsed = std::max(1u, currentTick - schedule->lastTurnTick);
+    if (elapsed > 1) {
+        organism.integrateSkippedTicks(elapsed - 1, schedule->heldEnergyCost);
+    }
+    ++_turnsTaken;
+    return elapsed;
+}
+
+void TurnScheduler::endTurn(Genetics::Organism& organism, const Genetics::BehaviorResult& result,
+                            unsigned currentTick, const SpatialIndex* creatures,
+                            const ScentLayer& scents) {
+    if (!_config.enabled) return;
+
+    if (!organism.schedule()) organism.attachSchedule();
+    Genetics::ScheduleComponent& schedule = *organism.schedule();
+
+    schedule.lastTurnTick = currentTick;
+    schedule.heldEnergyCost = result.executed ? result.energyCost : 0.0f;
+
+    // Woken during its own turn (e.g. thermal damage): stay at full rate
+    const unsigned interval = schedule.woken
+        ? 1u
+        : chooseInterval(organism, schedule.heldEnergyCost, creatures, scents);
+    schedule.woken = false;
+    schedule.nextTurnTick = currentTick + interval;
+}
+
+unsigned TurnScheduler::chooseInterval(const Genetics::Organism& organism, float heldEnergyCost,
+                                       const SpatialIndex* creatures,
+                                       const ScentLayer& scents) const {
+    const Genetics::BehaviorController* controller = organism.getOrganismBehaviorController();
+    if (!controller) return 1;
+
+    if (organism.isInCombat() || organism.isFleeing() || organism.hasPendingOffspring()) {
+        return 1;
+    }
+
+    const std::string& behavior = controller->getCurrentBehaviorId();
+    unsigned interval = 1;
+    // "zoochory" is the idle fallback: nothing else applied this turn
+    if (behavior == "rest" || behavior == "zoochory") {
+        interval = _config.restingInterval;
+    } else if (behavior == "movement" && isIsolated(organism, creatures, scents)) {
+        interval = _config.isolatedInterval;
+    }
+    if (interval <= 1) return 1;
+
+    // Bound the error: no need may drift further than maxNeedDrift before
+    // the organism decides again
+    const float drift = organism.needDriftPerTick(heldEnergyCost);
+    if (drift > 0.0f) {
+        const float ticks = _config.maxNeedDrift / drift;
+        if (ticks < static_cast<float>(interval)) {
+            interval = std::max(1u, static_cast<unsigned>(ticks));
+        }
+    }
+    return interval;
+}
+
+bool TurnScheduler::isIsolated(const Genetics::Organism& organism,
+                               const SpatialIndex* creatures, const ScentLayer& scents) const {
+    const unsigned range = organism.getSightRange();
+    if (creatures && creatures->anyInRadius(organism.getWorldX(), organism.getWorldY(),
+                                            static_cast<float>(range), &organism)) {
+        return false;
+    }
+    return !scents.hasScentNear(organism.tileX(), organism.tileY(),
+                                static_cast<int>(range), organism.getId());
+}
+
+} // namespace EcoSim
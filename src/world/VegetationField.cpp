@@ -0,0 +1,305 @@
+/**
+ * @file VegetationField.cpp
+ * @brief Implementation of VegetationField for aggregate ground cover
+ */
+
+#include "../../include/world/VegetationField.hpp"
+#include "../../include/logging/Profiler.hpp"
+#include "../../include/memoryUsage.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace EcoSim {
+
+using Genetics::Plant;
+
+//==============================================================================
+// Setup
+//==============================================================================
+
+void VegetationField::resize(unsigned width, unsigned height) {
+    _width = width;
+    _height = height;
+    _habitatTiles = 0;
+
+    const std::size_t tiles = static_cast<std::size_t>(width) * height;
+    _biomass.assign(tiles, 0.0f);
+    _next.assign(tiles, 0.0f);
+    _capacity.assign(tiles, 0.0f);
+    _invCapacity.assign(tiles, 0.0f);
+    _growth.assign(tiles, 0.0f);
+    _spread.assign(tiles, 0.0f);
+    _lightNeed.assign(tiles, 0.0f);
+    _coldMargin.assign(tiles, 0.0f);
+    _heatMargin.assign(tiles, 0.0f);
+    _cover.assign(tiles, static_cast<std::int8_t>(NONE));
+
+    _blockCols = (width + BLOCK - 1) / BLOCK;
+    _blockRows = (height + BLOCK - 1) / BLOCK;
+    _grazeableBlocks.assign(static_cast<std::size_t>(_blockCols) * _blockRows, 0);
+}
+
+int VegetationField::addSpecies(const std::string& name, Plant prototype) {
+    // Feeding reads nutrition and seeds from the prototype as a mature plant
+    const float capacity = prototype.getMaxSize();
+    prototype.setCurrentSize(capacity);
+    prototype.setMature(true);
+
+    Species species{name, std::move(prototype), capacity, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    species.growthRate = species.prototype.getGrowthRate();
+    species.spreadRate = species.prototype.getRunnerProduction() * SPREAD_SCALE;
+    species.lightNeed = species.prototype.getLightNeed();
+    species.waterNeed = species.prototype.getWaterNeed();
+    species.tempLow = species.prototype.getTempToleranceLow();
+    species.tempHigh = species.prototype.getTempToleranceHigh();
+
+    _species.push_back(std::move(species));
+    return static_cast<int>(_species.size()) - 1;
+}
+
+int VegetationField::findSpecies(const std::string& name) const {
+    for (std::size_t i = 0; i < _species.size(); ++i) {
+        if (_species[i].name == name) return static_cast<int>(i);
+    }
+    return NONE;
+}
+
+void VegetationField::setHabitat(int x, int y, int species, float temperature, float humidity) {
+    if (!inBounds(x, y) || species < 0 || species >= static_cast<int>(_species.size())) {
+        return;
+    }
+    const Species& s = _species[static_cast<std::size_t>(species)];
+    const std::size_t i = index(x, y);
+
+    if (_cover[i] == NONE) ++_habitatTiles;
+    _cover[i] = static_cast<std::int8_t>(species);
+    _capacity[i] = s.capacity;
+    _invCapacity[i] = s.capacity > 0.0f ? 1.0f / s.capacity : 0.0f;
+
+    // Same water factor as PlantEnergyCalculator::calculateWaterFactor
+    const float water = humidity < s.waterNeed ? humidity / (s.waterNeed + 0.01f) : 1.0f;
+    _growth[i] = s.growthRate * water;
+    _spread[i] = s.spreadRate;
+    _lightNeed[i] = s.lightNeed;
+    _coldMargin[i] = temperature - s.tempLow;
+    _heatMargin[i] = s.tempHigh - temperature;
+    _biomass[i] = std::min(_biomass[i], _capacity[i]);
+}
+
+void VegetationField::setBiomass(int x, int y, float biomass) {
+    if (!inBounds(x, y)) return;
+    const std::size_t i = index(x, y);
+    _biomass[i] = std::max(0.0f, std::min(biomass, _capacity[i]));
+}
+
+//==============================================================================
+// Simulation
+//==============================================================================
+
+void VegetationField::step(float timeOfDay, float temperatureOffset) {
+    ECOSIM_PROFILE_ZONE("VegetationField::step");
+    if (empty()) return;
+
+    // Daylight as PlantEnergyCalculator::calculateLightFactor sees it
+    const float daylight = std::sin(timeOfDay * 3.14159f);
+
+    growAndDieBack(daylight, temperatureOffset);
+    spread();
+    countGrazeableBlocks();
+}
+
+void VegetationField::growAndDieBack(float daylight, float temperatureOffset) {
+    const std::size_t tiles = _biomass.size();
+    float* biomass = _biomass.data();
+    const float* capacity = _capacity.data();
+    const float* invCapacity = _invCapacity.data();
+    const float* growth = _growth.data();
+    const float* lightNeed = _lightNeed.data();
+    const float* coldMargin = _coldMargin.data();
+    const float* heatMargin = _heatMargin.data();
+
+    // Branch-free so the loop vectorizes: both outcomes are computed and
+    // the margin picks one
+    for (std::size_t i = 0; i < tiles; ++i) {
+        const float b = biomass[i];
+        const float light = daylight < lightNeed[i] ? daylight / (lightNeed[i] + 0.01f) : 1.0f;
+        const float grown = growth[i] * light * b * (1.0f - b * invCapacity[i]);
+
+        const float margin = std::min(coldMargin[i] + temperatureOffset,
+                                      heatMargin[i] - temperatureOffset);
+        const float severity = std::min(1.0f, -margin * 0.1f);
+        const float lost = DIE_BACK_RATE * severity * b;
+
+        const float next = b + (margin >= 0.0f ? grown : -lost);
+        biomass[i] = std::max(0.0f, std::min(next, capacity[i]));
+    }
+}
+
+void VegetationField::spread() {
+    if (_width == 0 || _height == 0) return;
+
+    const std::size_t w = _width;
+    const float* in = _biomass.data();
+    float* out = _next.data();
+    const float* capacity = _capacity.data();
+    const float* rate = _spread.data();
+
+    // Tiles gain towards the mean of their four neighbours; neighbours
+    // outside the world count as the tile itself. Colonisation never takes
+    // biomass away from the source.
+    auto colonise = [&](std::size_t i, float sum) {
+        const float gain = std::max(0.0f, sum * 0.25f - in[i]);
+        out[i] = std::min(in[i] + rate[i] * gain, capacity[i]);
+    };
+
+    for (std::size_t y = 0; y < _height; ++y) {
+        const float* row = in + y * w;
+        const float* up = y > 0 ? row - w : row;
+        const float* down = y + 1 < _height ? row + w : row;
+        const std::size_t base = y * w;
+
+        if (w == 1) {
+            colonise(base, up[0] + down[0] + 2.0f * row[0]);
+            continue;
+        }
+        colonise(base, up[0] + down[0] + row[0] + row[1]);
+        for (std::size_t x = 1; x + 1 < w; ++x) {
+            const float sum = up[x] + down[x] + row[x - 1] + row[x + 1];
+            const float gain = std::max(0.0f, sum * 0.25f - row[x]);
+            out[base + x] = std::min(row[x] + rate[base + x] * gain, capacity[base + x]);
+        }
+        colonise(base + w - 1, up[w - 1] + down[w - 1] + row[w - 2] + row[w - 1]);
+    }
+
+    _biomass.swap(_next);
+}
+
+void VegetationField::countGrazeableBlocks() {
+    std::fill(_grazeableBlocks.begin(), _grazeableBlocks.end(), 0);
+    for (unsigned y = 0; y < _height; ++y) {
+        const std::size_t rowBlock = static_cast<std::size_t>(y / BLOCK) * _blockCols;
+        const std::size_t base = static_cast<std::size_t>(y) * _width;
+        for (unsigned x = 0; x < _width; ++x) {
+            const std::size_t i = base + x;
+            if (_capacity[i] > 0.0f && _biomass[i] >= GRAZEABLE_FRACTION * _capacity[i]) {
+                ++_grazeableBlocks[rowBlock + x / BLOCK];
+            }
+        }
+    }
+}
+
+float VegetationField::graze(int x, int y, float amount) {
+    if (!inBounds(x, y) || amount <= 0.0f) return 0.0f;
+    float& biomass = _biomass[index(x, y)];
+    const float eaten = std::min(amount, biomass);
+    biomass -= eaten;
+    return eaten;
+}
+
+//==============================================================================
+// Queries
+//==============================================================================
+
+float VegetationField::biomassAt(int x, int y) const {
+    return inBounds(x, y) ? _biomass[index(x, y)] : 0.0f;
+}
+
+float VegetationField::capacityAt(int x, int y) const {
+    return inBounds(x, y) ? _capacity[index(x, y)] : 0.0f;
+}
+
+int VegetationField::speciesAt(int x, int y) const {
+    return inBounds(x, y) ? _cover[index(x, y)] : NONE;
+}
+
+bool VegetationField::isGrazeable(int x, int y) const {
+    if (!inBounds(x, y)) return false;
+    const std::size_t i = index(x, y);
+    return _capacity[i] > 0.0f && _biomass[i] >= GRAZEABLE_FRACTION * _capacity[i];
+}
+
+bool VegetationField::findNearestGrazeable(int x, int y, float radius,
+                                           int& outX, int& outY) const {
+    if (empty() || radius < 0.0f) return false;
+    if (isGrazeable(x, y)) {
+        outX = x;
+        outY = y;
+        return true;
+    }
+
+    const int r = static_cast<int>(std::ceil(radius));
+    const int x0 = std::max(0, x - r);
+    const int y0 = std::max(0, y - r);
+    const int x1 = std::min(static_cast<int>(_width) - 1, x + r);
+    const int y1 = std::min(static_cast<int>(_height) - 1, y + r);
+    if (x0 > x1 || y0 > y1) return false;
+
+    const int block = static_cast<int>(BLOCK);
+    float bestDist2 = radius * radius;
+    bool found = false;
+
+    // Only blocks that had grazeable tiles at the last step are scanned
+    for (int by = y0 / block; by <= y1 / block; ++by) {
+        for (int bx = x0 / block; bx <= x1 / block; ++bx) {
+            const std::size_t b = static_cast<std::size_t>(by) * _blockCols
+                                + static_cast<std::size_t>(bx);
+            if (_grazeableBlocks[b] == 0) continue;
+
+            const int ty1 = std::min(y1, by * block + block - 1);
+            const int tx1 = std::min(x1, bx * block + block - 1);
+            for (int ty = std::max(y0, by * block); ty <= ty1; ++ty) {
+                for (int tx = std::max(x0, bx * block); tx <= tx1; ++tx) {
+                    const float dx = static_cast<float>(tx - x);
+                    const float dy = static_cast<float>(ty - y);
+                    const float d2 = dx * dx + dy * dy;
+                    if (d2 <= bestDist2 && isGrazeable(tx, ty)) {
+                        bestDist2 = d2;
+                        outX = tx;
+                        outY = ty;
+                        found = true;
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+const std::string& VegetationField::speciesName(int species) const {
+    return _species.at(static_cast<std::size_t>(species)).name;
+}
+
+const Plant& VegetationField::prototype(int species) const {
+    return _species.at(static_cast<std::size_t>(species)).prototype;
+}
+
+double VegetationField::totalBiomass() const {
+    double total = 0.0;
+    for (float b : _biomass) total += static_cast<double>(b);
+    return total;
+}
+
+std::size_t VegetationField::memoryUsage() const {
+    std::size_t bytes = Memory::heapBytes(_species)
+                      + Memory::heapBytes(_biomass)
+                      + Memory::heapBytes(_next)
+                      + Memory::heapBytes(_capacity)
+                      + Memory::heapBytes(_invCapacity)
+                      + Memory::heapBytes(_growth)
+                      + Memory::heapBytes(_spread)
+                      + Memory::heapBytes(_lightNeed)
+                      + Memory::heapBytes(_coldMargin)
+                      + Memory::heapBytes(_heatMargin)
+                      + Memory::heapBytes(_cover)
+                      + Memory::heapBytes(_grazeableBlocks);
+    for (const Species& species : _species) {
+        bytes += Memory::heapBytes(species.name)
+               + species.prototype.memoryUsage() - sizeof(Plant);
+    }
+    return bytes;
+}
+
+} // namespace EcoSim
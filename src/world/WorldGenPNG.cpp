@@ -439,14 +439,14 @@ bool WorldGenPNG::exportBiomes(const ClimateWorldGenerator& generator,
     const auto& climateMap = generator.getClimateMap();
     if (climateMap.empty()) return false;
     
-    unsigned int width = static_cast<unsigned int>(climateMap.size());
-    unsigned int height = static_cast<unsigned int>(climateMap[0].size());
+    unsigned int width = climateMap.width();
+    unsigned int height = climateMap.height();
     
     std::vector<uint8_t> data(width * height * 3);
     
     for (unsigned int y = 0; y < height; ++y) {
         for (unsigned int x = 0; x < width; ++x) {
-            const TileClimate& climate = climateMap[x][y];
+            TileClimate climate = climateMap.get(x, y);
             
             // Use blended biome color for smooth transitions
             RGB color = getBlendedBiomeColor(climate.biomeBlend);
@@ -479,14 +479,14 @@ bool WorldGenPNG::exportTerrain(const ClimateWorldGenerator& generator,
     const auto& climateMap = generator.getClimateMap();
     if (climateMap.empty()) return false;
 
-    unsigned int width  = static_cast<unsigned int>(climateMap.size());
-    unsigned int height = static_cast<unsigned int>(climateMap[0].size());
+    unsigned int width  = climateMap.width();
+    unsigned int height = climateMap.height();
 
     std::vector<uint8_t> data(width * height * 3);
 
     for (unsigned int y = 0; y < height; ++y) {
         for (unsigned int x = 0; x < width; ++x) {
-            const TileClimate& climate = climateMap[x][y];
+            TileClimate climate = climateMap.get(x, y);
 
             TerrainType terrain =
                 ClimateWorldGenerator::biomeToTerrainType(climate.biome());
@@ -523,15 +523,15 @@ bool WorldGenPNG::exportComposite(const ClimateWorldGenerator& generator,
     const auto& elevationMap = generator.getElevationMap();
     if (climateMap.empty() || elevationMap.empty()) return false;
     
-    unsigned int width = static_cast<unsigned int>(climateMap.size());
-    unsigned int height = static_cast<unsigned int>(climateMap[0].size());
+    unsigned int width = climateMap.width();
+    unsigned int height = climateMap.height();
     float seaLevel = generator.getConfig().seaLevel;
     
     std::vector<uint8_t> data(width * height * 3);
     
     for (unsigned int y = 0; y < height; ++y) {
         for (unsigned int x = 0; x < width; ++x) {
-            const TileClimate& climate = climateMap[x][y];
+            TileClimate climate = climateMap.get(x, y);
             float elev = elevationMap[x][y];
             
             // Base color from blended biome for smooth transitions
@@ -577,8 +577,9 @@ bool WorldGenPNG::exportComposite(const ClimateWorldGenerator& generator,
                         unsigned int nx = x + dx;
                         unsigned int ny = y + dy;
                         if (nx < width && ny < height) {
-                            if (climateMap[nx][ny].feature == TerrainFeature::RIVER ||
-                                climateMap[nx][ny].feature == TerrainFeature::LAKE) {
+                            TerrainFeature neighbour = climateMap.packed(nx, ny).feature();
+                            if (neighbour == TerrainFeature::RIVER ||
+                                neighbour == TerrainFeature::LAKE) {
                                 nearRiver = true;
                                 break;
                             }
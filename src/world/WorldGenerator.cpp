@@ -8,11 +8,35 @@
 #include "../../include/world/WorldGenerator.hpp"
 #include "../../include/colorPairs.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
 namespace EcoSim {
 
+namespace {
+
+/**
+ * @brief SimplexNoise::noise(freq * nx[i], freq * ny) for a whole row
+ *
+ * The coordinates are narrowed to float exactly as the per-tile calls did,
+ * so the batched results are unchanged.
+ */
+void sampleRow(double freq, const std::vector<double>& nx, double ny, std::vector<float>& out) {
+    thread_local std::vector<float> xs;
+    thread_local std::vector<float> ys;
+    const std::size_t count = nx.size();
+    xs.resize(count);
+    ys.assign(count, static_cast<float>(freq * ny));
+    out.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        xs[i] = static_cast<float>(freq * nx[i]);
+    }
+    SimplexNoise::noiseBatch(xs.data(), ys.data(), count, out.data());
+}
+
+} // anonymous namespace
+
 WorldGenerator::WorldGenerator() {
     initializeDefaultTerrainRules();
 }
@@ -141,16 +165,28 @@ void WorldGenerator::generate(WorldGrid& grid, double seed) {
     const double invSqrtHalf = 1.0 / 0.7071067811865476;  // 1/sqrt(0.5)
     const double invTerraces = 1.0 / _mapGen.terraces;
 
+    // Noise is sampled a row at a time so it can be batched
+    std::vector<double> nx(_mapGen.cols);
+    std::vector<double> rowNoise(_mapGen.cols);
+    std::vector<float> sample;
+
     double ny = _mapGen.seed;
     for (unsigned y = 0; y < _mapGen.rows; y++) {
-        double nx = _mapGen.seed;
+        double rowX = _mapGen.seed;
+        for (unsigned x = 0; x < _mapGen.cols; x++) {
+            nx[x] = rowX;
+            rowX += xinc;
+        }
+        sampleRow(_mapGen.freq, nx, ny, sample);
+        std::copy(sample.begin(), sample.end(), rowNoise.begin());
+        addOctaves(rowNoise, nx, ny);
+
         // Precompute dy for this row (island mode)
         const double dy = y * invRows - 0.5;
         const double dy2 = dy * dy;
         
         for (unsigned x = 0; x < _mapGen.cols; x++) {
-            double noise = SimplexNoise::noise(_mapGen.freq * nx, _mapGen.freq * ny);
-            addOctaves(noise, nx, ny);
+            double noise = rowNoise[x];
 
             if (_mapGen.isIsland) {
                 double dx = x * invCols - 0.5;
@@ -171,34 +207,36 @@ void WorldGenerator::generate(WorldGrid& grid, double seed) {
 
             grid(x, y) = assignTerrain(noise);
             grid(x, y).setElevation(noise);
-
-            nx += xinc;
         }
 
         ny += yinc;
     }
 }
 
-void WorldGenerator::addOctaves(double& noise, double nx, double ny) const {
+void WorldGenerator::addOctaves(std::vector<double>& noise, const std::vector<double>& nx,
+                                double ny) const {
     // The jump in weight each loop
     double weight = _octaveGen.maxWeight;
     double octaveFreq = _mapGen.freq;
     // Starts at one due to weight of base noise map
     double totalWeight = 1;
 
-    double xFreq, yFreq;
+    std::vector<float> sample;
     for (unsigned i = 0; i < _octaveGen.quantity; i++) {
         octaveFreq += _octaveGen.freqInterval;
-        xFreq = octaveFreq * nx;
-        yFreq = octaveFreq * ny;
-        noise += weight * SimplexNoise::noise(xFreq, yFreq);
+        sampleRow(octaveFreq, nx, ny, sample);
+        for (std::size_t x = 0; x < noise.size(); x++) {
+            noise[x] += weight * sample[x];
+        }
 
         totalWeight += weight;
         weight -= _octaveGen.weightInterval();
     }
 
     // Redistribute the noise back within the original range
-    noise = ((noise / totalWeight) + 1) / 2;
+    for (double& n : noise) {
+        n = ((n / totalWeight) + 1) / 2;
+    }
 }
 
 Tile WorldGenerator::assignTerrain(double height) const {
@@ -4,6 +4,9 @@
  */
 
 #include "../../include/world/WorldGrid.hpp"
+#include "../../include/world/ChunkedWorld.hpp"
+#include "../../include/memoryUsage.hpp"
+#include <algorithm>
 #include <sstream>
 
 namespace EcoSim {
@@ -25,7 +28,7 @@ Tile& WorldGrid::at(int x, int y) {
            << ") out of bounds (grid size: " << _width << "x" << _height << ")";
         throw std::out_of_range(ss.str());
     }
-    return _tiles[static_cast<unsigned int>(x)][static_cast<unsigned int>(y)];
+    return (*this)(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
 }
 
 const Tile& WorldGrid::at(int x, int y) const {
@@ -35,7 +38,7 @@ const Tile& WorldGrid::at(int x, int y) const {
            << ") out of bounds (grid size: " << _width << "x" << _height << ")";
         throw std::out_of_range(ss.str());
     }
-    return _tiles[static_cast<unsigned int>(x)][static_cast<unsigned int>(y)];
+    return (*this)(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
 }
 
 void WorldGrid::resize(unsigned int width, unsigned int height) {
@@ -58,4 +61,51 @@ void WorldGrid::resize(unsigned int width, unsigned int height, const Tile& defa
     }
 }
 
+size_t WorldGrid::memoryUsage() const {
+    size_t bytes = sizeof(*this) + Memory::nestedHeapBytes(_tiles);
+    for (const auto& column : _tiles) {
+        for (const Tile& tile : column) {
+            bytes += Memory::heapBytes(tile.getPlants());
+        }
+    }
+    return bytes;
+}
+
+//==============================================================================
+// Chunked Storage
+//==============================================================================
+
+void WorldGrid::attachChunks(ChunkedWorld* chunks) {
+    _chunks = chunks;
+    std::vector<std::vector<Tile>>().swap(_tiles);
+    _width = chunks ? chunks->width() : 0;
+    _height = chunks ? chunks->height() : 0;
+}
+
+std::vector<WorldGrid::Region> WorldGrid::residentRegions() const {
+    if (!_chunks) {
+        return {Region{0, 0, _width, _height}};
+    }
+
+    const unsigned int size = _chunks->chunkSize();
+    std::vector<Region> regions;
+    for (const auto& c : _chunks->residentChunks()) {
+        Region region;
+        region.x = c.first * size;
+        region.y = c.second * size;
+        region.width = std::min(size, _width - region.x);
+        region.height = std::min(size, _height - region.y);
+        regions.push_back(region);
+    }
+    return regions;
+}
+
+Tile& WorldGrid::chunkTile(unsigned int x, unsigned int y) const {
+    return _chunks->tile(x, y);
+}
+
+void WorldGrid::chunkPlantsChanged(unsigned int x, unsigned int y, int delta) {
+    _chunks->plantsChanged(x, y, delta);
+}
+
 } // namespace EcoSim
@@ -0,0 +1,233 @@
+/**
+ * @file WorldOverview.cpp
+ * @brief Implementation of the multi-resolution world overview
+ */
+
+#include "../../include/world/WorldOverview.hpp"
+#include "../../include/world/WorldGrid.hpp"
+#include "../../include/memoryUsage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace EcoSim {
+
+//==============================================================================
+// Levels
+//==============================================================================
+
+unsigned int WorldOverview::levelFitting(unsigned int minCells) const {
+    for (unsigned int level = levelCount(); level-- > 0;) {
+        if (std::max(_levels[level].width, _levels[level].height) >= minCells) {
+            return level;
+        }
+    }
+    return 0;
+}
+
+std::size_t WorldOverview::memoryUsage() const {
+    std::size_t bytes = sizeof(*this) + Memory::heapBytes(_levels);
+    for (const Level& level : _levels) {
+        bytes += Memory::heapBytes(level.cells);
+    }
+    return bytes;
+}
+
+//==============================================================================
+// Terrain
+//==============================================================================
+
+void WorldOverview::rebuildTerrain(const WorldGrid& grid) {
+    _worldWidth = grid.width();
+    _worldHeight = grid.height();
+    _levels.clear();
+    if (_worldWidth == 0 || _worldHeight == 0) {
+        return;
+    }
+
+    unsigned int width = (_worldWidth + BASE_BLOCK - 1) / BASE_BLOCK;
+    unsigned int height = (_worldHeight + BASE_BLOCK - 1) / BASE_BLOCK;
+    while (true) {
+        Level level;
+        level.width = width;
+        level.height = height;
+        level.cells.assign(static_cast<std::size_t>(width) * height, Cell());
+        _levels.push_back(std::move(level));
+        if (width == 1 && height == 1) {
+            break;
+        }
+        width = (width + 1) / 2;
+        height = (height + 1) / 2;
+    }
+
+    for (unsigned int cy = 0; cy < _levels[0].height; ++cy) {
+        for (unsigned int cx = 0; cx < _levels[0].width; ++cx) {
+            summariseBlock(grid, cx, cy);
+        }
+    }
+    for (unsigned int level = 1; level < levelCount(); ++level) {
+        for (unsigned int cy = 0; cy < _levels[level].height; ++cy) {
+            for (unsigned int cx = 0; cx < _levels[level].width; ++cx) {
+                mergeTerrain(level, cx, cy);
+            }
+        }
+    }
+}
+
+void WorldOverview::updateTerrain(const WorldGrid& grid, unsigned int x, unsigned int y) {
+    if (x >= _worldWidth || y >= _worldHeight) {
+        return;
+    }
+    unsigned int cx = x / BASE_BLOCK;
+    unsigned int cy = y / BASE_BLOCK;
+    summariseBlock(grid, cx, cy);
+    for (unsigned int level = 1; level < levelCount(); ++level) {
+        cx /= 2;
+        cy /= 2;
+        mergeTerrain(level, cx, cy);
+    }
+}
+
+void WorldOverview::summariseBlock(const WorldGrid& grid, unsigned int cx, unsigned int cy) {
+    std::array<std::uint32_t, static_cast<std::size_t>(TerrainType::COUNT)> counts{};
+
+    unsigned int x0 = cx * BASE_BLOCK;
+    unsigned int y0 = cy * BASE_BLOCK;
+    unsigned int x1 = std::min(x0 + BASE_BLOCK, _worldWidth);
+    unsigned int y1 = std::min(y0 + BASE_BLOCK, _worldHeight);
+    for (unsigned int y = y0; y < y1; ++y) {
+        for (unsigned int x = x0; x < x1; ++x) {
+            ++counts[static_cast<std::size_t>(grid(x, y).getTerrainType())];
+        }
+    }
+
+    auto dominant = std::max_element(counts.begin(), counts.end());
+    Cell& cell = _levels[0].cells[cy * _levels[0].width + cx];
+    cell.terrain = static_cast<TerrainType>(dominant - counts.begin());
+    cell.terrainTiles = *dominant;
+}
+
+void WorldOverview::mergeTerrain(unsigned int level, unsigned int cx, unsigned int cy) {
+    const Level& below = _levels[level - 1];
+
+    // At most four distinct candidates; the children's dominant terrains
+    // are weighted by how many tiles they cover
+    std::array<TerrainType, 4> types{};
+    std::array<std::uint32_t, 4> tiles{};
+    std::size_t candidates = 0;
+    for (unsigned int y = cy * 2; y < std::min(cy * 2 + 2, below.height); ++y) {
+        for (unsigned int x = cx * 2; x < std::min(cx * 2 + 2, below.width); ++x) {
+            const Cell& child = below.cells[y * below.width + x];
+            std::size_t i = 0;
+            while (i < candidates && types[i] != child.terrain) {
+                ++i;
+            }
+            if (i == candidates) {
+                types[candidates++] = child.terrain;
+            }
+            tiles[i] += child.terrainTiles;
+        }
+    }
+
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < candidates; ++i) {
+        if (tiles[i] > tiles[best]) {
+            best = i;
+        }
+    }
+    Cell& cell = _levels[level].cells[cy * _levels[level].width + cx];
+    cell.terrain = types[best];
+    cell.terrainTiles = tiles[best];
+}
+
+//==============================================================================
+// Population
+//==============================================================================
+
+void WorldOverview::clear(Layer layer) {
+    for (Level& level : _levels) {
+        for (Cell& cell : level.cells) {
+            switch (layer) {
+                case Layer::Plants:
+                    cell.plants = 0;
+                    cell.plantBiomass = 0.0f;
+                    break;
+                case Layer::Creatures:
+                    cell.creatures = 0;
+                    cell.herbivores = 0;
+                    cell.carnivores = 0;
+                    break;
+                case Layer::Corpses:
+                    cell.corpses = 0;
+                    break;
+            }
+        }
+    }
+}
+
+void WorldOverview::addPlant(int x, int y, float biomass) {
+    if (Cell* cell = baseCell(x, y)) {
+        ++cell->plants;
+        cell->plantBiomass += biomass;
+    }
+}
+
+void WorldOverview::addCreature(int x, int y, bool herbivore, bool carnivore) {
+    if (Cell* cell = baseCell(x, y)) {
+        ++cell->creatures;
+        cell->herbivores += herbivore ? 1u : 0u;
+        cell->carnivores += carnivore ? 1u : 0u;
+    }
+}
+
+void WorldOverview::addCorpse(int x, int y) {
+    if (Cell* cell = baseCell(x, y)) {
+        ++cell->corpses;
+    }
+}
+
+void WorldOverview::propagate(Layer layer) {
+    for (unsigned int level = 1; level < levelCount(); ++level) {
+        const Level& below = _levels[level - 1];
+        Level& above = _levels[level];
+        for (unsigned int cy = 0; cy < above.height; ++cy) {
+            for (unsigned int cx = 0; cx < above.width; ++cx) {
+                Cell& cell = above.cells[cy * above.width + cx];
+                for (unsigned int y = cy * 2; y < std::min(cy * 2 + 2, below.height); ++y) {
+                    for (unsigned int x = cx * 2; x < std::min(cx * 2 + 2, below.width); ++x) {
+                        const Cell& child = below.cells[y * below.width + x];
+                        switch (layer) {
+                            case Layer::Plants:
+                                cell.plants += child.plants;
+                                cell.plantBiomass += child.plantBiomass;
+                                break;
+                            case Layer::Creatures:
+                                cell.creatures += child.creatures;
+                                cell.herbivores += child.herbivores;
+                                cell.carnivores += child.carnivores;
+                                break;
+                            case Layer::Corpses:
+                                cell.corpses += child.corpses;
+                                break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+WorldOverview::Cell* WorldOverview::baseCell(int x, int y) {
+    if (_levels.empty() || x < 0 || y < 0 ||
+        static_cast<unsigned int>(x) >= _worldWidth ||
+        static_cast<unsigned int>(y) >= _worldHeight) {
+        return nullptr;
+    }
+    Level& base = _levels[0];
+    return &base.cells[(static_cast<unsigned int>(y) / BASE_BLOCK) * base.width +
+                       static_cast<unsigned int>(x) / BASE_BLOCK];
+}
+
+} // namespace EcoSim
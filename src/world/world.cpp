@@ -6,10 +6,42 @@
 
 #include "../../include/world/world.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 
 using namespace std;
 
+namespace {
+
+/// Revisions are drawn from one counter so a new World never repeats one.
+std::uint64_t nextTerrainRevision() {
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+/// Archetypes counted as herbivores in the overview's archetype mix
+bool isHerbivoreArchetype(const EcoSim::Genetics::ArchetypeIdentity* archetype) {
+    using EcoSim::Genetics::ArchetypeIdentity;
+    return archetype == ArchetypeIdentity::TankHerbivore() ||
+           archetype == ArchetypeIdentity::ArmoredGrazer() ||
+           archetype == ArchetypeIdentity::FleetRunner() ||
+           archetype == ArchetypeIdentity::SpikyDefender() ||
+           archetype == ArchetypeIdentity::CanopyForager();
+}
+
+/// Archetypes counted as carnivores in the overview's archetype mix
+bool isCarnivoreArchetype(const EcoSim::Genetics::ArchetypeIdentity* archetype) {
+    using EcoSim::Genetics::ArchetypeIdentity;
+    return archetype == ArchetypeIdentity::ApexPredator() ||
+           archetype == ArchetypeIdentity::PackHunter() ||
+           archetype == ArchetypeIdentity::AmbushPredator() ||
+           archetype == ArchetypeIdentity::PursuitHunter() ||
+           archetype == ArchetypeIdentity::Scavenger();
+}
+
+} // anonymous namespace
+
 //================================================================================
 // Construction
 //================================================================================
@@ -18,33 +50,44 @@ World::World(const MapGen& mapGen, const OctaveGen& octaveGen)
     : _scentLayer(mapGen.cols, mapGen.rows)
     , _currentTick(0)
     , _corpseManager(std::make_unique<EcoSim::CorpseManager>())
-    , _seasonManager(std::make_unique<EcoSim::SeasonManager>()) {
+    , _seasonManager(std::make_unique<EcoSim::SeasonManager>())
+    , _terrainRevision(nextTerrainRevision()) {
     
     // Create the terrain generator with the provided configuration
     _generator = std::make_unique<EcoSim::WorldGenerator>(mapGen, octaveGen);
     
-    // Initialize grid and generate terrain
+    // Initialize grid. The legacy simplexGen() terrain is not generated
+    // here: the climate generator overwrites every tile of it below.
     set2Dgrid();
-    simplexGen();
     
     // Create and generate climate data
-    EcoSim::ClimateGeneratorConfig climateConfig;
-    climateConfig.width = mapGen.cols;
-    climateConfig.height = mapGen.rows;
-    climateConfig.seed = static_cast<unsigned int>(mapGen.seed);
-    climateConfig.isIsland = mapGen.isIsland;
-    _climateGenerator = std::make_unique<EcoSim::ClimateWorldGenerator>(climateConfig);
-    _climateGenerator->generate(_grid);  // Generates climate data for the grid
+    _climateGenerator = std::make_unique<EcoSim::ClimateWorldGenerator>(climateConfigFor(mapGen));
+    // Generates climate data for the grid, or loads it from ECOSIM_WORLD_CACHE
+    _climateGenerator->generateCached(_grid, EcoSim::ClimateWorldGenerator::defaultCacheDirectory());
+    _climateGenerator->releaseIntermediateMaps();  // Only the climate store is read from here on
+    _overview.rebuildTerrain(_grid);
     
-    // Initialize the environment system (must happen after grid is ready)
-    _environmentSystem = std::make_unique<EcoSim::EnvironmentSystem>(*_seasonManager, _grid);
+    createSubsystems();
+}
+
+World::World(const MapGen& mapGen, const OctaveGen& octaveGen, const EcoSim::ChunkedWorldConfig& chunks)
+    : _scentLayer(static_cast<int>(mapGen.cols), static_cast<int>(mapGen.rows))
+    , _corpseManager(std::make_unique<EcoSim::CorpseManager>())
+    , _seasonManager(std::make_unique<EcoSim::SeasonManager>())
+    , _currentTick(0)
+    , _terrainRevision(nextTerrainRevision()) {
     
-    // Connect climate data to environment system for per-tile queries
-    _environmentSystem->setClimateMap(&_climateGenerator->getClimateMap());
+    _generator = std::make_unique<EcoSim::WorldGenerator>(mapGen, octaveGen);
     
-    // Initialize the plant manager and connect to environment system
-    _plantManager = std::make_unique<EcoSim::PlantManager>(_grid, _scentLayer);
-    _plantManager->setEnvironmentSystem(_environmentSystem.get());
+    // The climate generator only holds the settings; chunks generate
+    // against their own overview of the whole world
+    EcoSim::ChunkedWorldConfig chunkConfig = chunks;
+    chunkConfig.climate = climateConfigFor(mapGen);
+    _climateGenerator = std::make_unique<EcoSim::ClimateWorldGenerator>(chunkConfig.climate);
+    _chunks = std::make_unique<EcoSim::ChunkedWorld>(chunkConfig);
+    _grid.attachChunks(_chunks.get());
+    
+    createSubsystems();
 }
 
 //================================================================================
@@ -99,6 +142,18 @@ const EcoSim::PlantManager& World::plants() const {
     return *_plantManager;
 }
 
+const EcoSim::WorldOverview& World::overview() const {
+    return _overview;
+}
+
+EcoSim::TurnScheduler& World::turnScheduler() {
+    return _turnScheduler;
+}
+
+const EcoSim::TurnScheduler& World::turnScheduler() const {
+    return _turnScheduler;
+}
+
 //================================================================================
 // Spatial Indexing
 //================================================================================
@@ -124,6 +179,107 @@ void World::rebuildCreatureIndex(std::vector<std::unique_ptr<EcoSim::Genetics::O
         initializeCreatureIndex();
     }
     _creatureIndex->rebuild(creatures);
+    
+    _overview.clear(EcoSim::WorldOverview::Layer::Creatures);
+    for (const auto& creature : creatures) {
+        if (!creature || !creature->isAlive()) {
+            continue;
+        }
+        const auto* identity = creature->identity();
+        const EcoSim::Genetics::ArchetypeIdentity* archetype =
+            identity ? identity->archetype : nullptr;
+        _overview.addCreature(creature->getX(), creature->getY(),
+                              isHerbivoreArchetype(archetype),
+                              isCarnivoreArchetype(archetype));
+    }
+    _overview.propagate(EcoSim::WorldOverview::Layer::Creatures);
+}
+
+//================================================================================
+// Chunked Terrain
+//================================================================================
+
+bool World::isChunked() const {
+    return _chunks != nullptr;
+}
+
+EcoSim::ChunkedWorld* World::chunks() {
+    return _chunks.get();
+}
+
+const EcoSim::ChunkedWorld* World::chunks() const {
+    return _chunks.get();
+}
+
+void World::prefetchChunks(int x, int y, unsigned int radius) {
+    if (!_chunks || !_grid.inBounds(x, y)) {
+        return;
+    }
+    
+    const unsigned int cx = static_cast<unsigned int>(x) / _chunks->chunkSize();
+    const unsigned int cy = static_cast<unsigned int>(y) / _chunks->chunkSize();
+    std::vector<std::pair<unsigned int, unsigned int>> wanted;
+    for (unsigned int i = cx - std::min(cx, radius); i <= cx + radius && i < _chunks->chunksX(); ++i) {
+        for (unsigned int j = cy - std::min(cy, radius); j <= cy + radius && j < _chunks->chunksY(); ++j) {
+            wanted.emplace_back(i, j);
+        }
+    }
+    _chunks->prefetch(wanted);
+}
+
+std::size_t World::evictDistantChunks(const std::vector<std::unique_ptr<EcoSim::Genetics::Organism>>& creatures) {
+    if (!_chunks) {
+        return 0;
+    }
+    
+    std::vector<std::pair<int, int>> positions;
+    positions.reserve(creatures.size());
+    for (const auto& creature : creatures) {
+        if (creature && creature->isAlive()) {
+            positions.emplace_back(creature->getX(), creature->getY());
+        }
+    }
+    return _chunks->evictDistantChunks(positions, _chunks->getConfig().evictionRadius);
+}
+
+//================================================================================
+// Memory
+//================================================================================
+
+void World::reportMemory(logging::MemoryReport& report) const {
+    // Members held by value report their own size
+    size_t own = sizeof(*this) - sizeof(_grid) - sizeof(_scentLayer) - sizeof(_overview);
+    if (_generator)         own += sizeof(EcoSim::WorldGenerator);
+    if (_seasonManager)     own += sizeof(EcoSim::SeasonManager);
+    if (_environmentSystem) own += sizeof(EcoSim::EnvironmentSystem);
+    report.add("world", own);
+
+    if (_chunks) {
+        const size_t chunkTiles = static_cast<size_t>(_chunks->chunkSize()) * _chunks->chunkSize();
+        report.add("chunks", _chunks->memoryUsage(), _chunks->residentCount() * chunkTiles);
+    } else {
+        report.add("grid", _grid.memoryUsage(), static_cast<size_t>(_grid.width()) * _grid.height());
+    }
+    if (_climateGenerator) {
+        report.add("climate", _climateGenerator->memoryUsage());
+    }
+    if (_plantManager) {
+        report.add("plants", _plantManager->memoryUsage(), _plantManager->plantCount());
+    }
+    report.add("scents", _scentLayer.memoryUsage(), _scentLayer.getTotalScentCount());
+    if (_creatureIndex) {
+        report.add("creature index", _creatureIndex->memoryUsage(), _creatureIndex->size());
+    }
+    if (_corpseManager) {
+        report.add("corpses", _corpseManager->memoryUsage(), _corpseManager->count());
+    }
+    report.add("overview", _overview.memoryUsage());
+}
+
+size_t World::memoryUsage() const {
+    logging::MemoryReport report;
+    reportMemory(report);
+    return report.total();
 }
 
 //================================================================================
@@ -199,12 +355,18 @@ void World::setOctaveGen(const OctaveGen& og) {
 }
 
 void World::simplexGen() {
+    if (_chunks) {
+        return;
+    }
     _generator->generate(_grid);
+    terrainReplaced();
 }
 
 void World::regenerateClimate() {
-    if (_climateGenerator) {
-        _climateGenerator->generate(_grid);
+    if (_climateGenerator && !_chunks) {
+        _climateGenerator->generateCached(_grid, EcoSim::ClimateWorldGenerator::defaultCacheDirectory());
+        _climateGenerator->releaseIntermediateMaps();
+        terrainReplaced();
         
         // Update environment system with new climate data
         if (_environmentSystem) {
@@ -230,6 +392,14 @@ const EcoSim::ClimateWorldGenerator& World::climateGenerator() const {
     return *_climateGenerator;
 }
 
+//================================================================================
+// Terrain Revisions
+//================================================================================
+
+std::uint64_t World::getTerrainRevision() const {
+    return _terrainRevision;
+}
+
 //================================================================================
 // Simulation Update
 //================================================================================
@@ -259,6 +429,12 @@ void World::addCorpse(float x, float y, float size, const std::string& speciesNa
 
 void World::tickCorpses() {
     _corpseManager->tick();
+    
+    _overview.clear(EcoSim::WorldOverview::Layer::Corpses);
+    for (const auto& corpse : _corpseManager->getAll()) {
+        _overview.addCorpse(corpse->getTileX(), corpse->getTileY());
+    }
+    _overview.propagate(EcoSim::WorldOverview::Layer::Corpses);
 }
 
 const std::vector<std::unique_ptr<world::Corpse>>& World::getCorpses() const {
@@ -297,12 +473,14 @@ string World::toString() const {
 
     // Output plant data for tiles that have plants
     const Tile* tile;
-    for (unsigned x = 0; x < mapGen.cols; x++) {
-        for (unsigned y = 0; y < mapGen.rows; y++) {
-            tile = &_grid.at(x, y);
-            if (!tile->getPlants().empty()) {
-                ss << endl << x << "," << y
-                   << endl << tile->contentToString();
+    for (const EcoSim::WorldGrid::Region& region : _grid.residentRegions()) {
+        for (unsigned x = region.x; x < region.x + region.width; x++) {
+            for (unsigned y = region.y; y < region.y + region.height; y++) {
+                tile = &_grid(x, y);
+                if (!tile->getPlants().empty()) {
+                    ss << endl << x << "," << y
+                       << endl << tile->contentToString();
+                }
             }
         }
     }
@@ -340,3 +518,34 @@ void World::set2Dgrid() {
         _grid.resize(mapGen.cols, mapGen.rows);
     }
 }
+
+EcoSim::ClimateGeneratorConfig World::climateConfigFor(const MapGen& mapGen) {
+    EcoSim::ClimateGeneratorConfig climateConfig;
+    climateConfig.width = mapGen.cols;
+    climateConfig.height = mapGen.rows;
+    climateConfig.seed = static_cast<unsigned int>(mapGen.seed);
+    climateConfig.isIsland = mapGen.isIsland;
+    return climateConfig;
+}
+
+void World::createSubsystems() {
+    // Initialize the environment system (must happen after grid is ready)
+    _environmentSystem = std::make_unique<EcoSim::EnvironmentSystem>(*_seasonManager, _grid);
+    
+    // Connect climate data to environment system for per-tile queries
+    if (_chunks) {
+        _environmentSystem->setChunkedClimate(_chunks.get());
+    } else {
+        _environmentSystem->setClimateMap(&_climateGenerator->getClimateMap());
+    }
+    
+    // Initialize the plant manager and connect to environment system
+    _plantManager = std::make_unique<EcoSim::PlantManager>(_grid, _scentLayer);
+    _plantManager->setEnvironmentSystem(_environmentSystem.get());
+    _plantManager->setOverview(&_overview);
+}
+
+void World::terrainReplaced() {
+    _terrainRevision = nextTerrainRevision();
+    _overview.rebuildTerrain(_grid);
+}